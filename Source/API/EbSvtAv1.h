@@ -55,6 +55,38 @@ EbBool is a 32 bit quantity and is aligned on a 32 bit word boundary.
 #define EB_FALSE  0
 #define EB_TRUE   1
 
+/* Motion of a 64x64 block against one reference picture. */
+typedef struct EbSvtMotionVector
+{
+    // motion vector, in quarter pel
+    int16_t  mv_x;
+    int16_t  mv_y;
+    // display order distance to the reference picture, negative for a past
+    // reference, 0 for an unused entry
+    int32_t  ref_offset;
+} EbSvtMotionVector;
+
+#define EB_MOTION_FIELD_BLOCK_SIZE      64
+#define EB_MOTION_FIELD_MAX_MV_COUNT    8
+
+/* Motion field of a picture on a grid of 64x64 blocks in raster order, block
+ * (x, y) holds the mv_count entries of mvs starting at
+ * (y * block_cols + x) * mv_count.
+ *
+ * Attached to an input picture (encoder enable_motion_hints), it carries the
+ * motion hints of an upstream analysis, which seed or replace the HME of the
+ * encoder. Attached to an output packet (encoder export_motion_field), it
+ * carries the final ME field of the picture and is valid until the packet
+ * is released. */
+typedef struct EbSvtMotionField
+{
+    uint32_t           block_cols;
+    uint32_t           block_rows;
+    // entries per block, up to EB_MOTION_FIELD_MAX_MV_COUNT
+    uint32_t           mv_count;
+    EbSvtMotionVector *mvs;
+} EbSvtMotionField;
+
 typedef struct EbBufferHeaderType
 {
     // EbBufferHeaderType size
@@ -83,6 +115,9 @@ typedef struct EbBufferHeaderType
 
     // pic flags
     uint32_t flags;
+
+    // pic motion field, NULL when there is none
+    EbSvtMotionField *motion_field;
 } EbBufferHeaderType;
 
 typedef struct EbComponentType
@@ -112,13 +112,23 @@ typedef struct EbSvtAv1DecConfiguration
     uint32_t                 asm_type;
     // Application Specific parameters
 
-    /* Number of threads used by decoder.
+    /* Number of threads used by decoder. Tiles of a frame are parsed and
+    * reconstructed in parallel, so more threads than tiles are not used.
     *
-    * 0 = System default.
+    * 0 = Number of logical processors.
     * 1 = Single thread decoding.
     *
-    * Default is 0. */
+    * Default is 1. */
     uint32_t                 threads;
+
+    /* Number of frames decoded in parallel, each by up to threads threads.
+    * A frame starts once the rows of its reference frames it predicts from
+    * are decoded, the output is delayed by up to frame_threads frames.
+    *
+    * 0 or 1 = One frame at a time.
+    *
+    * Default is 1. */
+    uint32_t                 frame_threads;
     // Application Specific parameters
 
     /* ID assigned to each channel when multiple instances are running within the
@@ -199,6 +209,9 @@ typedef struct EbSvtAv1DecConfiguration
      * @ *data                  Buffer with data
      * @ data_size              Data size in bytes
      *
+     * A call with data_size 0 at the end of the stream flushes the decoder,
+     * eb_svt_dec_get_picture() then returns the pictures left.
+     *
      *  Returns EB_ErrorNone if the coded data has been processed successfully. */
     EB_API EbErrorType eb_svt_decode_frame(
         EbComponentType     *svt_dec_component,
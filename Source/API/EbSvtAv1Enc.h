@@ -254,6 +254,31 @@ typedef struct EbSvtAv1EncConfiguration
     * Default is 1. */
     EbBool                   enable_hme_flag;
 
+    /* Flag to search the HME search center with a predictive zonal search
+     * seeded from the motion of the neighbouring SBs instead of the HME
+     * levels.
+     *
+     * -1 = Auto, 0 = OFF, 1 = ON.
+     *
+     * Default is -1. */
+    int32_t                  predictive_hme;
+
+    /* Flag to use the motion field attached to the input pictures as motion
+     * hints. A hint against a reference at the same distance replaces the
+     * HME of the block and narrows its full pel search; otherwise the
+     * nearest hint on the side of the reference, scaled to its distance,
+     * seeds the HME level 1 search. The motion_field of every input buffer
+     * header must then be set, NULL for a picture without hints.
+     *
+     * Default is 0. */
+    EbBool                   enable_motion_hints;
+
+    /* Flag to attach the final ME field of the picture, the 64x64 motion
+     * vector against each of its references, to the output packets.
+     *
+     * Default is 0. */
+    EbBool                   export_motion_field;
+
     /* Flag to enable the use of non-swaure partitions
     *
     * Default is 1. */
@@ -294,6 +319,18 @@ typedef struct EbSvtAv1EncConfiguration
     * Default is -1. */
     int32_t                   olpd_refinement;
 
+    /* Flag to keep the quantized coefficients and the reconstruction of the
+     * mode decision winners and commit them in the encode pass instead of
+     * predicting, transforming and reconstructing each block a second time.
+     * Pictures using 10-bit, segmentation, screen content tools, the encode
+     * pass transform search or the two pass statistics keep the full encode
+     * pass.
+     *
+     * -1 = Auto, 0 = OFF, 1 = ON.
+     *
+     * Default is -1. */
+    int32_t                   md_recon_reuse;
+
     /* Enable the use of Constrained Intra, which yields sending two picture
      * parameter sets in the elementary streams .
      *
@@ -425,6 +462,47 @@ typedef struct EbSvtAv1EncConfiguration
      * Default is -1. */
     int32_t                 target_socket;
 
+    /* Run the picture analysis, motion estimation, encdec, dlf, cdef and
+     * restoration stages as tasks on one work-stealing pool of
+     * LogicalProcessorNumber workers instead of one set of threads per stage.
+     * When active_channel_count > 1, the channels of the process share one
+     * pool, created by the first channel.
+     *
+     * 0 = Thread per stage process.
+     * 1 = Shared task pool.
+     *
+     * Default is 0. */
+    EbBool                  enable_task_scheduler;
+
+    /* Memory budget of the encoder instance in MB. The picture pool depths,
+     * the lookahead distance (CQP only) and the process counts are reduced
+     * until the estimated memory fits in the budget.
+     *
+     * 0 = No limit.
+     *
+     * Default is 0. */
+    uint32_t                max_memory_mb;
+
+    /* Analysis group of the channel. The channels of a process in the same
+     * non zero group code the same source at the same resolution, bit depth
+     * and color format, e.g. the renditions of an ABR ladder. They reuse the
+     * picture analysis statistics and the temporally filtered alt-ref
+     * pictures of the primary channel of the group instead of computing
+     * them. All the channels of the group must be initialized before the
+     * first picture is sent. Not supported with enable_task_scheduler.
+     *
+     * 0 = Own analysis.
+     *
+     * Default is 0. */
+    uint32_t                analysis_group;
+
+    /* Makes the channel the primary of its analysis group, a group has at
+     * most one primary. The other channels of the group wait for the
+     * results of the primary, it must be sent the same pictures as them.
+     *
+     * Default is 0. */
+    EbBool                  analysis_primary;
+
     // Debug tools
 
     /* Output reconstructed yuv used for debug purposes. The value is set through
@@ -480,6 +558,14 @@ typedef struct EbSvtAv1EncConfiguration
     uint8_t                  altref_nframes;
     EbBool                   enable_overlays;
 
+    /* Flag to skip the temporal filtering of windows with a low noise level
+     * and of the neighbours that are too costly to motion compensate.
+     *
+     * -1 = Auto, 0 = OFF, 1 = ON.
+     *
+     * Default is -1. */
+    int32_t                  tf_adaptive_skip;
+
     uint32_t                     sq_weight;
 
     uint64_t                 md_stage_1_class_prune_th;
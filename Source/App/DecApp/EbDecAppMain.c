@@ -124,6 +124,14 @@ void write_frame(EbBufferHeaderType *recon_buffer, CLInput *cli) {
     fflush(cli->outFile);
 }
 
+static void write_output(EbBufferHeaderType *recon_buffer, CLInput *cli,
+                         MD5Context *md5_ctx, int enable_md5) {
+    if (enable_md5)
+        write_md5(recon_buffer, md5_ctx);
+    if (cli->outFile != NULL)
+        write_frame(recon_buffer, cli);
+}
+
 static void show_progress(int in_frame, uint64_t dx_time) {
     printf("\n%d frames decoded in %" PRId64 " us (%.2f fps)\r",
         in_frame, dx_time,
@@ -233,23 +241,43 @@ int32_t main(int32_t argc, char* argv[])
                     return_error |= eb_svt_decode_frame(p_handle, buf,
                         bytes_in_buffer, obu_ctx.is_annexb);
 
+                    /* With frame threads, the picture may wait on frames
+                       still decoding */
+                    EbErrorType out_status = eb_svt_dec_get_picture(p_handle,
+                        recon_buffer, stream_info, frame_info);
+
                     dec_timer_mark(&timer);
                     dx_time += dec_timer_elapsed(&timer);
 
                     in_frame++;
 
-                    if (eb_svt_dec_get_picture(p_handle, recon_buffer, stream_info, frame_info) != EB_DecNoOutputPicture) {
+                    if (out_status != EB_DecNoOutputPicture) {
                         if (fps_frm)
                             show_progress(in_frame , dx_time);
 
-                        if (enable_md5)
-                            write_md5(recon_buffer, &md5_ctx);
-                        if(cli.outFile != NULL)
-                            write_frame(recon_buffer, &cli);
+                        write_output(recon_buffer, &cli, &md5_ctx, enable_md5);
                     }
                 }
                 else break;
             }
+
+            /* End of stream : the pictures of the frames in flight */
+            dec_timer_start(&timer);
+            return_error |= eb_svt_decode_frame(p_handle, NULL, 0,
+                obu_ctx.is_annexb);
+            while (eb_svt_dec_get_picture(p_handle, recon_buffer, stream_info,
+                   frame_info) != EB_DecNoOutputPicture)
+            {
+                dec_timer_mark(&timer);
+                dx_time += dec_timer_elapsed(&timer);
+                if (fps_frm)
+                    show_progress(in_frame, dx_time);
+
+                write_output(recon_buffer, &cli, &md5_ctx, enable_md5);
+                dec_timer_start(&timer);
+            }
+            dec_timer_mark(&timer);
+            dx_time += dec_timer_elapsed(&timer);
             if (fps_summary || fps_frm) {
                 show_progress(in_frame, dx_time);
                 printf("\n");
@@ -28,6 +28,8 @@ static void set_bit_depth(const char *value, EbSvtAv1DecConfiguration *cfg) { cf
 static void set_pic_width(const char *value, EbSvtAv1DecConfiguration *cfg) { cfg->max_picture_width = strtoul(value, NULL, 0); };
 static void set_pic_height(const char *value, EbSvtAv1DecConfiguration *cfg) { cfg->max_picture_height = strtoul(value, NULL, 0); };
 static void set_colour_space(const char *value, EbSvtAv1DecConfiguration *cfg) { cfg->max_color_format = parse_name(value, csp_names); };
+static void set_threads(const char *value, EbSvtAv1DecConfiguration *cfg) { cfg->threads = strtoul(value, NULL, 0); };
+static void set_frame_threads(const char *value, EbSvtAv1DecConfiguration *cfg) { cfg->frame_threads = strtoul(value, NULL, 0); };
 
  /**********************************
   * Config Entry Array
@@ -36,6 +38,8 @@ ConfigEntry config_entry[] = {
     // Decoder settings
     { SKIP_FRAME_TOKEN, "SkipFrame", 1, set_skip_frame },
     { LIMIT_FRAME_TOKEN, "LimitFrame", 1, set_limit_frame },
+    { THREADS_TOKEN, "Threads", 1, set_threads },
+    { FRAME_THREADS_TOKEN, "FrameThreads", 1, set_frame_threads },
     // Picture properties
     { BIT_DEPTH_TOKEN,"InputBitDepth", 1, set_bit_depth },
     { PIC_WIDTH_TOKEN, "PictureWidth", 1, set_pic_width},
@@ -54,6 +58,8 @@ static void showHelp()
     H0( " -o <arg>                  Output file name \n");
     H0( " -skip <arg>               Skip the first n input frames \n");
     H0( " -limit <arg>              Stop decoding after n frames \n");
+    H0( " -threads <arg>            Number of tile threads, 0 for all cores \n");
+    H0( " -frame-threads <arg>      Number of frames decoded in parallel \n");
     H0( " -bit-depth <arg>          Input bitdepth. [8, 10] \n");
     H0( " -w <arg>                  Input picture width \n");
     H0( " -h <arg>                  Input picture height \n");
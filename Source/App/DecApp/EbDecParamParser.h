@@ -42,6 +42,8 @@
 #define FPS_SUMMARY_TOKEN               "-fps-summary"
 #define FILM_GRAIN_TOKEN                "-skip-film-grain"
 #define ANNEX_B_TOKEN                   "-annex-b"
+#define THREADS_TOKEN                   "-threads"
+#define FRAME_THREADS_TOKEN             "-frame-threads"
 #define MAX_NUM_TOKENS 200
 
 #define EB_STRCMP(target,token) \
@@ -35,6 +35,8 @@
 #define OUTPUT_STAT_FILE_TOKEN          "-output-stat-file"
 #endif
 #define STAT_FILE_TOKEN                 "-stat-file"
+#define INPUT_MV_FILE_TOKEN             "-input-mv-file"
+#define OUTPUT_MV_FILE_TOKEN            "-output-mv-file"
 #define WIDTH_TOKEN                     "-w"
 #define HEIGHT_TOKEN                    "-h"
 #define NUMBER_OF_PICTURES_TOKEN        "-n"
@@ -75,6 +77,7 @@
 #define HME_L0_ENABLE_TOKEN             "-hme-l0"
 #define HME_L1_ENABLE_TOKEN             "-hme-l1"
 #define HME_L2_ENABLE_TOKEN             "-hme-l2"
+#define PREDICTIVE_HME_TOKEN            "-predictive-hme"
 #define EXT_BLOCK                       "-ext-block"
 #define IN_LOOP_ME                      "-in-loop-me"
 #define SEARCH_AREA_WIDTH_TOKEN         "-search-w"
@@ -95,10 +98,12 @@
 #define ALTREF_STRENGTH                 "-altref-strength"
 #define ALTREF_NFRAMES                  "-altref-nframes"
 #define ENABLE_OVERLAYS                 "-enable-overlays"
+#define TF_ADAPTIVE_SKIP_TOKEN          "-tf-adaptive-skip"
 // --- end: ALTREF_FILTERING_SUPPORT
 #define HBD_MD_ENABLE_TOKEN             "-hbd-md"
 #define PALETTE_TOKEN                   "-palette"
 #define OLPD_REFINEMENT_TOKEN           "-olpd-refinement"
+#define MD_RECON_REUSE_TOKEN            "-md-recon-reuse"
 #define CONSTRAINED_INTRA_ENABLE_TOKEN  "-constrd-intra"
 #define HDR_INPUT_TOKEN                 "-hdr"
 #define RATE_CONTROL_ENABLE_TOKEN       "-rc"
@@ -120,6 +125,10 @@
 #define ASM_TYPE_TOKEN                  "-asm"
 #define THREAD_MGMNT                    "-lp"
 #define TARGET_SOCKET                   "-ss"
+#define TASK_SCHEDULER_TOKEN            "-task-scheduler"
+#define MAX_MEMORY_TOKEN                "-max-memory"
+#define ANALYSIS_GROUP_TOKEN            "-analysis-group"
+#define ANALYSIS_PRIMARY_TOKEN          "-analysis-primary"
 #define UNRESTRICTED_MOTION_VECTOR      "-umv"
 #define CONFIG_FILE_COMMENT_CHAR    '#'
 #define CONFIG_FILE_NEWLINE_CHAR    '\n'
@@ -216,6 +225,16 @@ static void SetCfgStatFile(const char *value, EbConfig *cfg)
     if (cfg->stat_file) { fclose(cfg->stat_file); }
     FOPEN(cfg->stat_file, value, "wb");
 };
+static void SetCfgInputMvFile(const char *value, EbConfig *cfg)
+{
+    if (cfg->input_mv_file) { fclose(cfg->input_mv_file); }
+    FOPEN(cfg->input_mv_file, value, "rb");
+};
+static void SetCfgOutputMvFile(const char *value, EbConfig *cfg)
+{
+    if (cfg->output_mv_file) { fclose(cfg->output_mv_file); }
+    FOPEN(cfg->output_mv_file, value, "wb");
+};
 static void SetStatReport                       (const char *value, EbConfig *cfg) {cfg->stat_report = (uint8_t) strtoul(value, NULL, 0);};
 static void SetCfgSourceWidth                   (const char *value, EbConfig *cfg) {cfg->source_width = strtoul(value, NULL, 0);};
 static void SetInterlacedVideo                  (const char *value, EbConfig *cfg) {cfg->interlaced_video  = (EbBool) strtoul(value, NULL, 0);};
@@ -273,6 +292,7 @@ static void SetCfgNumberHmeSearchRegionInHeight (const char *value, EbConfig *cf
 static void SetCfgHmeLevel0TotalSearchAreaWidth (const char *value, EbConfig *cfg) {cfg->hme_level0_total_search_area_width = strtoul(value, NULL, 0);};
 static void SetCfgHmeLevel0TotalSearchAreaHeight(const char *value, EbConfig *cfg) {cfg->hme_level0_total_search_area_height = strtoul(value, NULL, 0);};
 static void SetCfgUseDefaultMeHme               (const char *value, EbConfig *cfg) {cfg->use_default_me_hme = (EbBool)strtol(value, NULL, 0); };
+static void SetCfgPredictiveHme                 (const char *value, EbConfig *cfg) {cfg->predictive_hme = (int32_t)strtol(value, NULL, 0); };
 static void SetEnableExtBlockFlag(const char *value, EbConfig *cfg) { cfg->ext_block_flag = (EbBool)strtoul(value, NULL, 0); };
 static void SetEnableInLoopMeFlag(const char *value, EbConfig *cfg) { cfg->in_loop_me_flag = (EbBool)strtoul(value, NULL, 0); };
 static void SetHmeLevel0SearchAreaInWidthArray  (const char *value, EbConfig *cfg) {cfg->hme_level0_search_area_in_width_array[cfg->hme_level0_column_index++] = strtoul(value, NULL, 0);};
@@ -287,10 +307,12 @@ static void SetEnableAltRefs                    (const char *value, EbConfig *cf
 static void SetAltRefStrength                   (const char *value, EbConfig *cfg) {cfg->altref_strength = (uint8_t)strtoul(value, NULL, 0);};
 static void SetAltRefNFrames                    (const char *value, EbConfig *cfg) {cfg->altref_nframes = (uint8_t)strtoul(value, NULL, 0);};
 static void SetEnableOverlays                   (const char *value, EbConfig *cfg) { cfg->enable_overlays = (EbBool)strtoul(value, NULL, 0); };
+static void SetTfAdaptiveSkip                   (const char *value, EbConfig *cfg) { cfg->tf_adaptive_skip = (int32_t)strtol(value, NULL, 0); };
 // --- end: ALTREF_FILTERING_SUPPORT
 static void SetEnableHBDModeDecision            (const char *value, EbConfig *cfg) {cfg->enable_hbd_mode_decision = (uint8_t)strtoul(value, NULL, 0);};
 static void SetEnablePalette                    (const char *value, EbConfig *cfg) { cfg->enable_palette = (int32_t)strtoul(value, NULL, 0); };
 static void SetEnableOlpdRefinement              (const char *value, EbConfig *cfg) { cfg->olpd_refinement = (int32_t)strtoul(value, NULL, 0); };
+static void SetMdReconReuse                      (const char *value, EbConfig *cfg) { cfg->md_recon_reuse = (int32_t)strtol(value, NULL, 0); };
 static void SetEnableConstrainedIntra           (const char *value, EbConfig *cfg) {cfg->constrained_intra                                             = (EbBool)strtoul(value, NULL, 0);};
 static void SetHighDynamicRangeInput            (const char *value, EbConfig *cfg) {cfg->high_dynamic_range_input            = strtol(value,  NULL, 0);};
 static void SetProfile                          (const char *value, EbConfig *cfg) {cfg->profile                          = strtol(value,  NULL, 0);};
@@ -315,6 +337,10 @@ static void SetLatencyMode                      (const char *value, EbConfig *cf
 static void SetAsmType                          (const char *value, EbConfig *cfg)  {cfg->asm_type                   = (uint32_t)strtoul(value, NULL, 0);};
 static void SetLogicalProcessors                (const char *value, EbConfig *cfg)  {cfg->logical_processors         = (uint32_t)strtoul(value, NULL, 0);};
 static void SetTargetSocket                     (const char *value, EbConfig *cfg)  {cfg->target_socket              = (int32_t)strtol(value, NULL, 0);};
+static void SetTaskScheduler                    (const char *value, EbConfig *cfg)  {cfg->enable_task_scheduler      = (EbBool)strtoul(value, NULL, 0);};
+static void SetMaxMemory                        (const char *value, EbConfig *cfg)  {cfg->max_memory_mb              = strtoul(value, NULL, 0);};
+static void SetAnalysisGroup                    (const char *value, EbConfig *cfg)  {cfg->analysis_group             = strtoul(value, NULL, 0);};
+static void SetAnalysisPrimary                  (const char *value, EbConfig *cfg)  {cfg->analysis_primary           = (EbBool)strtoul(value, NULL, 0);};
 static void SetUnrestrictedMotionVector         (const char *value, EbConfig *cfg)  {cfg->unrestricted_motion_vector = (EbBool)strtol(value, NULL, 0);};
 
 static void SetSquareWeight                     (const char *value, EbConfig *cfg)  {cfg->sq_weight                  = (uint64_t)strtoul(value, NULL, 0);
@@ -369,6 +395,8 @@ config_entry_t config_entry[] = {
     { SINGLE_INPUT, OUTPUT_RECON_TOKEN, "ReconFile", SetCfgReconFile },
     { SINGLE_INPUT, QP_FILE_TOKEN, "QpFile", SetCfgQpFile },
     { SINGLE_INPUT, STAT_FILE_TOKEN, "StatFile", SetCfgStatFile },
+    { SINGLE_INPUT, INPUT_MV_FILE_TOKEN, "InputMvFile", SetCfgInputMvFile },
+    { SINGLE_INPUT, OUTPUT_MV_FILE_TOKEN, "OutputMvFile", SetCfgOutputMvFile },
 #if TWO_PASS
     { SINGLE_INPUT, INPUT_STAT_FILE_TOKEN, "input_stat_file", set_input_stat_file },
     { SINGLE_INPUT, OUTPUT_STAT_FILE_TOKEN, "output_stat_file", set_output_stat_file },
@@ -430,6 +458,7 @@ config_entry_t config_entry[] = {
     { SINGLE_INPUT, HME_L0_ENABLE_TOKEN, "HMELevel0", SetEnableHmeLevel0Flag },
     { SINGLE_INPUT, HME_L1_ENABLE_TOKEN, "HMELevel1", SetEnableHmeLevel1Flag },
     { SINGLE_INPUT, HME_L2_ENABLE_TOKEN, "HMELevel2", SetEnableHmeLevel2Flag },
+    { SINGLE_INPUT, PREDICTIVE_HME_TOKEN, "PredictiveHme", SetCfgPredictiveHme },
     { SINGLE_INPUT, EXT_BLOCK, "ExtBlockFlag", SetEnableExtBlockFlag },
     { SINGLE_INPUT, IN_LOOP_ME, "InLoopMeFlag", SetEnableInLoopMeFlag },
     // ME Parameters
@@ -445,10 +474,15 @@ config_entry_t config_entry[] = {
     { SINGLE_INPUT, HBD_MD_ENABLE_TOKEN, "HighBitDepthModeDecision", SetEnableHBDModeDecision },
     { SINGLE_INPUT, PALETTE_TOKEN, "PaletteMode", SetEnablePalette },
     { SINGLE_INPUT, OLPD_REFINEMENT_TOKEN, "OlpdRefinement", SetEnableOlpdRefinement },
+    { SINGLE_INPUT, MD_RECON_REUSE_TOKEN, "MdReconReuse", SetMdReconReuse },
     { SINGLE_INPUT, CONSTRAINED_INTRA_ENABLE_TOKEN, "ConstrainedIntra", SetEnableConstrainedIntra},
     // Thread Management
     { SINGLE_INPUT, THREAD_MGMNT, "logicalProcessors", SetLogicalProcessors },
     { SINGLE_INPUT, TARGET_SOCKET, "TargetSocket", SetTargetSocket },
+    { SINGLE_INPUT, TASK_SCHEDULER_TOKEN, "TaskScheduler", SetTaskScheduler },
+    { SINGLE_INPUT, MAX_MEMORY_TOKEN, "MaxMemoryMB", SetMaxMemory },
+    { SINGLE_INPUT, ANALYSIS_GROUP_TOKEN, "AnalysisGroup", SetAnalysisGroup },
+    { SINGLE_INPUT, ANALYSIS_PRIMARY_TOKEN, "AnalysisPrimary", SetAnalysisPrimary },
     // Optional Features
     { SINGLE_INPUT, UNRESTRICTED_MOTION_VECTOR, "UnrestrictedMotionVector", SetUnrestrictedMotionVector },
 
@@ -478,6 +512,7 @@ config_entry_t config_entry[] = {
     { SINGLE_INPUT, ALTREF_STRENGTH, "AltRefStrength", SetAltRefStrength },
     { SINGLE_INPUT, ALTREF_NFRAMES, "AltRefNframes", SetAltRefNFrames },
     { SINGLE_INPUT, ENABLE_OVERLAYS, "EnableOverlays", SetEnableOverlays },
+    { SINGLE_INPUT, TF_ADAPTIVE_SKIP_TOKEN, "TfAdaptiveSkip", SetTfAdaptiveSkip },
     // --- end: ALTREF_FILTERING_SUPPORT
 
     { SINGLE_INPUT, SQ_WEIGHT_TOKEN, "SquareWeight", SetSquareWeight },
@@ -527,6 +562,7 @@ void eb_config_ctor(EbConfig *config_ptr)
     config_ptr->use_default_me_hme                   = EB_TRUE;
     config_ptr->enable_hme_flag                        = EB_TRUE;
     config_ptr->enable_hme_level0_flag                  = EB_TRUE;
+    config_ptr->predictive_hme                         = -1;
     config_ptr->search_area_width                      = 16;
     config_ptr->search_area_height                     = 7;
     config_ptr->number_hme_search_region_in_width         = 2;
@@ -549,12 +585,17 @@ void eb_config_ctor(EbConfig *config_ptr)
     config_ptr->enable_hbd_mode_decision             = 1;
     config_ptr->enable_palette                       = -1;
     config_ptr->olpd_refinement                      = -1;
+    config_ptr->md_recon_reuse                       = -1;
     config_ptr->injector_frame_rate                    = 60 << 16;
 
     // ASM Type
     config_ptr->asm_type                              = 1;
 
     config_ptr->target_socket                         = -1;
+    config_ptr->enable_task_scheduler                 = EB_FALSE;
+    config_ptr->max_memory_mb                         = 0;
+    config_ptr->analysis_group                        = 0;
+    config_ptr->analysis_primary                      = EB_FALSE;
 
     config_ptr->unrestricted_motion_vector           = EB_TRUE;
 
@@ -562,6 +603,7 @@ void eb_config_ctor(EbConfig *config_ptr)
     config_ptr->enable_altrefs                       = EB_TRUE;
     config_ptr->altref_strength                      = 5;
     config_ptr->altref_nframes                       = 7;
+    config_ptr->tf_adaptive_skip                     = -1;
     // --- end: ALTREF_FILTERING_SUPPORT
 
     config_ptr->sq_weight                            = 100;
@@ -615,6 +657,18 @@ void eb_config_dtor(EbConfig *config_ptr)
         fclose(config_ptr->stat_file);
         config_ptr->stat_file = (FILE *) NULL;
     }
+
+    if (config_ptr->input_mv_file) {
+        fclose(config_ptr->input_mv_file);
+        config_ptr->input_mv_file = (FILE *)NULL;
+    }
+    free(config_ptr->input_mv_index);
+    config_ptr->input_mv_index = (MvFileIndexEntry *)NULL;
+
+    if (config_ptr->output_mv_file) {
+        fclose(config_ptr->output_mv_file);
+        config_ptr->output_mv_file = (FILE *)NULL;
+    }
 #if TWO_PASS
     if (config_ptr->input_stat_file) {
         fclose(config_ptr->input_stat_file);
@@ -159,6 +159,14 @@ typedef struct EbPerformanceContext {
 
 }EbPerformanceContext;
 
+/* Position of the motion field record of a picture in the input motion
+ * vector file */
+typedef struct MvFileIndexEntry
+{
+    int64_t                 pts;
+    int64_t                 offset;
+} MvFileIndexEntry;
+
 typedef struct EbConfig
 {
     /****************************************
@@ -174,6 +182,12 @@ typedef struct EbConfig
     FILE                    *buffer_file;
 
     FILE                    *qp_file;
+    FILE                    *input_mv_file;
+    FILE                    *output_mv_file;
+    // Records of input_mv_file sorted by pts, built on the first picture
+    MvFileIndexEntry        *input_mv_index;
+    uint32_t                 input_mv_index_count;
+    EbBool                   input_mv_indexed;
 #if TWO_PASS
     FILE                    *input_stat_file;
     FILE                    *output_stat_file;
@@ -274,6 +288,7 @@ typedef struct EbConfig
     EbBool                  enable_hme_level0_flag;
     EbBool                  enable_hme_level1_flag;
     EbBool                  enable_hme_level2_flag;
+    int32_t                 predictive_hme;
     EbBool                  ext_block_flag;
     EbBool                  in_loop_me_flag;
 
@@ -312,6 +327,7 @@ typedef struct EbConfig
     int32_t                  tile_columns;
     int32_t                  tile_rows;
     int32_t                  olpd_refinement;   // Open Loop Partitioning Decision Refinement
+    int32_t                  md_recon_reuse;    // Commit the MD reconstruction in the encode pass
 
     /****************************************
      * Rate Control
@@ -362,6 +378,10 @@ typedef struct EbConfig
     uint32_t                active_channel_count;
     uint32_t                logical_processors;
     int32_t                 target_socket;
+    EbBool                  enable_task_scheduler;
+    uint32_t                max_memory_mb;
+    uint32_t                analysis_group;
+    EbBool                  analysis_primary;
     EbBool                  stop_encoder;         // to signal CTRL+C Event, need to stop encoding.
 
     uint64_t                processed_frame_count;
@@ -378,6 +398,7 @@ typedef struct EbConfig
     uint8_t                 altref_strength;
     uint8_t                 altref_nframes;
     EbBool                  enable_overlays;
+    int32_t                 tf_adaptive_skip;
     // --- end: ALTREF_FILTERING_SUPPORT
 
     // square cost weighting for deciding if a/b shapes could be skipped
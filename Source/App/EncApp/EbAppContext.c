@@ -199,6 +199,9 @@ EbErrorType CopyConfigurationParameters(
     callback_data->eb_enc_parameters.enable_hme_level0_flag = (EbBool)config->enable_hme_level0_flag;
     callback_data->eb_enc_parameters.enable_hme_level1_flag = (EbBool)config->enable_hme_level1_flag;
     callback_data->eb_enc_parameters.enable_hme_level2_flag = (EbBool)config->enable_hme_level2_flag;
+    callback_data->eb_enc_parameters.predictive_hme = config->predictive_hme;
+    callback_data->eb_enc_parameters.enable_motion_hints = config->input_mv_file ? EB_TRUE : EB_FALSE;
+    callback_data->eb_enc_parameters.export_motion_field = config->output_mv_file ? EB_TRUE : EB_FALSE;
     callback_data->eb_enc_parameters.search_area_width = config->search_area_width;
     callback_data->eb_enc_parameters.search_area_height = config->search_area_height;
     callback_data->eb_enc_parameters.number_hme_search_region_in_width = config->number_hme_search_region_in_width;
@@ -209,6 +212,7 @@ EbErrorType CopyConfigurationParameters(
     callback_data->eb_enc_parameters.enable_hbd_mode_decision = (EbBool)config->enable_hbd_mode_decision;
     callback_data->eb_enc_parameters.enable_palette = config->enable_palette;
     callback_data->eb_enc_parameters.olpd_refinement = config->olpd_refinement;
+    callback_data->eb_enc_parameters.md_recon_reuse = config->md_recon_reuse;
     callback_data->eb_enc_parameters.constrained_intra = (EbBool)config->constrained_intra;
     callback_data->eb_enc_parameters.channel_id = config->channel_id;
     callback_data->eb_enc_parameters.active_channel_count = config->active_channel_count;
@@ -225,6 +229,10 @@ EbErrorType CopyConfigurationParameters(
     callback_data->eb_enc_parameters.asm_type = config->asm_type;
     callback_data->eb_enc_parameters.logical_processors = config->logical_processors;
     callback_data->eb_enc_parameters.target_socket = config->target_socket;
+    callback_data->eb_enc_parameters.enable_task_scheduler = config->enable_task_scheduler;
+    callback_data->eb_enc_parameters.max_memory_mb = config->max_memory_mb;
+    callback_data->eb_enc_parameters.analysis_group = config->analysis_group;
+    callback_data->eb_enc_parameters.analysis_primary = config->analysis_primary;
     callback_data->eb_enc_parameters.unrestricted_motion_vector = config->unrestricted_motion_vector;
     callback_data->eb_enc_parameters.recon_enabled = config->recon_file ? EB_TRUE : EB_FALSE;
     // --- start: ALTREF_FILTERING_SUPPORT
@@ -232,6 +240,7 @@ EbErrorType CopyConfigurationParameters(
     callback_data->eb_enc_parameters.altref_strength = config->altref_strength;
     callback_data->eb_enc_parameters.altref_nframes  = config->altref_nframes;
     callback_data->eb_enc_parameters.enable_overlays = (EbBool)config->enable_overlays;
+    callback_data->eb_enc_parameters.tf_adaptive_skip = config->tf_adaptive_skip;
     // --- end: ALTREF_FILTERING_SUPPORT
 
     for (hmeRegionIndex = 0; hmeRegionIndex < callback_data->eb_enc_parameters.number_hme_search_region_in_width; ++hmeRegionIndex) {
@@ -352,6 +361,23 @@ EbErrorType AllocateInputBuffers(EbConfig *config, EbAppContext *callback_data)
     // Assign the variables
     callback_data->input_buffer_pool->p_app_private = NULL;
     callback_data->input_buffer_pool->pic_type = EB_AV1_INVALID_PICTURE;
+    callback_data->input_buffer_pool->motion_field = NULL;
+
+    // Motion hints read from the input motion vector file
+    if (config->input_mv_file) {
+        const uint32_t block_count =
+            ((config->source_width + EB_MOTION_FIELD_BLOCK_SIZE - 1) / EB_MOTION_FIELD_BLOCK_SIZE) *
+            ((config->source_height + EB_MOTION_FIELD_BLOCK_SIZE - 1) / EB_MOTION_FIELD_BLOCK_SIZE);
+        EB_APP_MALLOC(EbSvtMotionField*, callback_data->input_motion_field,
+                      sizeof(EbSvtMotionField), EB_N_PTR,
+                      EB_ErrorInsufficientResources);
+        EB_APP_MALLOC(EbSvtMotionVector*, callback_data->input_motion_field->mvs,
+                      block_count * EB_MOTION_FIELD_MAX_MV_COUNT * sizeof(EbSvtMotionVector), EB_N_PTR,
+                      EB_ErrorInsufficientResources);
+        callback_data->input_motion_field->block_cols = 0;
+        callback_data->input_motion_field->block_rows = 0;
+        callback_data->input_motion_field->mv_count = 0;
+    }
 
     return EB_ErrorNone;
 }
@@ -27,6 +27,9 @@ typedef struct EbAppContext {
     EbBufferHeaderType                *stream_buffer_pool;
     EbBufferHeaderType                *recon_buffer;
 
+    // Motion hints of the input picture
+    EbSvtMotionField                  *input_motion_field;
+
     // Instance Index
     uint8_t                            instance_idx;
 } EbAppContext;
@@ -937,6 +937,95 @@ void SendQpOnTheFly(
     return;
 }
 
+/***************************************
+ * Motion vector files hold a record per picture: its pts (int64_t),
+ * block_cols, block_rows and mv_count (uint32_t) of its motion field,
+ * followed by the block_cols * block_rows * mv_count EbSvtMotionVector.
+ * The records are written in output (decode) order, only for the
+ * pictures with motion vectors.
+ ***************************************/
+static int compare_mv_file_index_entry(const void *a, const void *b)
+{
+    const int64_t pts_a = ((const MvFileIndexEntry*)a)->pts;
+    const int64_t pts_b = ((const MvFileIndexEntry*)b)->pts;
+    return (pts_a > pts_b) - (pts_a < pts_b);
+}
+
+static void index_input_mv_file(EbConfig *config)
+{
+    uint32_t capacity = 0;
+    config->input_mv_indexed = EB_TRUE;
+    rewind(config->input_mv_file);
+    for (;;) {
+        const int64_t offset = ftello(config->input_mv_file);
+        int64_t pts;
+        uint32_t dims[3];
+        if (fread(&pts, sizeof(pts), 1, config->input_mv_file) != 1 ||
+            fread(dims, sizeof(dims[0]), 3, config->input_mv_file) != 3)
+            break;
+        if (config->input_mv_index_count == capacity) {
+            MvFileIndexEntry *index;
+            capacity = capacity ? capacity * 2 : 256;
+            index = (MvFileIndexEntry*)realloc(config->input_mv_index, capacity * sizeof(MvFileIndexEntry));
+            if (index == NULL)
+                break;
+            config->input_mv_index = index;
+        }
+        config->input_mv_index[config->input_mv_index_count].pts = pts;
+        config->input_mv_index[config->input_mv_index_count++].offset = offset;
+        if (fseeko(config->input_mv_file, (int64_t)dims[0] * dims[1] * dims[2] * sizeof(EbSvtMotionVector), SEEK_CUR))
+            break;
+    }
+    if (config->input_mv_index_count)
+        qsort(config->input_mv_index, config->input_mv_index_count, sizeof(MvFileIndexEntry), compare_mv_file_index_entry);
+}
+
+/***************************************
+ * Reads the motion hints of the picture,
+ * EB_FALSE when the file has none on the
+ * 64x64 grid of the source
+ ***************************************/
+static EbBool read_input_motion_field(
+    EbConfig         *config,
+    int64_t           pts,
+    EbSvtMotionField *motion_field)
+{
+    MvFileIndexEntry key;
+    const MvFileIndexEntry *entry;
+    int64_t record_pts;
+    uint32_t dims[3];
+    const uint32_t block_cols = (config->source_width + EB_MOTION_FIELD_BLOCK_SIZE - 1) / EB_MOTION_FIELD_BLOCK_SIZE;
+    const uint32_t block_rows = (config->source_height + EB_MOTION_FIELD_BLOCK_SIZE - 1) / EB_MOTION_FIELD_BLOCK_SIZE;
+
+    if (!config->input_mv_indexed)
+        index_input_mv_file(config);
+    key.pts = pts;
+    entry = (const MvFileIndexEntry*)bsearch(&key, config->input_mv_index, config->input_mv_index_count,
+        sizeof(MvFileIndexEntry), compare_mv_file_index_entry);
+    if (entry == NULL || fseeko(config->input_mv_file, entry->offset, SEEK_SET))
+        return EB_FALSE;
+    if (fread(&record_pts, sizeof(record_pts), 1, config->input_mv_file) != 1 ||
+        fread(dims, sizeof(dims[0]), 3, config->input_mv_file) != 3 ||
+        dims[0] != block_cols || dims[1] != block_rows || dims[2] == 0 || dims[2] > EB_MOTION_FIELD_MAX_MV_COUNT)
+        return EB_FALSE;
+    motion_field->block_cols = dims[0];
+    motion_field->block_rows = dims[1];
+    motion_field->mv_count = dims[2];
+    return fread(motion_field->mvs, sizeof(EbSvtMotionVector), (size_t)dims[0] * dims[1] * dims[2], config->input_mv_file) ==
+        (size_t)dims[0] * dims[1] * dims[2] ? EB_TRUE : EB_FALSE;
+}
+
+static void write_output_motion_field(
+    FILE                     *mv_file,
+    const EbBufferHeaderType *header_ptr)
+{
+    const EbSvtMotionField *motion_field = header_ptr->motion_field;
+    const uint32_t dims[3] = { motion_field->block_cols, motion_field->block_rows, motion_field->mv_count };
+    fwrite(&header_ptr->pts, sizeof(header_ptr->pts), 1, mv_file);
+    fwrite(dims, sizeof(dims[0]), 3, mv_file);
+    fwrite(motion_field->mvs, sizeof(EbSvtMotionVector), (size_t)dims[0] * dims[1] * dims[2], mv_file);
+}
+
 //************************************/
 // ProcessInputBuffer
 // Reads yuv frames from file and copy
@@ -995,6 +1084,11 @@ AppExitConditionType ProcessInputBuffer(
 
             headerPtr->flags = 0;
 
+            // Motion hints of the picture
+            if (config->input_mv_file)
+                headerPtr->motion_field = read_input_motion_field(config, headerPtr->pts, appCallBack->input_motion_field) ?
+                    appCallBack->input_motion_field : NULL;
+
             // Send the picture
             eb_svt_enc_send_picture(componentHandle, headerPtr);
         }
@@ -1007,6 +1101,7 @@ AppExitConditionType ProcessInputBuffer(
             headerPtr->flags       = EB_BUFFERFLAG_EOS;
             headerPtr->p_buffer      = NULL;
             headerPtr->pic_type    = EB_AV1_INVALID_PICTURE;
+            headerPtr->motion_field = NULL;
 
             eb_svt_enc_send_picture(componentHandle, headerPtr);
         }
@@ -1294,6 +1389,9 @@ AppExitConditionType ProcessOutputStreamBuffer(
             }
             config->performance_context.byte_count += headerPtr->n_filled_len;
 
+            if (config->output_mv_file && headerPtr->motion_field && headerPtr->motion_field->mv_count)
+                write_output_motion_field(config->output_mv_file, headerPtr);
+
             if (config->stat_report && !(headerPtr->flags & EB_BUFFERFLAG_IS_ALT_REF))
                 process_output_statistics_buffer(headerPtr, config);
 
@@ -0,0 +1,822 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include <assert.h>
+#include <immintrin.h>
+
+#include "EbDefinitions.h"
+#include "EbTemporalFiltering_constants.h"
+#include "aom_dsp_rtcd.h"
+
+// Neighbor constants of the left, middle, right and single column groups
+static const int16_t *const *const LUMA_NEIGHBORS[4] = {
+    LUMA_LEFT_COLUMN_NEIGHBORS, LUMA_MIDDLE_COLUMN_NEIGHBORS,
+    LUMA_RIGHT_COLUMN_NEIGHBORS, NULL };
+static const int16_t *const *const CHROMA_NO_SS_NEIGHBORS[4] = {
+    CHROMA_NO_SS_LEFT_COLUMN_NEIGHBORS, CHROMA_NO_SS_MIDDLE_COLUMN_NEIGHBORS,
+    CHROMA_NO_SS_RIGHT_COLUMN_NEIGHBORS, NULL };
+static const int16_t *const *const CHROMA_SINGLE_SS_NEIGHBORS[4] = {
+    CHROMA_SINGLE_SS_LEFT_COLUMN_NEIGHBORS,
+    CHROMA_SINGLE_SS_MIDDLE_COLUMN_NEIGHBORS,
+    CHROMA_SINGLE_SS_RIGHT_COLUMN_NEIGHBORS,
+    CHROMA_SINGLE_SS_SINGLE_COLUMN_NEIGHBORS };
+static const int16_t *const *const CHROMA_DOUBLE_SS_NEIGHBORS[4] = {
+    CHROMA_DOUBLE_SS_LEFT_COLUMN_NEIGHBORS,
+    CHROMA_DOUBLE_SS_MIDDLE_COLUMN_NEIGHBORS,
+    CHROMA_DOUBLE_SS_RIGHT_COLUMN_NEIGHBORS,
+    CHROMA_DOUBLE_SS_SINGLE_COLUMN_NEIGHBORS };
+
+static const uint32_t *const *const HIGHBD_LUMA_NEIGHBORS[3] = {
+    HIGHBD_LUMA_LEFT_COLUMN_NEIGHBORS, HIGHBD_LUMA_MIDDLE_COLUMN_NEIGHBORS,
+    HIGHBD_LUMA_RIGHT_COLUMN_NEIGHBORS };
+static const uint32_t *const *const HIGHBD_CHROMA_NO_SS_NEIGHBORS[3] = {
+    HIGHBD_CHROMA_NO_SS_LEFT_COLUMN_NEIGHBORS,
+    HIGHBD_CHROMA_NO_SS_MIDDLE_COLUMN_NEIGHBORS,
+    HIGHBD_CHROMA_NO_SS_RIGHT_COLUMN_NEIGHBORS };
+static const uint32_t *const *const HIGHBD_CHROMA_SINGLE_SS_NEIGHBORS[3] = {
+    HIGHBD_CHROMA_SINGLE_SS_LEFT_COLUMN_NEIGHBORS,
+    HIGHBD_CHROMA_SINGLE_SS_MIDDLE_COLUMN_NEIGHBORS,
+    HIGHBD_CHROMA_SINGLE_SS_RIGHT_COLUMN_NEIGHBORS };
+static const uint32_t *const *const HIGHBD_CHROMA_DOUBLE_SS_NEIGHBORS[3] = {
+    HIGHBD_CHROMA_DOUBLE_SS_LEFT_COLUMN_NEIGHBORS,
+    HIGHBD_CHROMA_DOUBLE_SS_MIDDLE_COLUMN_NEIGHBORS,
+    HIGHBD_CHROMA_DOUBLE_SS_RIGHT_COLUMN_NEIGHBORS };
+
+// Pick the neighbor constants of the group of columns [col, col + size) in a
+// row of width columns
+static INLINE const int16_t *const *get_neighbors(
+        const int16_t *const *const *neighbors, unsigned int col,
+        unsigned int size, unsigned int width) {
+    const int first = col == 0;
+    const int last = col + size == width;
+
+    if (first && last)
+        return neighbors[3];
+    if (first)
+        return neighbors[0];
+    return last ? neighbors[2] : neighbors[1];
+}
+
+static INLINE const uint32_t *const *highbd_get_neighbors(
+        const uint32_t *const *const *neighbors, unsigned int col,
+        unsigned int width) {
+    if (col == 0)
+        return neighbors[0];
+    return col + 4 == width ? neighbors[2] : neighbors[1];
+}
+
+// Filter weights of the columns [col, col + size) in the top and bottom halves
+// of the block
+static INLINE void get_weights(const int *blk_fw, int use_whole_blk,
+                               unsigned int col, unsigned int size,
+                               unsigned int width, int16_t *top,
+                               int16_t *bottom) {
+    const int16_t top_left = (int16_t)blk_fw[0];
+    const int16_t top_right = (int16_t)(use_whole_blk ? blk_fw[0] : blk_fw[1]);
+    const int16_t bottom_left = (int16_t)(use_whole_blk ? blk_fw[0] : blk_fw[2]);
+    const int16_t bottom_right = (int16_t)(use_whole_blk ? blk_fw[0] : blk_fw[3]);
+
+    for (unsigned int i = 0; i < size; i++) {
+        const int right = col + i >= (width >> 1);
+        top[i] = right ? top_right : top_left;
+        bottom[i] = right ? bottom_right : bottom_left;
+    }
+}
+
+static INLINE void highbd_get_weights(const int *blk_fw, int use_whole_blk,
+                                      unsigned int col, unsigned int width,
+                                      int32_t *top, int32_t *bottom) {
+    const int32_t top_left = blk_fw[0];
+    const int32_t top_right = use_whole_blk ? blk_fw[0] : blk_fw[1];
+    const int32_t bottom_left = use_whole_blk ? blk_fw[0] : blk_fw[2];
+    const int32_t bottom_right = use_whole_blk ? blk_fw[0] : blk_fw[3];
+
+    for (unsigned int i = 0; i < 8; i++) {
+        const int right = col + i >= (width >> 1);
+        top[i] = right ? top_right : top_left;
+        bottom[i] = right ? bottom_right : bottom_left;
+    }
+}
+
+static INLINE __m256i load_u16_8x2(const uint16_t *lo, const uint16_t *hi) {
+    return _mm256_inserti128_si256(
+            _mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)lo)),
+            _mm_loadu_si128((const __m128i *)hi), 1);
+}
+
+// Compute (a-b)**2 for 16 pixels and store as unsigned 16-bit integers
+static INLINE void store_dist_16(const uint8_t *a, const uint8_t *b,
+                                 uint16_t *dst) {
+    const __m256i a_reg =
+            _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)a));
+    const __m256i b_reg =
+            _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)b));
+    const __m256i diff = _mm256_sub_epi16(a_reg, b_reg);
+
+    _mm256_storeu_si256((__m256i *)dst, _mm256_mullo_epi16(diff, diff));
+}
+
+// Compute (a-b)**2 for 8 pixels of both chroma planes
+static INLINE void store_dist_8x2(const uint8_t *u_a, const uint8_t *u_b,
+                                  const uint8_t *v_a, const uint8_t *v_b,
+                                  uint16_t *u_dst, uint16_t *v_dst) {
+    const __m256i a_reg = _mm256_cvtepu8_epi16(
+            _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)u_a),
+                               _mm_loadl_epi64((const __m128i *)v_a)));
+    const __m256i b_reg = _mm256_cvtepu8_epi16(
+            _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)u_b),
+                               _mm_loadl_epi64((const __m128i *)v_b)));
+    const __m256i diff = _mm256_sub_epi16(a_reg, b_reg);
+    const __m256i dist = _mm256_mullo_epi16(diff, diff);
+
+    _mm_storeu_si128((__m128i *)u_dst, _mm256_castsi256_si128(dist));
+    _mm_storeu_si128((__m128i *)v_dst, _mm256_extracti128_si256(dist, 1));
+}
+
+// Sum up three neighboring distortions for 16 pixels
+static INLINE __m256i get_sum_16(const uint16_t *dist) {
+    const __m256i left = _mm256_loadu_si256((const __m256i *)(dist - 1));
+    const __m256i center = _mm256_loadu_si256((const __m256i *)dist);
+    const __m256i right = _mm256_loadu_si256((const __m256i *)(dist + 1));
+
+    return _mm256_adds_epu16(_mm256_adds_epu16(left, center), right);
+}
+
+static INLINE __m256i get_sum_8x2(const uint16_t *u_dist,
+                                  const uint16_t *v_dist) {
+    const __m256i left = load_u16_8x2(u_dist - 1, v_dist - 1);
+    const __m256i center = load_u16_8x2(u_dist, v_dist);
+    const __m256i right = load_u16_8x2(u_dist + 1, v_dist + 1);
+
+    return _mm256_adds_epu16(_mm256_adds_epu16(left, center), right);
+}
+
+// Read the chroma distortions co-located with 16 luma pixels
+static INLINE __m256i read_chroma_dist_16(const uint16_t *dist, int ss_x) {
+    if (ss_x) {
+        const __m256i dist_u32 =
+                _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)dist));
+        return _mm256_or_si256(dist_u32, _mm256_slli_epi32(dist_u32, 16));
+    }
+    return _mm256_loadu_si256((const __m256i *)dist);
+}
+
+// Add up the luma distortions co-located with 8 chroma pixels and duplicate
+// them for both chroma planes
+static INLINE __m256i get_luma_dist_8x2(const uint16_t *y_dist, int ss_x,
+                                        int ss_y) {
+    __m128i sum;
+
+    if (ss_x) {
+        __m256i row = _mm256_loadu_si256((const __m256i *)y_dist);
+        if (ss_y)
+            row = _mm256_adds_epu16(
+                    row,
+                    _mm256_loadu_si256((const __m256i *)(y_dist + DIST_STRIDE)));
+        // Add the horizontal pairs in 32-bit and saturate back to 16-bit
+        const __m256i pairs = _mm256_add_epi32(
+                _mm256_and_si256(row, _mm256_set1_epi32(0xffff)),
+                _mm256_srli_epi32(row, 16));
+        sum = _mm_packus_epi32(_mm256_castsi256_si128(pairs),
+                               _mm256_extracti128_si256(pairs, 1));
+    } else {
+        sum = _mm_loadu_si128((const __m128i *)y_dist);
+        if (ss_y)
+            sum = _mm_adds_epu16(
+                    sum, _mm_loadu_si128((const __m128i *)(y_dist + DIST_STRIDE)));
+    }
+    return _mm256_broadcastsi128_si256(sum);
+}
+
+// Average the value based on the number of values summed, add in the rounding
+// factor and shift, clamp to 16, invert and multiply by the weight
+static INLINE __m256i average_16(const __m256i sum, const __m256i mul_constants,
+                                 const __m128i strength,
+                                 const __m256i rounding, const __m256i weight) {
+    const __m256i sixteen = _mm256_set1_epi16(16);
+    __m256i output = _mm256_mulhi_epu16(sum, mul_constants);
+
+    output = _mm256_adds_epu16(output, rounding);
+    output = _mm256_srl_epi16(output, strength);
+    output = _mm256_min_epu16(output, sixteen);
+    output = _mm256_sub_epi16(sixteen, output);
+    return _mm256_mullo_epi16(output, weight);
+}
+
+// Add 'mod' to 'count'. Multiply by 'pred' and add to 'accumulator'
+static INLINE void accumulate_and_store_16(const __m256i mod,
+                                           const uint8_t *pred,
+                                           uint16_t *count,
+                                           uint32_t *accumulator) {
+    const __m256i pred_u16 =
+            _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)pred));
+    const __m256i count_u16 = _mm256_adds_epu16(
+            _mm256_loadu_si256((const __m256i *)count), mod);
+    const __m256i mul = _mm256_mullo_epi16(mod, pred_u16);
+    const __m256i accum_0 = _mm256_add_epi32(
+            _mm256_loadu_si256((const __m256i *)accumulator),
+            _mm256_cvtepu16_epi32(_mm256_castsi256_si128(mul)));
+    const __m256i accum_1 = _mm256_add_epi32(
+            _mm256_loadu_si256((const __m256i *)(accumulator + 8)),
+            _mm256_cvtepu16_epi32(_mm256_extracti128_si256(mul, 1)));
+
+    _mm256_storeu_si256((__m256i *)count, count_u16);
+    _mm256_storeu_si256((__m256i *)accumulator, accum_0);
+    _mm256_storeu_si256((__m256i *)(accumulator + 8), accum_1);
+}
+
+static INLINE void accumulate_and_store_8x2(const __m256i mod,
+                                            const uint8_t *u_pred,
+                                            const uint8_t *v_pred,
+                                            uint16_t *u_count, uint16_t *v_count,
+                                            uint32_t *u_accum,
+                                            uint32_t *v_accum) {
+    const __m256i pred_u16 = _mm256_cvtepu8_epi16(
+            _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)u_pred),
+                               _mm_loadl_epi64((const __m128i *)v_pred)));
+    const __m256i count_u16 =
+            _mm256_adds_epu16(load_u16_8x2(u_count, v_count), mod);
+    const __m256i mul = _mm256_mullo_epi16(mod, pred_u16);
+    const __m256i u_accum_u32 = _mm256_add_epi32(
+            _mm256_loadu_si256((const __m256i *)u_accum),
+            _mm256_cvtepu16_epi32(_mm256_castsi256_si128(mul)));
+    const __m256i v_accum_u32 = _mm256_add_epi32(
+            _mm256_loadu_si256((const __m256i *)v_accum),
+            _mm256_cvtepu16_epi32(_mm256_extracti128_si256(mul, 1)));
+
+    _mm_storeu_si128((__m128i *)u_count, _mm256_castsi256_si128(count_u16));
+    _mm_storeu_si128((__m128i *)v_count, _mm256_extracti128_si256(count_u16, 1));
+    _mm256_storeu_si256((__m256i *)u_accum, u_accum_u32);
+    _mm256_storeu_si256((__m256i *)v_accum, v_accum_u32);
+}
+
+// Apply temporal filter to a column of 16 luma pixels
+static void apply_temporal_filter_luma_16(
+        const uint8_t *y_pre, int y_pre_stride, unsigned int block_width,
+        unsigned int block_height, int ss_x, int ss_y, int strength,
+        const int *blk_fw, int use_whole_blk, uint32_t *y_accum,
+        uint16_t *y_count, const uint16_t *y_dist, const uint16_t *u_dist,
+        const uint16_t *v_dist, unsigned int col) {
+    const __m128i shift = _mm_cvtsi32_si128(strength);
+    const __m256i rounding = _mm256_set1_epi16((1 << strength) >> 1);
+    const int16_t *const *neighbors_0 =
+            get_neighbors(LUMA_NEIGHBORS, col, 8, block_width);
+    const int16_t *const *neighbors_1 =
+            get_neighbors(LUMA_NEIGHBORS, col + 8, 8, block_width);
+    DECLARE_ALIGNED(32, int16_t, weights[2][16]);
+    __m256i mul_constants[2], weight[2];
+    __m256i sum_prev = _mm256_setzero_si256(), sum_cur, sum_next;
+    unsigned int h;
+
+    get_weights(blk_fw, use_whole_blk, col, 16, block_width, weights[0],
+                weights[1]);
+    for (int i = 0; i < 2; i++) {
+        mul_constants[i] = load_u16_8x2((const uint16_t *)neighbors_0[i],
+                                        (const uint16_t *)neighbors_1[i]);
+        weight[i] = _mm256_load_si256((const __m256i *)weights[i]);
+    }
+
+    y_pre += col;
+    y_accum += col;
+    y_count += col;
+    y_dist += col;
+    u_dist += col >> ss_x;
+    v_dist += col >> ss_x;
+
+    sum_cur = get_sum_16(y_dist);
+    for (h = 0; h < block_height; h++) {
+        const int edge = h == 0 || h == block_height - 1;
+        const uint16_t *u_row = u_dist + (h >> ss_y) * DIST_STRIDE;
+        const uint16_t *v_row = v_dist + (h >> ss_y) * DIST_STRIDE;
+        __m256i sum;
+
+        sum_next = h + 1 < block_height
+                ? get_sum_16(y_dist + (h + 1) * DIST_STRIDE)
+                : _mm256_setzero_si256();
+        sum = _mm256_adds_epu16(_mm256_adds_epu16(sum_prev, sum_cur), sum_next);
+        sum = _mm256_adds_epu16(sum, read_chroma_dist_16(u_row, ss_x));
+        sum = _mm256_adds_epu16(sum, read_chroma_dist_16(v_row, ss_x));
+
+        accumulate_and_store_16(
+                average_16(sum, mul_constants[!edge], shift, rounding,
+                           weight[h >= block_height / 2]),
+                y_pre + h * y_pre_stride, y_count + h * y_pre_stride,
+                y_accum + h * y_pre_stride);
+
+        sum_prev = sum_cur;
+        sum_cur = sum_next;
+    }
+}
+
+// Apply temporal filter to a column of 8 pixels of both chroma planes
+static void apply_temporal_filter_chroma_8(
+        const uint8_t *u_pre, const uint8_t *v_pre, int uv_pre_stride,
+        unsigned int uv_width, unsigned int uv_height, int ss_x, int ss_y,
+        int strength, const int *blk_fw, int use_whole_blk, uint32_t *u_accum,
+        uint16_t *u_count, uint32_t *v_accum, uint16_t *v_count,
+        const uint16_t *y_dist, const uint16_t *u_dist, const uint16_t *v_dist,
+        const int16_t *const *const *neighbors, unsigned int col) {
+    const __m128i shift = _mm_cvtsi32_si128(strength);
+    const __m256i rounding = _mm256_set1_epi16((1 << strength) >> 1);
+    const int16_t *const *col_neighbors =
+            get_neighbors(neighbors, col, 8, uv_width);
+    DECLARE_ALIGNED(16, int16_t, weights[2][8]);
+    __m256i mul_constants[2], weight[2];
+    __m256i sum_prev = _mm256_setzero_si256(), sum_cur, sum_next;
+    unsigned int h;
+
+    get_weights(blk_fw, use_whole_blk, col, 8, uv_width, weights[0],
+                weights[1]);
+    for (int i = 0; i < 2; i++) {
+        mul_constants[i] = _mm256_broadcastsi128_si256(
+                _mm_loadu_si128((const __m128i *)col_neighbors[i]));
+        weight[i] = _mm256_broadcastsi128_si256(
+                _mm_load_si128((const __m128i *)weights[i]));
+    }
+
+    u_pre += col;
+    v_pre += col;
+    u_accum += col;
+    v_accum += col;
+    u_count += col;
+    v_count += col;
+    u_dist += col;
+    v_dist += col;
+    y_dist += col << ss_x;
+
+    sum_cur = get_sum_8x2(u_dist, v_dist);
+    for (h = 0; h < uv_height; h++) {
+        const int edge = h == 0 || h == uv_height - 1;
+        const int offset = h * uv_pre_stride;
+        __m256i sum;
+
+        sum_next = h + 1 < uv_height
+                ? get_sum_8x2(u_dist + (h + 1) * DIST_STRIDE,
+                              v_dist + (h + 1) * DIST_STRIDE)
+                : _mm256_setzero_si256();
+        sum = _mm256_adds_epu16(_mm256_adds_epu16(sum_prev, sum_cur), sum_next);
+        sum = _mm256_adds_epu16(
+                sum,
+                get_luma_dist_8x2(y_dist + (h << ss_y) * DIST_STRIDE, ss_x, ss_y));
+
+        accumulate_and_store_8x2(
+                average_16(sum, mul_constants[!edge], shift, rounding,
+                           weight[h >= uv_height / 2]),
+                u_pre + offset, v_pre + offset, u_count + offset,
+                v_count + offset, u_accum + offset, v_accum + offset);
+
+        sum_prev = sum_cur;
+        sum_cur = sum_next;
+    }
+}
+
+void svt_av1_apply_temporal_filter_avx2(
+        const uint8_t *y_src, int y_src_stride, const uint8_t *y_pre,
+        int y_pre_stride, const uint8_t *u_src, const uint8_t *v_src,
+        int uv_src_stride, const uint8_t *u_pre, const uint8_t *v_pre,
+        int uv_pre_stride, unsigned int block_width, unsigned int block_height,
+        int ss_x, int ss_y, int strength, const int *blk_fw, int use_whole_blk,
+        uint32_t *y_accum, uint16_t *y_count, uint32_t *u_accum, uint16_t *u_count,
+        uint32_t *v_accum, uint16_t *v_count) {
+    const unsigned int uv_height = block_height >> ss_y,
+            uv_width = block_width >> ss_x;
+    const int16_t *const *const *chroma_neighbors = ss_x && ss_y
+            ? CHROMA_DOUBLE_SS_NEIGHBORS
+            : ss_x || ss_y ? CHROMA_SINGLE_SS_NEIGHBORS : CHROMA_NO_SS_NEIGHBORS;
+    DECLARE_ALIGNED(32, uint16_t, y_dist[BH * DIST_STRIDE]);
+    DECLARE_ALIGNED(32, uint16_t, u_dist[BH * DIST_STRIDE]);
+    DECLARE_ALIGNED(32, uint16_t, v_dist[BH * DIST_STRIDE]);
+    unsigned int row, col;
+
+    assert(block_width <= BW && "block width too large");
+    assert(block_height <= BH && "block height too large");
+    assert(block_width % 16 == 0 && "block width must be multiple of 16");
+    assert(block_height % 2 == 0 && "block height must be even");
+    assert((ss_x == 0 || ss_x == 1) && (ss_y == 0 || ss_y == 1) &&
+           "invalid chroma subsampling");
+    assert(strength >= 0 && strength <= 6 && "invalid temporal filter strength");
+    assert(blk_fw[0] >= 0 && blk_fw[0] <= 2 && "invalid filter weight");
+
+    // Precompute the difference squared, the padding columns on both sides
+    // account for the missing neighbors
+    for (row = 0; row < block_height; row++) {
+        uint16_t *dist = y_dist + row * DIST_STRIDE;
+        dist[0] = dist[block_width + 1] = 0;
+        for (col = 0; col < block_width; col += 16)
+            store_dist_16(y_src + row * y_src_stride + col,
+                          y_pre + row * y_pre_stride + col, dist + 1 + col);
+    }
+    for (row = 0; row < uv_height; row++) {
+        uint16_t *u = u_dist + row * DIST_STRIDE;
+        uint16_t *v = v_dist + row * DIST_STRIDE;
+        u[0] = u[uv_width + 1] = v[0] = v[uv_width + 1] = 0;
+        for (col = 0; col < uv_width; col += 8)
+            store_dist_8x2(u_src + row * uv_src_stride + col,
+                           u_pre + row * uv_pre_stride + col,
+                           v_src + row * uv_src_stride + col,
+                           v_pre + row * uv_pre_stride + col, u + 1 + col,
+                           v + 1 + col);
+    }
+
+    for (col = 0; col < block_width; col += 16)
+        apply_temporal_filter_luma_16(
+                y_pre, y_pre_stride, block_width, block_height, ss_x, ss_y,
+                strength, blk_fw, use_whole_blk, y_accum, y_count, y_dist + 1,
+                u_dist + 1, v_dist + 1, col);
+
+    for (col = 0; col < uv_width; col += 8)
+        apply_temporal_filter_chroma_8(
+                u_pre, v_pre, uv_pre_stride, uv_width, uv_height, ss_x, ss_y,
+                strength, blk_fw, use_whole_blk, u_accum, u_count, v_accum,
+                v_count, y_dist + 1, u_dist + 1, v_dist + 1, chroma_neighbors,
+                col);
+}
+
+// Compute (a-b)**2 for 8 high bit depth pixels
+static INLINE void highbd_store_dist_8(const uint16_t *a, const uint16_t *b,
+                                       uint32_t *dst) {
+    const __m256i a_reg =
+            _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)a));
+    const __m256i b_reg =
+            _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)b));
+    const __m256i diff = _mm256_sub_epi32(a_reg, b_reg);
+
+    _mm256_storeu_si256((__m256i *)dst, _mm256_mullo_epi32(diff, diff));
+}
+
+// Sum up three neighboring distortions for 8 high bit depth pixels
+static INLINE __m256i highbd_get_sum_8(const uint32_t *dist) {
+    const __m256i left = _mm256_loadu_si256((const __m256i *)(dist - 1));
+    const __m256i center = _mm256_loadu_si256((const __m256i *)dist);
+    const __m256i right = _mm256_loadu_si256((const __m256i *)(dist + 1));
+
+    return _mm256_add_epi32(_mm256_add_epi32(left, center), right);
+}
+
+static INLINE __m256i highbd_read_chroma_dist_8(const uint32_t *dist,
+                                                int ss_x) {
+    if (ss_x) {
+        const __m256i dist_u64 =
+                _mm256_cvtepu32_epi64(_mm_loadu_si128((const __m128i *)dist));
+        return _mm256_or_si256(dist_u64, _mm256_slli_epi64(dist_u64, 32));
+    }
+    return _mm256_loadu_si256((const __m256i *)dist);
+}
+
+static INLINE __m256i highbd_get_luma_dist_8(const uint32_t *y_dist, int ss_x,
+                                             int ss_y) {
+    __m256i first = _mm256_loadu_si256((const __m256i *)y_dist);
+
+    if (ss_y)
+        first = _mm256_add_epi32(
+                first, _mm256_loadu_si256((const __m256i *)(y_dist + DIST_STRIDE)));
+    if (ss_x) {
+        __m256i second = _mm256_loadu_si256((const __m256i *)(y_dist + 8));
+        if (ss_y)
+            second = _mm256_add_epi32(
+                    second,
+                    _mm256_loadu_si256(
+                            (const __m256i *)(y_dist + DIST_STRIDE + 8)));
+        // hadd interleaves the 128-bit lanes of both operands
+        first = _mm256_permute4x64_epi64(_mm256_hadd_epi32(first, second), 0xd8);
+    }
+    return first;
+}
+
+static INLINE __m256i highbd_average_8(const __m256i sum,
+                                       const __m256i mul_constants,
+                                       const __m128i strength,
+                                       const __m256i rounding,
+                                       const __m256i weight) {
+    const __m256i sixteen = _mm256_set1_epi32(16);
+    // modifier * 3 / index, the odd elements are multiplied separately
+    const __m256i mul_even =
+            _mm256_srli_epi64(_mm256_mul_epu32(sum, mul_constants), 32);
+    const __m256i mul_odd =
+            _mm256_mul_epu32(_mm256_srli_epi64(sum, 32),
+                             _mm256_srli_epi64(mul_constants, 32));
+    __m256i output = _mm256_blend_epi32(mul_even, mul_odd, 0xaa);
+
+    output = _mm256_add_epi32(output, rounding);
+    output = _mm256_srl_epi32(output, strength);
+    output = _mm256_min_epu32(output, sixteen);
+    output = _mm256_sub_epi32(sixteen, output);
+    return _mm256_mullo_epi32(output, weight);
+}
+
+static INLINE void highbd_accumulate_and_store_8(const __m256i mod,
+                                                 const uint16_t *pred,
+                                                 uint16_t *count,
+                                                 uint32_t *accumulator) {
+    const __m128i mod_u16 = _mm_packus_epi32(_mm256_castsi256_si128(mod),
+                                             _mm256_extracti128_si256(mod, 1));
+    const __m256i pred_u32 =
+            _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)pred));
+
+    _mm_storeu_si128(
+            (__m128i *)count,
+            _mm_adds_epu16(_mm_loadu_si128((const __m128i *)count), mod_u16));
+    _mm256_storeu_si256(
+            (__m256i *)accumulator,
+            _mm256_add_epi32(_mm256_loadu_si256((const __m256i *)accumulator),
+                             _mm256_mullo_epi32(mod, pred_u32)));
+}
+
+static INLINE __m256i highbd_load_neighbors_8(const uint32_t *lo,
+                                              const uint32_t *hi) {
+    return _mm256_inserti128_si256(
+            _mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)lo)),
+            _mm_loadu_si128((const __m128i *)hi), 1);
+}
+
+// Apply temporal filter to a column of 8 high bit depth luma pixels
+static void highbd_apply_temporal_filter_luma_8(
+        const uint16_t *y_pre, int y_pre_stride, unsigned int block_width,
+        unsigned int block_height, int ss_x, int ss_y, int strength,
+        const int *blk_fw, int use_whole_blk, uint32_t *y_accum,
+        uint16_t *y_count, const uint32_t *y_dist, const uint32_t *u_dist,
+        const uint32_t *v_dist, unsigned int col) {
+    const __m128i shift = _mm_cvtsi32_si128(strength);
+    const __m256i rounding = _mm256_set1_epi32((1 << strength) >> 1);
+    const uint32_t *const *neighbors_0 =
+            highbd_get_neighbors(HIGHBD_LUMA_NEIGHBORS, col, block_width);
+    const uint32_t *const *neighbors_1 =
+            highbd_get_neighbors(HIGHBD_LUMA_NEIGHBORS, col + 4, block_width);
+    DECLARE_ALIGNED(32, int32_t, weights[2][8]);
+    __m256i mul_constants[2], weight[2];
+    __m256i sum_prev = _mm256_setzero_si256(), sum_cur, sum_next;
+    unsigned int h;
+
+    highbd_get_weights(blk_fw, use_whole_blk, col, block_width, weights[0],
+                       weights[1]);
+    for (int i = 0; i < 2; i++) {
+        mul_constants[i] = highbd_load_neighbors_8(neighbors_0[i], neighbors_1[i]);
+        weight[i] = _mm256_load_si256((const __m256i *)weights[i]);
+    }
+
+    y_pre += col;
+    y_accum += col;
+    y_count += col;
+    y_dist += col;
+    u_dist += col >> ss_x;
+    v_dist += col >> ss_x;
+
+    sum_cur = highbd_get_sum_8(y_dist);
+    for (h = 0; h < block_height; h++) {
+        const int edge = h == 0 || h == block_height - 1;
+        const uint32_t *u_row = u_dist + (h >> ss_y) * DIST_STRIDE;
+        const uint32_t *v_row = v_dist + (h >> ss_y) * DIST_STRIDE;
+        __m256i sum;
+
+        sum_next = h + 1 < block_height
+                ? highbd_get_sum_8(y_dist + (h + 1) * DIST_STRIDE)
+                : _mm256_setzero_si256();
+        sum = _mm256_add_epi32(_mm256_add_epi32(sum_prev, sum_cur), sum_next);
+        sum = _mm256_add_epi32(sum, highbd_read_chroma_dist_8(u_row, ss_x));
+        sum = _mm256_add_epi32(sum, highbd_read_chroma_dist_8(v_row, ss_x));
+
+        highbd_accumulate_and_store_8(
+                highbd_average_8(sum, mul_constants[!edge], shift, rounding,
+                                 weight[h >= block_height / 2]),
+                y_pre + h * y_pre_stride, y_count + h * y_pre_stride,
+                y_accum + h * y_pre_stride);
+
+        sum_prev = sum_cur;
+        sum_cur = sum_next;
+    }
+}
+
+// Apply temporal filter to a column of 8 high bit depth chroma pixels of
+// both planes
+static void highbd_apply_temporal_filter_chroma_8(
+        const uint16_t *u_pre, const uint16_t *v_pre, int uv_pre_stride,
+        unsigned int uv_width, unsigned int uv_height, int ss_x, int ss_y,
+        int strength, const int *blk_fw, int use_whole_blk, uint32_t *u_accum,
+        uint16_t *u_count, uint32_t *v_accum, uint16_t *v_count,
+        const uint32_t *y_dist, const uint32_t *u_dist, const uint32_t *v_dist,
+        const uint32_t *const *const *neighbors, unsigned int col) {
+    const __m128i shift = _mm_cvtsi32_si128(strength);
+    const __m256i rounding = _mm256_set1_epi32((1 << strength) >> 1);
+    const uint32_t *const *neighbors_0 =
+            highbd_get_neighbors(neighbors, col, uv_width);
+    const uint32_t *const *neighbors_1 =
+            highbd_get_neighbors(neighbors, col + 4, uv_width);
+    DECLARE_ALIGNED(32, int32_t, weights[2][8]);
+    __m256i mul_constants[2], weight[2];
+    __m256i u_sum_prev = _mm256_setzero_si256(), u_sum_cur, u_sum_next;
+    __m256i v_sum_prev = _mm256_setzero_si256(), v_sum_cur, v_sum_next;
+    unsigned int h;
+
+    highbd_get_weights(blk_fw, use_whole_blk, col, uv_width, weights[0],
+                       weights[1]);
+    for (int i = 0; i < 2; i++) {
+        mul_constants[i] = highbd_load_neighbors_8(neighbors_0[i], neighbors_1[i]);
+        weight[i] = _mm256_load_si256((const __m256i *)weights[i]);
+    }
+
+    u_pre += col;
+    v_pre += col;
+    u_accum += col;
+    v_accum += col;
+    u_count += col;
+    v_count += col;
+    u_dist += col;
+    v_dist += col;
+    y_dist += col << ss_x;
+
+    u_sum_cur = highbd_get_sum_8(u_dist);
+    v_sum_cur = highbd_get_sum_8(v_dist);
+    for (h = 0; h < uv_height; h++) {
+        const int edge = h == 0 || h == uv_height - 1;
+        const int offset = h * uv_pre_stride;
+        const __m256i y_sum =
+                highbd_get_luma_dist_8(y_dist + (h << ss_y) * DIST_STRIDE, ss_x, ss_y);
+        __m256i u_sum, v_sum;
+
+        if (h + 1 < uv_height) {
+            u_sum_next = highbd_get_sum_8(u_dist + (h + 1) * DIST_STRIDE);
+            v_sum_next = highbd_get_sum_8(v_dist + (h + 1) * DIST_STRIDE);
+        } else
+            u_sum_next = v_sum_next = _mm256_setzero_si256();
+        u_sum = _mm256_add_epi32(_mm256_add_epi32(u_sum_prev, u_sum_cur), u_sum_next);
+        v_sum = _mm256_add_epi32(_mm256_add_epi32(v_sum_prev, v_sum_cur), v_sum_next);
+        u_sum = _mm256_add_epi32(u_sum, y_sum);
+        v_sum = _mm256_add_epi32(v_sum, y_sum);
+
+        highbd_accumulate_and_store_8(
+                highbd_average_8(u_sum, mul_constants[!edge], shift, rounding,
+                                 weight[h >= uv_height / 2]),
+                u_pre + offset, u_count + offset, u_accum + offset);
+        highbd_accumulate_and_store_8(
+                highbd_average_8(v_sum, mul_constants[!edge], shift, rounding,
+                                 weight[h >= uv_height / 2]),
+                v_pre + offset, v_count + offset, v_accum + offset);
+
+        u_sum_prev = u_sum_cur;
+        u_sum_cur = u_sum_next;
+        v_sum_prev = v_sum_cur;
+        v_sum_cur = v_sum_next;
+    }
+}
+
+void svt_av1_highbd_apply_temporal_filter_avx2(
+        const uint16_t *y_src, int y_src_stride, const uint16_t *y_pre,
+        int y_pre_stride, const uint16_t *u_src, const uint16_t *v_src,
+        int uv_src_stride, const uint16_t *u_pre, const uint16_t *v_pre,
+        int uv_pre_stride, unsigned int block_width, unsigned int block_height,
+        int ss_x, int ss_y, int strength, const int *blk_fw, int use_whole_blk,
+        uint32_t *y_accum, uint16_t *y_count, uint32_t *u_accum, uint16_t *u_count,
+        uint32_t *v_accum, uint16_t *v_count) {
+    const unsigned int uv_height = block_height >> ss_y,
+            uv_width = block_width >> ss_x;
+    const uint32_t *const *const *chroma_neighbors = ss_x && ss_y
+            ? HIGHBD_CHROMA_DOUBLE_SS_NEIGHBORS
+            : ss_x || ss_y ? HIGHBD_CHROMA_SINGLE_SS_NEIGHBORS
+                           : HIGHBD_CHROMA_NO_SS_NEIGHBORS;
+    DECLARE_ALIGNED(32, uint32_t, y_dist[BH * DIST_STRIDE]);
+    DECLARE_ALIGNED(32, uint32_t, u_dist[BH * DIST_STRIDE]);
+    DECLARE_ALIGNED(32, uint32_t, v_dist[BH * DIST_STRIDE]);
+    unsigned int row, col;
+
+    assert(block_width <= BW && "block width too large");
+    assert(block_height <= BH && "block height too large");
+    assert(block_width % 16 == 0 && "block width must be multiple of 16");
+    assert(block_height % 2 == 0 && "block height must be even");
+    assert((ss_x == 0 || ss_x == 1) && (ss_y == 0 || ss_y == 1) &&
+           "invalid chroma subsampling");
+    assert(blk_fw[0] >= 0 && blk_fw[0] <= 2 && "invalid filter weight");
+
+    for (row = 0; row < block_height; row++) {
+        uint32_t *dist = y_dist + row * DIST_STRIDE;
+        dist[0] = dist[block_width + 1] = 0;
+        for (col = 0; col < block_width; col += 8)
+            highbd_store_dist_8(y_src + row * y_src_stride + col,
+                                y_pre + row * y_pre_stride + col, dist + 1 + col);
+    }
+    for (row = 0; row < uv_height; row++) {
+        uint32_t *u = u_dist + row * DIST_STRIDE;
+        uint32_t *v = v_dist + row * DIST_STRIDE;
+        u[0] = u[uv_width + 1] = v[0] = v[uv_width + 1] = 0;
+        for (col = 0; col < uv_width; col += 8) {
+            highbd_store_dist_8(u_src + row * uv_src_stride + col,
+                                u_pre + row * uv_pre_stride + col, u + 1 + col);
+            highbd_store_dist_8(v_src + row * uv_src_stride + col,
+                                v_pre + row * uv_pre_stride + col, v + 1 + col);
+        }
+    }
+
+    for (col = 0; col < block_width; col += 8)
+        highbd_apply_temporal_filter_luma_8(
+                y_pre, y_pre_stride, block_width, block_height, ss_x, ss_y,
+                strength, blk_fw, use_whole_blk, y_accum, y_count, y_dist + 1,
+                u_dist + 1, v_dist + 1, col);
+
+    for (col = 0; col < uv_width; col += 8)
+        highbd_apply_temporal_filter_chroma_8(
+                u_pre, v_pre, uv_pre_stride, uv_width, uv_height, ss_x, ss_y,
+                strength, blk_fw, use_whole_blk, u_accum, u_count, v_accum,
+                v_count, y_dist + 1, u_dist + 1, v_dist + 1, chroma_neighbors,
+                col);
+}
+
+// Divide 8 accumulators by their count with rounding. The division is exact
+// in double precision for 32-bit operands, so it matches OD_DIVU
+static INLINE __m256i get_filtered_pixels_8(const uint32_t *accum,
+                                            const uint16_t *count) {
+    const __m256i count_u32 =
+            _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)count));
+    const __m256i num =
+            _mm256_add_epi32(_mm256_loadu_si256((const __m256i *)accum),
+                             _mm256_srli_epi32(count_u32, 1));
+    // Convert the unsigned numerator through its signed offset value
+    const __m256i num_signed =
+            _mm256_xor_si256(num, _mm256_set1_epi32((int32_t)0x80000000));
+    const __m256d offset = _mm256_set1_pd(2147483648.0);
+    const __m256d num_lo = _mm256_add_pd(
+            _mm256_cvtepi32_pd(_mm256_castsi256_si128(num_signed)), offset);
+    const __m256d num_hi = _mm256_add_pd(
+            _mm256_cvtepi32_pd(_mm256_extracti128_si256(num_signed, 1)), offset);
+    const __m128i quot_lo = _mm256_cvttpd_epi32(_mm256_div_pd(
+            num_lo, _mm256_cvtepi32_pd(_mm256_castsi256_si128(count_u32))));
+    const __m128i quot_hi = _mm256_cvttpd_epi32(_mm256_div_pd(
+            num_hi, _mm256_cvtepi32_pd(_mm256_extracti128_si256(count_u32, 1))));
+
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(quot_lo), quot_hi, 1);
+}
+
+// Accumulate the squared differences of 8 pixels in 64-bit
+static INLINE __m256i add_sse_8(const __m256i sse, const __m256i src,
+                                const __m256i filtered) {
+    const __m256i diff = _mm256_sub_epi32(src, filtered);
+    const __m256i diff_odd = _mm256_srli_epi64(diff, 32);
+
+    return _mm256_add_epi64(_mm256_add_epi64(sse, _mm256_mul_epi32(diff, diff)),
+                            _mm256_mul_epi32(diff_odd, diff_odd));
+}
+
+static INLINE uint64_t hadd_sse(const __m256i sse) {
+    const __m128i sum = _mm_add_epi64(_mm256_castsi256_si128(sse),
+                                      _mm256_extracti128_si256(sse, 1));
+
+    return (uint64_t)_mm_cvtsi128_si64(_mm_add_epi64(sum, _mm_srli_si128(sum, 8)));
+}
+
+void svt_av1_get_final_filtered_pixels_avx2(const uint32_t *accum,
+                                            const uint16_t *count,
+                                            uint32_t width, uint32_t height,
+                                            uint8_t *dst, uint32_t dst_stride,
+                                            uint64_t *sse) {
+    __m256i sse_u64 = _mm256_setzero_si256();
+
+    assert(width % 8 == 0 && "block width must be multiple of 8");
+
+    for (uint32_t i = 0; i < height; i++) {
+        for (uint32_t j = 0; j < width; j += 8) {
+            const __m256i filtered = get_filtered_pixels_8(accum, count);
+            const __m256i src =
+                    _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)(dst + j)));
+            const __m128i filtered_u16 =
+                    _mm_packus_epi32(_mm256_castsi256_si128(filtered),
+                                     _mm256_extracti128_si256(filtered, 1));
+
+            sse_u64 = add_sse_8(sse_u64, src, filtered);
+            _mm_storel_epi64((__m128i *)(dst + j),
+                             _mm_packus_epi16(filtered_u16, filtered_u16));
+            accum += 8;
+            count += 8;
+        }
+        dst += dst_stride;
+    }
+    *sse += hadd_sse(sse_u64);
+}
+
+void svt_av1_get_final_filtered_pixels_highbd_avx2(const uint32_t *accum,
+                                                   const uint16_t *count,
+                                                   uint32_t width,
+                                                   uint32_t height,
+                                                   uint16_t *dst,
+                                                   uint32_t dst_stride,
+                                                   uint64_t *sse) {
+    __m256i sse_u64 = _mm256_setzero_si256();
+
+    assert(width % 8 == 0 && "block width must be multiple of 8");
+
+    for (uint32_t i = 0; i < height; i++) {
+        for (uint32_t j = 0; j < width; j += 8) {
+            const __m256i filtered = get_filtered_pixels_8(accum, count);
+            const __m256i src =
+                    _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)(dst + j)));
+
+            sse_u64 = add_sse_8(sse_u64, src, filtered);
+            _mm_storeu_si128((__m128i *)(dst + j),
+                             _mm_packus_epi32(_mm256_castsi256_si128(filtered),
+                                              _mm256_extracti128_si256(filtered, 1)));
+            accum += 8;
+            count += 8;
+        }
+        dst += dst_stride;
+    }
+    *sse += hadd_sse(sse_u64);
+}
@@ -0,0 +1,858 @@
+/*
+ * Copyright(c) 2019 Intel Corporation
+ * SPDX - License - Identifier: BSD - 2 - Clause - Patent
+ */
+
+#include <assert.h>
+#include <immintrin.h>
+
+#include "EbDefinitions.h"
+#include "EbTemporalFiltering_constants.h"
+#include "aom_dsp_rtcd.h"
+
+#ifndef NON_AVX512_SUPPORT
+
+// Neighbor constants of the left, middle, right and single column groups
+static const int16_t *const *const LUMA_NEIGHBORS[4] = {
+    LUMA_LEFT_COLUMN_NEIGHBORS, LUMA_MIDDLE_COLUMN_NEIGHBORS,
+    LUMA_RIGHT_COLUMN_NEIGHBORS, NULL };
+static const int16_t *const *const CHROMA_NO_SS_NEIGHBORS[4] = {
+    CHROMA_NO_SS_LEFT_COLUMN_NEIGHBORS, CHROMA_NO_SS_MIDDLE_COLUMN_NEIGHBORS,
+    CHROMA_NO_SS_RIGHT_COLUMN_NEIGHBORS, NULL };
+static const int16_t *const *const CHROMA_SINGLE_SS_NEIGHBORS[4] = {
+    CHROMA_SINGLE_SS_LEFT_COLUMN_NEIGHBORS,
+    CHROMA_SINGLE_SS_MIDDLE_COLUMN_NEIGHBORS,
+    CHROMA_SINGLE_SS_RIGHT_COLUMN_NEIGHBORS,
+    CHROMA_SINGLE_SS_SINGLE_COLUMN_NEIGHBORS };
+static const int16_t *const *const CHROMA_DOUBLE_SS_NEIGHBORS[4] = {
+    CHROMA_DOUBLE_SS_LEFT_COLUMN_NEIGHBORS,
+    CHROMA_DOUBLE_SS_MIDDLE_COLUMN_NEIGHBORS,
+    CHROMA_DOUBLE_SS_RIGHT_COLUMN_NEIGHBORS,
+    CHROMA_DOUBLE_SS_SINGLE_COLUMN_NEIGHBORS };
+
+static const uint32_t *const *const HIGHBD_LUMA_NEIGHBORS[3] = {
+    HIGHBD_LUMA_LEFT_COLUMN_NEIGHBORS, HIGHBD_LUMA_MIDDLE_COLUMN_NEIGHBORS,
+    HIGHBD_LUMA_RIGHT_COLUMN_NEIGHBORS };
+static const uint32_t *const *const HIGHBD_CHROMA_NO_SS_NEIGHBORS[3] = {
+    HIGHBD_CHROMA_NO_SS_LEFT_COLUMN_NEIGHBORS,
+    HIGHBD_CHROMA_NO_SS_MIDDLE_COLUMN_NEIGHBORS,
+    HIGHBD_CHROMA_NO_SS_RIGHT_COLUMN_NEIGHBORS };
+static const uint32_t *const *const HIGHBD_CHROMA_SINGLE_SS_NEIGHBORS[3] = {
+    HIGHBD_CHROMA_SINGLE_SS_LEFT_COLUMN_NEIGHBORS,
+    HIGHBD_CHROMA_SINGLE_SS_MIDDLE_COLUMN_NEIGHBORS,
+    HIGHBD_CHROMA_SINGLE_SS_RIGHT_COLUMN_NEIGHBORS };
+static const uint32_t *const *const HIGHBD_CHROMA_DOUBLE_SS_NEIGHBORS[3] = {
+    HIGHBD_CHROMA_DOUBLE_SS_LEFT_COLUMN_NEIGHBORS,
+    HIGHBD_CHROMA_DOUBLE_SS_MIDDLE_COLUMN_NEIGHBORS,
+    HIGHBD_CHROMA_DOUBLE_SS_RIGHT_COLUMN_NEIGHBORS };
+
+// Pick the neighbor constants of the group of 8 columns starting at col in a
+// row of width columns
+static INLINE const int16_t *const *get_neighbors(
+        const int16_t *const *const *neighbors, unsigned int col,
+        unsigned int width) {
+    const int first = col == 0;
+    const int last = col + 8 == width;
+
+    if (first && last)
+        return neighbors[3];
+    if (first)
+        return neighbors[0];
+    return last ? neighbors[2] : neighbors[1];
+}
+
+// Same for a group of 4 high bit depth columns
+static INLINE const uint32_t *const *highbd_get_neighbors(
+        const uint32_t *const *const *neighbors, unsigned int col,
+        unsigned int width) {
+    if (col == 0)
+        return neighbors[0];
+    return col + 4 == width ? neighbors[2] : neighbors[1];
+}
+
+// Load the neighbor constants of 4 consecutive groups of columns, row selects
+// the corner/edge or the edge/center constants
+static INLINE __m512i load_neighbors_x4(const void *const *groups[4],
+                                        int row) {
+    const __m256i lo = _mm256_inserti128_si256(
+            _mm256_castsi128_si256(
+                    _mm_loadu_si128((const __m128i *)groups[0][row])),
+            _mm_loadu_si128((const __m128i *)groups[1][row]), 1);
+    const __m256i hi = _mm256_inserti128_si256(
+            _mm256_castsi128_si256(
+                    _mm_loadu_si128((const __m128i *)groups[2][row])),
+            _mm_loadu_si128((const __m128i *)groups[3][row]), 1);
+
+    return _mm512_inserti64x4(_mm512_castsi256_si512(lo), hi, 1);
+}
+
+// Filter weights of the columns [col, col + size) in the top and bottom halves
+// of the block
+static INLINE void get_weights(const int *blk_fw, int use_whole_blk,
+                               unsigned int col, unsigned int size,
+                               unsigned int width, int16_t *top,
+                               int16_t *bottom) {
+    const int16_t top_left = (int16_t)blk_fw[0];
+    const int16_t top_right = (int16_t)(use_whole_blk ? blk_fw[0] : blk_fw[1]);
+    const int16_t bottom_left = (int16_t)(use_whole_blk ? blk_fw[0] : blk_fw[2]);
+    const int16_t bottom_right = (int16_t)(use_whole_blk ? blk_fw[0] : blk_fw[3]);
+
+    for (unsigned int i = 0; i < size; i++) {
+        const int right = col + i >= (width >> 1);
+        top[i] = right ? top_right : top_left;
+        bottom[i] = right ? bottom_right : bottom_left;
+    }
+}
+
+static INLINE void highbd_get_weights(const int *blk_fw, int use_whole_blk,
+                                      unsigned int col, unsigned int width,
+                                      int32_t *top, int32_t *bottom) {
+    const int32_t top_left = blk_fw[0];
+    const int32_t top_right = use_whole_blk ? blk_fw[0] : blk_fw[1];
+    const int32_t bottom_left = use_whole_blk ? blk_fw[0] : blk_fw[2];
+    const int32_t bottom_right = use_whole_blk ? blk_fw[0] : blk_fw[3];
+
+    for (unsigned int i = 0; i < 16; i++) {
+        const int right = col + i >= (width >> 1);
+        top[i] = right ? top_right : top_left;
+        bottom[i] = right ? bottom_right : bottom_left;
+    }
+}
+
+static INLINE __m512i load_u16_16x2(const uint16_t *lo, const uint16_t *hi) {
+    return _mm512_inserti64x4(
+            _mm512_castsi256_si512(_mm256_loadu_si256((const __m256i *)lo)),
+            _mm256_loadu_si256((const __m256i *)hi), 1);
+}
+
+static INLINE __m512i load_u8_16x2(const uint8_t *lo, const uint8_t *hi) {
+    return _mm512_cvtepu8_epi16(_mm256_inserti128_si256(
+            _mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)lo)),
+            _mm_loadu_si128((const __m128i *)hi), 1));
+}
+
+// Compute (a-b)**2 for 32 pixels and store as unsigned 16-bit integers
+static INLINE void store_dist_32(const uint8_t *a, const uint8_t *b,
+                                 uint16_t *dst) {
+    const __m512i a_reg =
+            _mm512_cvtepu8_epi16(_mm256_loadu_si256((const __m256i *)a));
+    const __m512i b_reg =
+            _mm512_cvtepu8_epi16(_mm256_loadu_si256((const __m256i *)b));
+    const __m512i diff = _mm512_sub_epi16(a_reg, b_reg);
+
+    _mm512_storeu_si512((__m512i *)dst, _mm512_mullo_epi16(diff, diff));
+}
+
+// Compute (a-b)**2 for 16 pixels of both chroma planes
+static INLINE void store_dist_16x2(const uint8_t *u_a, const uint8_t *u_b,
+                                   const uint8_t *v_a, const uint8_t *v_b,
+                                   uint16_t *u_dst, uint16_t *v_dst) {
+    const __m512i diff =
+            _mm512_sub_epi16(load_u8_16x2(u_a, v_a), load_u8_16x2(u_b, v_b));
+    const __m512i dist = _mm512_mullo_epi16(diff, diff);
+
+    _mm256_storeu_si256((__m256i *)u_dst, _mm512_castsi512_si256(dist));
+    _mm256_storeu_si256((__m256i *)v_dst, _mm512_extracti64x4_epi64(dist, 1));
+}
+
+// Sum up three neighboring distortions for 32 pixels
+static INLINE __m512i get_sum_32(const uint16_t *dist) {
+    const __m512i left = _mm512_loadu_si512((const __m512i *)(dist - 1));
+    const __m512i center = _mm512_loadu_si512((const __m512i *)dist);
+    const __m512i right = _mm512_loadu_si512((const __m512i *)(dist + 1));
+
+    return _mm512_adds_epu16(_mm512_adds_epu16(left, center), right);
+}
+
+static INLINE __m512i get_sum_16x2(const uint16_t *u_dist,
+                                   const uint16_t *v_dist) {
+    const __m512i left = load_u16_16x2(u_dist - 1, v_dist - 1);
+    const __m512i center = load_u16_16x2(u_dist, v_dist);
+    const __m512i right = load_u16_16x2(u_dist + 1, v_dist + 1);
+
+    return _mm512_adds_epu16(_mm512_adds_epu16(left, center), right);
+}
+
+// Read the chroma distortions co-located with 32 luma pixels
+static INLINE __m512i read_chroma_dist_32(const uint16_t *dist, int ss_x) {
+    if (ss_x) {
+        const __m512i dist_u32 =
+                _mm512_cvtepu16_epi32(_mm256_loadu_si256((const __m256i *)dist));
+        return _mm512_or_si512(dist_u32, _mm512_slli_epi32(dist_u32, 16));
+    }
+    return _mm512_loadu_si512((const __m512i *)dist);
+}
+
+// Add up the luma distortions co-located with 16 chroma pixels and duplicate
+// them for both chroma planes
+static INLINE __m512i get_luma_dist_16x2(const uint16_t *y_dist, int ss_x,
+                                         int ss_y) {
+    __m256i sum;
+
+    if (ss_x) {
+        __m512i row = _mm512_loadu_si512((const __m512i *)y_dist);
+        if (ss_y)
+            row = _mm512_adds_epu16(
+                    row,
+                    _mm512_loadu_si512((const __m512i *)(y_dist + DIST_STRIDE)));
+        // Add the horizontal pairs in 32-bit and saturate back to 16-bit
+        sum = _mm512_cvtusepi32_epi16(
+                _mm512_add_epi32(_mm512_and_si512(row, _mm512_set1_epi32(0xffff)),
+                                 _mm512_srli_epi32(row, 16)));
+    } else {
+        sum = _mm256_loadu_si256((const __m256i *)y_dist);
+        if (ss_y)
+            sum = _mm256_adds_epu16(
+                    sum,
+                    _mm256_loadu_si256((const __m256i *)(y_dist + DIST_STRIDE)));
+    }
+    return _mm512_broadcast_i64x4(sum);
+}
+
+// Average the value based on the number of values summed, add in the rounding
+// factor and shift, clamp to 16, invert and multiply by the weight
+static INLINE __m512i average_32(const __m512i sum, const __m512i mul_constants,
+                                 const __m128i strength,
+                                 const __m512i rounding, const __m512i weight) {
+    const __m512i sixteen = _mm512_set1_epi16(16);
+    __m512i output = _mm512_mulhi_epu16(sum, mul_constants);
+
+    output = _mm512_adds_epu16(output, rounding);
+    output = _mm512_srl_epi16(output, strength);
+    output = _mm512_min_epu16(output, sixteen);
+    output = _mm512_sub_epi16(sixteen, output);
+    return _mm512_mullo_epi16(output, weight);
+}
+
+// Add 'mod' to 'count'. Multiply by 'pred' and add to 'accumulator'
+static INLINE void accumulate_and_store_32(const __m512i mod,
+                                           const uint8_t *pred,
+                                           uint16_t *count,
+                                           uint32_t *accumulator) {
+    const __m512i pred_u16 =
+            _mm512_cvtepu8_epi16(_mm256_loadu_si256((const __m256i *)pred));
+    const __m512i count_u16 = _mm512_adds_epu16(
+            _mm512_loadu_si512((const __m512i *)count), mod);
+    const __m512i mul = _mm512_mullo_epi16(mod, pred_u16);
+    const __m512i accum_0 = _mm512_add_epi32(
+            _mm512_loadu_si512((const __m512i *)accumulator),
+            _mm512_cvtepu16_epi32(_mm512_castsi512_si256(mul)));
+    const __m512i accum_1 = _mm512_add_epi32(
+            _mm512_loadu_si512((const __m512i *)(accumulator + 16)),
+            _mm512_cvtepu16_epi32(_mm512_extracti64x4_epi64(mul, 1)));
+
+    _mm512_storeu_si512((__m512i *)count, count_u16);
+    _mm512_storeu_si512((__m512i *)accumulator, accum_0);
+    _mm512_storeu_si512((__m512i *)(accumulator + 16), accum_1);
+}
+
+static INLINE void accumulate_and_store_16x2(const __m512i mod,
+                                             const uint8_t *u_pred,
+                                             const uint8_t *v_pred,
+                                             uint16_t *u_count,
+                                             uint16_t *v_count,
+                                             uint32_t *u_accum,
+                                             uint32_t *v_accum) {
+    const __m512i count_u16 =
+            _mm512_adds_epu16(load_u16_16x2(u_count, v_count), mod);
+    const __m512i mul = _mm512_mullo_epi16(mod, load_u8_16x2(u_pred, v_pred));
+    const __m512i u_accum_u32 = _mm512_add_epi32(
+            _mm512_loadu_si512((const __m512i *)u_accum),
+            _mm512_cvtepu16_epi32(_mm512_castsi512_si256(mul)));
+    const __m512i v_accum_u32 = _mm512_add_epi32(
+            _mm512_loadu_si512((const __m512i *)v_accum),
+            _mm512_cvtepu16_epi32(_mm512_extracti64x4_epi64(mul, 1)));
+
+    _mm256_storeu_si256((__m256i *)u_count, _mm512_castsi512_si256(count_u16));
+    _mm256_storeu_si256((__m256i *)v_count,
+                        _mm512_extracti64x4_epi64(count_u16, 1));
+    _mm512_storeu_si512((__m512i *)u_accum, u_accum_u32);
+    _mm512_storeu_si512((__m512i *)v_accum, v_accum_u32);
+}
+
+// Apply temporal filter to a column of 32 luma pixels
+static void apply_temporal_filter_luma_32(
+        const uint8_t *y_pre, int y_pre_stride, unsigned int block_width,
+        unsigned int block_height, int ss_x, int ss_y, int strength,
+        const int *blk_fw, int use_whole_blk, uint32_t *y_accum,
+        uint16_t *y_count, const uint16_t *y_dist, const uint16_t *u_dist,
+        const uint16_t *v_dist, unsigned int col) {
+    const __m128i shift = _mm_cvtsi32_si128(strength);
+    const __m512i rounding = _mm512_set1_epi16((1 << strength) >> 1);
+    const void *const *groups[4];
+    DECLARE_ALIGNED(64, int16_t, weights[2][32]);
+    __m512i mul_constants[2], weight[2];
+    __m512i sum_prev = _mm512_setzero_si512(), sum_cur, sum_next;
+    unsigned int h;
+
+    for (int i = 0; i < 4; i++)
+        groups[i] = (const void *const *)get_neighbors(LUMA_NEIGHBORS,
+                                                       col + 8 * i, block_width);
+    get_weights(blk_fw, use_whole_blk, col, 32, block_width, weights[0],
+                weights[1]);
+    for (int i = 0; i < 2; i++) {
+        mul_constants[i] = load_neighbors_x4(groups, i);
+        weight[i] = _mm512_load_si512((const __m512i *)weights[i]);
+    }
+
+    y_pre += col;
+    y_accum += col;
+    y_count += col;
+    y_dist += col;
+    u_dist += col >> ss_x;
+    v_dist += col >> ss_x;
+
+    sum_cur = get_sum_32(y_dist);
+    for (h = 0; h < block_height; h++) {
+        const int edge = h == 0 || h == block_height - 1;
+        const uint16_t *u_row = u_dist + (h >> ss_y) * DIST_STRIDE;
+        const uint16_t *v_row = v_dist + (h >> ss_y) * DIST_STRIDE;
+        __m512i sum;
+
+        sum_next = h + 1 < block_height
+                ? get_sum_32(y_dist + (h + 1) * DIST_STRIDE)
+                : _mm512_setzero_si512();
+        sum = _mm512_adds_epu16(_mm512_adds_epu16(sum_prev, sum_cur), sum_next);
+        sum = _mm512_adds_epu16(sum, read_chroma_dist_32(u_row, ss_x));
+        sum = _mm512_adds_epu16(sum, read_chroma_dist_32(v_row, ss_x));
+
+        accumulate_and_store_32(
+                average_32(sum, mul_constants[!edge], shift, rounding,
+                           weight[h >= block_height / 2]),
+                y_pre + h * y_pre_stride, y_count + h * y_pre_stride,
+                y_accum + h * y_pre_stride);
+
+        sum_prev = sum_cur;
+        sum_cur = sum_next;
+    }
+}
+
+// Apply temporal filter to a column of 16 pixels of both chroma planes
+static void apply_temporal_filter_chroma_16(
+        const uint8_t *u_pre, const uint8_t *v_pre, int uv_pre_stride,
+        unsigned int uv_width, unsigned int uv_height, int ss_x, int ss_y,
+        int strength, const int *blk_fw, int use_whole_blk, uint32_t *u_accum,
+        uint16_t *u_count, uint32_t *v_accum, uint16_t *v_count,
+        const uint16_t *y_dist, const uint16_t *u_dist, const uint16_t *v_dist,
+        const int16_t *const *const *neighbors, unsigned int col) {
+    const __m128i shift = _mm_cvtsi32_si128(strength);
+    const __m512i rounding = _mm512_set1_epi16((1 << strength) >> 1);
+    const void *const *groups[4];
+    DECLARE_ALIGNED(64, int16_t, weights[2][32]);
+    __m512i mul_constants[2], weight[2];
+    __m512i sum_prev = _mm512_setzero_si512(), sum_cur, sum_next;
+    unsigned int h;
+
+    // Both chroma planes share the constants and the weights of the columns
+    for (int i = 0; i < 4; i++)
+        groups[i] = (const void *const *)get_neighbors(
+                neighbors, col + 8 * (i & 1), uv_width);
+    get_weights(blk_fw, use_whole_blk, col, 16, uv_width, weights[0],
+                weights[1]);
+    get_weights(blk_fw, use_whole_blk, col, 16, uv_width, weights[0] + 16,
+                weights[1] + 16);
+    for (int i = 0; i < 2; i++) {
+        mul_constants[i] = load_neighbors_x4(groups, i);
+        weight[i] = _mm512_load_si512((const __m512i *)weights[i]);
+    }
+
+    u_pre += col;
+    v_pre += col;
+    u_accum += col;
+    v_accum += col;
+    u_count += col;
+    v_count += col;
+    u_dist += col;
+    v_dist += col;
+    y_dist += col << ss_x;
+
+    sum_cur = get_sum_16x2(u_dist, v_dist);
+    for (h = 0; h < uv_height; h++) {
+        const int edge = h == 0 || h == uv_height - 1;
+        const int offset = h * uv_pre_stride;
+        __m512i sum;
+
+        sum_next = h + 1 < uv_height
+                ? get_sum_16x2(u_dist + (h + 1) * DIST_STRIDE,
+                               v_dist + (h + 1) * DIST_STRIDE)
+                : _mm512_setzero_si512();
+        sum = _mm512_adds_epu16(_mm512_adds_epu16(sum_prev, sum_cur), sum_next);
+        sum = _mm512_adds_epu16(
+                sum,
+                get_luma_dist_16x2(y_dist + (h << ss_y) * DIST_STRIDE, ss_x, ss_y));
+
+        accumulate_and_store_16x2(
+                average_32(sum, mul_constants[!edge], shift, rounding,
+                           weight[h >= uv_height / 2]),
+                u_pre + offset, v_pre + offset, u_count + offset,
+                v_count + offset, u_accum + offset, v_accum + offset);
+
+        sum_prev = sum_cur;
+        sum_cur = sum_next;
+    }
+}
+
+void svt_av1_apply_temporal_filter_avx512(
+        const uint8_t *y_src, int y_src_stride, const uint8_t *y_pre,
+        int y_pre_stride, const uint8_t *u_src, const uint8_t *v_src,
+        int uv_src_stride, const uint8_t *u_pre, const uint8_t *v_pre,
+        int uv_pre_stride, unsigned int block_width, unsigned int block_height,
+        int ss_x, int ss_y, int strength, const int *blk_fw, int use_whole_blk,
+        uint32_t *y_accum, uint16_t *y_count, uint32_t *u_accum, uint16_t *u_count,
+        uint32_t *v_accum, uint16_t *v_count) {
+    const unsigned int uv_height = block_height >> ss_y,
+            uv_width = block_width >> ss_x;
+    const int16_t *const *const *chroma_neighbors = ss_x && ss_y
+            ? CHROMA_DOUBLE_SS_NEIGHBORS
+            : ss_x || ss_y ? CHROMA_SINGLE_SS_NEIGHBORS : CHROMA_NO_SS_NEIGHBORS;
+    DECLARE_ALIGNED(64, uint16_t, y_dist[BH * DIST_STRIDE]);
+    DECLARE_ALIGNED(64, uint16_t, u_dist[BH * DIST_STRIDE]);
+    DECLARE_ALIGNED(64, uint16_t, v_dist[BH * DIST_STRIDE]);
+    unsigned int row, col;
+
+    // The columns are processed by 32 luma and 16 chroma pixels
+    if ((block_width & 31) || (uv_width & 15)) {
+        svt_av1_apply_temporal_filter_avx2(
+                y_src, y_src_stride, y_pre, y_pre_stride, u_src, v_src,
+                uv_src_stride, u_pre, v_pre, uv_pre_stride, block_width,
+                block_height, ss_x, ss_y, strength, blk_fw, use_whole_blk,
+                y_accum, y_count, u_accum, u_count, v_accum, v_count);
+        return;
+    }
+
+    assert(block_width <= BW && "block width too large");
+    assert(block_height <= BH && "block height too large");
+    assert(block_height % 2 == 0 && "block height must be even");
+    assert((ss_x == 0 || ss_x == 1) && (ss_y == 0 || ss_y == 1) &&
+           "invalid chroma subsampling");
+    assert(strength >= 0 && strength <= 6 && "invalid temporal filter strength");
+    assert(blk_fw[0] >= 0 && blk_fw[0] <= 2 && "invalid filter weight");
+
+    // Precompute the difference squared, the padding columns on both sides
+    // account for the missing neighbors
+    for (row = 0; row < block_height; row++) {
+        uint16_t *dist = y_dist + row * DIST_STRIDE;
+        dist[0] = dist[block_width + 1] = 0;
+        for (col = 0; col < block_width; col += 32)
+            store_dist_32(y_src + row * y_src_stride + col,
+                          y_pre + row * y_pre_stride + col, dist + 1 + col);
+    }
+    for (row = 0; row < uv_height; row++) {
+        uint16_t *u = u_dist + row * DIST_STRIDE;
+        uint16_t *v = v_dist + row * DIST_STRIDE;
+        u[0] = u[uv_width + 1] = v[0] = v[uv_width + 1] = 0;
+        for (col = 0; col < uv_width; col += 16)
+            store_dist_16x2(u_src + row * uv_src_stride + col,
+                            u_pre + row * uv_pre_stride + col,
+                            v_src + row * uv_src_stride + col,
+                            v_pre + row * uv_pre_stride + col, u + 1 + col,
+                            v + 1 + col);
+    }
+
+    for (col = 0; col < block_width; col += 32)
+        apply_temporal_filter_luma_32(
+                y_pre, y_pre_stride, block_width, block_height, ss_x, ss_y,
+                strength, blk_fw, use_whole_blk, y_accum, y_count, y_dist + 1,
+                u_dist + 1, v_dist + 1, col);
+
+    for (col = 0; col < uv_width; col += 16)
+        apply_temporal_filter_chroma_16(
+                u_pre, v_pre, uv_pre_stride, uv_width, uv_height, ss_x, ss_y,
+                strength, blk_fw, use_whole_blk, u_accum, u_count, v_accum,
+                v_count, y_dist + 1, u_dist + 1, v_dist + 1, chroma_neighbors,
+                col);
+}
+
+// Compute (a-b)**2 for 16 high bit depth pixels
+static INLINE void highbd_store_dist_16(const uint16_t *a, const uint16_t *b,
+                                        uint32_t *dst) {
+    const __m512i a_reg =
+            _mm512_cvtepu16_epi32(_mm256_loadu_si256((const __m256i *)a));
+    const __m512i b_reg =
+            _mm512_cvtepu16_epi32(_mm256_loadu_si256((const __m256i *)b));
+    const __m512i diff = _mm512_sub_epi32(a_reg, b_reg);
+
+    _mm512_storeu_si512((__m512i *)dst, _mm512_mullo_epi32(diff, diff));
+}
+
+// Sum up three neighboring distortions for 16 high bit depth pixels
+static INLINE __m512i highbd_get_sum_16(const uint32_t *dist) {
+    const __m512i left = _mm512_loadu_si512((const __m512i *)(dist - 1));
+    const __m512i center = _mm512_loadu_si512((const __m512i *)dist);
+    const __m512i right = _mm512_loadu_si512((const __m512i *)(dist + 1));
+
+    return _mm512_add_epi32(_mm512_add_epi32(left, center), right);
+}
+
+static INLINE __m512i highbd_read_chroma_dist_16(const uint32_t *dist,
+                                                 int ss_x) {
+    if (ss_x) {
+        const __m512i dist_u64 =
+                _mm512_cvtepu32_epi64(_mm256_loadu_si256((const __m256i *)dist));
+        return _mm512_or_si512(dist_u64, _mm512_slli_epi64(dist_u64, 32));
+    }
+    return _mm512_loadu_si512((const __m512i *)dist);
+}
+
+static INLINE __m512i highbd_get_luma_dist_16(const uint32_t *y_dist, int ss_x,
+                                              int ss_y) {
+    __m512i first = _mm512_loadu_si512((const __m512i *)y_dist);
+
+    if (ss_y)
+        first = _mm512_add_epi32(
+                first, _mm512_loadu_si512((const __m512i *)(y_dist + DIST_STRIDE)));
+    if (ss_x) {
+        const __m512i even = _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 16,
+                                               18, 20, 22, 24, 26, 28, 30);
+        const __m512i odd = _mm512_add_epi32(even, _mm512_set1_epi32(1));
+        __m512i second = _mm512_loadu_si512((const __m512i *)(y_dist + 16));
+        if (ss_y)
+            second = _mm512_add_epi32(
+                    second,
+                    _mm512_loadu_si512(
+                            (const __m512i *)(y_dist + DIST_STRIDE + 16)));
+        first = _mm512_add_epi32(_mm512_permutex2var_epi32(first, even, second),
+                                 _mm512_permutex2var_epi32(first, odd, second));
+    }
+    return first;
+}
+
+static INLINE __m512i highbd_average_16(const __m512i sum,
+                                        const __m512i mul_constants,
+                                        const __m128i strength,
+                                        const __m512i rounding,
+                                        const __m512i weight) {
+    const __m512i sixteen = _mm512_set1_epi32(16);
+    // modifier * 3 / index, the odd elements are multiplied separately
+    const __m512i mul_even =
+            _mm512_srli_epi64(_mm512_mul_epu32(sum, mul_constants), 32);
+    const __m512i mul_odd =
+            _mm512_mul_epu32(_mm512_srli_epi64(sum, 32),
+                             _mm512_srli_epi64(mul_constants, 32));
+    __m512i output = _mm512_mask_blend_epi32(0xaaaa, mul_even, mul_odd);
+
+    output = _mm512_add_epi32(output, rounding);
+    output = _mm512_srl_epi32(output, strength);
+    output = _mm512_min_epu32(output, sixteen);
+    output = _mm512_sub_epi32(sixteen, output);
+    return _mm512_mullo_epi32(output, weight);
+}
+
+static INLINE void highbd_accumulate_and_store_16(const __m512i mod,
+                                                  const uint16_t *pred,
+                                                  uint16_t *count,
+                                                  uint32_t *accumulator) {
+    const __m512i pred_u32 =
+            _mm512_cvtepu16_epi32(_mm256_loadu_si256((const __m256i *)pred));
+
+    _mm256_storeu_si256(
+            (__m256i *)count,
+            _mm256_adds_epu16(_mm256_loadu_si256((const __m256i *)count),
+                              _mm512_cvtusepi32_epi16(mod)));
+    _mm512_storeu_si512(
+            (__m512i *)accumulator,
+            _mm512_add_epi32(_mm512_loadu_si512((const __m512i *)accumulator),
+                             _mm512_mullo_epi32(mod, pred_u32)));
+}
+
+// Apply temporal filter to a column of 16 high bit depth luma pixels
+static void highbd_apply_temporal_filter_luma_16(
+        const uint16_t *y_pre, int y_pre_stride, unsigned int block_width,
+        unsigned int block_height, int ss_x, int ss_y, int strength,
+        const int *blk_fw, int use_whole_blk, uint32_t *y_accum,
+        uint16_t *y_count, const uint32_t *y_dist, const uint32_t *u_dist,
+        const uint32_t *v_dist, unsigned int col) {
+    const __m128i shift = _mm_cvtsi32_si128(strength);
+    const __m512i rounding = _mm512_set1_epi32((1 << strength) >> 1);
+    const void *const *groups[4];
+    DECLARE_ALIGNED(64, int32_t, weights[2][16]);
+    __m512i mul_constants[2], weight[2];
+    __m512i sum_prev = _mm512_setzero_si512(), sum_cur, sum_next;
+    unsigned int h;
+
+    for (int i = 0; i < 4; i++)
+        groups[i] = (const void *const *)highbd_get_neighbors(
+                HIGHBD_LUMA_NEIGHBORS, col + 4 * i, block_width);
+    highbd_get_weights(blk_fw, use_whole_blk, col, block_width, weights[0],
+                       weights[1]);
+    for (int i = 0; i < 2; i++) {
+        mul_constants[i] = load_neighbors_x4(groups, i);
+        weight[i] = _mm512_load_si512((const __m512i *)weights[i]);
+    }
+
+    y_pre += col;
+    y_accum += col;
+    y_count += col;
+    y_dist += col;
+    u_dist += col >> ss_x;
+    v_dist += col >> ss_x;
+
+    sum_cur = highbd_get_sum_16(y_dist);
+    for (h = 0; h < block_height; h++) {
+        const int edge = h == 0 || h == block_height - 1;
+        const uint32_t *u_row = u_dist + (h >> ss_y) * DIST_STRIDE;
+        const uint32_t *v_row = v_dist + (h >> ss_y) * DIST_STRIDE;
+        __m512i sum;
+
+        sum_next = h + 1 < block_height
+                ? highbd_get_sum_16(y_dist + (h + 1) * DIST_STRIDE)
+                : _mm512_setzero_si512();
+        sum = _mm512_add_epi32(_mm512_add_epi32(sum_prev, sum_cur), sum_next);
+        sum = _mm512_add_epi32(sum, highbd_read_chroma_dist_16(u_row, ss_x));
+        sum = _mm512_add_epi32(sum, highbd_read_chroma_dist_16(v_row, ss_x));
+
+        highbd_accumulate_and_store_16(
+                highbd_average_16(sum, mul_constants[!edge], shift, rounding,
+                                  weight[h >= block_height / 2]),
+                y_pre + h * y_pre_stride, y_count + h * y_pre_stride,
+                y_accum + h * y_pre_stride);
+
+        sum_prev = sum_cur;
+        sum_cur = sum_next;
+    }
+}
+
+// Apply temporal filter to a column of 16 high bit depth chroma pixels of
+// both planes
+static void highbd_apply_temporal_filter_chroma_16(
+        const uint16_t *u_pre, const uint16_t *v_pre, int uv_pre_stride,
+        unsigned int uv_width, unsigned int uv_height, int ss_x, int ss_y,
+        int strength, const int *blk_fw, int use_whole_blk, uint32_t *u_accum,
+        uint16_t *u_count, uint32_t *v_accum, uint16_t *v_count,
+        const uint32_t *y_dist, const uint32_t *u_dist, const uint32_t *v_dist,
+        const uint32_t *const *const *neighbors, unsigned int col) {
+    const __m128i shift = _mm_cvtsi32_si128(strength);
+    const __m512i rounding = _mm512_set1_epi32((1 << strength) >> 1);
+    const void *const *groups[4];
+    DECLARE_ALIGNED(64, int32_t, weights[2][16]);
+    __m512i mul_constants[2], weight[2];
+    __m512i u_sum_prev = _mm512_setzero_si512(), u_sum_cur, u_sum_next;
+    __m512i v_sum_prev = _mm512_setzero_si512(), v_sum_cur, v_sum_next;
+    unsigned int h;
+
+    for (int i = 0; i < 4; i++)
+        groups[i] = (const void *const *)highbd_get_neighbors(
+                neighbors, col + 4 * i, uv_width);
+    highbd_get_weights(blk_fw, use_whole_blk, col, uv_width, weights[0],
+                       weights[1]);
+    for (int i = 0; i < 2; i++) {
+        mul_constants[i] = load_neighbors_x4(groups, i);
+        weight[i] = _mm512_load_si512((const __m512i *)weights[i]);
+    }
+
+    u_pre += col;
+    v_pre += col;
+    u_accum += col;
+    v_accum += col;
+    u_count += col;
+    v_count += col;
+    u_dist += col;
+    v_dist += col;
+    y_dist += col << ss_x;
+
+    u_sum_cur = highbd_get_sum_16(u_dist);
+    v_sum_cur = highbd_get_sum_16(v_dist);
+    for (h = 0; h < uv_height; h++) {
+        const int edge = h == 0 || h == uv_height - 1;
+        const int offset = h * uv_pre_stride;
+        const __m512i y_sum = highbd_get_luma_dist_16(
+                y_dist + (h << ss_y) * DIST_STRIDE, ss_x, ss_y);
+        __m512i u_sum, v_sum;
+
+        if (h + 1 < uv_height) {
+            u_sum_next = highbd_get_sum_16(u_dist + (h + 1) * DIST_STRIDE);
+            v_sum_next = highbd_get_sum_16(v_dist + (h + 1) * DIST_STRIDE);
+        } else
+            u_sum_next = v_sum_next = _mm512_setzero_si512();
+        u_sum = _mm512_add_epi32(_mm512_add_epi32(u_sum_prev, u_sum_cur), u_sum_next);
+        v_sum = _mm512_add_epi32(_mm512_add_epi32(v_sum_prev, v_sum_cur), v_sum_next);
+        u_sum = _mm512_add_epi32(u_sum, y_sum);
+        v_sum = _mm512_add_epi32(v_sum, y_sum);
+
+        highbd_accumulate_and_store_16(
+                highbd_average_16(u_sum, mul_constants[!edge], shift, rounding,
+                                  weight[h >= uv_height / 2]),
+                u_pre + offset, u_count + offset, u_accum + offset);
+        highbd_accumulate_and_store_16(
+                highbd_average_16(v_sum, mul_constants[!edge], shift, rounding,
+                                  weight[h >= uv_height / 2]),
+                v_pre + offset, v_count + offset, v_accum + offset);
+
+        u_sum_prev = u_sum_cur;
+        u_sum_cur = u_sum_next;
+        v_sum_prev = v_sum_cur;
+        v_sum_cur = v_sum_next;
+    }
+}
+
+void svt_av1_highbd_apply_temporal_filter_avx512(
+        const uint16_t *y_src, int y_src_stride, const uint16_t *y_pre,
+        int y_pre_stride, const uint16_t *u_src, const uint16_t *v_src,
+        int uv_src_stride, const uint16_t *u_pre, const uint16_t *v_pre,
+        int uv_pre_stride, unsigned int block_width, unsigned int block_height,
+        int ss_x, int ss_y, int strength, const int *blk_fw, int use_whole_blk,
+        uint32_t *y_accum, uint16_t *y_count, uint32_t *u_accum, uint16_t *u_count,
+        uint32_t *v_accum, uint16_t *v_count) {
+    const unsigned int uv_height = block_height >> ss_y,
+            uv_width = block_width >> ss_x;
+    const uint32_t *const *const *chroma_neighbors = ss_x && ss_y
+            ? HIGHBD_CHROMA_DOUBLE_SS_NEIGHBORS
+            : ss_x || ss_y ? HIGHBD_CHROMA_SINGLE_SS_NEIGHBORS
+                           : HIGHBD_CHROMA_NO_SS_NEIGHBORS;
+    DECLARE_ALIGNED(64, uint32_t, y_dist[BH * DIST_STRIDE]);
+    DECLARE_ALIGNED(64, uint32_t, u_dist[BH * DIST_STRIDE]);
+    DECLARE_ALIGNED(64, uint32_t, v_dist[BH * DIST_STRIDE]);
+    unsigned int row, col;
+
+    // The columns are processed by 16 pixels
+    if ((block_width & 15) || (uv_width & 15)) {
+        svt_av1_highbd_apply_temporal_filter_avx2(
+                y_src, y_src_stride, y_pre, y_pre_stride, u_src, v_src,
+                uv_src_stride, u_pre, v_pre, uv_pre_stride, block_width,
+                block_height, ss_x, ss_y, strength, blk_fw, use_whole_blk,
+                y_accum, y_count, u_accum, u_count, v_accum, v_count);
+        return;
+    }
+
+    assert(block_width <= BW && "block width too large");
+    assert(block_height <= BH && "block height too large");
+    assert(block_height % 2 == 0 && "block height must be even");
+    assert((ss_x == 0 || ss_x == 1) && (ss_y == 0 || ss_y == 1) &&
+           "invalid chroma subsampling");
+    assert(blk_fw[0] >= 0 && blk_fw[0] <= 2 && "invalid filter weight");
+
+    for (row = 0; row < block_height; row++) {
+        uint32_t *dist = y_dist + row * DIST_STRIDE;
+        dist[0] = dist[block_width + 1] = 0;
+        for (col = 0; col < block_width; col += 16)
+            highbd_store_dist_16(y_src + row * y_src_stride + col,
+                                 y_pre + row * y_pre_stride + col,
+                                 dist + 1 + col);
+    }
+    for (row = 0; row < uv_height; row++) {
+        uint32_t *u = u_dist + row * DIST_STRIDE;
+        uint32_t *v = v_dist + row * DIST_STRIDE;
+        u[0] = u[uv_width + 1] = v[0] = v[uv_width + 1] = 0;
+        for (col = 0; col < uv_width; col += 16) {
+            highbd_store_dist_16(u_src + row * uv_src_stride + col,
+                                 u_pre + row * uv_pre_stride + col, u + 1 + col);
+            highbd_store_dist_16(v_src + row * uv_src_stride + col,
+                                 v_pre + row * uv_pre_stride + col, v + 1 + col);
+        }
+    }
+
+    for (col = 0; col < block_width; col += 16)
+        highbd_apply_temporal_filter_luma_16(
+                y_pre, y_pre_stride, block_width, block_height, ss_x, ss_y,
+                strength, blk_fw, use_whole_blk, y_accum, y_count, y_dist + 1,
+                u_dist + 1, v_dist + 1, col);
+
+    for (col = 0; col < uv_width; col += 16)
+        highbd_apply_temporal_filter_chroma_16(
+                u_pre, v_pre, uv_pre_stride, uv_width, uv_height, ss_x, ss_y,
+                strength, blk_fw, use_whole_blk, u_accum, u_count, v_accum,
+                v_count, y_dist + 1, u_dist + 1, v_dist + 1, chroma_neighbors,
+                col);
+}
+
+// Divide 16 accumulators by their count with rounding. The division is exact
+// in double precision for 32-bit operands, so it matches OD_DIVU
+static INLINE __m512i get_filtered_pixels_16(const uint32_t *accum,
+                                             const uint16_t *count) {
+    const __m512i count_u32 =
+            _mm512_cvtepu16_epi32(_mm256_loadu_si256((const __m256i *)count));
+    const __m512i num =
+            _mm512_add_epi32(_mm512_loadu_si512((const __m512i *)accum),
+                             _mm512_srli_epi32(count_u32, 1));
+    const __m256i quot_lo = _mm512_cvttpd_epu32(
+            _mm512_div_pd(_mm512_cvtepu32_pd(_mm512_castsi512_si256(num)),
+                          _mm512_cvtepu32_pd(_mm512_castsi512_si256(count_u32))));
+    const __m256i quot_hi = _mm512_cvttpd_epu32(_mm512_div_pd(
+            _mm512_cvtepu32_pd(_mm512_extracti64x4_epi64(num, 1)),
+            _mm512_cvtepu32_pd(_mm512_extracti64x4_epi64(count_u32, 1))));
+
+    return _mm512_inserti64x4(_mm512_castsi256_si512(quot_lo), quot_hi, 1);
+}
+
+// Accumulate the squared differences of 16 pixels in 64-bit
+static INLINE __m512i add_sse_16(const __m512i sse, const __m512i src,
+                                 const __m512i filtered) {
+    const __m512i diff = _mm512_sub_epi32(src, filtered);
+    const __m512i diff_odd = _mm512_srli_epi64(diff, 32);
+
+    return _mm512_add_epi64(_mm512_add_epi64(sse, _mm512_mul_epi32(diff, diff)),
+                            _mm512_mul_epi32(diff_odd, diff_odd));
+}
+
+static INLINE uint64_t hadd_sse(const __m512i sse) {
+    const __m256i sum_256 = _mm256_add_epi64(_mm512_castsi512_si256(sse),
+                                             _mm512_extracti64x4_epi64(sse, 1));
+    const __m128i sum = _mm_add_epi64(_mm256_castsi256_si128(sum_256),
+                                      _mm256_extracti128_si256(sum_256, 1));
+
+    return (uint64_t)_mm_cvtsi128_si64(_mm_add_epi64(sum, _mm_srli_si128(sum, 8)));
+}
+
+void svt_av1_get_final_filtered_pixels_avx512(const uint32_t *accum,
+                                              const uint16_t *count,
+                                              uint32_t width, uint32_t height,
+                                              uint8_t *dst, uint32_t dst_stride,
+                                              uint64_t *sse) {
+    __m512i sse_u64 = _mm512_setzero_si512();
+
+    if (width & 15) {
+        svt_av1_get_final_filtered_pixels_avx2(accum, count, width, height, dst,
+                                               dst_stride, sse);
+        return;
+    }
+
+    for (uint32_t i = 0; i < height; i++) {
+        for (uint32_t j = 0; j < width; j += 16) {
+            const __m512i filtered = get_filtered_pixels_16(accum, count);
+            const __m512i src =
+                    _mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i *)(dst + j)));
+
+            sse_u64 = add_sse_16(sse_u64, src, filtered);
+            _mm_storeu_si128((__m128i *)(dst + j), _mm512_cvtusepi32_epi8(filtered));
+            accum += 16;
+            count += 16;
+        }
+        dst += dst_stride;
+    }
+    *sse += hadd_sse(sse_u64);
+}
+
+void svt_av1_get_final_filtered_pixels_highbd_avx512(const uint32_t *accum,
+                                                     const uint16_t *count,
+                                                     uint32_t width,
+                                                     uint32_t height,
+                                                     uint16_t *dst,
+                                                     uint32_t dst_stride,
+                                                     uint64_t *sse) {
+    __m512i sse_u64 = _mm512_setzero_si512();
+
+    if (width & 15) {
+        svt_av1_get_final_filtered_pixels_highbd_avx2(accum, count, width,
+                                                      height, dst, dst_stride,
+                                                      sse);
+        return;
+    }
+
+    for (uint32_t i = 0; i < height; i++) {
+        for (uint32_t j = 0; j < width; j += 16) {
+            const __m512i filtered = get_filtered_pixels_16(accum, count);
+            const __m512i src = _mm512_cvtepu16_epi32(
+                    _mm256_loadu_si256((const __m256i *)(dst + j)));
+
+            sse_u64 = add_sse_16(sse_u64, src, filtered);
+            _mm256_storeu_si256((__m256i *)(dst + j),
+                                _mm512_cvtusepi32_epi16(filtered));
+            accum += 16;
+            count += 16;
+        }
+        dst += dst_stride;
+    }
+    *sse += hadd_sse(sse_u64);
+}
+
+#endif
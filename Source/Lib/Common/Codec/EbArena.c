@@ -0,0 +1,73 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include <stdlib.h>
+
+#include "EbArena.h"
+
+// the slab header takes the first aligned block of the slab
+#define SLAB_HEADER_SIZE EB_ARENA_SIZE(EbArenaSlab, 1)
+
+static void eb_arena_dctor(EbPtr p)
+{
+    EbArena *obj = (EbArena*)p;
+    while (obj->slab_ptr) {
+        EbArenaSlab *slab_ptr = obj->slab_ptr;
+        obj->slab_ptr = slab_ptr->next_ptr;
+        EB_FREE_ALIGNED(slab_ptr);
+    }
+}
+
+static EbErrorType arena_add_slab(
+    EbArena *arena_ptr,
+    size_t   size)
+{
+    EbArenaSlab *slab_ptr;
+    EB_MALLOC_ALIGNED(slab_ptr, SLAB_HEADER_SIZE + size);
+    slab_ptr->next_ptr = arena_ptr->slab_ptr;
+    slab_ptr->size = size;
+    slab_ptr->used = 0;
+    arena_ptr->slab_ptr = slab_ptr;
+    arena_ptr->slab_count++;
+    arena_ptr->total_size += size;
+    return EB_ErrorNone;
+}
+
+EbErrorType eb_arena_ctor(
+    EbArena *arena_ptr,
+    size_t   size)
+{
+    arena_ptr->dctor = eb_arena_dctor;
+    return arena_add_slab(arena_ptr, EB_ARENA_SIZE(uint8_t, size));
+}
+
+/*****************************************
+ * eb_arena_alloc
+ *  Carves size bytes, ALVALUE aligned, out
+ *  of the current slab, or out of a new one
+ *  when they do not fit.
+ *****************************************/
+EbErrorType eb_arena_alloc(
+    EbArena *arena_ptr,
+    size_t   size,
+    void   **ptr)
+{
+    EbArenaSlab *slab_ptr = arena_ptr->slab_ptr;
+    size = EB_ARENA_SIZE(uint8_t, size);
+
+    if (slab_ptr == NULL || slab_ptr->size - slab_ptr->used < size) {
+        EbErrorType return_error = arena_add_slab(arena_ptr,
+            size > EB_ARENA_GROW_SIZE ? size : EB_ARENA_GROW_SIZE);
+        if (return_error != EB_ErrorNone) {
+            *ptr = NULL;
+            return return_error;
+        }
+        slab_ptr = arena_ptr->slab_ptr;
+    }
+
+    *ptr = (uint8_t*)slab_ptr + SLAB_HEADER_SIZE + slab_ptr->used;
+    slab_ptr->used += size;
+    return EB_ErrorNone;
+}
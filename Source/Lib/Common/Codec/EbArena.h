@@ -0,0 +1,80 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#ifndef EbArena_h
+#define EbArena_h
+
+#include <string.h>
+
+#include "EbDefinitions.h"
+#include "EbObject.h"
+#ifdef __cplusplus
+extern "C" {
+#endif
+    /*********************************************************************
+     * Arena
+     *   Bump allocator for the arrays an object keeps for its whole
+     *   life. The arrays are carved out of ALVALUE aligned slabs and are
+     *   never freed one by one, deleting the arena frees them all. Each
+     *   slab is a single entry of the memory map.
+     *
+     *   The first slab has the size given to the ctor, which should cover
+     *   the object. An array that does not fit opens a new slab of at
+     *   least EB_ARENA_GROW_SIZE bytes.
+     *********************************************************************/
+#define EB_ARENA_GROW_SIZE (256 * 1024)
+
+    typedef struct EbArenaSlab
+    {
+        struct EbArenaSlab *next_ptr;
+        size_t              size;
+        size_t              used;
+    } EbArenaSlab;
+
+    typedef struct EbArena
+    {
+        EbDctor             dctor;
+        EbArenaSlab        *slab_ptr;       // current slab, the older ones follow
+        size_t              slab_count;
+        size_t              total_size;
+    } EbArena;
+
+    extern EbErrorType eb_arena_ctor(
+        EbArena            *arena_ptr,
+        size_t              size);
+
+    extern EbErrorType eb_arena_alloc(
+        EbArena            *arena_ptr,
+        size_t              size,
+        void              **ptr);
+
+#define EB_ARENA_MALLOC_ARRAY(arena, pa, count) \
+    do { \
+        EbErrorType arena_err = eb_arena_alloc(arena, sizeof(*(pa)) * (count), (void**)&(pa)); \
+        if (arena_err != EB_ErrorNone) return arena_err; \
+    } while (0)
+
+#define EB_ARENA_CALLOC_ARRAY(arena, pa, count) \
+    do { \
+        EB_ARENA_MALLOC_ARRAY(arena, pa, count); \
+        memset(pa, 0, sizeof(*(pa)) * (count)); \
+    } while (0)
+
+#define EB_ARENA_MALLOC_2D(arena, p2d, width, height) \
+    do { \
+        EB_ARENA_MALLOC_ARRAY(arena, p2d, width); \
+        EB_ARENA_MALLOC_ARRAY(arena, p2d[0], (width) * (height)); \
+        for (uint32_t w = 1; w < (width); w++) \
+            p2d[w] = p2d[0] + w * (height); \
+    } while (0)
+
+/* Arena bytes taken by count elements of type */
+#define EB_ARENA_SIZE(type, count) \
+    (((sizeof(type) * (count)) + ALVALUE - 1) & ~(size_t)(ALVALUE - 1))
+
+#ifdef __cplusplus
+}
+#endif
+#endif // EbArena_h
@@ -2102,6 +2102,338 @@ void av1_copy_frame_mvs(PictureControlSet *picture_control_set_ptr, const Av1Com
         frame_mvs += frame_mvs_stride;
     }
 }
+static INLINE void set_dc_sign(int32_t *cul_level, int32_t dc_val) {
+    if (dc_val < 0)
+        *cul_level |= 1 << COEFF_CONTEXT_BITS;
+    else if (dc_val > 0)
+        *cul_level += 2 << COEFF_CONTEXT_BITS;
+}
+
+/*******************************************
+* Encode Pass - MD recon reuse
+*
+* Summary: Commits the quantized coefficients and
+*   the reconstruction kept by MD for the block
+*   winner instead of predicting, transforming and
+*   reconstructing the block a second time. The
+*   merge/skip decision of the encode pass is kept,
+*   MD stored the block accordingly.
+*
+*******************************************/
+static void md_recon_reuse_commit(
+    PictureControlSet      *picture_control_set_ptr,
+    LargestCodingUnit      *sb_ptr,
+    uint32_t                tbAddr,
+    CodingUnit             *cu_ptr,
+    EncDecContext          *context_ptr,
+    EbPictureBufferDesc    *recon_buffer,
+    EbPictureBufferDesc    *coeff_buffer_sb)
+{
+    ModeDecisionContext    *md_context = context_ptr->md_context;
+    const BlockGeom        *blk_geom = context_ptr->blk_geom;
+    const uint32_t          blk_idx = blk_geom->blkidx_mds;
+    const uint8_t           tx_depth = cu_ptr->tx_depth;
+    const uint32_t          tot_tu = blk_geom->txb_count[tx_depth];
+    PredictionUnit         *pu_ptr = cu_ptr->prediction_unit_array;
+    const EbBool            is_inter = cu_ptr->prediction_mode_flag == INTER_MODE;
+    EntropyCoder           *coeff_est_entropy_coder_ptr = picture_control_set_ptr->coeff_est_entropy_coder_ptr;
+    ModeDecisionCandidateBuffer *candidate_buffer = md_context->candidate_buffer_ptr_array[0];
+    EbBool                  skip = EB_FALSE;
+    uint32_t                txb_1d_offset = 0, txb_1d_offset_uv = 0;
+
+    context_ptr->is_inter = is_inter;
+    if (is_inter) {
+        enc_pass_av1_mv_pred(
+            &sb_ptr->tile_info,
+            md_context,
+            cu_ptr,
+            blk_geom,
+            context_ptr->cu_origin_x,
+            context_ptr->cu_origin_y,
+            picture_control_set_ptr,
+            pu_ptr->ref_frame_type,
+            pu_ptr->is_compound,
+            cu_ptr->pred_mode,
+            cu_ptr->predmv);
+
+        //keep final usefull mvp for entropy
+        memcpy(cu_ptr->av1xd->final_ref_mv_stack,
+            md_context->md_local_cu_unit[blk_idx].ed_ref_mv_stack[pu_ptr->ref_frame_type],
+            sizeof(CandidateMv)*MAX_REF_MV_STACK_SIZE);
+
+        if (pu_ptr->merge_flag == EB_TRUE) {
+            cu_ptr->skip_flag = md_context->md_ep_pipe_sb[blk_idx].skip_cost <= md_context->md_ep_pipe_sb[blk_idx].merge_cost ? EB_TRUE : EB_FALSE;
+            pu_ptr->merge_flag = cu_ptr->skip_flag ? EB_FALSE : EB_TRUE;
+        }
+        skip = cu_ptr->skip_flag || context_ptr->md_skip_blk;
+    }
+    else {
+        context_ptr->tot_intra_coded_area += blk_geom->bwidth* blk_geom->bheight;
+        if (picture_control_set_ptr->slice_type != I_SLICE)
+            context_ptr->intra_coded_area_sb[tbAddr] += blk_geom->bwidth* blk_geom->bheight;
+
+        GeneratePuIntraLumaNeighborModes(
+            cu_ptr,
+            context_ptr->cu_origin_x,
+            context_ptr->cu_origin_y,
+            BLOCK_SIZE_64,
+            picture_control_set_ptr->ep_intra_luma_mode_neighbor_array,
+            picture_control_set_ptr->ep_intra_chroma_mode_neighbor_array,
+            picture_control_set_ptr->ep_mode_type_neighbor_array);
+    }
+
+    for (context_ptr->txb_itr = 0; context_ptr->txb_itr < tot_tu; context_ptr->txb_itr++) {
+        const uint32_t  tu = context_ptr->txb_itr;
+        TransformUnit  *txb_ptr = &cu_ptr->transform_unit_array[tu];
+        const uint8_t   uv_pass = blk_geom->has_uv && (tx_depth == 0 || tu == 0);
+        const uint16_t  txb_origin_x = context_ptr->cu_origin_x + blk_geom->tx_boff_x[tx_depth][tu];
+        const uint16_t  txb_origin_y = context_ptr->cu_origin_y + blk_geom->tx_boff_y[tx_depth][tu];
+        const uint32_t  coeff_offset[3] = {
+            md_context->md_recon_reuse_offset[blk_idx] + txb_1d_offset,
+            md_context->md_recon_reuse_offset_uv[blk_idx] + txb_1d_offset_uv,
+            md_context->md_recon_reuse_offset_uv[blk_idx] + txb_1d_offset_uv };
+        const uint32_t  coded_area[3] = {
+            context_ptr->coded_area_sb,
+            context_ptr->coded_area_sb_uv,
+            context_ptr->coded_area_sb_uv };
+        EbByte          coeff_dst[3] = {
+            coeff_buffer_sb->buffer_y,
+            coeff_buffer_sb->buffer_cb,
+            coeff_buffer_sb->buffer_cr };
+        uint16_t        eob[3] = { 0, 0, 0 };
+
+        for (int32_t plane = 0; plane < (uv_pass ? MAX_MB_PLANE : 1); ++plane) {
+            const TxSize   tx_size = plane ? blk_geom->txsize_uv[tx_depth][tu] : blk_geom->txsize[tx_depth][tu];
+            const int32_t  max_eob = av1_get_max_eob(tx_size);
+            const int32_t *coeff = md_context->md_recon_reuse_coeff[plane] + coeff_offset[plane];
+            int32_t        cul_level = 0;
+
+            eob[plane] = skip ? 0 : txb_ptr->nz_coef_count[plane];
+            if (eob[plane]) {
+                memcpy(((int32_t*)coeff_dst[plane]) + coded_area[plane], coeff, max_eob * sizeof(int32_t));
+                for (int32_t c = 0; c < max_eob; ++c)
+                    cul_level += ABS(coeff[c]);
+                cul_level = AOMMIN(COEFF_CONTEXT_MASK, cul_level);
+                set_dc_sign(&cul_level, coeff[0]);
+            }
+            cu_ptr->quantized_dc[plane][tu] = cul_level;
+            txb_ptr->nz_coef_count[plane] = eob[plane];
+        }
+        txb_ptr->y_has_coeff = eob[0] ? EB_TRUE : EB_FALSE;
+        if (uv_pass) {
+            txb_ptr->u_has_coeff = eob[1] ? EB_TRUE : EB_FALSE;
+            txb_ptr->v_has_coeff = eob[2] ? EB_TRUE : EB_FALSE;
+        }
+        if (eob[0] == 0) {
+            // INTER. Chroma follows Luma in transform type
+            txb_ptr->transform_type[PLANE_TYPE_Y] = DCT_DCT;
+            if (is_inter)
+                txb_ptr->transform_type[PLANE_TYPE_UV] = DCT_DCT;
+        }
+
+        if (picture_control_set_ptr->update_cdf && !skip) {
+            uint64_t y_tu_coeff_bits;
+            uint64_t cb_tu_coeff_bits;
+            uint64_t cr_tu_coeff_bits;
+
+            md_context->luma_txb_skip_context = 0;
+            md_context->luma_dc_sign_context = 0;
+            get_txb_ctx(
+                picture_control_set_ptr->parent_pcs_ptr->sequence_control_set_ptr,
+                COMPONENT_LUMA,
+                picture_control_set_ptr->ep_luma_dc_sign_level_coeff_neighbor_array,
+                txb_origin_x,
+                txb_origin_y,
+                blk_geom->bsize,
+                blk_geom->txsize[tx_depth][tu],
+                &md_context->luma_txb_skip_context,
+                &md_context->luma_dc_sign_context);
+            if (uv_pass) {
+                md_context->cb_txb_skip_context = 0;
+                md_context->cb_dc_sign_context = 0;
+                get_txb_ctx(
+                    picture_control_set_ptr->parent_pcs_ptr->sequence_control_set_ptr,
+                    COMPONENT_CHROMA,
+                    picture_control_set_ptr->ep_cb_dc_sign_level_coeff_neighbor_array,
+                    ROUND_UV(txb_origin_x) >> 1,
+                    ROUND_UV(txb_origin_y) >> 1,
+                    blk_geom->bsize_uv,
+                    blk_geom->txsize_uv[tx_depth][tu],
+                    &md_context->cb_txb_skip_context,
+                    &md_context->cb_dc_sign_context);
+
+                md_context->cr_txb_skip_context = 0;
+                md_context->cr_dc_sign_context = 0;
+                get_txb_ctx(
+                    picture_control_set_ptr->parent_pcs_ptr->sequence_control_set_ptr,
+                    COMPONENT_CHROMA,
+                    picture_control_set_ptr->ep_cr_dc_sign_level_coeff_neighbor_array,
+                    ROUND_UV(txb_origin_x) >> 1,
+                    ROUND_UV(txb_origin_y) >> 1,
+                    blk_geom->bsize_uv,
+                    blk_geom->txsize_uv[tx_depth][tu],
+                    &md_context->cr_txb_skip_context,
+                    &md_context->cr_dc_sign_context);
+            }
+
+            // Rate estimation function uses the values from CandidatePtr. The right values are copied from cu_ptr to CandidatePtr
+            candidate_buffer->candidate_ptr->transform_type[tu] = txb_ptr->transform_type[PLANE_TYPE_Y];
+            candidate_buffer->candidate_ptr->transform_type_uv = txb_ptr->transform_type[PLANE_TYPE_UV];
+            candidate_buffer->candidate_ptr->type = cu_ptr->prediction_mode_flag;
+            candidate_buffer->candidate_ptr->pred_mode = cu_ptr->pred_mode;
+#if FILTER_INTRA_FLAG
+            candidate_buffer->candidate_ptr->filter_intra_mode = cu_ptr->filter_intra_mode;
+#endif
+            av1_tu_estimate_coeff_bits(
+                md_context,
+                1,//allow_update_cdf,
+                &picture_control_set_ptr->ec_ctx_array[tbAddr],
+                picture_control_set_ptr,
+                candidate_buffer,
+                context_ptr->coded_area_sb,
+                context_ptr->coded_area_sb_uv,
+                coeff_est_entropy_coder_ptr,
+                coeff_buffer_sb,
+                eob[0],
+                eob[1],
+                eob[2],
+                &y_tu_coeff_bits,
+                &cb_tu_coeff_bits,
+                &cr_tu_coeff_bits,
+                blk_geom->txsize[tx_depth][tu],
+                blk_geom->txsize_uv[tx_depth][tu],
+                txb_ptr->transform_type[PLANE_TYPE_Y],
+                txb_ptr->transform_type[PLANE_TYPE_UV],
+                uv_pass ? COMPONENT_ALL : COMPONENT_LUMA);
+        }
+
+        // Update the Dc Sign Level Coeff Neighbor Arrays
+        {
+            uint8_t dcSignLevelCoeff = (uint8_t)cu_ptr->quantized_dc[0][tu];
+            neighbor_array_unit_mode_write(
+                picture_control_set_ptr->ep_luma_dc_sign_level_coeff_neighbor_array,
+                (uint8_t*)&dcSignLevelCoeff,
+                txb_origin_x,
+                txb_origin_y,
+                blk_geom->tx_width[tx_depth][tu],
+                blk_geom->tx_height[tx_depth][tu],
+                NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
+        }
+        if (uv_pass) {
+            uint8_t dcSignLevelCoeff = (uint8_t)cu_ptr->quantized_dc[1][tu];
+            neighbor_array_unit_mode_write(
+                picture_control_set_ptr->ep_cb_dc_sign_level_coeff_neighbor_array,
+                (uint8_t*)&dcSignLevelCoeff,
+                ROUND_UV(txb_origin_x) >> 1,
+                ROUND_UV(txb_origin_y) >> 1,
+                blk_geom->tx_width_uv[tx_depth][tu],
+                blk_geom->tx_height_uv[tx_depth][tu],
+                NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
+
+            dcSignLevelCoeff = (uint8_t)cu_ptr->quantized_dc[2][tu];
+            neighbor_array_unit_mode_write(
+                picture_control_set_ptr->ep_cr_dc_sign_level_coeff_neighbor_array,
+                (uint8_t*)&dcSignLevelCoeff,
+                ROUND_UV(txb_origin_x) >> 1,
+                ROUND_UV(txb_origin_y) >> 1,
+                blk_geom->tx_width_uv[tx_depth][tu],
+                blk_geom->tx_height_uv[tx_depth][tu],
+                NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
+        }
+
+        cu_ptr->block_has_coeff = cu_ptr->block_has_coeff | txb_ptr->y_has_coeff;
+        if (uv_pass)
+            cu_ptr->block_has_coeff = cu_ptr->block_has_coeff | txb_ptr->u_has_coeff | txb_ptr->v_has_coeff;
+
+        context_ptr->coded_area_sb += blk_geom->tx_width[tx_depth][tu] * blk_geom->tx_height[tx_depth][tu];
+        txb_1d_offset += blk_geom->tx_width[tx_depth][tu] * blk_geom->tx_height[tx_depth][tu];
+        if (uv_pass) {
+            context_ptr->coded_area_sb_uv += blk_geom->tx_width_uv[tx_depth][tu] * blk_geom->tx_height_uv[tx_depth][tu];
+            txb_1d_offset_uv += blk_geom->tx_width_uv[tx_depth][tu] * blk_geom->tx_height_uv[tx_depth][tu];
+        }
+    }
+
+    if (is_inter) {
+        // Force Skip if MergeFlag == TRUE && RootCbf == 0
+        if (cu_ptr->skip_flag == EB_FALSE && pu_ptr->merge_flag == EB_TRUE && cu_ptr->block_has_coeff == EB_FALSE)
+            cu_ptr->skip_flag = EB_TRUE;
+
+        // Set MvUnit
+        context_ptr->mv_unit.pred_direction = (uint8_t)pu_ptr->inter_pred_direction_index;
+        context_ptr->mv_unit.mv[REF_LIST_0].mv_union = pu_ptr->mv[REF_LIST_0].mv_union;
+        context_ptr->mv_unit.mv[REF_LIST_1].mv_union = pu_ptr->mv[REF_LIST_1].mv_union;
+
+        // Update Neighbor Arrays (Mode Type, mvs, SKIP)
+        {
+            uint8_t skip_flag = (uint8_t)cu_ptr->skip_flag;
+            EncodePassUpdateInterModeNeighborArrays(
+                picture_control_set_ptr->ep_mode_type_neighbor_array,
+                picture_control_set_ptr->ep_mv_neighbor_array,
+                picture_control_set_ptr->ep_skip_flag_neighbor_array,
+                &context_ptr->mv_unit,
+                &skip_flag,
+                context_ptr->cu_origin_x,
+                context_ptr->cu_origin_y,
+                blk_geom->bwidth,
+                blk_geom->bheight);
+        }
+    }
+    else {
+        // Update the Intra-specific Neighbor Arrays
+        EncodePassUpdateIntraModeNeighborArrays(
+            picture_control_set_ptr->ep_mode_type_neighbor_array,
+            picture_control_set_ptr->ep_intra_luma_mode_neighbor_array,
+            picture_control_set_ptr->ep_intra_chroma_mode_neighbor_array,
+            (uint8_t)cu_ptr->pred_mode,
+            (uint8_t)pu_ptr->intra_chroma_mode,
+            context_ptr->cu_origin_x,
+            context_ptr->cu_origin_y,
+            blk_geom->bwidth,
+            blk_geom->bheight,
+            blk_geom->bwidth_uv,
+            blk_geom->bheight_uv,
+            blk_geom->has_uv ? PICTURE_BUFFER_DESC_FULL_MASK : PICTURE_BUFFER_DESC_LUMA_MASK);
+    }
+
+    // Copy the MD reconstruction
+    {
+        const uint8_t *src = md_context->md_recon_reuse_recon[0] + md_context->md_recon_reuse_offset[blk_idx];
+        EbByte dst = recon_buffer->buffer_y +
+            (recon_buffer->origin_y + context_ptr->cu_origin_y) * recon_buffer->stride_y + recon_buffer->origin_x + context_ptr->cu_origin_x;
+        for (uint32_t j = 0; j < blk_geom->bheight; ++j)
+            memcpy(dst + j * recon_buffer->stride_y, src + j * blk_geom->bwidth, blk_geom->bwidth);
+    }
+    if (blk_geom->has_uv) {
+        const uint32_t round_origin_x = ROUND_UV(context_ptr->cu_origin_x) >> 1;
+        const uint32_t round_origin_y = ROUND_UV(context_ptr->cu_origin_y) >> 1;
+        const uint8_t *src_cb = md_context->md_recon_reuse_recon[1] + md_context->md_recon_reuse_offset_uv[blk_idx];
+        const uint8_t *src_cr = md_context->md_recon_reuse_recon[2] + md_context->md_recon_reuse_offset_uv[blk_idx];
+        EbByte dst_cb = recon_buffer->buffer_cb +
+            ((recon_buffer->origin_y >> 1) + round_origin_y) * recon_buffer->stride_cb + (recon_buffer->origin_x >> 1) + round_origin_x;
+        EbByte dst_cr = recon_buffer->buffer_cr +
+            ((recon_buffer->origin_y >> 1) + round_origin_y) * recon_buffer->stride_cr + (recon_buffer->origin_x >> 1) + round_origin_x;
+        for (uint32_t j = 0; j < blk_geom->bheight_uv; ++j) {
+            memcpy(dst_cb + j * recon_buffer->stride_cb, src_cb + j * blk_geom->bwidth_uv, blk_geom->bwidth_uv);
+            memcpy(dst_cr + j * recon_buffer->stride_cr, src_cr + j * blk_geom->bwidth_uv, blk_geom->bwidth_uv);
+        }
+    }
+
+    // Update Recon Samples Neighbor Arrays
+    EncodePassUpdateReconSampleNeighborArrays(
+        picture_control_set_ptr->ep_luma_recon_neighbor_array,
+        picture_control_set_ptr->ep_cb_recon_neighbor_array,
+        picture_control_set_ptr->ep_cr_recon_neighbor_array,
+        recon_buffer,
+        context_ptr->cu_origin_x,
+        context_ptr->cu_origin_y,
+        blk_geom->bwidth,
+        blk_geom->bheight,
+        blk_geom->bwidth_uv,
+        blk_geom->bheight_uv,
+        blk_geom->has_uv ? PICTURE_BUFFER_DESC_FULL_MASK : PICTURE_BUFFER_DESC_LUMA_MASK,
+        EB_FALSE);
+}
+
 /*******************************************
 * Encode Pass
 *
@@ -2389,7 +2721,16 @@ EB_EXTERN void av1_encode_pass(
                 }
 
 
-                if (cu_ptr->prediction_mode_flag == INTRA_MODE) {
+                if (mdcontextPtr->md_recon_reuse)
+                    md_recon_reuse_commit(
+                        picture_control_set_ptr,
+                        sb_ptr,
+                        tbAddr,
+                        cu_ptr,
+                        context_ptr,
+                        recon_buffer,
+                        coeff_buffer_sb);
+                else if (cu_ptr->prediction_mode_flag == INTRA_MODE) {
                     context_ptr->is_inter = cu_ptr->av1xd->use_intrabc;
                     context_ptr->tot_intra_coded_area += blk_geom->bwidth* blk_geom->bheight;
                     if (picture_control_set_ptr->slice_type != I_SLICE)
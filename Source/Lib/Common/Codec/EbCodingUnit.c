@@ -11,13 +11,26 @@
 #include "EbTransformUnit.h"
 #include "EbPictureControlSet.h"
 
-void largest_coding_unit_dctor(EbPtr p)
+/*****************************************
+ * largest_coding_unit_arena_size
+ *  Arena bytes largest_coding_unit_ctor
+ *  carves for one SB.
+ *****************************************/
+size_t largest_coding_unit_arena_size(
+    uint8_t                        sb_size_pix,
+    EbColorFormat                  color_format)
 {
-    LargestCodingUnit* obj = (LargestCodingUnit*)p;
-    EB_DELETE(obj->quantized_coeff);
-    EB_FREE_ARRAY(obj->av1xd);
-    EB_FREE_ARRAY(obj->final_cu_arr);
-    EB_FREE_ARRAY(obj->cu_partition_array);
+    const uint32_t tot_cu_num = sb_size_pix == 128 ? 1024 : 256;
+    const uint32_t max_block_count = sb_size_pix == 128 ? BLOCK_MAX_COUNT_SB_128 : BLOCK_MAX_COUNT_SB_64;
+    const uint32_t luma_size = SB_STRIDE_Y * SB_STRIDE_Y;
+
+    return EB_ARENA_SIZE(LargestCodingUnit, 1) +
+        EB_ARENA_SIZE(CodingUnit, tot_cu_num) +
+        EB_ARENA_SIZE(MacroBlockD, tot_cu_num) +
+        EB_ARENA_SIZE(PartitionType, max_block_count) +
+        EB_ARENA_SIZE(EbPictureBufferDesc, 1) +
+        EB_ARENA_SIZE(int32_t, luma_size) +
+        2 * EB_ARENA_SIZE(int32_t, luma_size >> (3 - color_format));
 }
 /*
 Tasks & Questions
@@ -40,7 +53,10 @@ EbErrorType largest_coding_unit_ctor(
     uint32_t tu_index;
     EbPictureBufferDescInitData coeffInitData;
 
-    larget_coding_unit_ptr->dctor = largest_coding_unit_dctor;
+    EbArena *arena = picture_control_set->arena;
+
+    // All the SB arrays live in the PCS arena
+    larget_coding_unit_ptr->dctor = NULL;
 
     // ************ SB ***************
         // Which borderLargestCuSize is not a power of two
@@ -57,8 +73,8 @@ EbErrorType largest_coding_unit_ctor(
     uint32_t  tot_cu_num = sb_size_pix == 128 ? 1024 : 256;
     larget_coding_unit_ptr->final_cu_count = tot_cu_num;
 
-    EB_MALLOC_ARRAY(larget_coding_unit_ptr->final_cu_arr, tot_cu_num);
-    EB_MALLOC_ARRAY(larget_coding_unit_ptr->av1xd, tot_cu_num);
+    EB_ARENA_MALLOC_ARRAY(arena, larget_coding_unit_ptr->final_cu_arr, tot_cu_num);
+    EB_ARENA_MALLOC_ARRAY(arena, larget_coding_unit_ptr->av1xd, tot_cu_num);
 
     for (cu_i = 0; cu_i < tot_cu_num; ++cu_i) {
         for (tu_index = 0; tu_index < TRANSFORM_UNIT_MAX_COUNT; ++tu_index)
@@ -69,7 +85,7 @@ EbErrorType largest_coding_unit_ctor(
 
     uint32_t  max_block_count = sb_size_pix == 128 ? BLOCK_MAX_COUNT_SB_128 : BLOCK_MAX_COUNT_SB_64;
 
-    EB_MALLOC_ARRAY(larget_coding_unit_ptr->cu_partition_array, max_block_count);
+    EB_ARENA_MALLOC_ARRAY(arena, larget_coding_unit_ptr->cu_partition_array, max_block_count);
 
     coeffInitData.buffer_enable_mask = PICTURE_BUFFER_DESC_FULL_MASK;
     coeffInitData.max_width = SB_STRIDE_Y;
@@ -82,10 +98,10 @@ EbErrorType largest_coding_unit_ctor(
     coeffInitData.bot_padding = 0;
     coeffInitData.split_mode = EB_FALSE;
 
-    EB_NEW(
-        larget_coding_unit_ptr->quantized_coeff,
-        eb_picture_buffer_desc_ctor,
-        (EbPtr)&coeffInitData);
+    EB_ARENA_CALLOC_ARRAY(arena, larget_coding_unit_ptr->quantized_coeff, 1);
 
-    return EB_ErrorNone;
+    return eb_picture_buffer_desc_arena_ctor(
+        larget_coding_unit_ptr->quantized_coeff,
+        (EbPtr)&coeffInitData,
+        arena);
 }
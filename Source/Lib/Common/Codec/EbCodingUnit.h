@@ -590,6 +590,10 @@ extern "C" {
         TileInfo tile_info;
     } LargestCodingUnit;
 
+    extern size_t largest_coding_unit_arena_size(
+        uint8_t                        sb_sz,
+        EbColorFormat                  color_format);
+
     extern EbErrorType largest_coding_unit_ctor(
         LargestCodingUnit             *larget_coding_unit_ptr,
         uint8_t                        sb_sz,
@@ -114,6 +114,10 @@ extern "C" {
 //FOR DEBUGGING - Do not remove
 #define NO_ENCDEC                         0 // bypass encDec to test cmpliance of MD. complained achieved when skip_flag is OFF. Port sample code from VCI-SW_AV1_Candidate1 branch
 
+#ifndef LOCK_FREE_FIFO
+#define LOCK_FREE_FIFO                    0 // Lock-free MPMC rings with spin-then-park waiting for the system resource queues (cmake -DLOCK_FREE_FIFO=ON)
+#endif
+
 #define ADP_STATS_PER_LAYER                             0
 #define AOM_INTERP_EXTEND                               4
 #define OPTIMISED_EX_SUBPEL                             1
@@ -139,9 +139,11 @@ extern "C" {
         EbBool                   is16bit,
         EbColorFormat            color_format,
         uint8_t                  enable_hbd_mode_decision,
+        uint8_t                  md_recon_reuse,
         uint32_t                 max_input_luma_width,
         uint32_t                 max_input_luma_height);
 
+    extern void enc_dec_task(void *input_ptr, EbObjectWrapper *input_wrapper_ptr);
     extern void* enc_dec_kernel(void *input_ptr);
 
 #ifdef __cplusplus
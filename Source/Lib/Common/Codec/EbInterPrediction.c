@@ -2314,7 +2314,7 @@ static void model_rd_with_curvfit(
 #else
     int32_t current_q_index = picture_control_set_ptr->parent_pcs_ptr->frm_hdr.quantization_params.base_q_idx;
 #endif
-    Dequants *const dequants = &picture_control_set_ptr->parent_pcs_ptr->deq;
+    Dequants *const dequants = picture_control_set_ptr->parent_pcs_ptr->deq;
     int16_t quantizer = dequants->y_dequant_Q3[current_q_index][1];
 
     const int qstep = AOMMAX(quantizer >> dequant_shift, 1);
@@ -6966,7 +6966,7 @@ extern void model_rd_for_sb(
 
         int32_t current_q_index = picture_control_set_ptr->
             parent_pcs_ptr->frm_hdr.quantization_params.base_q_idx;
-        Dequants *const dequants = &picture_control_set_ptr->parent_pcs_ptr->deq;
+        Dequants *const dequants = picture_control_set_ptr->parent_pcs_ptr->deq;
 
         int16_t quantizer = dequants->y_dequant_Q3[current_q_index][1];
         model_rd_from_sse(
@@ -316,6 +316,79 @@ static void print_top_10_locations() {
 }
 #endif //PROFILE_MEMORY_USAGE
 
+#ifdef __linux__
+#include <unistd.h>
+#include <sys/syscall.h>
+
+#define NUMA_MAX_NODES   64
+#define NUMA_QUERY_PAGES 1024
+
+typedef struct NumaSummary {
+    uint64_t pages[NUMA_MAX_NODES];
+    uint64_t untouched;
+    uint64_t page_size;
+    EbBool   supported;
+} NumaSummary;
+
+//node of the pages of an allocation, small ones share pages so only the
+//allocations of a page or more are counted
+static EbBool count_numa_pages(MemoryEntry* e, void* param)
+{
+    NumaSummary* sum = (NumaSummary*)param;
+    void* pages[NUMA_QUERY_PAGES];
+    int status[NUMA_QUERY_PAGES];
+    if (!e->ptr || e->type > EB_A_PTR || e->count < sum->page_size)
+        return EB_FALSE;
+
+    uint64_t page = (uint64_t)(uintptr_t)e->ptr & ~(sum->page_size - 1);
+    const uint64_t end = (uint64_t)(uintptr_t)e->ptr + e->count;
+    while (page < end) {
+        unsigned long count = 0;
+        for (; count < NUMA_QUERY_PAGES && page < end; count++, page += sum->page_size)
+            pages[count] = (void*)(uintptr_t)page;
+        //move_pages without target nodes only reports where the pages are
+        if (syscall(SYS_move_pages, 0, count, pages, NULL, status, 0) != 0) {
+            sum->supported = EB_FALSE;
+            return EB_TRUE;
+        }
+        for (unsigned long i = 0; i < count; i++) {
+            if (status[i] >= 0 && status[i] < NUMA_MAX_NODES)
+                sum->pages[status[i]]++;
+            else
+                sum->untouched++;
+        }
+    }
+    return EB_FALSE;
+}
+
+//pages of the library on each NUMA node, and the ones remote to the calling
+//thread, which runs where the encoder threads run
+static void print_numa_usage()
+{
+    NumaSummary sum;
+    unsigned int cpu, node;
+    uint64_t total = 0;
+    memset(&sum, 0, sizeof(NumaSummary));
+    sum.page_size = (uint64_t)sysconf(_SC_PAGESIZE);
+    sum.supported = EB_TRUE;
+    if (syscall(SYS_getcpu, &cpu, &node, NULL) != 0 || node >= NUMA_MAX_NODES)
+        return;
+
+    for_each_mem_entry(0, count_numa_pages, &sum);
+    if (!sum.supported)
+        return;
+    printf("    numa pages (node %u is local):\r\n", node);
+    for (unsigned int i = 0; i < NUMA_MAX_NODES; i++) {
+        if (sum.pages[i]) {
+            printf("        node %u: %" PRIu64 "\r\n", i, sum.pages[i]);
+            total += sum.pages[i];
+        }
+    }
+    printf("        cross node: %" PRIu64 " of %" PRIu64 ", untouched: %" PRIu64 "\r\n",
+        total - sum.pages[node], total, sum.untouched);
+}
+#endif //__linux__
+
 static int g_component_count;
 
 #endif //DEBUG_MEMORY_USAGE
@@ -345,6 +418,9 @@ void eb_print_memory_usage()
     printf("    thread count: %d\r\n", (int)sum.amount[EB_THREAD]);
     fulless = (double)sum.occupied / MEM_ENTRY_SIZE;
     printf("    hash table fulless: %f, hash bucket is %s\r\n", fulless, fulless < .3 ? "healthy":"too full" );
+#ifdef __linux__
+    print_numa_usage();
+#endif
 #ifdef PROFILE_MEMORY_USAGE
     print_top_10_locations();
 #endif
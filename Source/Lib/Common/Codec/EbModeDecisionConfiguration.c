@@ -770,31 +770,31 @@ int32_t mdc_av1_quantize_inv_quantize(
     uint32_t qIndex = picture_control_set_ptr->parent_pcs_ptr->delta_q_present_flag ? quantizer_to_qindex[qp] : picture_control_set_ptr->parent_pcs_ptr->base_qindex;
 #endif
     if (component_type == COMPONENT_LUMA) {
-        candidate_plane.quant_QTX = picture_control_set_ptr->parent_pcs_ptr->quantsMd.y_quant[qIndex];
-        candidate_plane.quant_fp_QTX = picture_control_set_ptr->parent_pcs_ptr->quantsMd.y_quant_fp[qIndex];
-        candidate_plane.round_fp_QTX = picture_control_set_ptr->parent_pcs_ptr->quantsMd.y_round_fp[qIndex];
-        candidate_plane.quant_shift_QTX = picture_control_set_ptr->parent_pcs_ptr->quantsMd.y_quant_shift[qIndex];
-        candidate_plane.zbin_QTX = picture_control_set_ptr->parent_pcs_ptr->quantsMd.y_zbin[qIndex];
-        candidate_plane.round_QTX = picture_control_set_ptr->parent_pcs_ptr->quantsMd.y_round[qIndex];
-        candidate_plane.dequant_QTX = picture_control_set_ptr->parent_pcs_ptr->deqMd.y_dequant_QTX[qIndex];
+        candidate_plane.quant_QTX = picture_control_set_ptr->parent_pcs_ptr->quantsMd->y_quant[qIndex];
+        candidate_plane.quant_fp_QTX = picture_control_set_ptr->parent_pcs_ptr->quantsMd->y_quant_fp[qIndex];
+        candidate_plane.round_fp_QTX = picture_control_set_ptr->parent_pcs_ptr->quantsMd->y_round_fp[qIndex];
+        candidate_plane.quant_shift_QTX = picture_control_set_ptr->parent_pcs_ptr->quantsMd->y_quant_shift[qIndex];
+        candidate_plane.zbin_QTX = picture_control_set_ptr->parent_pcs_ptr->quantsMd->y_zbin[qIndex];
+        candidate_plane.round_QTX = picture_control_set_ptr->parent_pcs_ptr->quantsMd->y_round[qIndex];
+        candidate_plane.dequant_QTX = picture_control_set_ptr->parent_pcs_ptr->deqMd->y_dequant_QTX[qIndex];
     }
     if (component_type == COMPONENT_CHROMA_CB) {
-        candidate_plane.quant_QTX = picture_control_set_ptr->parent_pcs_ptr->quantsMd.u_quant[qIndex];
-        candidate_plane.quant_fp_QTX = picture_control_set_ptr->parent_pcs_ptr->quantsMd.u_quant_fp[qIndex];
-        candidate_plane.round_fp_QTX = picture_control_set_ptr->parent_pcs_ptr->quantsMd.u_round_fp[qIndex];
-        candidate_plane.quant_shift_QTX = picture_control_set_ptr->parent_pcs_ptr->quantsMd.u_quant_shift[qIndex];
-        candidate_plane.zbin_QTX = picture_control_set_ptr->parent_pcs_ptr->quantsMd.u_zbin[qIndex];
-        candidate_plane.round_QTX = picture_control_set_ptr->parent_pcs_ptr->quantsMd.u_round[qIndex];
-        candidate_plane.dequant_QTX = picture_control_set_ptr->parent_pcs_ptr->deqMd.u_dequant_QTX[qIndex];
+        candidate_plane.quant_QTX = picture_control_set_ptr->parent_pcs_ptr->quantsMd->u_quant[qIndex];
+        candidate_plane.quant_fp_QTX = picture_control_set_ptr->parent_pcs_ptr->quantsMd->u_quant_fp[qIndex];
+        candidate_plane.round_fp_QTX = picture_control_set_ptr->parent_pcs_ptr->quantsMd->u_round_fp[qIndex];
+        candidate_plane.quant_shift_QTX = picture_control_set_ptr->parent_pcs_ptr->quantsMd->u_quant_shift[qIndex];
+        candidate_plane.zbin_QTX = picture_control_set_ptr->parent_pcs_ptr->quantsMd->u_zbin[qIndex];
+        candidate_plane.round_QTX = picture_control_set_ptr->parent_pcs_ptr->quantsMd->u_round[qIndex];
+        candidate_plane.dequant_QTX = picture_control_set_ptr->parent_pcs_ptr->deqMd->u_dequant_QTX[qIndex];
     }
     if (component_type == COMPONENT_CHROMA_CR) {
-        candidate_plane.quant_QTX = picture_control_set_ptr->parent_pcs_ptr->quantsMd.v_quant[qIndex];
-        candidate_plane.quant_fp_QTX = picture_control_set_ptr->parent_pcs_ptr->quantsMd.v_quant_fp[qIndex];
-        candidate_plane.round_fp_QTX = picture_control_set_ptr->parent_pcs_ptr->quantsMd.v_round_fp[qIndex];
-        candidate_plane.quant_shift_QTX = picture_control_set_ptr->parent_pcs_ptr->quantsMd.v_quant_shift[qIndex];
-        candidate_plane.zbin_QTX = picture_control_set_ptr->parent_pcs_ptr->quantsMd.v_zbin[qIndex];
-        candidate_plane.round_QTX = picture_control_set_ptr->parent_pcs_ptr->quantsMd.v_round[qIndex];
-        candidate_plane.dequant_QTX = picture_control_set_ptr->parent_pcs_ptr->deqMd.v_dequant_QTX[qIndex];
+        candidate_plane.quant_QTX = picture_control_set_ptr->parent_pcs_ptr->quantsMd->v_quant[qIndex];
+        candidate_plane.quant_fp_QTX = picture_control_set_ptr->parent_pcs_ptr->quantsMd->v_quant_fp[qIndex];
+        candidate_plane.round_fp_QTX = picture_control_set_ptr->parent_pcs_ptr->quantsMd->v_round_fp[qIndex];
+        candidate_plane.quant_shift_QTX = picture_control_set_ptr->parent_pcs_ptr->quantsMd->v_quant_shift[qIndex];
+        candidate_plane.zbin_QTX = picture_control_set_ptr->parent_pcs_ptr->quantsMd->v_zbin[qIndex];
+        candidate_plane.round_QTX = picture_control_set_ptr->parent_pcs_ptr->quantsMd->v_round[qIndex];
+        candidate_plane.dequant_QTX = picture_control_set_ptr->parent_pcs_ptr->deqMd->v_dequant_QTX[qIndex];
     }
     const ScanOrder *const scan_order = &av1_scan_orders[txsize][tx_type];
 
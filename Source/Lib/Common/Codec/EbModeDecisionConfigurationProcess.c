@@ -2983,33 +2983,16 @@ void* mode_decision_configuration_kernel(void *input_ptr)
         eb_av1_qm_init(
             picture_control_set_ptr->parent_pcs_ptr);
 
-        Quants *const quants = &picture_control_set_ptr->parent_pcs_ptr->quants;
-        Dequants *const dequants = &picture_control_set_ptr->parent_pcs_ptr->deq;
-
         eb_av1_set_quantizer(
             picture_control_set_ptr->parent_pcs_ptr,
             frm_hdr->quantization_params.base_q_idx);
-        eb_av1_build_quantizer(
-            (AomBitDepth)sequence_control_set_ptr->static_config.encoder_bit_depth,
-            frm_hdr->quantization_params.delta_q_y_dc,
-            frm_hdr->quantization_params.delta_q_u_dc,
-            frm_hdr->quantization_params.delta_q_u_ac,
-            frm_hdr->quantization_params.delta_q_v_dc,
-            frm_hdr->quantization_params.delta_q_v_ac,
-            quants,
-            dequants);
-
-        Quants *const quantsMd = &picture_control_set_ptr->parent_pcs_ptr->quantsMd;
-        Dequants *const dequantsMd = &picture_control_set_ptr->parent_pcs_ptr->deqMd;
-        eb_av1_build_quantizer(
-            picture_control_set_ptr->hbd_mode_decision ? AOM_BITS_10 : AOM_BITS_8,
-            frm_hdr->quantization_params.delta_q_y_dc,
-            frm_hdr->quantization_params.delta_q_u_dc,
-            frm_hdr->quantization_params.delta_q_u_ac,
-            frm_hdr->quantization_params.delta_q_v_dc,
-            frm_hdr->quantization_params.delta_q_v_ac,
-            quantsMd,
-            dequantsMd);
+
+        // The delta q are 0, the quantizer tables only depend on the bit depth
+        // and are built once per process (see quants_bd)
+        picture_control_set_ptr->parent_pcs_ptr->quants = sequence_control_set_ptr->quants_bd[sequence_control_set_ptr->static_config.encoder_bit_depth > EB_8BIT];
+        picture_control_set_ptr->parent_pcs_ptr->deq = sequence_control_set_ptr->deq_bd[sequence_control_set_ptr->static_config.encoder_bit_depth > EB_8BIT];
+        picture_control_set_ptr->parent_pcs_ptr->quantsMd = sequence_control_set_ptr->quants_bd[picture_control_set_ptr->hbd_mode_decision ? 1 : 0];
+        picture_control_set_ptr->parent_pcs_ptr->deqMd = sequence_control_set_ptr->deq_bd[picture_control_set_ptr->hbd_mode_decision ? 1 : 0];
 
         // Hsan: collapse spare code
         MdRateEstimationContext   *md_rate_estimation_array;
@@ -87,6 +87,12 @@ static void mode_decision_context_dctor(EbPtr p)
         }
     }
 
+    EB_FREE_ARRAY(obj->md_recon_reuse_offset);
+    EB_FREE_ARRAY(obj->md_recon_reuse_offset_uv);
+    for (int plane = 0; plane < MAX_MB_PLANE; plane++) {
+        EB_FREE_ARRAY(obj->md_recon_reuse_coeff[plane]);
+        EB_FREE_ARRAY(obj->md_recon_reuse_recon[plane]);
+    }
     EB_FREE_ARRAY(obj->md_local_cu_unit);
     EB_FREE_ARRAY(obj->md_cu_arr_nsq);
     EB_FREE_ARRAY(obj->md_ep_pipe_sb);
@@ -100,7 +106,8 @@ EbErrorType mode_decision_context_ctor(
     EbColorFormat         color_format,
     EbFifo                *mode_decision_configuration_input_fifo_ptr,
     EbFifo                *mode_decision_output_fifo_ptr,
-    uint8_t                enable_hbd_mode_decision
+    uint8_t                enable_hbd_mode_decision,
+    uint8_t                md_recon_reuse
 #if PAL_SUP
     ,uint8_t                 cfg_palette
 #endif
@@ -145,6 +152,35 @@ EbErrorType mode_decision_context_ctor(
     EB_MALLOC_ARRAY(context_ptr->md_cu_arr_nsq, BLOCK_MAX_COUNT_SB_128);
     EB_MALLOC_ARRAY(context_ptr->md_ep_pipe_sb, BLOCK_MAX_COUNT_SB_128);
 
+    // MD recon reuse pool: one slot per block of the SB, packed back to back
+    if (md_recon_reuse) {
+        uint32_t luma_size = 0, chroma_size = 0;
+        EB_MALLOC_ARRAY(context_ptr->md_recon_reuse_offset, BLOCK_MAX_COUNT_SB_128);
+        EB_MALLOC_ARRAY(context_ptr->md_recon_reuse_offset_uv, BLOCK_MAX_COUNT_SB_128);
+        for (uint32_t blk_index = 0; blk_index < BLOCK_MAX_COUNT_SB_128; ++blk_index) {
+            const BlockGeom *blk_geom = get_blk_geom_mds(blk_index);
+            context_ptr->md_recon_reuse_offset[blk_index] = luma_size;
+            context_ptr->md_recon_reuse_offset_uv[blk_index] = chroma_size;
+            luma_size += blk_geom->bwidth * blk_geom->bheight;
+            if (blk_geom->has_uv)
+                chroma_size += blk_geom->bwidth_uv * blk_geom->bheight_uv;
+        }
+        for (int plane = 0; plane < MAX_MB_PLANE; plane++) {
+            const uint32_t plane_size = plane ? chroma_size : luma_size;
+            EB_MALLOC_ARRAY(context_ptr->md_recon_reuse_coeff[plane], plane_size);
+            EB_MALLOC_ARRAY(context_ptr->md_recon_reuse_recon[plane], plane_size);
+        }
+    }
+    else {
+        context_ptr->md_recon_reuse_offset = NULL;
+        context_ptr->md_recon_reuse_offset_uv = NULL;
+        for (int plane = 0; plane < MAX_MB_PLANE; plane++) {
+            context_ptr->md_recon_reuse_coeff[plane] = NULL;
+            context_ptr->md_recon_reuse_recon[plane] = NULL;
+        }
+    }
+    context_ptr->md_recon_reuse = 0;
+
     // Fast Candidate Array
     EB_MALLOC_ARRAY(context_ptr->fast_candidate_array, MODE_DECISION_CANDIDATE_MAX_COUNT);
 
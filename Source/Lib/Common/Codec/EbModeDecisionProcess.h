@@ -362,6 +362,13 @@ extern "C" {
     // square cost weighting for deciding if a/b shapes could be skipped
     uint32_t sq_weight;
 #endif
+    // MD recon reuse: quantized coefficients and reconstruction of each block
+    // winner, committed by the encode pass instead of being recomputed
+    uint8_t                             md_recon_reuse;
+    uint32_t                           *md_recon_reuse_offset;
+    uint32_t                           *md_recon_reuse_offset_uv;
+    int32_t                            *md_recon_reuse_coeff[MAX_MB_PLANE];
+    uint8_t                            *md_recon_reuse_recon[MAX_MB_PLANE];
     } ModeDecisionContext;
 
     typedef void(*EbAv1LambdaAssignFunc)(
@@ -391,7 +398,8 @@ extern "C" {
         EbColorFormat              color_format,
         EbFifo                    *mode_decision_configuration_input_fifo_ptr,
         EbFifo                    *mode_decision_output_fifo_ptr,
-        uint8_t                    enable_hbd_mode_decision
+        uint8_t                    enable_hbd_mode_decision,
+        uint8_t                    md_recon_reuse
 #if PAL_SUP
         ,uint8_t                 cfg_palette
 #endif
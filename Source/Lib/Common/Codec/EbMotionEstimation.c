@@ -4057,6 +4057,143 @@ static void GetEightHorizontalSearchPointResultsAll85PUs(
                    currMV);
 }
 
+/*******************************************
+ * generate_sb_block_sums
+ *   sums of the even and odd rows of the 8x8
+ *   blocks of the SB, in the order of the 8x8 PUs
+ *******************************************/
+static void generate_sb_block_sums(MeContext *context_ptr) {
+    uint32_t block_index;
+    uint32_t row;
+
+    for (block_index = 0; block_index < 64; block_index++) {
+        const uint32_t x8 = ((block_index >> 4) & 1) * 4 + ((block_index >> 2) & 1) * 2 + (block_index & 1);
+        const uint32_t y8 = (block_index >> 5) * 4 + ((block_index >> 3) & 1) * 2 + ((block_index >> 1) & 1);
+        const uint8_t *src = context_ptr->sb_src_ptr + (y8 << 3) * context_ptr->sb_src_stride + (x8 << 3);
+        uint16_t sum[2] = { 0, 0 };
+        for (row = 0; row < 8; row++) {
+            const uint8_t *src_row = src + row * context_ptr->sb_src_stride;
+            sum[row & 1] += src_row[0] + src_row[1] + src_row[2] + src_row[3] +
+                src_row[4] + src_row[5] + src_row[6] + src_row[7];
+        }
+        context_ptr->sb_block_sum[0][block_index] = sum[0];
+        context_ptr->sb_block_sum[1][block_index] = sum[1];
+    }
+}
+
+/*******************************************
+ * successive_elimination_skip
+ *   EB_TRUE when the search position can not
+ *   improve the best SAD of any PU: the lower
+ *   bound |sum(src) - sum(ref)| of the SAD of each
+ *   8x8 block, summed over the 8x8 blocks of the
+ *   PU, is not below the best SAD of the PU
+ *******************************************/
+static EbBool successive_elimination_skip(
+    MeContext      *context_ptr,
+    const uint16_t *ref_block_sum,  // input parameter, block sums at the search position
+    uint32_t        ref_block_sum_stride,
+    EbBool          sub_sad,        // input parameter, SADs of the even rows only
+    EbBool          nsq)            // input parameter, check the non-square PUs
+{
+    uint32_t lb8x8[64];
+    uint32_t lb16x16[16];
+    uint32_t lb32x32[4];
+    uint32_t lb64x64;
+    uint32_t block_index;
+
+    // 8x8, in the order of the 16x16 and 32x32 they belong to
+    for (block_index = 0; block_index < 64; block_index++) {
+        const uint32_t x8 = ((block_index >> 4) & 1) * 4 + ((block_index >> 2) & 1) * 2 + (block_index & 1);
+        const uint32_t y8 = (block_index >> 5) * 4 + ((block_index >> 3) & 1) * 2 + ((block_index >> 1) & 1);
+        const uint16_t *sum = &ref_block_sum[(y8 << 3) * ref_block_sum_stride + (x8 << 3)];
+        const int32_t src_sum = sub_sad
+            ? context_ptr->sb_block_sum[0][block_index]
+            : context_ptr->sb_block_sum[0][block_index] + context_ptr->sb_block_sum[1][block_index];
+        const int32_t ref_sum = sub_sad ? sum[0] : sum[0] + sum[ref_block_sum_stride];
+        lb8x8[block_index] = (uint32_t)ABS(src_sum - ref_sum) << (sub_sad ? 1 : 0);
+        if (lb8x8[block_index] < context_ptr->p_best_sad8x8[block_index])
+            return EB_FALSE;
+    }
+    for (block_index = 0; block_index < 16; block_index++) {
+        lb16x16[block_index] = lb8x8[4 * block_index] + lb8x8[4 * block_index + 1] +
+            lb8x8[4 * block_index + 2] + lb8x8[4 * block_index + 3];
+        if (lb16x16[block_index] < context_ptr->p_best_sad16x16[block_index])
+            return EB_FALSE;
+    }
+    for (block_index = 0; block_index < 4; block_index++) {
+        lb32x32[block_index] = lb16x16[4 * block_index] + lb16x16[4 * block_index + 1] +
+            lb16x16[4 * block_index + 2] + lb16x16[4 * block_index + 3];
+        if (lb32x32[block_index] < context_ptr->p_best_sad32x32[block_index])
+            return EB_FALSE;
+    }
+    lb64x64 = lb32x32[0] + lb32x32[1] + lb32x32[2] + lb32x32[3];
+    if (lb64x64 < context_ptr->p_best_sad64x64[0])
+        return EB_FALSE;
+
+    if (nsq) {
+        uint32_t lb16x8[32], lb8x16[32], lb32x16[8], lb16x32[8];
+        // Same composition of the 8x8, 16x16 and 32x32 as ext_eigth_sad_calculation_nsq
+        for (block_index = 0; block_index < 2; block_index++) {
+            if (lb32x32[2 * block_index] + lb32x32[2 * block_index + 1] < context_ptr->p_best_sad64x32[block_index] ||
+                lb32x32[block_index] + lb32x32[block_index + 2] < context_ptr->p_best_sad32x64[block_index])
+                return EB_FALSE;
+        }
+        for (block_index = 0; block_index < 8; block_index++) {
+            const uint32_t vertical_index = (block_index >> 1) * 4 + (block_index & 1);
+            lb32x16[block_index] = lb16x16[2 * block_index] + lb16x16[2 * block_index + 1];
+            lb16x32[block_index] = lb16x16[vertical_index] + lb16x16[vertical_index + 2];
+            if (lb32x16[block_index] < context_ptr->p_best_sad32x16[block_index] ||
+                lb16x32[block_index] < context_ptr->p_best_sad16x32[block_index])
+                return EB_FALSE;
+        }
+        for (block_index = 0; block_index < 4; block_index++) {
+            const uint32_t horizontal_index = (block_index >> 1) * 4 + (block_index & 1);
+            if (lb32x16[horizontal_index] + lb32x16[horizontal_index + 2] < context_ptr->p_best_sad64x16[block_index] ||
+                lb16x32[block_index] + lb16x32[block_index + 4] < context_ptr->p_best_sad16x64[block_index])
+                return EB_FALSE;
+        }
+        for (block_index = 0; block_index < 32; block_index++) {
+            const uint32_t vertical_index = (block_index >> 1) * 4 + (block_index & 1);
+            lb16x8[block_index] = lb8x8[2 * block_index] + lb8x8[2 * block_index + 1];
+            lb8x16[block_index] = lb8x8[vertical_index] + lb8x8[vertical_index + 2];
+            if (lb16x8[block_index] < context_ptr->p_best_sad16x8[block_index] ||
+                lb8x16[block_index] < context_ptr->p_best_sad8x16[block_index])
+                return EB_FALSE;
+        }
+        for (block_index = 0; block_index < 16; block_index++) {
+            const uint32_t horizontal_index = (block_index >> 1) * 4 + (block_index & 1);
+            const uint32_t vertical_index = (block_index >> 2) * 8 + (block_index & 3);
+            if (lb16x8[horizontal_index] + lb16x8[horizontal_index + 2] < context_ptr->p_best_sad32x8[block_index] ||
+                lb8x16[vertical_index] + lb8x16[vertical_index + 4] < context_ptr->p_best_sad8x32[block_index])
+                return EB_FALSE;
+        }
+    }
+    return EB_TRUE;
+}
+
+/*******************************************
+ * successive_elimination_skip_eight
+ *   EB_TRUE when none of the eight horizontal
+ *   search positions can improve the best SADs
+ *******************************************/
+static EbBool successive_elimination_skip_eight(
+    MeContext      *context_ptr,
+    const uint16_t *ref_block_sum,
+    uint32_t        ref_block_sum_stride,
+    EbBool          sub_sad,
+    EbBool          nsq)
+{
+    uint32_t search_index;
+
+    for (search_index = 0; search_index < 8; search_index++) {
+        if (!successive_elimination_skip(
+                context_ptr, ref_block_sum + search_index, ref_block_sum_stride, sub_sad, nsq))
+            return EB_FALSE;
+    }
+    return EB_TRUE;
+}
+
 /*******************************************
  * FullPelSearch_LCU
  *******************************************/
@@ -4065,8 +4202,12 @@ static void FullPelSearch_LCU(MeContext *context_ptr, uint32_t listIndex,
                               int16_t x_search_area_origin,
                               int16_t y_search_area_origin,
                               uint32_t search_area_width,
-                              uint32_t search_area_height)
+                              uint32_t search_area_height,
+                              const uint16_t *ref_block_sum)
 {
+    const EbBool sub_sad = (context_ptr->me_search_method == SUB_SAD_SEARCH);
+    const uint32_t ref_stride =
+        context_ptr->interpolated_full_stride[listIndex][ref_pic_index];
     uint32_t xSearchIndex, ySearchIndex;
 
     uint32_t searchAreaWidthRest8 = search_area_width & 7;
@@ -4075,6 +4216,14 @@ static void FullPelSearch_LCU(MeContext *context_ptr, uint32_t listIndex,
     for (ySearchIndex = 0; ySearchIndex < search_area_height; ySearchIndex++) {
         for (xSearchIndex = 0; xSearchIndex < searchAreaWidthMult8;
              xSearchIndex += 8) {
+            if (ref_block_sum &&
+                successive_elimination_skip_eight(
+                    context_ptr,
+                    ref_block_sum + xSearchIndex + ySearchIndex * ref_stride,
+                    ref_stride,
+                    sub_sad,
+                    EB_FALSE))
+                continue;
             // this function will do:  xSearchIndex, +1, +2, ..., +7
             GetEightHorizontalSearchPointResultsAll85PUs(
                 context_ptr,
@@ -4091,6 +4240,14 @@ static void FullPelSearch_LCU(MeContext *context_ptr, uint32_t listIndex,
         for (xSearchIndex = searchAreaWidthMult8;
              xSearchIndex < search_area_width;
              xSearchIndex++) {
+            if (ref_block_sum &&
+                successive_elimination_skip(
+                    context_ptr,
+                    ref_block_sum + xSearchIndex + ySearchIndex * ref_stride,
+                    ref_stride,
+                    sub_sad,
+                    EB_FALSE))
+                continue;
             GetSearchPointResults(
                 context_ptr,
                 listIndex,
@@ -5670,8 +5827,12 @@ static void open_loop_me_fullpel_search_sblock(
     MeContext *context_ptr, uint32_t listIndex,
     uint32_t ref_pic_index,
     int16_t x_search_area_origin, int16_t y_search_area_origin,
-    uint32_t search_area_width, uint32_t search_area_height)
+    uint32_t search_area_width, uint32_t search_area_height,
+    const uint16_t *ref_block_sum)
 {
+    const EbBool sub_sad = (context_ptr->me_search_method == SUB_SAD_SEARCH);
+    const uint32_t ref_stride =
+        context_ptr->interpolated_full_stride[listIndex][ref_pic_index];
     uint32_t xSearchIndex, ySearchIndex;
     uint32_t searchAreaWidthRest8 = search_area_width & 7;
     uint32_t searchAreaWidthMult8 = search_area_width - searchAreaWidthRest8;
@@ -5679,6 +5840,15 @@ static void open_loop_me_fullpel_search_sblock(
     for (ySearchIndex = 0; ySearchIndex < search_area_height; ySearchIndex++) {
         for (xSearchIndex = 0; xSearchIndex < searchAreaWidthMult8;
              xSearchIndex += 8) {
+            // The eight positions are searched with the SAD of all the rows
+            if (ref_block_sum &&
+                successive_elimination_skip_eight(
+                    context_ptr,
+                    ref_block_sum + xSearchIndex + ySearchIndex * ref_stride,
+                    ref_stride,
+                    EB_FALSE,
+                    EB_TRUE))
+                continue;
             // this function will do:  xSearchIndex, +1, +2, ..., +7
             open_loop_me_get_eight_search_point_results_block(
                 context_ptr,
@@ -5695,6 +5865,14 @@ static void open_loop_me_fullpel_search_sblock(
         for (xSearchIndex = searchAreaWidthMult8;
              xSearchIndex < search_area_width;
              xSearchIndex++) {
+            if (ref_block_sum &&
+                successive_elimination_skip(
+                    context_ptr,
+                    ref_block_sum + xSearchIndex + ySearchIndex * ref_stride,
+                    ref_stride,
+                    sub_sad,
+                    EB_TRUE))
+                continue;
 
             open_loop_me_get_search_point_results_block(
                 context_ptr,
@@ -5823,6 +6001,249 @@ static void AvcStyleInterpolation(
     return;
 }
 #endif
+/*******************************************
+ * interpolate_search_region_tiles
+ *   interpolates the tiles of the b, h and j buffers that overlap the
+ *   [x0, x1) x [y0, y1) area of the search region (in j buffer coordinates)
+ *   and that were not interpolated yet for the current SB.
+ *   The filters are separable and position-wise, so a tile holds the same
+ *   samples as the interpolation of the whole search region.
+ ********************************************/
+static void interpolate_search_region_tiles(MeContext *context_ptr,
+                                            uint32_t listIndex,
+                                            uint32_t ref_pic_index,
+                                            int32_t x0, int32_t y0,
+                                            int32_t x1, int32_t y1)
+{
+    uint8_t *searchRegionBuffer =
+        context_ptr->interp_src_ptr[listIndex][ref_pic_index];
+    uint32_t lumaStride = context_ptr->interp_src_stride[listIndex][ref_pic_index];
+    uint32_t interpolated_stride = context_ptr->interpolated_stride;
+    int32_t width = (int32_t)context_ptr->interp_width[listIndex][ref_pic_index];
+    // The h and j buffers hold search_area_height + 1 rows, the b buffer
+    // ME_FILTER_TAP - 1 more for the vertical filtering of j
+    int32_t height =
+        (int32_t)context_ptr->interp_height[listIndex][ref_pic_index] + 1;
+    uint8_t *tile_valid = context_ptr->interp_tile_valid[listIndex][ref_pic_index];
+    int32_t tx, ty;
+
+    x0 = MAX(x0, 0);
+    y0 = MAX(y0, 0);
+    x1 = MIN(x1, width);
+    y1 = MIN(y1, height);
+    if (x0 >= x1 || y0 >= y1)
+        return;
+
+    for (ty = y0 / ME_INTERP_TILE_SIZE; ty <= (y1 - 1) / ME_INTERP_TILE_SIZE;
+         ty++) {
+        for (tx = x0 / ME_INTERP_TILE_SIZE;
+             tx <= (x1 - 1) / ME_INTERP_TILE_SIZE;
+             tx++) {
+            uint8_t *valid = &tile_valid[ty * context_ptr->interp_tile_stride + tx];
+            if (*valid)
+                continue;
+            *valid = 1;
+
+            // The width is a multiple of 8 to align with the ASM kernel
+            uint32_t tile_x = tx * ME_INTERP_TILE_SIZE;
+            uint32_t tile_y = ty * ME_INTERP_TILE_SIZE;
+            uint32_t tile_width =
+                MIN(ME_INTERP_TILE_SIZE, (uint32_t)width - tile_x);
+            uint32_t tile_height =
+                MIN(ME_INTERP_TILE_SIZE, (uint32_t)height - tile_y);
+            uint8_t *pos_b = context_ptr->pos_b_buffer[listIndex][ref_pic_index] +
+                             tile_y * interpolated_stride + tile_x;
+            uint8_t *pos_h = context_ptr->pos_h_buffer[listIndex][ref_pic_index] +
+                             tile_y * interpolated_stride + tile_x;
+            uint8_t *pos_j = context_ptr->pos_j_buffer[listIndex][ref_pic_index] +
+                             tile_y * interpolated_stride + tile_x;
+            uint8_t *src = searchRegionBuffer + tile_y * lumaStride + tile_x;
+
+#ifdef AVCCODEL
+            // Half pel interpolation of the search region using f1 ->
+            // pos_b_buffer
+            avc_style_luma_interpolation_filter(
+                src - (ME_FILTER_TAP >> 1) * lumaStride -
+                    (ME_FILTER_TAP >> 1) + 1,
+                lumaStride,
+                pos_b,
+                interpolated_stride,
+                tile_width,
+                tile_height + ME_FILTER_TAP - 1,
+                context_ptr->avctemp_buffer,
+                EB_FALSE,
+                2,
+                2);
+
+            // Half pel interpolation of the search region using f1 ->
+            // pos_h_buffer
+            avc_style_luma_interpolation_filter(
+                src - (ME_FILTER_TAP >> 1) * lumaStride - 1 + lumaStride,
+                lumaStride,
+                pos_h,
+                interpolated_stride,
+                tile_width,
+                tile_height,
+                context_ptr->avctemp_buffer,
+                EB_FALSE,
+                2,
+                8);
+
+            // Half pel interpolation of the search region using f1 ->
+            // pos_j_buffer
+            avc_style_luma_interpolation_filter(
+                pos_b + interpolated_stride,
+                interpolated_stride,
+                pos_j,
+                interpolated_stride,
+                tile_width,
+                tile_height,
+                context_ptr->avctemp_buffer,
+                EB_FALSE,
+                2,
+                8);
+#else
+            // Half pel interpolation of the search region using f1 ->
+            // pos_b_buffer
+            HorizontalPelInterpolation(
+                src - (ME_FILTER_TAP >> 1) * lumaStride - (ME_FILTER_TAP >> 1),
+                lumaStride,
+                tile_width,
+                tile_height + ME_FILTER_TAP - 1,
+                &(me_if_coeff[F1][0]),
+                context_ptr->interp_bit_depth,
+                interpolated_stride,
+                pos_b);
+
+            // Half pel interpolation of the search region using f1 ->
+            // pos_h_buffer
+            VerticalPelInterpolation(
+                src - (ME_FILTER_TAP >> 1) * lumaStride - 1,
+                lumaStride,
+                tile_width,
+                tile_height,
+                &(me_if_coeff[F1][0]),
+                context_ptr->interp_bit_depth,
+                interpolated_stride,
+                pos_h);
+
+            // Half pel interpolation of the search region using f1 ->
+            // pos_j_buffer
+            VerticalPelInterpolation(pos_b,
+                                     interpolated_stride,
+                                     tile_width,
+                                     tile_height,
+                                     &(me_if_coeff[F1][0]),
+                                     context_ptr->interp_bit_depth,
+                                     interpolated_stride,
+                                     pos_j);
+#endif
+        }
+    }
+}
+
+/*******************************************
+ * init_search_region_interpolation
+ *   records the search region of the SB for the lazy interpolation of the
+ *   b, h and j buffers, and invalidates the interpolated tiles
+ ********************************************/
+static void init_search_region_interpolation(
+    MeContext *context_ptr,  // input/output parameter, ME context ptr
+    uint32_t listIndex,      // Refrence picture list index
+    uint32_t ref_pic_index,
+    uint8_t *searchRegionBuffer,  // input parameter, search region index, used
+                                  // to point to reference samples
+    uint32_t lumaStride,          // input parameter, reference Picture stride
+    uint32_t search_area_width,   // input parameter, search area width
+    uint32_t search_area_height,  // input parameter, search area height
+    uint32_t inputBitDepth)       // input parameter, input sample bit depth
+{
+    // The Search area needs to be a multiple of 8 to align with the ASM kernel
+    // Also the search area must be oversized by 2 to account for edge
+    // conditions
+    uint32_t searchAreaWidthForAsm = ROUND_UP_MUL_8(search_area_width + 2);
+
+    context_ptr->interp_src_ptr[listIndex][ref_pic_index] = searchRegionBuffer;
+    context_ptr->interp_src_stride[listIndex][ref_pic_index] = lumaStride;
+    context_ptr->interp_width[listIndex][ref_pic_index] =
+        MIN(searchAreaWidthForAsm,
+            context_ptr->interp_tile_stride * ME_INTERP_TILE_SIZE);
+    context_ptr->interp_height[listIndex][ref_pic_index] = search_area_height;
+    context_ptr->interp_bit_depth = inputBitDepth;
+
+    EB_MEMSET(context_ptr->interp_tile_valid[listIndex][ref_pic_index],
+              0,
+              context_ptr->interp_tile_stride *
+                  MIN(context_ptr->interp_tile_rows,
+                      (search_area_height + ME_INTERP_TILE_SIZE) /
+                          ME_INTERP_TILE_SIZE));
+}
+
+/*******************************************
+ * me_pu_result_index
+ *   maps a PU index of the partition_width / pu_search_index_map tables
+ *   to its index in the per-SB ME result arrays
+ ********************************************/
+static INLINE uint32_t me_pu_result_index(uint32_t pu_index)
+{
+    if (pu_index > 200)
+        return pu_index;
+    else if (pu_index > 184)
+        return tab8x32[pu_index - 185] + 185;
+    else if (pu_index > 168)
+        return tab32x8[pu_index - 169] + 169;
+    else if (pu_index > 136)
+        return tab8x16[pu_index - 137] + 137;
+    else if (pu_index > 128)
+        return tab16x32[pu_index - 129] + 129;
+    else if (pu_index > 126)
+        return pu_index;
+    else if (pu_index > 94)
+        return tab16x8[pu_index - 95] + 95;
+    else if (pu_index > 86)
+        return tab32x16[pu_index - 87] + 87;
+    else if (pu_index > 84)
+        return pu_index;
+    else if (pu_index > 20)
+        return tab8x8[pu_index - 21] + 21;
+    else if (pu_index > 4)
+        return tab16x16[pu_index - 5] + 5;
+    else
+        return pu_index;
+}
+
+/*******************************************
+ * interpolate_best_full_pel_neighborhoods
+ *   interpolates the b, h and j samples the half-pel, quarter-pel and
+ *   bi-prediction searches read around the best full-pel MV of each PU
+ ********************************************/
+static void interpolate_best_full_pel_neighborhoods(
+    MeContext *context_ptr, uint32_t listIndex, uint32_t ref_pic_index,
+    int16_t x_search_area_origin, int16_t y_search_area_origin)
+{
+    uint32_t *p_best_mv = context_ptr->p_sb_best_mv[listIndex][ref_pic_index];
+    uint32_t pu_index;
+
+    for (pu_index = 0; pu_index < MAX_ME_PU_COUNT; pu_index++) {
+        uint32_t best_mv = p_best_mv[me_pu_result_index(pu_index)];
+        int32_t x_search_index = (_MVXT(best_mv) >> 2) - x_search_area_origin +
+                                 (int32_t)pu_search_index_map[pu_index][0];
+        int32_t y_search_index = (_MVYT(best_mv) >> 2) - y_search_area_origin +
+                                 (int32_t)pu_search_index_map[pu_index][1];
+
+        // The fractional candidates stay within 3/4 of a sample of the full
+        // pel position, which spans one extra column and row of b, h and j
+        interpolate_search_region_tiles(
+            context_ptr,
+            listIndex,
+            ref_pic_index,
+            x_search_index - 1,
+            y_search_index - 1,
+            x_search_index + (int32_t)partition_width[pu_index] + 3,
+            y_search_index + (int32_t)partition_height[pu_index] + 3);
+    }
+}
+
 /*******************************************
  * InterpolateSearchRegion AVC
  *   interpolates the search area
@@ -5869,100 +6290,22 @@ void InterpolateSearchRegionAVC(
     // q         3           2           F1                 F2
     // r         3           3           F2                 F2
 
-    // Start a b c
-
-    // The Search area needs to be a multiple of 8 to align with the ASM kernel
-    // Also the search area must be oversized by 2 to account for edge
-    // conditions
-    uint32_t searchAreaWidthForAsm = ROUND_UP_MUL_8(search_area_width + 2);
-
-#ifdef AVCCODEL
-
-    (void)inputBitDepth;
-    // Half pel interpolation of the search region using f1 -> pos_b_buffer
-    if (searchAreaWidthForAsm) {
-        avc_style_luma_interpolation_filter(
-            searchRegionBuffer - (ME_FILTER_TAP >> 1) * lumaStride -
-                (ME_FILTER_TAP >> 1) + 1,
-            lumaStride,
-            context_ptr->pos_b_buffer[listIndex][ref_pic_index],
-            context_ptr->interpolated_stride,
-            searchAreaWidthForAsm,
-            search_area_height + ME_FILTER_TAP,
-            context_ptr->avctemp_buffer,
-            EB_FALSE,
-            2,
-            2);
-    }
-
-    // Half pel interpolation of the search region using f1 -> pos_h_buffer
-    if (searchAreaWidthForAsm) {
-        avc_style_luma_interpolation_filter(
-            searchRegionBuffer - (ME_FILTER_TAP >> 1) * lumaStride - 1 +
-                lumaStride,
-            lumaStride,
-            context_ptr->pos_h_buffer[listIndex][ref_pic_index],
-            context_ptr->interpolated_stride,
-            searchAreaWidthForAsm,
-            search_area_height + 1,
-            context_ptr->avctemp_buffer,
-            EB_FALSE,
-            2,
-            8);
-    }
-
-    if (searchAreaWidthForAsm) {
-        // Half pel interpolation of the search region using f1 -> pos_j_buffer
-        avc_style_luma_interpolation_filter(
-            context_ptr->pos_b_buffer[listIndex][ref_pic_index] +
-                context_ptr->interpolated_stride,
-            context_ptr->interpolated_stride,
-            context_ptr->pos_j_buffer[listIndex][ref_pic_index],
-            context_ptr->interpolated_stride,
-            searchAreaWidthForAsm,
-            search_area_height + 1,
-            context_ptr->avctemp_buffer,
-            EB_FALSE,
-            2,
-            8);
-    }
-
-#else
-
-    // Half pel interpolation of the search region using f1 -> pos_b_buffer
-    HorizontalPelInterpolation(searchRegionBuffer -
-                                   (ME_FILTER_TAP >> 1) * lumaStride -
-                                   (ME_FILTER_TAP >> 1),
-                               lumaStride,
-                               search_area_width + 1,
-                               search_area_height + ME_FILTER_TAP,
-                               &(me_if_coeff[F1][0]),
-                               inputBitDepth,
-                               context_ptr->interpolated_stride,
-                               context_ptr->pos_b_buffer);
-
-    // Half pel interpolation of the search region using f1 -> pos_h_buffer
-    VerticalPelInterpolation(
-        searchRegionBuffer - (ME_FILTER_TAP >> 1) * lumaStride - 1,
-        lumaStride,
-        search_area_width + 2,
-        search_area_height + 1,
-        &(me_if_coeff[F1][0]),
-        inputBitDepth,
-        context_ptr->interpolated_stride,
-        context_ptr->pos_h_buffer);
-
-    // Half pel interpolation of the search region using f1 -> pos_j_buffer
-    VerticalPelInterpolation(context_ptr->pos_b_buffer,
-                             context_ptr->interpolated_stride,
-                             search_area_width + 1,
-                             search_area_height + 1,
-                             &(me_if_coeff[F1][0]),
-                             inputBitDepth,
-                             context_ptr->interpolated_stride,
-                             context_ptr->pos_j_buffer);
-
-#endif
+    init_search_region_interpolation(context_ptr,
+                                     listIndex,
+                                     ref_pic_index,
+                                     searchRegionBuffer,
+                                     lumaStride,
+                                     search_area_width,
+                                     search_area_height,
+                                     inputBitDepth);
+
+    interpolate_search_region_tiles(context_ptr,
+                                    listIndex,
+                                    ref_pic_index,
+                                    0,
+                                    0,
+                                    INT32_MAX,
+                                    INT32_MAX);
 
     return;
 }
@@ -12123,32 +12466,7 @@ EbErrorType BiPredictionCompensation(MeContext *context_ptr, uint32_t pu_index,
         (int32_t)context_ptr->interpolated_stride *
             (int32_t)(ysecondSearchIndex + (ME_FILTER_TAP >> 1) - 1);
 
-    uint32_t nIndex;
-
-    if (pu_index > 200)
-        nIndex = pu_index;
-    else if (pu_index > 184)
-        nIndex = tab8x32[pu_index - 185] + 185;
-    else if (pu_index > 168)
-        nIndex = tab32x8[pu_index - 169] + 169;
-    else if (pu_index > 136)
-        nIndex = tab8x16[pu_index - 137] + 137;
-    else if (pu_index > 128)
-        nIndex = tab16x32[pu_index - 129] + 129;
-    else if (pu_index > 126)
-        nIndex = pu_index;
-    else if (pu_index > 94)
-        nIndex = tab16x8[pu_index - 95] + 95;
-    else if (pu_index > 86)
-        nIndex = tab32x16[pu_index - 87] + 87;
-    else if (pu_index > 84)
-        nIndex = pu_index;
-    else if (pu_index > 20)
-        nIndex = tab8x8[pu_index - 21] + 21;
-    else if (pu_index > 4)
-        nIndex = tab16x16[pu_index - 5] + 5;
-    else
-        nIndex = pu_index;
+    uint32_t nIndex = me_pu_result_index(pu_index);
     context_ptr->p_sb_bipred_sad[nIndex] =
 
         BiPredAverging(
@@ -12225,32 +12543,7 @@ EbErrorType BiPredictionSearch(
 
     (void)picture_control_set_ptr;
 
-    uint32_t nIndex;
-
-    if (pu_index > 200)
-        nIndex = pu_index;
-    else if (pu_index > 184)
-        nIndex = tab8x32[pu_index - 185] + 185;
-    else if (pu_index > 168)
-        nIndex = tab32x8[pu_index - 169] + 169;
-    else if (pu_index > 136)
-        nIndex = tab8x16[pu_index - 137] + 137;
-    else if (pu_index > 128)
-        nIndex = tab16x32[pu_index - 129] + 129;
-    else if (pu_index > 126)
-        nIndex = pu_index;
-    else if (pu_index > 94)
-        nIndex = tab16x8[pu_index - 95] + 95;
-    else if (pu_index > 86)
-        nIndex = tab32x16[pu_index - 87] + 87;
-    else if (pu_index > 84)
-        nIndex = pu_index;
-    else if (pu_index > 20)
-        nIndex = tab8x8[pu_index - 21] + 21;
-    else if (pu_index > 4)
-        nIndex = tab16x16[pu_index - 5] + 5;
-    else
-        nIndex = pu_index;
+    uint32_t nIndex = me_pu_result_index(pu_index);
     // NM: Inter list bipred.
     //(LAST,BWD) , (LAST,ALT)  and (LAST,ALT2)
     //(LAST2,BWD), (LAST2,ALT) and (LAST2,ALT2)
@@ -13521,6 +13814,301 @@ void SwapMeCandidate(MePredUnit *a, MePredUnit *b) {
     *b = tempPtr;
 }
 
+/*******************************************
+ * get_tf_hme_center
+ *   HME search center the temporal filtering of
+ *   the picture found against the reference,
+ *   NULL when it did not search it
+ *******************************************/
+static const TfHmeCenter *get_tf_hme_center(
+    PictureParentControlSet *picture_control_set_ptr,
+    uint32_t                 sb_index,
+    uint64_t                 ref_poc)
+{
+    for (uint8_t frame_index = 0; frame_index < picture_control_set_ptr->tf_hme_frame_count; frame_index++) {
+        if (picture_control_set_ptr->tf_hme_picture_number[frame_index] == ref_poc) {
+            const TfHmeCenter *tf_hme_center = &picture_control_set_ptr->tf_hme_center[frame_index][sb_index];
+            return tf_hme_center->valid ? tf_hme_center : NULL;
+        }
+    }
+    return NULL;
+}
+
+/*******************************************
+ * get_tf_hme_seed
+ *   HME search center of the temporal filtering
+ *   against the farthest of its frames on the
+ *   side of the reference, scaled to the distance
+ *   of the reference, EB_FALSE when there is none
+ *******************************************/
+static EbBool get_tf_hme_seed(
+    PictureParentControlSet *picture_control_set_ptr,
+    uint32_t                 sb_index,
+    uint64_t                 ref_poc,
+    int16_t                 *x_seed,
+    int16_t                 *y_seed)
+{
+    const int32_t ref_dist = (int32_t)((int64_t)ref_poc - (int64_t)picture_control_set_ptr->picture_number);
+    int32_t tf_dist = 0;
+    const TfHmeCenter *tf_hme_center = NULL;
+    for (uint8_t frame_index = 0; frame_index < picture_control_set_ptr->tf_hme_frame_count; frame_index++) {
+        const int32_t dist = (int32_t)((int64_t)picture_control_set_ptr->tf_hme_picture_number[frame_index] -
+            (int64_t)picture_control_set_ptr->picture_number);
+        if (dist == 0 || (dist < 0) != (ref_dist < 0) || ABS(dist) <= ABS(tf_dist) ||
+            !picture_control_set_ptr->tf_hme_center[frame_index][sb_index].valid)
+            continue;
+        tf_dist = dist;
+        tf_hme_center = &picture_control_set_ptr->tf_hme_center[frame_index][sb_index];
+    }
+    if (tf_hme_center == NULL)
+        return EB_FALSE;
+    // Scale to the distance of the reference, rounded to the nearest full-pel
+    const int32_t x_scaled = (tf_hme_center->x * ref_dist * 2 / tf_dist);
+    const int32_t y_scaled = (tf_hme_center->y * ref_dist * 2 / tf_dist);
+    *x_seed = (int16_t)CLIP3(INT16_MIN, INT16_MAX, ROUND_POWER_OF_TWO_SIGNED(x_scaled, 1));
+    *y_seed = (int16_t)CLIP3(INT16_MIN, INT16_MAX, ROUND_POWER_OF_TWO_SIGNED(y_scaled, 1));
+    return EB_TRUE;
+}
+
+/*******************************************
+ * get_motion_hint
+ *   full-pel motion hint of the application for
+ *   the SB: the hint against the reference when
+ *   there is one (exact), otherwise the farthest
+ *   hint on the side of the reference scaled to
+ *   its distance, EB_FALSE when there is none
+ *******************************************/
+static EbBool get_motion_hint(
+    PictureParentControlSet *picture_control_set_ptr,
+    uint32_t                 sb_origin_x,
+    uint32_t                 sb_origin_y,
+    uint64_t                 ref_poc,
+    int16_t                 *x_hint,
+    int16_t                 *y_hint,
+    EbBool                  *exact)
+{
+    const EbSvtMotionField *motion_field = picture_control_set_ptr->input_ptr->motion_field;
+    if (motion_field == NULL || motion_field->mv_count == 0)
+        return EB_FALSE;
+    const uint32_t block_index = (sb_origin_y / EB_MOTION_FIELD_BLOCK_SIZE) * motion_field->block_cols +
+        sb_origin_x / EB_MOTION_FIELD_BLOCK_SIZE;
+    const EbSvtMotionVector *mvs = &motion_field->mvs[block_index * motion_field->mv_count];
+    const int32_t ref_dist = (int32_t)((int64_t)ref_poc - (int64_t)picture_control_set_ptr->picture_number);
+    const EbSvtMotionVector *hint = NULL;
+    for (uint32_t mv_index = 0; mv_index < motion_field->mv_count; mv_index++) {
+        const int32_t dist = mvs[mv_index].ref_offset;
+        if (dist == ref_dist) {
+            *x_hint = (int16_t)ROUND_POWER_OF_TWO_SIGNED(mvs[mv_index].mv_x, 2);
+            *y_hint = (int16_t)ROUND_POWER_OF_TWO_SIGNED(mvs[mv_index].mv_y, 2);
+            *exact = EB_TRUE;
+            return EB_TRUE;
+        }
+        if (dist == 0 || (dist < 0) != (ref_dist < 0) || (hint && ABS(dist) <= ABS(hint->ref_offset)))
+            continue;
+        hint = &mvs[mv_index];
+    }
+    if (hint == NULL)
+        return EB_FALSE;
+    // Scale to the distance of the reference, rounded to the nearest full-pel
+    const int32_t x_scaled = hint->mv_x * ref_dist / hint->ref_offset;
+    const int32_t y_scaled = hint->mv_y * ref_dist / hint->ref_offset;
+    *x_hint = (int16_t)CLIP3(INT16_MIN, INT16_MAX, ROUND_POWER_OF_TWO_SIGNED(x_scaled, 2));
+    *y_hint = (int16_t)CLIP3(INT16_MIN, INT16_MAX, ROUND_POWER_OF_TWO_SIGNED(y_scaled, 2));
+    *exact = EB_FALSE;
+    return EB_TRUE;
+}
+
+#define PREDICTIVE_HME_MAX_CANDIDATES       9
+#define PREDICTIVE_HME_MAX_STEP             4
+#define PREDICTIVE_HME_MAX_ITERATIONS       8
+#define PREDICTIVE_HME_SAD_PER_PIXEL_TH     2
+
+/*******************************************
+ * predictive_hme_sad
+ *   sub-sampled SAD of the SB at the search
+ *   center, the search center is clamped for
+ *   the SB to stay on the padded reference
+ *******************************************/
+static uint64_t predictive_hme_sad(
+    EbPictureBufferDesc *ref_pic_ptr,
+    MeContext           *context_ptr,
+    int16_t              origin_x,
+    int16_t              origin_y,
+    uint32_t             sb_width,
+    uint32_t             sb_height,
+    int16_t             *xsc,
+    int16_t             *ysc)
+{
+    const int16_t pad_width = (int16_t)BLOCK_SIZE_64 - 1;
+    const int16_t pad_height = (int16_t)BLOCK_SIZE_64 - 1;
+
+    *xsc = (int16_t)CLIP3(-pad_width - origin_x, (int16_t)ref_pic_ptr->width - 1 - origin_x, *xsc);
+    *ysc = (int16_t)CLIP3(-pad_height - origin_y, (int16_t)ref_pic_ptr->height - 1 - origin_y, *ysc);
+
+    const uint32_t search_region_index =
+        (int16_t)ref_pic_ptr->origin_x + origin_x + *xsc +
+        ((int16_t)ref_pic_ptr->origin_y + origin_y + *ysc) * ref_pic_ptr->stride_y;
+
+    return nxm_sad_kernel(
+        context_ptr->sb_src_ptr,
+        context_ptr->sb_src_stride << 1,
+        &(ref_pic_ptr->buffer_y[search_region_index]),
+        ref_pic_ptr->stride_y << 1,
+        sb_height >> 1,
+        sb_width) << 1;
+}
+
+/*******************************************
+ * predictive_hme_search_center
+ *   predictive zonal search of the HME search
+ *   center: the best of the zero MV, the MVs of
+ *   the neighbouring SBs already searched in the
+ *   segment, the MV of the SB against the previous
+ *   reference of the list and the HME search center
+ *   of the temporal filtering (both scaled to the
+ *   distance of the reference) and the mean search
+ *   center of the segment is refined with a
+ *   shrinking diamond, unless its SAD is already low
+ *******************************************/
+static void predictive_hme_search_center(
+    PictureParentControlSet *picture_control_set_ptr,
+    MeContext               *context_ptr,
+    EbPictureBufferDesc     *ref_pic_ptr,
+    uint32_t                 sb_index,
+    uint32_t                 list_index,
+    uint8_t                  ref_pic_index,
+    int16_t                  origin_x,
+    int16_t                  origin_y,
+    uint32_t                 sb_width,
+    uint32_t                 sb_height,
+    int16_t                 *xsc,
+    int16_t                 *ysc)
+{
+    static const int8_t diamond[4][2] = { { -1, 0 }, { 1, 0 }, { 0, -1 }, { 0, 1 } };
+    SequenceControlSet *sequence_control_set_ptr =
+        (SequenceControlSet *)picture_control_set_ptr->sequence_control_set_wrapper_ptr->object_ptr;
+    const uint32_t picture_width_in_sb =
+        (sequence_control_set_ptr->seq_header.max_frame_width + sequence_control_set_ptr->sb_sz - 1) /
+        sequence_control_set_ptr->sb_sz;
+    const uint32_t sb_x = sb_index % picture_width_in_sb;
+    const uint32_t sb_y = sb_index / picture_width_in_sb;
+    const uint32_t mv_index =
+        ((list_index && sequence_control_set_ptr->mrp_mode == 0) ? 4 : list_index ? 2 : 0) + ref_pic_index;
+    const uint64_t ref_poc = picture_control_set_ptr->ref_pic_poc_array[list_index][ref_pic_index];
+    const int32_t ref_dist = (int32_t)((int64_t)ref_poc - (int64_t)picture_control_set_ptr->picture_number);
+
+    int16_t x_candidate[PREDICTIVE_HME_MAX_CANDIDATES];
+    int16_t y_candidate[PREDICTIVE_HME_MAX_CANDIDATES];
+    uint32_t candidate_count = 0;
+
+    // Zero MV
+    x_candidate[candidate_count] = 0;
+    y_candidate[candidate_count++] = 0;
+
+    // Left, top, top-left and top-right SBs, when searched before the SB in the segment
+    const EbBool left_available = sb_x > context_ptr->segment_sb_x_start;
+    const EbBool top_available = sb_y > context_ptr->segment_sb_y_start;
+    const EbBool right_available = sb_x + 1 < context_ptr->segment_sb_x_end;
+    const uint32_t neighbor_sb_index[4] = {
+        sb_index - 1,
+        sb_index - picture_width_in_sb,
+        sb_index - picture_width_in_sb - 1,
+        sb_index - picture_width_in_sb + 1 };
+    const EbBool neighbor_available[4] = {
+        left_available,
+        top_available,
+        top_available && left_available,
+        top_available && right_available };
+    for (uint32_t neighbor_index = 0; neighbor_index < 4; neighbor_index++) {
+        if (!neighbor_available[neighbor_index])
+            continue;
+        const MvCandidate *mv = &picture_control_set_ptr->me_results[neighbor_sb_index[neighbor_index]]
+            ->me_mv_array[ME_TIER_ZERO_PU_64x64][mv_index];
+        x_candidate[candidate_count] = mv->x_mv >> 2;
+        y_candidate[candidate_count++] = mv->y_mv >> 2;
+    }
+
+    // Same SB against the previous reference of the list
+    if (ref_pic_index > 0) {
+        const int32_t prev_dist = (int32_t)((int64_t)picture_control_set_ptr->ref_pic_poc_array[list_index][ref_pic_index - 1] -
+            (int64_t)picture_control_set_ptr->picture_number);
+        const uint32_t prev_mv = context_ptr->p_sb_best_mv[list_index][ref_pic_index - 1][ME_TIER_ZERO_PU_64x64];
+        if (prev_dist != 0) {
+            x_candidate[candidate_count] = (int16_t)CLIP3(INT16_MIN, INT16_MAX, (_MVXT(prev_mv) * ref_dist / prev_dist) >> 2);
+            y_candidate[candidate_count++] = (int16_t)CLIP3(INT16_MIN, INT16_MAX, (_MVYT(prev_mv) * ref_dist / prev_dist) >> 2);
+        }
+    }
+
+    // Motion of the neighbouring pictures, found by the temporal filtering
+    if (get_tf_hme_seed(
+            picture_control_set_ptr,
+            sb_index,
+            ref_poc,
+            &x_candidate[candidate_count],
+            &y_candidate[candidate_count]))
+        candidate_count++;
+
+    // Motion hint of the application, scaled to the distance of the reference
+    EbBool motion_hint_exact;
+    if (get_motion_hint(
+            picture_control_set_ptr,
+            (uint32_t)origin_x,
+            (uint32_t)origin_y,
+            ref_poc,
+            &x_candidate[candidate_count],
+            &y_candidate[candidate_count],
+            &motion_hint_exact))
+        candidate_count++;
+
+    // Mean search center of the segment
+    if (context_ptr->segment_hme_count[list_index][ref_pic_index]) {
+        const int32_t count = (int32_t)context_ptr->segment_hme_count[list_index][ref_pic_index];
+        x_candidate[candidate_count] = (int16_t)(context_ptr->segment_hme_sum_x[list_index][ref_pic_index] / count);
+        y_candidate[candidate_count++] = (int16_t)(context_ptr->segment_hme_sum_y[list_index][ref_pic_index] / count);
+    }
+
+    int16_t best_x = 0;
+    int16_t best_y = 0;
+    uint64_t best_sad = (uint64_t)~0;
+    for (uint32_t candidate_index = 0; candidate_index < candidate_count; candidate_index++) {
+        int16_t x = x_candidate[candidate_index];
+        int16_t y = y_candidate[candidate_index];
+        const uint64_t sad = predictive_hme_sad(ref_pic_ptr, context_ptr, origin_x, origin_y, sb_width, sb_height, &x, &y);
+        if (sad < best_sad) {
+            best_sad = sad;
+            best_x = x;
+            best_y = y;
+        }
+    }
+
+    // Refine around the best candidate, halving the step when the center stays the best
+    const uint64_t sad_th = (uint64_t)PREDICTIVE_HME_SAD_PER_PIXEL_TH * sb_width * sb_height;
+    int16_t step = PREDICTIVE_HME_MAX_STEP;
+    for (uint32_t iteration = 0; iteration < PREDICTIVE_HME_MAX_ITERATIONS && step && best_sad > sad_th; iteration++) {
+        const int16_t center_x = best_x;
+        const int16_t center_y = best_y;
+        for (uint32_t point_index = 0; point_index < 4; point_index++) {
+            int16_t x = center_x + diamond[point_index][0] * step;
+            int16_t y = center_y + diamond[point_index][1] * step;
+            const uint64_t sad = predictive_hme_sad(ref_pic_ptr, context_ptr, origin_x, origin_y, sb_width, sb_height, &x, &y);
+            if (sad < best_sad) {
+                best_sad = sad;
+                best_x = x;
+                best_y = y;
+            }
+        }
+        if (best_x == center_x && best_y == center_y)
+            step >>= 1;
+    }
+
+    context_ptr->segment_hme_sum_x[list_index][ref_pic_index] += best_x;
+    context_ptr->segment_hme_sum_y[list_index][ref_pic_index] += best_y;
+    context_ptr->segment_hme_count[list_index][ref_pic_index]++;
+
+    *xsc = best_x;
+    *ysc = best_y;
+}
+
 /*******************************************
  * motion_estimate_lcu
  *   performs ME (LCU)
@@ -13620,6 +14208,7 @@ EbErrorType motion_estimate_lcu(
 
     MePredUnit *me_candidate;
     EbPictureBufferDesc *refPicPtr;
+    const uint16_t *ref_block_sum;
     EbPictureBufferDesc *quarterRefPicPtr;
     EbPictureBufferDesc *sixteenthRefPicPtr;
 
@@ -13662,6 +14251,9 @@ EbErrorType motion_estimate_lcu(
                             ? (uint32_t)REF_LIST_0
                             : (uint32_t)REF_LIST_1;
 
+    if (sequence_control_set_ptr->me_successive_elimination)
+        generate_sb_block_sums(context_ptr);
+
     EbBool is_nsq_table_used =
         (picture_control_set_ptr->pic_depth_mode <= PIC_ALL_C_DEPTH_MODE &&
          picture_control_set_ptr->nsq_search_level >= NSQ_SEARCH_LEVEL1 &&
@@ -13671,8 +14263,10 @@ EbErrorType motion_estimate_lcu(
 
     is_nsq_table_used = picture_control_set_ptr->enc_mode == ENC_M0 ?  EB_FALSE : is_nsq_table_used;
 
-    if (context_ptr->me_alt_ref == EB_TRUE)
+    if (context_ptr->me_alt_ref == EB_TRUE) {
         numOfListToSearch = 0;
+        context_ptr->tf_hme_center_valid = EB_FALSE;
+    }
 
     // Uni-Prediction motion estimation loop
     // List Loop
@@ -13725,6 +14319,10 @@ EbErrorType motion_estimate_lcu(
             sixteenthRefPicPtr = (sequence_control_set_ptr->down_sampling_method_me_search == ME_FILTERED_DOWNSAMPLED) ?
                 (EbPictureBufferDesc*)referenceObject->sixteenth_filtered_picture_ptr:
                 (EbPictureBufferDesc*)referenceObject->sixteenth_decimated_picture_ptr;
+            EbBool motion_hint = EB_FALSE;
+            EbBool motion_hint_exact = EB_FALSE;
+            int16_t x_motion_hint = 0;
+            int16_t y_motion_hint = 0;
             if (picture_control_set_ptr->temporal_layer_index > 0 ||
                 listIndex == 0) {
                 // A - The MV center for Tier0 search could be either (0,0), or
@@ -13745,13 +14343,93 @@ EbErrorType motion_estimate_lcu(
                 }
                 // B - NO HME in boundaries
                 // C - Skip HME
-
-                if (context_ptr->enable_hme_flag &&
+                // G - Take the motion hint of the application against the same reference
+                motion_hint =
+                    (context_ptr->me_alt_ref == EB_FALSE &&
+                     sb_height == BLOCK_SIZE_64)
+                        ? get_motion_hint(
+                              picture_control_set_ptr,
+                              sb_origin_x,
+                              sb_origin_y,
+                              picture_control_set_ptr->ref_pic_poc_array[listIndex][ref_pic_index],
+                              &x_motion_hint,
+                              &y_motion_hint,
+                              &motion_hint_exact)
+                        : EB_FALSE;
+                // D - Take the HME search center of the temporal filtering of the picture against the same reference
+                const TfHmeCenter *tf_hme_center =
+                    (context_ptr->me_alt_ref == EB_FALSE &&
+                     context_ptr->enable_hme_flag &&
+                     sb_height == BLOCK_SIZE_64 &&
+                     !((ref0Poc == ref1Poc) && (listIndex == 1)))
+                        ? get_tf_hme_center(
+                              picture_control_set_ptr,
+                              sb_index,
+                              picture_control_set_ptr->ref_pic_poc_array[listIndex][ref_pic_index])
+                        : NULL;
+
+                if (motion_hint && motion_hint_exact) {
+                    x_search_center = x_motion_hint;
+                    y_search_center = y_motion_hint;
+                }
+                else if (tf_hme_center) {
+                    x_search_center = tf_hme_center->x;
+                    y_search_center = tf_hme_center->y;
+                }
+                // F - Predictive zonal search in place of the HME levels
+                else if (context_ptr->predictive_hme_flag &&
+                         context_ptr->me_alt_ref == EB_FALSE &&
+                         context_ptr->enable_hme_flag &&
+                         sb_height == BLOCK_SIZE_64) {
+                    predictive_hme_search_center(
+                        picture_control_set_ptr,
+                        context_ptr,
+                        refPicPtr,
+                        sb_index,
+                        listIndex,
+                        ref_pic_index,
+                        origin_x,
+                        origin_y,
+                        sb_width,
+                        sb_height,
+                        &x_search_center,
+                        &y_search_center);
+                }
+                else if (context_ptr->enable_hme_flag &&
 
                     /*B*/ sb_height ==
                         BLOCK_SIZE_64) {  //(searchCenterSad >
                                           // sequence_control_set_ptr->static_config.skipTier0HmeTh))
                                           //{
+                    // E - Seed Level1 with the scaled motion hint, or else with the scaled HME search center of the
+                    // temporal filtering, in place of Level0
+                    int16_t x_hme_seed = x_motion_hint;
+                    int16_t y_hme_seed = y_motion_hint;
+                    const EbBool hme_seeded =
+                        (motion_hint && enable_hme_level1_flag) ||
+                        ((context_ptr->me_alt_ref == EB_FALSE &&
+                          enable_hme_level1_flag &&
+                          !((ref0Poc == ref1Poc) && (listIndex == 1)))
+                             ? get_tf_hme_seed(
+                                   picture_control_set_ptr,
+                                   sb_index,
+                                   picture_control_set_ptr->ref_pic_poc_array[listIndex][ref_pic_index],
+                                   &x_hme_seed,
+                                   &y_hme_seed)
+                             : EB_FALSE);
+                    if (hme_seeded) {
+                        for (searchRegionNumberInHeight = 0;
+                             searchRegionNumberInHeight < context_ptr->number_hme_search_region_in_height;
+                             searchRegionNumberInHeight++) {
+                            for (searchRegionNumberInWidth = 0;
+                                 searchRegionNumberInWidth < context_ptr->number_hme_search_region_in_width;
+                                 searchRegionNumberInWidth++) {
+                                xHmeLevel0SearchCenter[searchRegionNumberInWidth][searchRegionNumberInHeight] = x_hme_seed;
+                                yHmeLevel0SearchCenter[searchRegionNumberInWidth][searchRegionNumberInHeight] = y_hme_seed;
+                            }
+                        }
+                        searchRegionNumberInWidth = 0;
+                    }
                     while (searchRegionNumberInHeight <
                            context_ptr->number_hme_search_region_in_height) {
                         while (searchRegionNumberInWidth <
@@ -13785,7 +14463,7 @@ EbErrorType motion_estimate_lcu(
 
                     // HME: Level0 search
 
-                    if (enable_hme_level0_flag) {
+                    if (enable_hme_level0_flag && !hme_seeded) {
                         if (oneQuadrantHME && !enable_hme_level1_flag &&
                             !enable_hme_level2_flag) {
                             searchRegionNumberInHeight = 0;
@@ -14208,6 +14886,12 @@ EbErrorType motion_estimate_lcu(
 
                     x_search_center = xHmeSearchCenter;
                     y_search_center = yHmeSearchCenter;
+
+                    if (context_ptr->me_alt_ref == EB_TRUE) {
+                        context_ptr->tf_hme_center_x = x_search_center;
+                        context_ptr->tf_hme_center_y = y_search_center;
+                        context_ptr->tf_hme_center_valid = EB_TRUE;
+                    }
                 }
             }
 
@@ -14218,6 +14902,11 @@ EbErrorType motion_estimate_lcu(
             // Constrain x_ME to be a multiple of 8 (round up)
             search_area_width = (context_ptr->search_area_width + 7) & ~0x07;
             search_area_height = context_ptr->search_area_height;
+            // Only refine around a motion hint against the same reference
+            if (motion_hint && motion_hint_exact) {
+                search_area_width = MIN(search_area_width, MOTION_HINT_SEARCH_AREA_WIDTH);
+                search_area_height = MIN(search_area_height, MOTION_HINT_SEARCH_AREA_HEIGHT);
+            }
             if ((x_search_center != 0 || y_search_center != 0) &&
                 (picture_control_set_ptr->is_used_as_reference_flag ==
                  EB_TRUE)) {
@@ -14398,6 +15087,10 @@ EbErrorType motion_estimate_lcu(
                 y_search_area_origin;
             searchRegionIndex = xTopLeftSearchRegion +
                                 yTopLeftSearchRegion * refPicPtr->stride_y;
+            // Block sums at the top left of the search region, skipping the positions that can not improve the SADs
+            ref_block_sum = referenceObject->me_block_sum
+                                ? &referenceObject->me_block_sum[searchRegionIndex]
+                                : NULL;
 
             {
                 {
@@ -14561,7 +15254,8 @@ EbErrorType motion_estimate_lcu(
                                                            x_search_area_origin,
                                                            y_search_area_origin,
                                                            search_area_width,
-                                                           search_area_height);
+                                                           search_area_height,
+                                                           ref_block_sum);
                         context_ptr->full_quarter_pel_refinement = 0;
 
                         if (context_ptr->half_pel_mode ==
@@ -14754,7 +15448,8 @@ EbErrorType motion_estimate_lcu(
                                           x_search_area_origin,
                                           y_search_area_origin,
                                           search_area_width,
-                                          search_area_height);
+                                          search_area_height,
+                                          ref_block_sum);
                     }
                 }
 
@@ -14798,7 +15493,7 @@ EbErrorType motion_estimate_lcu(
 
                     if (context_ptr->half_pel_mode ==
                         REFINMENT_HP_MODE) {
-                        InterpolateSearchRegionAVC(
+                        init_search_region_interpolation(
                             context_ptr,
                             listIndex,
                             ref_pic_index,
@@ -14815,6 +15510,13 @@ EbErrorType motion_estimate_lcu(
                             (uint32_t)search_area_width + (BLOCK_SIZE_64 - 1),
                             (uint32_t)search_area_height + (BLOCK_SIZE_64 - 1),
                             8);
+                        // Only interpolate around the best full-pel MVs
+                        interpolate_best_full_pel_neighborhoods(
+                            context_ptr,
+                            listIndex,
+                            ref_pic_index,
+                            x_search_area_origin,
+                            y_search_area_origin);
 
                         // Half-Pel Refinement [8 search positions]
                         HalfPelSearch_LCU(
@@ -31,6 +31,7 @@ static void me_context_dctor(EbPtr p)
             EB_FREE_ARRAY(obj->pos_b_buffer[listIndex][refPicIndex]);
             EB_FREE_ARRAY(obj->pos_h_buffer[listIndex][refPicIndex]);
             EB_FREE_ARRAY(obj->pos_j_buffer[listIndex][refPicIndex]);
+            EB_FREE_ARRAY(obj->interp_tile_valid[listIndex][refPicIndex]);
         }
     }
 
@@ -119,6 +120,15 @@ EbErrorType me_context_ctor(
         }
     }
 
+    // The pos_b/h/j buffers are filled on demand, one tile at a time, around
+    // the candidates the sub-pel refinement visits
+    object_ptr->interp_tile_stride = (object_ptr->interpolated_stride + ME_INTERP_TILE_SIZE - 1) / ME_INTERP_TILE_SIZE;
+    object_ptr->interp_tile_rows = (max_search_area_height + ME_INTERP_TILE_SIZE - 1) / ME_INTERP_TILE_SIZE;
+    for (listIndex = 0; listIndex < MAX_NUM_OF_REF_PIC_LIST; listIndex++) {
+        for (refPicIndex = 0; refPicIndex < MAX_REF_IDX; refPicIndex++)
+            EB_CALLOC_ARRAY(object_ptr->interp_tile_valid[listIndex][refPicIndex], object_ptr->interp_tile_stride * object_ptr->interp_tile_rows);
+    }
+
     EB_MALLOC_ARRAY(object_ptr->one_d_intermediate_results_buf0, BLOCK_SIZE_64*BLOCK_SIZE_64);
 
     EB_MALLOC_ARRAY(object_ptr->one_d_intermediate_results_buf1, BLOCK_SIZE_64*BLOCK_SIZE_64);
@@ -130,7 +140,9 @@ EbErrorType me_context_ctor(
         }
     }
 
-    EB_MALLOC_ARRAY(object_ptr->avctemp_buffer, object_ptr->interpolated_stride * max_search_area_height);
+    // Only the 2-D AVC-style positions use the temporary buffer, and the
+    // search region is interpolated tile by tile
+    EB_MALLOC_ARRAY(object_ptr->avctemp_buffer, 3 * ME_INTERP_TILE_SIZE * ME_INTERP_TILE_SIZE);
     EB_MALLOC_ARRAY(object_ptr->p_eight_pos_sad16x16, 8 * 16);//16= 16 16x16 blocks in a LCU.       8=8search points
 
     // Initialize Alt-Ref parameters
@@ -19,9 +19,14 @@ extern "C" {
 #define MAX_SEARCH_AREA_HEIGHT      1280
 #define MAX_SEARCH_AREA_WIDTH_CH       MAX_SEARCH_AREA_WIDTH  + PAD_VALUE
 #define MAX_SEARCH_AREA_HEIGHT_CH      MAX_SEARCH_AREA_HEIGHT  + PAD_VALUE
+// Search Area around a motion hint of the application against the same reference
+#define MOTION_HINT_SEARCH_AREA_WIDTH   8
+#define MOTION_HINT_SEARCH_AREA_HEIGHT  8
 
 // 1-D interpolation shift value
 #define IFShift                     6
+// Size of the tiles the sub-pel search region is lazily interpolated in
+#define ME_INTERP_TILE_SIZE         16
 #define NUMBER_OF_SB_QUAD           4
 #define VARIANCE_PRECISION          16
 #define MEAN_PRECISION              (VARIANCE_PRECISION >> 1)
@@ -315,6 +320,16 @@ extern "C" {
         uint8_t                      *pos_b_buffer[MAX_NUM_OF_REF_PIC_LIST][MAX_REF_IDX];
         uint8_t                      *pos_h_buffer[MAX_NUM_OF_REF_PIC_LIST][MAX_REF_IDX];
         uint8_t                      *pos_j_buffer[MAX_NUM_OF_REF_PIC_LIST][MAX_REF_IDX];
+        // Lazy interpolation of the pos_b/h/j buffers: source region of the
+        // current SB and per-tile validity map
+        uint8_t                      *interp_src_ptr[MAX_NUM_OF_REF_PIC_LIST][MAX_REF_IDX];
+        uint32_t                      interp_src_stride[MAX_NUM_OF_REF_PIC_LIST][MAX_REF_IDX];
+        uint32_t                      interp_width[MAX_NUM_OF_REF_PIC_LIST][MAX_REF_IDX];
+        uint32_t                      interp_height[MAX_NUM_OF_REF_PIC_LIST][MAX_REF_IDX];
+        uint32_t                      interp_bit_depth;
+        uint8_t                      *interp_tile_valid[MAX_NUM_OF_REF_PIC_LIST][MAX_REF_IDX];
+        uint32_t                      interp_tile_stride;
+        uint32_t                      interp_tile_rows;
         uint8_t                      *one_d_intermediate_results_buf0;
         uint8_t                      *one_d_intermediate_results_buf1;
         int16_t                       x_search_area_origin[MAX_NUM_OF_REF_PIC_LIST][MAX_REF_IDX];
@@ -448,12 +463,28 @@ extern "C" {
         uint16_t                      hme_level2_search_area_in_width_array[EB_HME_SEARCH_AREA_COLUMN_MAX_COUNT];
         uint16_t                      hme_level2_search_area_in_height_array[EB_HME_SEARCH_AREA_ROW_MAX_COUNT];
         uint8_t                       update_hme_search_center_flag;
+        // Predictive zonal search of the HME search center
+        EbBool                        predictive_hme_flag;
+        // SB bounds of the ME segment, the neighbours outside of it are not searched yet
+        uint16_t                      segment_sb_x_start;
+        uint16_t                      segment_sb_x_end;
+        uint16_t                      segment_sb_y_start;
+        // Sum of the search centers found in the segment, per reference
+        int32_t                       segment_hme_sum_x[MAX_NUM_OF_REF_PIC_LIST][MAX_REF_IDX];
+        int32_t                       segment_hme_sum_y[MAX_NUM_OF_REF_PIC_LIST][MAX_REF_IDX];
+        uint32_t                      segment_hme_count[MAX_NUM_OF_REF_PIC_LIST][MAX_REF_IDX];
+        // Sums of the even and odd rows of the 8x8 blocks of the SB, for the successive elimination
+        uint16_t                      sb_block_sum[2][64];
 
         // ------- Context for Alt-Ref ME ------
         uint16_t                      adj_search_area_width;
         uint16_t                      adj_search_area_height;
         EbBool                        me_alt_ref;
         void                          *alt_ref_reference_ptr;
+        // HME search center of the last alt-ref search, kept by the temporal filtering
+        int16_t                       tf_hme_center_x;
+        int16_t                       tf_hme_center_y;
+        EbBool                        tf_hme_center_valid;
         // -------
     } MeContext;
 
@@ -87,6 +87,51 @@ static void write_td (
     }
 }
 
+/**************************************
+ * Export the 64x64 ME motion vectors of the
+ * picture against each of its references
+ **************************************/
+static void export_motion_field(
+    PictureParentControlSet *picture_control_set_ptr,
+    EbSvtMotionField        *motion_field)
+{
+    SequenceControlSet *sequence_control_set_ptr =
+        (SequenceControlSet *)picture_control_set_ptr->sequence_control_set_wrapper_ptr->object_ptr;
+    motion_field->mv_count = 0;
+    // The overlay is only predicted from its alt-ref, at the same distance
+    if (picture_control_set_ptr->slice_type == I_SLICE || picture_control_set_ptr->is_overlay)
+        return;
+    const uint32_t list_count = (picture_control_set_ptr->slice_type == P_SLICE) ? 1 : 2;
+    for (uint32_t list_index = REF_LIST_0; list_index < list_count; list_index++)
+        motion_field->mv_count += (list_index == REF_LIST_0)
+            ? picture_control_set_ptr->ref_list0_count
+            : picture_control_set_ptr->ref_list1_count;
+    motion_field->mv_count = MIN(motion_field->mv_count, EB_MOTION_FIELD_MAX_MV_COUNT);
+
+    const uint32_t block_count = MIN(
+        motion_field->block_cols * motion_field->block_rows,
+        (uint32_t)sequence_control_set_ptr->sb_total_count);
+    for (uint32_t block_index = 0; block_index < block_count; block_index++) {
+        const MvCandidate *me_mv = picture_control_set_ptr->me_results[block_index]->me_mv_array[ME_TIER_ZERO_PU_64x64];
+        EbSvtMotionVector *mv = &motion_field->mvs[block_index * motion_field->mv_count];
+        uint32_t mv_index = 0;
+        for (uint32_t list_index = REF_LIST_0; list_index < list_count; list_index++) {
+            const uint8_t ref_count = (list_index == REF_LIST_0)
+                ? picture_control_set_ptr->ref_list0_count
+                : picture_control_set_ptr->ref_list1_count;
+            for (uint8_t ref_pic_index = 0; ref_pic_index < ref_count && mv_index < motion_field->mv_count; ref_pic_index++) {
+                const uint32_t me_mv_index =
+                    ((list_index && sequence_control_set_ptr->mrp_mode == 0) ? 4 : list_index ? 2 : 0) + ref_pic_index;
+                mv[mv_index].mv_x = me_mv[me_mv_index].x_mv;
+                mv[mv_index].mv_y = me_mv[me_mv_index].y_mv;
+                mv[mv_index].ref_offset = (int32_t)((int64_t)picture_control_set_ptr->ref_pic_poc_array[list_index][ref_pic_index] -
+                    (int64_t)picture_control_set_ptr->picture_number);
+                mv_index++;
+            }
+        }
+    }
+}
+
 void update_rc_rate_tables(
     PictureControlSet            *picture_control_set_ptr,
     SequenceControlSet           *sequence_control_set_ptr) {
@@ -131,7 +176,7 @@ void update_rc_rate_tables(
         {
             eb_block_on_mutex(encode_context_ptr->rate_table_update_mutex);
 
-            uint64_t ref_qindex_dequant = (uint64_t)picture_control_set_ptr->parent_pcs_ptr->deq.y_dequant_QTX[frm_hdr->quantization_params.base_q_idx][1];
+            uint64_t ref_qindex_dequant = (uint64_t)picture_control_set_ptr->parent_pcs_ptr->deq->y_dequant_QTX[frm_hdr->quantization_params.base_q_idx][1];
             uint64_t sad_bits_ref_dequant = 0;
             uint64_t weight = 0;
             {
@@ -149,7 +194,7 @@ void update_rc_rate_tables(
                                 sad_bits_ref_dequant = sadBits[sad_interval_index] * ref_qindex_dequant;
                                 for (qp_index = sequence_control_set_ptr->static_config.min_qp_allowed; qp_index <= (int32_t)sequence_control_set_ptr->static_config.max_qp_allowed; qp_index++) {
                                     encode_context_ptr->rate_control_tables_array[qp_index].intra_sad_bits_array[picture_control_set_ptr->temporal_layer_index][sad_interval_index] =
-                                        (EbBitNumber)(((weight * sad_bits_ref_dequant / picture_control_set_ptr->parent_pcs_ptr->deq.y_dequant_QTX[quantizer_to_qindex[qp_index]][1])
+                                        (EbBitNumber)(((weight * sad_bits_ref_dequant / picture_control_set_ptr->parent_pcs_ptr->deq->y_dequant_QTX[quantizer_to_qindex[qp_index]][1])
                                             + (10 - weight) * (uint32_t)encode_context_ptr->rate_control_tables_array[qp_index].intra_sad_bits_array[picture_control_set_ptr->temporal_layer_index][sad_interval_index] + 5) / 10);
 
                                     encode_context_ptr->rate_control_tables_array[qp_index].intra_sad_bits_array[picture_control_set_ptr->temporal_layer_index][sad_interval_index] =
@@ -171,7 +216,7 @@ void update_rc_rate_tables(
                                 sad_bits_ref_dequant = sadBits[sad_interval_index] * ref_qindex_dequant;
                                 for (qp_index = sequence_control_set_ptr->static_config.min_qp_allowed; qp_index <= (int32_t)sequence_control_set_ptr->static_config.max_qp_allowed; qp_index++) {
                                     encode_context_ptr->rate_control_tables_array[qp_index].intra_sad_bits_array[picture_control_set_ptr->temporal_layer_index][sad_interval_index] =
-                                        (EbBitNumber)(((weight * sad_bits_ref_dequant / picture_control_set_ptr->parent_pcs_ptr->deq.y_dequant_QTX[quantizer_to_qindex[qp_index]][1])
+                                        (EbBitNumber)(((weight * sad_bits_ref_dequant / picture_control_set_ptr->parent_pcs_ptr->deq->y_dequant_QTX[quantizer_to_qindex[qp_index]][1])
                                             + (10 - weight) * (uint32_t)encode_context_ptr->rate_control_tables_array[qp_index].intra_sad_bits_array[picture_control_set_ptr->temporal_layer_index][sad_interval_index] + 5) / 10);
 
                                     encode_context_ptr->rate_control_tables_array[qp_index].intra_sad_bits_array[picture_control_set_ptr->temporal_layer_index][sad_interval_index] =
@@ -195,7 +240,7 @@ void update_rc_rate_tables(
                                 sad_bits_ref_dequant = sadBits[sad_interval_index] * ref_qindex_dequant;
                                 for (qp_index = sequence_control_set_ptr->static_config.min_qp_allowed; qp_index <= (int32_t)sequence_control_set_ptr->static_config.max_qp_allowed; qp_index++) {
                                     encode_context_ptr->rate_control_tables_array[qp_index].sad_bits_array[picture_control_set_ptr->temporal_layer_index][sad_interval_index] =
-                                        (EbBitNumber)(((weight * sad_bits_ref_dequant / picture_control_set_ptr->parent_pcs_ptr->deq.y_dequant_QTX[quantizer_to_qindex[qp_index]][1])
+                                        (EbBitNumber)(((weight * sad_bits_ref_dequant / picture_control_set_ptr->parent_pcs_ptr->deq->y_dequant_QTX[quantizer_to_qindex[qp_index]][1])
                                             + (10 - weight) * (uint32_t)encode_context_ptr->rate_control_tables_array[qp_index].sad_bits_array[picture_control_set_ptr->temporal_layer_index][sad_interval_index] + 5) / 10);
                                     encode_context_ptr->rate_control_tables_array[qp_index].sad_bits_array[picture_control_set_ptr->temporal_layer_index][sad_interval_index] =
                                         MIN((uint16_t)encode_context_ptr->rate_control_tables_array[qp_index].sad_bits_array[picture_control_set_ptr->temporal_layer_index][sad_interval_index], (uint16_t)((1 << 15) - 1));
@@ -216,7 +261,7 @@ void update_rc_rate_tables(
                                 sad_bits_ref_dequant = sadBits[sad_interval_index] * ref_qindex_dequant;
                                 for (qp_index = sequence_control_set_ptr->static_config.min_qp_allowed; qp_index <= (int32_t)sequence_control_set_ptr->static_config.max_qp_allowed; qp_index++) {
                                     encode_context_ptr->rate_control_tables_array[qp_index].sad_bits_array[picture_control_set_ptr->temporal_layer_index][sad_interval_index] =
-                                        (EbBitNumber)(((weight * sad_bits_ref_dequant / picture_control_set_ptr->parent_pcs_ptr->deq.y_dequant_QTX[quantizer_to_qindex[qp_index]][1])
+                                        (EbBitNumber)(((weight * sad_bits_ref_dequant / picture_control_set_ptr->parent_pcs_ptr->deq->y_dequant_QTX[quantizer_to_qindex[qp_index]][1])
                                             + (10 - weight) * (uint32_t)encode_context_ptr->rate_control_tables_array[qp_index].sad_bits_array[picture_control_set_ptr->temporal_layer_index][sad_interval_index] + 5) / 10);
                                     encode_context_ptr->rate_control_tables_array[qp_index].sad_bits_array[picture_control_set_ptr->temporal_layer_index][sad_interval_index] =
                                         MIN((uint16_t)encode_context_ptr->rate_control_tables_array[qp_index].sad_bits_array[picture_control_set_ptr->temporal_layer_index][sad_interval_index], (uint16_t)((1 << 15) - 1));
@@ -298,6 +343,8 @@ void* packetization_kernel(void *input_ptr)
             picture_control_set_ptr->slice_type : EB_AV1_NON_REF_PICTURE;
         output_stream_ptr->p_app_private = picture_control_set_ptr->parent_pcs_ptr->input_ptr->p_app_private;
         output_stream_ptr->qp            = picture_control_set_ptr->parent_pcs_ptr->picture_qp;
+        if (output_stream_ptr->motion_field)
+            export_motion_field(picture_control_set_ptr->parent_pcs_ptr, output_stream_ptr->motion_field);
 
         if (sequence_control_set_ptr->static_config.stat_report){
             output_stream_ptr->luma_sse = picture_control_set_ptr->parent_pcs_ptr->luma_sse;
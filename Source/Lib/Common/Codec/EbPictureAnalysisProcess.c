@@ -19,6 +19,7 @@
 #include "EbMcp.h"
 #include "EbMotionEstimation.h"
 #include "EbReferenceObject.h"
+#include "EbSharedAnalysis.h"
 
 #include "EbComputeMean.h"
 #include "EbMeSadCalculation.h"
@@ -3397,10 +3398,71 @@ void PicturePreProcessingOperations(
 * Generate picture histogram bins for YUV pixel intensity *
 * Calculation is done on a region based (Set previously, resolution dependent)
 **************************************************************/
-void SubSampleLumaGeneratePixelIntensityHistogramBins(
+static void InitLumaHistogramBins(
+    SequenceControlSet            *sequence_control_set_ptr,
+    PictureParentControlSet       *picture_control_set_ptr,
+    uint64_t                       region_sum[MAX_NUMBER_OF_REGIONS_IN_WIDTH][MAX_NUMBER_OF_REGIONS_IN_HEIGHT]) {
+    uint32_t                          regionInPictureWidthIndex;
+    uint32_t                          regionInPictureHeightIndex;
+
+    for (regionInPictureWidthIndex = 0; regionInPictureWidthIndex < sequence_control_set_ptr->picture_analysis_number_of_regions_per_width; regionInPictureWidthIndex++) {  // loop over horizontal regions
+        for (regionInPictureHeightIndex = 0; regionInPictureHeightIndex < sequence_control_set_ptr->picture_analysis_number_of_regions_per_height; regionInPictureHeightIndex++) { // loop over vertical regions
+            // Initialize bins to 1
+            initialize_buffer_32bits(picture_control_set_ptr->picture_histogram[regionInPictureWidthIndex][regionInPictureHeightIndex][0], 64, 0, 1);
+            region_sum[regionInPictureWidthIndex][regionInPictureHeightIndex] = 0;
+        }
+    }
+}
+
+/**************************************************************
+* Accumulates the luma histogram bins of a block of the 1/16 decimated
+* picture into the histograms of the regions it overlaps
+**************************************************************/
+static void AccumulateLumaHistogramBins(
+    SequenceControlSet            *sequence_control_set_ptr,
+    PictureParentControlSet       *picture_control_set_ptr,
+    EbPictureBufferDesc           *input_picture_ptr,
+    uint32_t                       block_origin_x,
+    uint32_t                       block_origin_y,
+    uint32_t                       block_width,
+    uint32_t                       block_height,
+    uint64_t                       region_sum[MAX_NUMBER_OF_REGIONS_IN_WIDTH][MAX_NUMBER_OF_REGIONS_IN_HEIGHT]) {
+    const uint32_t regionsPerWidth = sequence_control_set_ptr->picture_analysis_number_of_regions_per_width;
+    const uint32_t regionsPerHeight = sequence_control_set_ptr->picture_analysis_number_of_regions_per_height;
+    const uint32_t regionWidth = input_picture_ptr->width / regionsPerWidth;
+    const uint32_t regionHeight = input_picture_ptr->height / regionsPerHeight;
+    const uint32_t blockEndX = MIN(block_origin_x + block_width, input_picture_ptr->width);
+    const uint32_t blockEndY = MIN(block_origin_y + block_height, input_picture_ptr->height);
+    uint32_t x, y, nextX, nextY;
+    uint64_t sum;
+
+    // The last region of a row / column also takes the remaining samples
+    for (y = block_origin_y; y < blockEndY; y = nextY) {
+        uint32_t regionInPictureHeightIndex = regionHeight ? MIN(y / regionHeight, regionsPerHeight - 1) : regionsPerHeight - 1;
+        nextY = (regionInPictureHeightIndex == regionsPerHeight - 1) ? blockEndY : MIN(blockEndY, (regionInPictureHeightIndex + 1) * regionHeight);
+        for (x = block_origin_x; x < blockEndX; x = nextX) {
+            uint32_t regionInPictureWidthIndex = regionWidth ? MIN(x / regionWidth, regionsPerWidth - 1) : regionsPerWidth - 1;
+            nextX = (regionInPictureWidthIndex == regionsPerWidth - 1) ? blockEndX : MIN(blockEndX, (regionInPictureWidthIndex + 1) * regionWidth);
+
+            // Y Histogram
+            CalculateHistogram(
+                &input_picture_ptr->buffer_y[(input_picture_ptr->origin_x + x) + ((input_picture_ptr->origin_y + y) * input_picture_ptr->stride_y)],
+                nextX - x,
+                nextY - y,
+                input_picture_ptr->stride_y,
+                1,
+                picture_control_set_ptr->picture_histogram[regionInPictureWidthIndex][regionInPictureHeightIndex][0],
+                &sum);
+            region_sum[regionInPictureWidthIndex][regionInPictureHeightIndex] += sum;
+        }
+    }
+}
+
+static void FinalizeLumaHistogramBins(
     SequenceControlSet            *sequence_control_set_ptr,
     PictureParentControlSet       *picture_control_set_ptr,
     EbPictureBufferDesc           *input_picture_ptr,
+    uint64_t                       region_sum[MAX_NUMBER_OF_REGIONS_IN_WIDTH][MAX_NUMBER_OF_REGIONS_IN_HEIGHT],
     uint64_t                          *sumAverageIntensityTotalRegionsLuma) {
     uint32_t                          regionWidth;
     uint32_t                          regionHeight;
@@ -3417,10 +3479,6 @@ void SubSampleLumaGeneratePixelIntensityHistogramBins(
     // Loop over regions inside the picture
     for (regionInPictureWidthIndex = 0; regionInPictureWidthIndex < sequence_control_set_ptr->picture_analysis_number_of_regions_per_width; regionInPictureWidthIndex++) {  // loop over horizontal regions
         for (regionInPictureHeightIndex = 0; regionInPictureHeightIndex < sequence_control_set_ptr->picture_analysis_number_of_regions_per_height; regionInPictureHeightIndex++) { // loop over vertical regions
-
-            // Initialize bins to 1
-            initialize_buffer_32bits(picture_control_set_ptr->picture_histogram[regionInPictureWidthIndex][regionInPictureHeightIndex][0], 64, 0, 1);
-
             regionWidthOffset = (regionInPictureWidthIndex == sequence_control_set_ptr->picture_analysis_number_of_regions_per_width - 1) ?
                 input_picture_ptr->width - (sequence_control_set_ptr->picture_analysis_number_of_regions_per_width * regionWidth) :
                 0;
@@ -3429,16 +3487,7 @@ void SubSampleLumaGeneratePixelIntensityHistogramBins(
                 input_picture_ptr->height - (sequence_control_set_ptr->picture_analysis_number_of_regions_per_height * regionHeight) :
                 0;
 
-            // Y Histogram
-            CalculateHistogram(
-                &input_picture_ptr->buffer_y[(input_picture_ptr->origin_x + regionInPictureWidthIndex * regionWidth) + ((input_picture_ptr->origin_y + regionInPictureHeightIndex * regionHeight) * input_picture_ptr->stride_y)],
-                regionWidth + regionWidthOffset,
-                regionHeight + regionHeightOffset,
-                input_picture_ptr->stride_y,
-                1,
-                picture_control_set_ptr->picture_histogram[regionInPictureWidthIndex][regionInPictureHeightIndex][0],
-                &sum);
-
+            sum = region_sum[regionInPictureWidthIndex][regionInPictureHeightIndex];
             picture_control_set_ptr->average_intensity_per_region[regionInPictureWidthIndex][regionInPictureHeightIndex][0] = (uint8_t)((sum + (((regionWidth + regionWidthOffset)*(regionHeight + regionHeightOffset)) >> 1)) / ((regionWidth + regionWidthOffset)*(regionHeight + regionHeightOffset)));
             (*sumAverageIntensityTotalRegionsLuma) += (sum << 4);
             for (histogramBin = 0; histogramBin < HISTOGRAM_NUMBER_OF_BINS; histogramBin++) { // Loop over the histogram bins
@@ -3447,6 +3496,34 @@ void SubSampleLumaGeneratePixelIntensityHistogramBins(
             }
         }
     }
+}
+
+void SubSampleLumaGeneratePixelIntensityHistogramBins(
+    SequenceControlSet            *sequence_control_set_ptr,
+    PictureParentControlSet       *picture_control_set_ptr,
+    EbPictureBufferDesc           *input_picture_ptr,
+    uint64_t                          *sumAverageIntensityTotalRegionsLuma) {
+    uint64_t region_sum[MAX_NUMBER_OF_REGIONS_IN_WIDTH][MAX_NUMBER_OF_REGIONS_IN_HEIGHT];
+
+    InitLumaHistogramBins(
+        sequence_control_set_ptr,
+        picture_control_set_ptr,
+        region_sum);
+    AccumulateLumaHistogramBins(
+        sequence_control_set_ptr,
+        picture_control_set_ptr,
+        input_picture_ptr,
+        0,
+        0,
+        input_picture_ptr->width,
+        input_picture_ptr->height,
+        region_sum);
+    FinalizeLumaHistogramBins(
+        sequence_control_set_ptr,
+        picture_control_set_ptr,
+        input_picture_ptr,
+        region_sum,
+        sumAverageIntensityTotalRegionsLuma);
 
     return;
 }
@@ -3762,64 +3839,70 @@ void DetermineHomogeneousRegionInPicture(
     return;
 }
 /************************************************
- * ComputePictureSpatialStatistics
- ** Compute Block Variance
- ** Compute Picture Variance
- ** Compute Block Mean for all blocks in the picture
+ * ComputeSbSpatialStatistics
+ ** Compute Block Variance and Block Mean for all blocks in the SB
  ************************************************/
-void ComputePictureSpatialStatistics(
+static void ComputeSbSpatialStatistics(
     SequenceControlSet            *sequence_control_set_ptr,
     PictureParentControlSet       *picture_control_set_ptr,
     EbPictureBufferDesc           *input_picture_ptr,
     EbPictureBufferDesc           *input_padded_picture_ptr,
-    uint32_t                           sb_total_count)
+    uint32_t                       sb_index)
 {
-    uint32_t sb_index;
-    uint32_t sb_origin_x;        // to avoid using child PCS
-    uint32_t sb_origin_y;
+    SbParams   *sb_params = &sequence_control_set_ptr->sb_params_array[sb_index];
+    uint32_t sb_origin_x = sb_params->origin_x;        // to avoid using child PCS
+    uint32_t sb_origin_y = sb_params->origin_y;
     uint32_t inputLumaOriginIndex;
     uint32_t inputCbOriginIndex;
     uint32_t inputCrOriginIndex;
-    uint64_t picTotVariance;
 
-    // Variance
-    picTotVariance = 0;
+    inputLumaOriginIndex = (input_padded_picture_ptr->origin_y + sb_origin_y) * input_padded_picture_ptr->stride_y +
+        input_padded_picture_ptr->origin_x + sb_origin_x;
 
-    for (sb_index = 0; sb_index < picture_control_set_ptr->sb_total_count; ++sb_index) {
-        SbParams   *sb_params = &sequence_control_set_ptr->sb_params_array[sb_index];
-
-        sb_origin_x = sb_params->origin_x;
-        sb_origin_y = sb_params->origin_y;
-        inputLumaOriginIndex = (input_padded_picture_ptr->origin_y + sb_origin_y) * input_padded_picture_ptr->stride_y +
-            input_padded_picture_ptr->origin_x + sb_origin_x;
+    inputCbOriginIndex = ((input_picture_ptr->origin_y + sb_origin_y) >> 1) * input_picture_ptr->stride_cb + ((input_picture_ptr->origin_x + sb_origin_x) >> 1);
+    inputCrOriginIndex = ((input_picture_ptr->origin_y + sb_origin_y) >> 1) * input_picture_ptr->stride_cr + ((input_picture_ptr->origin_x + sb_origin_x) >> 1);
 
-        inputCbOriginIndex = ((input_picture_ptr->origin_y + sb_origin_y) >> 1) * input_picture_ptr->stride_cb + ((input_picture_ptr->origin_x + sb_origin_x) >> 1);
-        inputCrOriginIndex = ((input_picture_ptr->origin_y + sb_origin_y) >> 1) * input_picture_ptr->stride_cr + ((input_picture_ptr->origin_x + sb_origin_x) >> 1);
+    ComputeBlockMeanComputeVariance(
+        sequence_control_set_ptr,
+        picture_control_set_ptr,
+        input_padded_picture_ptr,
+        sb_index,
+        inputLumaOriginIndex);
 
-        ComputeBlockMeanComputeVariance(
+    if (sb_params->is_complete_sb) {
+        ComputeChromaBlockMean(
             sequence_control_set_ptr,
             picture_control_set_ptr,
-            input_padded_picture_ptr,
+            input_picture_ptr,
             sb_index,
-            inputLumaOriginIndex);
+            inputCbOriginIndex,
+            inputCrOriginIndex);
+    }
+    else {
+        ZeroOutChromaBlockMean(
+            picture_control_set_ptr,
+            sb_index);
+    }
+}
 
-        if (sb_params->is_complete_sb) {
-            ComputeChromaBlockMean(
-                sequence_control_set_ptr,
-                picture_control_set_ptr,
-                input_picture_ptr,
-                sb_index,
-                inputCbOriginIndex,
-                inputCrOriginIndex);
-        }
-        else {
-            ZeroOutChromaBlockMean(
-                picture_control_set_ptr,
-                sb_index);
-        }
+/************************************************
+ * FinalizePictureSpatialStatistics
+ ** Compute Picture Variance from the SB variances
+ ** Detect the homogeneous regions and the edges
+ ************************************************/
+static void FinalizePictureSpatialStatistics(
+    SequenceControlSet            *sequence_control_set_ptr,
+    PictureParentControlSet       *picture_control_set_ptr,
+    uint32_t                           sb_total_count)
+{
+    uint32_t sb_index;
+    uint64_t picTotVariance;
+
+    // Variance
+    picTotVariance = 0;
 
+    for (sb_index = 0; sb_index < picture_control_set_ptr->sb_total_count; ++sb_index)
         picTotVariance += (picture_control_set_ptr->variance[sb_index][RASTER_SCAN_CU_INDEX_64x64]);
-    }
 
     picture_control_set_ptr->pic_avg_variance = (uint16_t)(picTotVariance / sb_total_count);
 
@@ -3840,6 +3923,38 @@ void ComputePictureSpatialStatistics(
     return;
 }
 
+/************************************************
+ * ComputePictureSpatialStatistics
+ ** Compute Block Variance
+ ** Compute Picture Variance
+ ** Compute Block Mean for all blocks in the picture
+ ************************************************/
+void ComputePictureSpatialStatistics(
+    SequenceControlSet            *sequence_control_set_ptr,
+    PictureParentControlSet       *picture_control_set_ptr,
+    EbPictureBufferDesc           *input_picture_ptr,
+    EbPictureBufferDesc           *input_padded_picture_ptr,
+    uint32_t                           sb_total_count)
+{
+    uint32_t sb_index;
+
+    for (sb_index = 0; sb_index < picture_control_set_ptr->sb_total_count; ++sb_index) {
+        ComputeSbSpatialStatistics(
+            sequence_control_set_ptr,
+            picture_control_set_ptr,
+            input_picture_ptr,
+            input_padded_picture_ptr,
+            sb_index);
+    }
+
+    FinalizePictureSpatialStatistics(
+        sequence_control_set_ptr,
+        picture_control_set_ptr,
+        sb_total_count);
+
+    return;
+}
+
 void CalculateInputAverageIntensity(
     SequenceControlSet            *sequence_control_set_ptr,
     PictureParentControlSet       *picture_control_set_ptr,
@@ -3934,6 +4049,47 @@ void GatheringPictureStatistics(
 
     return;
 }
+
+/************************************************
+ * Gathering the picture level statistics
+ ** Complements AnalyzeInputPictureBlocks(), which gathers the block
+ ** statistics and the luma histogram bins
+ ************************************************/
+static void GatheringPictureLevelStatistics(
+    SequenceControlSet            *sequence_control_set_ptr,
+    PictureParentControlSet       *picture_control_set_ptr,
+    EbPictureBufferDesc           *input_picture_ptr,
+    uint64_t                       sumAverageIntensityTotalRegionsLuma,
+    uint32_t                       sb_total_count)
+{
+    uint64_t                          sumAverageIntensityTotalRegionsCb = 0;
+    uint64_t                          sumAverageIntensityTotalRegionsCr = 0;
+
+    // Use 1/4 Chroma for Histogram generation
+    // 1/4 input not ready => perform operation on the fly
+    SubSampleChromaGeneratePixelIntensityHistogramBins(
+        sequence_control_set_ptr,
+        picture_control_set_ptr,
+        input_picture_ptr,
+        &sumAverageIntensityTotalRegionsCb,
+        &sumAverageIntensityTotalRegionsCr);
+    //
+    // Calculate the LUMA average intensity
+    CalculateInputAverageIntensity(
+        sequence_control_set_ptr,
+        picture_control_set_ptr,
+        input_picture_ptr,
+        sumAverageIntensityTotalRegionsLuma,
+        sumAverageIntensityTotalRegionsCb,
+        sumAverageIntensityTotalRegionsCr);
+
+    FinalizePictureSpatialStatistics(
+        sequence_control_set_ptr,
+        picture_control_set_ptr,
+        sb_total_count);
+
+    return;
+}
 /************************************************
  * Pad Picture at the right and bottom sides
  ** To match a multiple of min CU size in width and height
@@ -4024,24 +4180,96 @@ void PadPictureToMultipleOfLcuDimensions(
 }
 
 /************************************************
-* 1/4 & 1/16 input picture decimation
+ * Block sums of the padded input picture for the
+ * successive elimination of the full-pel ME: the
+ * sum of the 8x4 block of the rows y, y + 2, y + 4
+ * and y + 6 at each position (x, y), the sum of the
+ * 8x8 block is the sum at (x, y) and (x, y + 1)
+ ************************************************/
+void GenerateMeBlockSums(
+    EbPaReferenceObject           *pa_reference_object)
+{
+    EbPictureBufferDesc *input_padded_picture_ptr = pa_reference_object->input_padded_picture_ptr;
+    uint16_t *block_sum = pa_reference_object->me_block_sum;
+    const uint32_t stride = input_padded_picture_ptr->stride_y;
+    const uint32_t height = input_padded_picture_ptr->luma_size / stride;
+    uint32_t x, y;
+
+    if (block_sum == NULL)
+        return;
+
+    // Sum of the 8 samples of the row at each position
+    for (y = 0; y < height; ++y) {
+        const uint8_t *src = &input_padded_picture_ptr->buffer_y[y * stride];
+        uint16_t *dst = &block_sum[y * stride];
+        uint16_t sum = 0;
+        for (x = 0; x < 8; ++x)
+            sum += src[x];
+        dst[0] = sum;
+        for (x = 1; x + 8 <= stride; ++x) {
+            sum += src[x + 7] - src[x - 1];
+            dst[x] = sum;
+        }
+    }
+
+    // Sum of the rows y, y + 2, y + 4 and y + 6, in place as only the following rows are read
+    for (y = 0; y + 6 < height; ++y) {
+        uint16_t *dst = &block_sum[y * stride];
+        for (x = 0; x + 8 <= stride; ++x)
+            dst[x] += dst[x + 2 * stride] + dst[x + 4 * stride] + dst[x + 6 * stride];
+    }
+
+    return;
+}
+
+/************************************************
+* 1/4 & 1/16 input picture decimation of the rows [y_start, y_end)
+** y_start is a multiple of 4, the decimated pictures are not padded
 ************************************************/
-void DownsampleDecimationInputPicture(
+void DownsampleDecimationInputPictureRows(
     PictureParentControlSet       *picture_control_set_ptr,
     EbPictureBufferDesc           *input_padded_picture_ptr,
     EbPictureBufferDesc           *quarter_decimated_picture_ptr,
-    EbPictureBufferDesc           *sixteenth_decimated_picture_ptr) {
+    EbPictureBufferDesc           *sixteenth_decimated_picture_ptr,
+    uint32_t                       y_start,
+    uint32_t                       y_end) {
+    uint8_t *input_ptr = &input_padded_picture_ptr->buffer_y[input_padded_picture_ptr->origin_x + (input_padded_picture_ptr->origin_y + y_start) * input_padded_picture_ptr->stride_y];
+
     // Decimate input picture for HME L0 and L1
     if (picture_control_set_ptr->enable_hme_flag || picture_control_set_ptr->tf_enable_hme_flag) {
         if (picture_control_set_ptr->enable_hme_level1_flag || picture_control_set_ptr->tf_enable_hme_level1_flag) {
             decimation_2d(
-                &input_padded_picture_ptr->buffer_y[input_padded_picture_ptr->origin_x + input_padded_picture_ptr->origin_y * input_padded_picture_ptr->stride_y],
+                input_ptr,
                 input_padded_picture_ptr->stride_y,
                 input_padded_picture_ptr->width,
-                input_padded_picture_ptr->height,
-                &quarter_decimated_picture_ptr->buffer_y[quarter_decimated_picture_ptr->origin_x + quarter_decimated_picture_ptr->origin_x*quarter_decimated_picture_ptr->stride_y],
+                y_end - y_start,
+                &quarter_decimated_picture_ptr->buffer_y[quarter_decimated_picture_ptr->origin_x + (quarter_decimated_picture_ptr->origin_x + (y_start >> 1))*quarter_decimated_picture_ptr->stride_y],
                 quarter_decimated_picture_ptr->stride_y,
                 2);
+        }
+    }
+
+    // Always perform 1/16th decimation as
+    // Sixteenth Input Picture Decimation
+    decimation_2d(
+        input_ptr,
+        input_padded_picture_ptr->stride_y,
+        input_padded_picture_ptr->width,
+        y_end - y_start,
+        &sixteenth_decimated_picture_ptr->buffer_y[sixteenth_decimated_picture_ptr->origin_x + (sixteenth_decimated_picture_ptr->origin_x + (y_start >> 2))*sixteenth_decimated_picture_ptr->stride_y],
+        sixteenth_decimated_picture_ptr->stride_y,
+        4);
+}
+
+/************************************************
+* 1/4 & 1/16 decimated input picture padding
+************************************************/
+void PadDecimatedInputPicture(
+    PictureParentControlSet       *picture_control_set_ptr,
+    EbPictureBufferDesc           *quarter_decimated_picture_ptr,
+    EbPictureBufferDesc           *sixteenth_decimated_picture_ptr) {
+    if (picture_control_set_ptr->enable_hme_flag || picture_control_set_ptr->tf_enable_hme_flag) {
+        if (picture_control_set_ptr->enable_hme_level1_flag || picture_control_set_ptr->tf_enable_hme_level1_flag) {
             generate_padding(
                 &quarter_decimated_picture_ptr->buffer_y[0],
                 quarter_decimated_picture_ptr->stride_y,
@@ -4052,17 +4280,127 @@ void DownsampleDecimationInputPicture(
         }
     }
 
-    // Always perform 1/16th decimation as
-    // Sixteenth Input Picture Decimation
-    decimation_2d(
-        &input_padded_picture_ptr->buffer_y[input_padded_picture_ptr->origin_x + input_padded_picture_ptr->origin_y * input_padded_picture_ptr->stride_y],
-        input_padded_picture_ptr->stride_y,
-        input_padded_picture_ptr->width,
-        input_padded_picture_ptr->height,
-        &sixteenth_decimated_picture_ptr->buffer_y[sixteenth_decimated_picture_ptr->origin_x + sixteenth_decimated_picture_ptr->origin_x*sixteenth_decimated_picture_ptr->stride_y],
+    generate_padding(
+        &sixteenth_decimated_picture_ptr->buffer_y[0],
         sixteenth_decimated_picture_ptr->stride_y,
-        4);
+        sixteenth_decimated_picture_ptr->width,
+        sixteenth_decimated_picture_ptr->height,
+        sixteenth_decimated_picture_ptr->origin_x,
+        sixteenth_decimated_picture_ptr->origin_y);
+}
+
+/************************************************
+* 1/4 & 1/16 input picture decimation
+************************************************/
+void DownsampleDecimationInputPicture(
+    PictureParentControlSet       *picture_control_set_ptr,
+    EbPictureBufferDesc           *input_padded_picture_ptr,
+    EbPictureBufferDesc           *quarter_decimated_picture_ptr,
+    EbPictureBufferDesc           *sixteenth_decimated_picture_ptr) {
+    DownsampleDecimationInputPictureRows(
+        picture_control_set_ptr,
+        input_padded_picture_ptr,
+        quarter_decimated_picture_ptr,
+        sixteenth_decimated_picture_ptr,
+        0,
+        input_padded_picture_ptr->height);
+
+    PadDecimatedInputPicture(
+        picture_control_set_ptr,
+        quarter_decimated_picture_ptr,
+        sixteenth_decimated_picture_ptr);
+}
+/************************************************
+ * Analyze Input Picture Blocks
+ ** One sweep over the 64x64 blocks of the input picture that performs the
+ ** 1/4 & 1/16 decimation of the block and, when gather_statistics is set,
+ ** accumulates its 1/16 luma histogram bins and computes its block means
+ ** and variances while the block is still in the cache. Bit-exact with
+ ** DownsampleDecimationInputPicture() followed by the luma histogram and
+ ** the SB loop of GatheringPictureStatistics().
+ ************************************************/
+static void AnalyzeInputPictureBlocks(
+    SequenceControlSet            *sequence_control_set_ptr,
+    PictureParentControlSet       *picture_control_set_ptr,
+    EbPictureBufferDesc           *input_picture_ptr,
+    EbPictureBufferDesc           *input_padded_picture_ptr,
+    EbPictureBufferDesc           *quarter_decimated_picture_ptr,
+    EbPictureBufferDesc           *sixteenth_decimated_picture_ptr,
+    EbBool                         gather_statistics,
+    uint64_t                      *sumAverageIntensityTotalRegionsLuma)
+{
+    uint64_t region_sum[MAX_NUMBER_OF_REGIONS_IN_WIDTH][MAX_NUMBER_OF_REGIONS_IN_HEIGHT];
+    EbBool quarter_decimation =
+        (picture_control_set_ptr->enable_hme_flag || picture_control_set_ptr->tf_enable_hme_flag) &&
+        (picture_control_set_ptr->enable_hme_level1_flag || picture_control_set_ptr->tf_enable_hme_level1_flag);
+    uint8_t *input_origin = &input_padded_picture_ptr->buffer_y[input_padded_picture_ptr->origin_x + input_padded_picture_ptr->origin_y * input_padded_picture_ptr->stride_y];
+    uint8_t *quarter_origin = &quarter_decimated_picture_ptr->buffer_y[quarter_decimated_picture_ptr->origin_x + quarter_decimated_picture_ptr->origin_x*quarter_decimated_picture_ptr->stride_y];
+    uint8_t *sixteenth_origin = &sixteenth_decimated_picture_ptr->buffer_y[sixteenth_decimated_picture_ptr->origin_x + sixteenth_decimated_picture_ptr->origin_x*sixteenth_decimated_picture_ptr->stride_y];
+    uint32_t sb_index;
 
+    if (gather_statistics) {
+        InitLumaHistogramBins(
+            sequence_control_set_ptr,
+            picture_control_set_ptr,
+            region_sum);
+    }
+
+    for (sb_index = 0; sb_index < picture_control_set_ptr->sb_total_count; ++sb_index) {
+        SbParams *sb_params = &sequence_control_set_ptr->sb_params_array[sb_index];
+        uint32_t block_width = MIN((uint32_t)sequence_control_set_ptr->sb_sz, (uint32_t)(input_padded_picture_ptr->width - sb_params->origin_x));
+        uint32_t block_height = MIN((uint32_t)sequence_control_set_ptr->sb_sz, (uint32_t)(input_padded_picture_ptr->height - sb_params->origin_y));
+        uint8_t *block_ptr = input_origin + sb_params->origin_y * input_padded_picture_ptr->stride_y + sb_params->origin_x;
+
+        // Decimate the block for HME L0 and L1
+        if (quarter_decimation) {
+            decimation_2d(
+                block_ptr,
+                input_padded_picture_ptr->stride_y,
+                block_width,
+                block_height,
+                quarter_origin + (sb_params->origin_y >> 1) * quarter_decimated_picture_ptr->stride_y + (sb_params->origin_x >> 1),
+                quarter_decimated_picture_ptr->stride_y,
+                2);
+        }
+        decimation_2d(
+            block_ptr,
+            input_padded_picture_ptr->stride_y,
+            block_width,
+            block_height,
+            sixteenth_origin + (sb_params->origin_y >> 2) * sixteenth_decimated_picture_ptr->stride_y + (sb_params->origin_x >> 2),
+            sixteenth_decimated_picture_ptr->stride_y,
+            4);
+
+        if (gather_statistics) {
+            // Use 1/16 Luma for Histogram generation
+            AccumulateLumaHistogramBins(
+                sequence_control_set_ptr,
+                picture_control_set_ptr,
+                sixteenth_decimated_picture_ptr,
+                sb_params->origin_x >> 2,
+                sb_params->origin_y >> 2,
+                (block_width + 3) >> 2,
+                (block_height + 3) >> 2,
+                region_sum);
+
+            ComputeSbSpatialStatistics(
+                sequence_control_set_ptr,
+                picture_control_set_ptr,
+                input_picture_ptr,
+                input_padded_picture_ptr,
+                sb_index);
+        }
+    }
+
+    if (quarter_decimation) {
+        generate_padding(
+            &quarter_decimated_picture_ptr->buffer_y[0],
+            quarter_decimated_picture_ptr->stride_y,
+            quarter_decimated_picture_ptr->width,
+            quarter_decimated_picture_ptr->height,
+            quarter_decimated_picture_ptr->origin_x,
+            quarter_decimated_picture_ptr->origin_y);
+    }
     generate_padding(
         &sixteenth_decimated_picture_ptr->buffer_y[0],
         sixteenth_decimated_picture_ptr->stride_y,
@@ -4071,7 +4409,58 @@ void DownsampleDecimationInputPicture(
         sixteenth_decimated_picture_ptr->origin_x,
         sixteenth_decimated_picture_ptr->origin_y);
 
+    if (gather_statistics) {
+        FinalizeLumaHistogramBins(
+            sequence_control_set_ptr,
+            picture_control_set_ptr,
+            sixteenth_decimated_picture_ptr,
+            region_sum,
+            sumAverageIntensityTotalRegionsLuma);
+    }
+}
+
+/************************************************
+ * Generate Scene Change Signature
+ ** Reduces the 1/16 decimated luma to a grid of block means and a coarse
+ ** histogram, used by the picture decision to skip the scene transition
+ ** detection of clearly static pictures
+ ************************************************/
+static void GenerateSceneChangeSignature(
+    PictureParentControlSet       *picture_control_set_ptr,
+    EbPictureBufferDesc           *sixteenth_decimated_picture_ptr)
+{
+    uint32_t width = sixteenth_decimated_picture_ptr->width;
+    uint32_t height = sixteenth_decimated_picture_ptr->height;
+    uint32_t stride = sixteenth_decimated_picture_ptr->stride_y;
+    uint8_t *origin = &sixteenth_decimated_picture_ptr->buffer_y[sixteenth_decimated_picture_ptr->origin_x + sixteenth_decimated_picture_ptr->origin_y * stride];
+    uint32_t *histogram = picture_control_set_ptr->scd_signature_histogram;
+    uint32_t cell_x, cell_y, x, y;
+
+    EB_MEMSET(histogram, 0, sizeof(picture_control_set_ptr->scd_signature_histogram));
+
+    for (cell_y = 0; cell_y < SCD_SIGNATURE_GRID_SIZE; cell_y++) {
+        uint32_t y_start = (cell_y * height) / SCD_SIGNATURE_GRID_SIZE;
+        uint32_t y_end = ((cell_y + 1) * height) / SCD_SIGNATURE_GRID_SIZE;
+        for (cell_x = 0; cell_x < SCD_SIGNATURE_GRID_SIZE; cell_x++) {
+            uint32_t x_start = (cell_x * width) / SCD_SIGNATURE_GRID_SIZE;
+            uint32_t x_end = ((cell_x + 1) * width) / SCD_SIGNATURE_GRID_SIZE;
+            uint32_t cell_count = (x_end - x_start) * (y_end - y_start);
+            uint32_t cell_sum = 0;
+            for (y = y_start; y < y_end; y++) {
+                uint8_t *row = origin + y * stride;
+                for (x = x_start; x < x_end; x++) {
+                    cell_sum += row[x];
+                    histogram[(row[x] * SCD_SIGNATURE_NUMBER_OF_BINS) >> 8]++;
+                }
+            }
+            picture_control_set_ptr->scd_signature_mean[cell_y][cell_x] = cell_count ?
+                (uint8_t)((cell_sum + (cell_count >> 1)) / cell_count) :
+                0;
+        }
+    }
+    picture_control_set_ptr->scd_signature_sample_count = width * height;
 }
+
 #if PAL_SUP
 int av1_count_colors_highbd(uint16_t *src, int stride, int rows, int cols,
     int bit_depth, int *val_count) {
@@ -4262,13 +4651,12 @@ void DownsampleFilteringInputPicture(
  * The Picture Analysis process is multithreaded, so pictures can be
  * processed out of order as long as all inputs are available.
  ************************************************/
-void* picture_analysis_kernel(void *input_ptr)
+void picture_analysis_task(void *input_ptr, EbObjectWrapper *inputResultsWrapperPtr)
 {
     PictureAnalysisContext        *context_ptr = (PictureAnalysisContext*)input_ptr;
     PictureParentControlSet       *picture_control_set_ptr;
     SequenceControlSet            *sequence_control_set_ptr;
 
-    EbObjectWrapper               *inputResultsWrapperPtr;
     ResourceCoordinationResults   *inputResultsPtr;
     EbObjectWrapper               *outputResultsWrapperPtr;
     PictureAnalysisResults        *outputResultsPtr;
@@ -4282,70 +4670,96 @@ void* picture_analysis_kernel(void *input_ptr)
     uint32_t                        pictureHeighInLcu;
     uint32_t                        sb_total_count;
 
-    for (;;) {
-        // Get Input Full Object
-        eb_get_full_object(
-            context_ptr->resource_coordination_results_input_fifo_ptr,
-            &inputResultsWrapperPtr);
+    inputResultsPtr = (ResourceCoordinationResults*)inputResultsWrapperPtr->object_ptr;
+    picture_control_set_ptr = (PictureParentControlSet*)inputResultsPtr->picture_control_set_wrapper_ptr->object_ptr;
 
-        inputResultsPtr = (ResourceCoordinationResults*)inputResultsWrapperPtr->object_ptr;
-        picture_control_set_ptr = (PictureParentControlSet*)inputResultsPtr->picture_control_set_wrapper_ptr->object_ptr;
+    // There is no need to do processing for overlay picture. Overlay and AltRef share the same results.
+    if (!picture_control_set_ptr->is_overlay)
+    {
+        sequence_control_set_ptr = (SequenceControlSet*)picture_control_set_ptr->sequence_control_set_wrapper_ptr->object_ptr;
+        input_picture_ptr = picture_control_set_ptr->enhanced_picture_ptr;
+
+        paReferenceObject = (EbPaReferenceObject*)picture_control_set_ptr->pa_reference_picture_wrapper_ptr->object_ptr;
+        input_padded_picture_ptr = (EbPictureBufferDesc*)paReferenceObject->input_padded_picture_ptr;
+        // Variance
+        picture_width_in_sb = (sequence_control_set_ptr->seq_header.max_frame_width + sequence_control_set_ptr->sb_sz - 1) / sequence_control_set_ptr->sb_sz;
+        pictureHeighInLcu = (sequence_control_set_ptr->seq_header.max_frame_height + sequence_control_set_ptr->sb_sz - 1) / sequence_control_set_ptr->sb_sz;
+        sb_total_count = picture_width_in_sb * pictureHeighInLcu;
+
+        // Set picture parameters to account for subpicture, picture scantype, and set regions by resolutions
+        SetPictureParametersForStatisticsGathering(
+            sequence_control_set_ptr);
+
+        // Pad pictures to multiple min cu size
+        PadPictureToMultipleOfMinCuSizeDimensions(
+            sequence_control_set_ptr,
+            input_picture_ptr);
 
-        // There is no need to do processing for overlay picture. Overlay and AltRef share the same results.
-        if (!picture_control_set_ptr->is_overlay)
-        {
-            sequence_control_set_ptr = (SequenceControlSet*)picture_control_set_ptr->sequence_control_set_wrapper_ptr->object_ptr;
-            input_picture_ptr = picture_control_set_ptr->enhanced_picture_ptr;
-
-            paReferenceObject = (EbPaReferenceObject*)picture_control_set_ptr->pa_reference_picture_wrapper_ptr->object_ptr;
-            input_padded_picture_ptr = (EbPictureBufferDesc*)paReferenceObject->input_padded_picture_ptr;
-            // Variance
-            picture_width_in_sb = (sequence_control_set_ptr->seq_header.max_frame_width + sequence_control_set_ptr->sb_sz - 1) / sequence_control_set_ptr->sb_sz;
-            pictureHeighInLcu = (sequence_control_set_ptr->seq_header.max_frame_height + sequence_control_set_ptr->sb_sz - 1) / sequence_control_set_ptr->sb_sz;
-            sb_total_count = picture_width_in_sb * pictureHeighInLcu;
-
-            // Set picture parameters to account for subpicture, picture scantype, and set regions by resolutions
-            SetPictureParametersForStatisticsGathering(
-                sequence_control_set_ptr);
-
-            // Pad pictures to multiple min cu size
-            PadPictureToMultipleOfMinCuSizeDimensions(
-                sequence_control_set_ptr,
-                input_picture_ptr);
+        // Pre processing operations performed on the input picture
+        PicturePreProcessingOperations(
+            picture_control_set_ptr,
+            sequence_control_set_ptr,
+            sb_total_count);
+        if (input_picture_ptr->color_format >= EB_YUV422) {
+            // Jing: Do the conversion of 422/444=>420 here since it's multi-threaded kernel
+            //       Reuse the Y, only add cb/cr in the newly created buffer desc
+            //       NOTE: since denoise may change the src, so this part is after PicturePreProcessingOperations()
+            picture_control_set_ptr->chroma_downsampled_picture_ptr->buffer_y = input_picture_ptr->buffer_y;
+            DownSampleChroma(input_picture_ptr, picture_control_set_ptr->chroma_downsampled_picture_ptr);
+        }
+        else
+            picture_control_set_ptr->chroma_downsampled_picture_ptr = input_picture_ptr;
+        // Pad input picture to complete border LCUs
+        PadPictureToMultipleOfLcuDimensions(
+            input_padded_picture_ptr);
+        // Block sums for the successive elimination of the ME
+        GenerateMeBlockSums(
+            paReferenceObject);
+        // The siblings of an analysis group take the statistics of the primary
+        SharedAnalysisGroup *analysis_group_ptr = sequence_control_set_ptr->analysis_group_ptr;
+        EbBool analysis_primary = sequence_control_set_ptr->static_config.analysis_primary;
+        EbBool gather_statistics = analysis_group_ptr == NULL || analysis_primary;
+        uint64_t sumAverageIntensityTotalRegionsLuma = 0;
+
+        // 1/4 & 1/16 input picture decimation, and gathering of the block
+        // statistics of input picture (Variance Calculation, Luma Histogram Bins)
+        // in the same sweep
+        AnalyzeInputPictureBlocks(
+            sequence_control_set_ptr,
+            picture_control_set_ptr,
+            picture_control_set_ptr->chroma_downsampled_picture_ptr, //420 input_picture_ptr
+            input_padded_picture_ptr,
+            (EbPictureBufferDesc*)paReferenceObject->quarter_decimated_picture_ptr,
+            (EbPictureBufferDesc*)paReferenceObject->sixteenth_decimated_picture_ptr, // Hsan: always use decimated until studying the trade offs
+            gather_statistics,
+            &sumAverageIntensityTotalRegionsLuma);
+
+        // Signature of the decimated picture for the scene change detection
+        if (sequence_control_set_ptr->static_config.scene_change_detection) {
+            GenerateSceneChangeSignature(
+                picture_control_set_ptr,
+                (EbPictureBufferDesc*)paReferenceObject->sixteenth_decimated_picture_ptr);
+        }
 
-            // Pre processing operations performed on the input picture
-            PicturePreProcessingOperations(
+        // 1/4 & 1/16 input picture downsampling through filtering
+        if (sequence_control_set_ptr->down_sampling_method_me_search == ME_FILTERED_DOWNSAMPLED) {
+            DownsampleFilteringInputPicture(
                 picture_control_set_ptr,
+                input_padded_picture_ptr,
+                (EbPictureBufferDesc*)paReferenceObject->quarter_filtered_picture_ptr,
+                (EbPictureBufferDesc*)paReferenceObject->sixteenth_filtered_picture_ptr);
+        }
+        if (gather_statistics) {
+            // Gathering the picture level statistics of input picture
+            GatheringPictureLevelStatistics(
                 sequence_control_set_ptr,
-                sb_total_count);
-            if (input_picture_ptr->color_format >= EB_YUV422) {
-                // Jing: Do the conversion of 422/444=>420 here since it's multi-threaded kernel
-                //       Reuse the Y, only add cb/cr in the newly created buffer desc
-                //       NOTE: since denoise may change the src, so this part is after PicturePreProcessingOperations()
-                picture_control_set_ptr->chroma_downsampled_picture_ptr->buffer_y = input_picture_ptr->buffer_y;
-                DownSampleChroma(input_picture_ptr, picture_control_set_ptr->chroma_downsampled_picture_ptr);
-            }
-            else
-                picture_control_set_ptr->chroma_downsampled_picture_ptr = input_picture_ptr;
-            // Pad input picture to complete border LCUs
-            PadPictureToMultipleOfLcuDimensions(
-                input_padded_picture_ptr);
-            // 1/4 & 1/16 input picture decimation
-            DownsampleDecimationInputPicture(
                 picture_control_set_ptr,
-                input_padded_picture_ptr,
-                (EbPictureBufferDesc*)paReferenceObject->quarter_decimated_picture_ptr,
-                (EbPictureBufferDesc*)paReferenceObject->sixteenth_decimated_picture_ptr);
-
-            // 1/4 & 1/16 input picture downsampling through filtering
-            if (sequence_control_set_ptr->down_sampling_method_me_search == ME_FILTERED_DOWNSAMPLED) {
-                DownsampleFilteringInputPicture(
-                    picture_control_set_ptr,
-                    input_padded_picture_ptr,
-                    (EbPictureBufferDesc*)paReferenceObject->quarter_filtered_picture_ptr,
-                    (EbPictureBufferDesc*)paReferenceObject->sixteenth_filtered_picture_ptr);
-            }
-           // Gathering statistics of input picture, including Variance Calculation, Histogram Bins
+                picture_control_set_ptr->chroma_downsampled_picture_ptr, //420 input_picture_ptr
+                sumAverageIntensityTotalRegionsLuma,
+                sb_total_count);
+        }
+        else if (!shared_analysis_get_statistics(analysis_group_ptr, picture_control_set_ptr)) {
+            // Gathering statistics of input picture, including Variance Calculation, Histogram Bins
             GatheringPictureStatistics(
                 sequence_control_set_ptr,
                 picture_control_set_ptr,
@@ -4353,7 +4767,10 @@ void* picture_analysis_kernel(void *input_ptr)
                 input_padded_picture_ptr,
                 (EbPictureBufferDesc*)paReferenceObject->sixteenth_decimated_picture_ptr, // Hsan: always use decimated until studying the trade offs
                 sb_total_count);
+            gather_statistics = EB_TRUE;
+        }
 
+        if (gather_statistics) {
             if (sequence_control_set_ptr->static_config.screen_content_mode == 2){ // auto detect
                 is_screen_content(
                     picture_control_set_ptr,
@@ -4365,26 +4782,49 @@ void* picture_analysis_kernel(void *input_ptr)
             else // off / on
                 picture_control_set_ptr->sc_content_detected = sequence_control_set_ptr->static_config.screen_content_mode;
 
-            // Hold the 64x64 variance and mean in the reference frame
-            uint32_t sb_index;
-            for (sb_index = 0; sb_index < picture_control_set_ptr->sb_total_count; ++sb_index) {
-                paReferenceObject->variance[sb_index] = picture_control_set_ptr->variance[sb_index][ME_TIER_ZERO_PU_64x64];
-                paReferenceObject->y_mean[sb_index] = picture_control_set_ptr->y_mean[sb_index][ME_TIER_ZERO_PU_64x64];
-            }
+            if (analysis_group_ptr && analysis_primary)
+                shared_analysis_put_statistics(analysis_group_ptr, picture_control_set_ptr);
         }
-        // Get Empty Results Object
-        eb_get_empty_object(
-            context_ptr->picture_analysis_results_output_fifo_ptr,
-            &outputResultsWrapperPtr);
 
-        outputResultsPtr = (PictureAnalysisResults*)outputResultsWrapperPtr->object_ptr;
-        outputResultsPtr->picture_control_set_wrapper_ptr = inputResultsPtr->picture_control_set_wrapper_ptr;
+        // Hold the 64x64 variance and mean in the reference frame
+        uint32_t sb_index;
+        for (sb_index = 0; sb_index < picture_control_set_ptr->sb_total_count; ++sb_index) {
+            paReferenceObject->variance[sb_index] = picture_control_set_ptr->variance[sb_index][ME_TIER_ZERO_PU_64x64];
+            paReferenceObject->y_mean[sb_index] = picture_control_set_ptr->y_mean[sb_index][ME_TIER_ZERO_PU_64x64];
+        }
+    }
+    // Get Empty Results Object
+    eb_get_empty_object(
+        context_ptr->picture_analysis_results_output_fifo_ptr,
+        &outputResultsWrapperPtr);
+
+    outputResultsPtr = (PictureAnalysisResults*)outputResultsWrapperPtr->object_ptr;
+    outputResultsPtr->picture_control_set_wrapper_ptr = inputResultsPtr->picture_control_set_wrapper_ptr;
+
+    // Release the Input Results
+    eb_release_object(inputResultsWrapperPtr);
+
+    // Post the Full Results Object
+    eb_post_full_object(outputResultsWrapperPtr);
+}
+
+/******************************************************
+ * Picture Analysis Kernel
+ ******************************************************/
+void* picture_analysis_kernel(void *input_ptr)
+{
+    PictureAnalysisContext        *context_ptr = (PictureAnalysisContext*)input_ptr;
 
-        // Release the Input Results
-        eb_release_object(inputResultsWrapperPtr);
+    EbObjectWrapper               *inputResultsWrapperPtr;
+
+    for (;;) {
+        // Get Input Full Object
+        eb_get_full_object(
+            context_ptr->resource_coordination_results_input_fifo_ptr,
+            &inputResultsWrapperPtr);
 
-        // Post the Full Results Object
-        eb_post_full_object(outputResultsWrapperPtr);
+        picture_analysis_task(input_ptr, inputResultsWrapperPtr);
     }
+
     return EB_NULL;
 }
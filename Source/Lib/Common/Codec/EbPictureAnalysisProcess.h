@@ -36,6 +36,7 @@ extern EbErrorType picture_analysis_context_ctor(
     EbFifo                      *resource_coordination_results_input_fifo_ptr,
     EbFifo                      *picture_analysis_results_output_fifo_ptr);
 
+extern void picture_analysis_task(void *input_ptr, EbObjectWrapper *input_wrapper_ptr);
 extern void* picture_analysis_kernel(void *input_ptr);
 
 void noise_extract_luma_weak_c(
@@ -36,22 +36,18 @@ static void eb_picture_buffer_desc_dctor(EbPtr p)
 }
 
 /*****************************************
- * eb_picture_buffer_desc_ctor
- *  Initializes the Buffer Descriptor's
- *  values that are fixed for the life of
- *  the descriptor.
+ * picture_buffer_desc_init
+ *  Sets the Buffer Descriptor's values that
+ *  are fixed for the life of the descriptor
+ *  and returns the bytes per pixel.
  *****************************************/
-EbErrorType eb_picture_buffer_desc_ctor(
-    EbPictureBufferDesc* pictureBufferDescPtr,
-    EbPtr   object_init_data_ptr)
+static uint32_t picture_buffer_desc_init(
+    EbPictureBufferDesc          *pictureBufferDescPtr,
+    EbPictureBufferDescInitData  *pictureBufferDescInitDataPtr)
 {
-    EbPictureBufferDescInitData  *pictureBufferDescInitDataPtr = (EbPictureBufferDescInitData*)object_init_data_ptr;
-
     uint32_t bytesPerPixel = (pictureBufferDescInitDataPtr->bit_depth == EB_8BIT) ? 1 : (pictureBufferDescInitDataPtr->bit_depth <= EB_16BIT) ? 2 : 4;
     const uint16_t subsampling_x = (pictureBufferDescInitDataPtr->color_format == EB_YUV444 ? 1 : 2) - 1;
 
-    pictureBufferDescPtr->dctor = eb_picture_buffer_desc_dctor;
-
     if (pictureBufferDescInitDataPtr->bit_depth > EB_8BIT && pictureBufferDescInitDataPtr->bit_depth <= EB_16BIT && pictureBufferDescInitDataPtr->split_mode == EB_TRUE)
         bytesPerPixel = 1;
 
@@ -80,6 +76,24 @@ EbErrorType eb_picture_buffer_desc_ctor(
     }
     pictureBufferDescPtr->buffer_enable_mask = pictureBufferDescInitDataPtr->buffer_enable_mask;
 
+    return bytesPerPixel;
+}
+
+/*****************************************
+ * eb_picture_buffer_desc_ctor
+ *  Initializes the Buffer Descriptor's
+ *  values that are fixed for the life of
+ *  the descriptor.
+ *****************************************/
+EbErrorType eb_picture_buffer_desc_ctor(
+    EbPictureBufferDesc* pictureBufferDescPtr,
+    EbPtr   object_init_data_ptr)
+{
+    EbPictureBufferDescInitData  *pictureBufferDescInitDataPtr = (EbPictureBufferDescInitData*)object_init_data_ptr;
+    const uint32_t bytesPerPixel = picture_buffer_desc_init(pictureBufferDescPtr, pictureBufferDescInitDataPtr);
+
+    pictureBufferDescPtr->dctor = eb_picture_buffer_desc_dctor;
+
     // Allocate the Picture Buffers (luma & chroma)
     if (pictureBufferDescInitDataPtr->buffer_enable_mask & PICTURE_BUFFER_DESC_Y_FLAG) {
         EB_CALLOC_ALIGNED_ARRAY(pictureBufferDescPtr->buffer_y, pictureBufferDescPtr->luma_size * bytesPerPixel);
@@ -108,6 +122,44 @@ EbErrorType eb_picture_buffer_desc_ctor(
     return EB_ErrorNone;
 }
 
+/*****************************************
+ * eb_picture_buffer_desc_arena_ctor
+ *  Same as eb_picture_buffer_desc_ctor, the
+ *  buffers are carved out of the arena and
+ *  freed with it, the descriptor has no dctor.
+ *****************************************/
+EbErrorType eb_picture_buffer_desc_arena_ctor(
+    EbPictureBufferDesc* pictureBufferDescPtr,
+    EbPtr   object_init_data_ptr,
+    EbArena *arena_ptr)
+{
+    EbPictureBufferDescInitData  *pictureBufferDescInitDataPtr = (EbPictureBufferDescInitData*)object_init_data_ptr;
+    const uint32_t bytesPerPixel = picture_buffer_desc_init(pictureBufferDescPtr, pictureBufferDescInitDataPtr);
+    const uint32_t planes = (pictureBufferDescInitDataPtr->split_mode == EB_TRUE) ? 2 : 1;
+
+    pictureBufferDescPtr->dctor = NULL;
+
+    if (pictureBufferDescInitDataPtr->buffer_enable_mask & PICTURE_BUFFER_DESC_Y_FLAG) {
+        EB_ARENA_CALLOC_ARRAY(arena_ptr, pictureBufferDescPtr->buffer_y, pictureBufferDescPtr->luma_size * bytesPerPixel * planes);
+        pictureBufferDescPtr->buffer_bit_inc_y = (planes == 2) ?
+            pictureBufferDescPtr->buffer_y + pictureBufferDescPtr->luma_size * bytesPerPixel : 0;
+    }
+
+    if (pictureBufferDescInitDataPtr->buffer_enable_mask & PICTURE_BUFFER_DESC_Cb_FLAG) {
+        EB_ARENA_CALLOC_ARRAY(arena_ptr, pictureBufferDescPtr->buffer_cb, pictureBufferDescPtr->chroma_size * bytesPerPixel * planes);
+        pictureBufferDescPtr->buffer_bit_inc_cb = (planes == 2) ?
+            pictureBufferDescPtr->buffer_cb + pictureBufferDescPtr->chroma_size * bytesPerPixel : 0;
+    }
+
+    if (pictureBufferDescInitDataPtr->buffer_enable_mask & PICTURE_BUFFER_DESC_Cr_FLAG) {
+        EB_ARENA_CALLOC_ARRAY(arena_ptr, pictureBufferDescPtr->buffer_cr, pictureBufferDescPtr->chroma_size * bytesPerPixel * planes);
+        pictureBufferDescPtr->buffer_bit_inc_cr = (planes == 2) ?
+            pictureBufferDescPtr->buffer_cr + pictureBufferDescPtr->chroma_size * bytesPerPixel : 0;
+    }
+
+    return EB_ErrorNone;
+}
+
 void eb_recon_picture_buffer_desc_dctor(EbPtr p)
 {
     EbPictureBufferDesc *obj = (EbPictureBufferDesc*)p;
@@ -12,6 +12,7 @@
 #include "grainSynthesis.h"
 #include "EbSvtAv1Formats.h"
 #include "EbObject.h"
+#include "EbArena.h"
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -310,6 +311,11 @@ extern "C" {
         EbPictureBufferDesc *object_ptr,
         EbPtr  object_init_data_ptr);
 
+    extern EbErrorType eb_picture_buffer_desc_arena_ctor(
+        EbPictureBufferDesc *object_ptr,
+        EbPtr  object_init_data_ptr,
+        EbArena *arena_ptr);
+
     extern EbErrorType eb_recon_picture_buffer_desc_ctor(
         EbPictureBufferDesc *object_ptr,
         EbPtr  object_init_data_ptr);
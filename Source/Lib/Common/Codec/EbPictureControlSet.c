@@ -63,41 +63,37 @@ EbErrorType segmentation_map_ctor(SegmentationNeighborMap *seg_neighbor_map,
     return  EB_ErrorNone;
 }
 
-static void me_sb_results_dctor(EbPtr p)
-{
-    MeLcuResults* obj = (MeLcuResults*)p;
-
-    EB_FREE_ARRAY(obj->me_candidate);
-    if (obj->me_mv_array) {
-        EB_FREE_ARRAY(obj->me_mv_array[0]);
-    }
-    EB_FREE_ARRAY(obj->me_mv_array);
-    EB_FREE_ARRAY(obj->me_candidate_array);
-    EB_FREE_ARRAY(obj->total_me_candidate_index);
-
-    EB_FREE_ARRAY(obj->me_nsq_0);
-    EB_FREE_ARRAY(obj->me_nsq_1);
+/* Arena bytes of the ME results of a SB */
+static size_t me_sb_results_size(
+    uint32_t           maxNumberOfPusPerLcu,
+    uint8_t            mrp_mode,
+    uint32_t           maxNumberOfMeCandidatesPerPU){
+    size_t count = ((mrp_mode == 0) ? ME_MV_MRP_MODE_0 : ME_MV_MRP_MODE_1);
+    return EB_ARENA_SIZE(MeLcuResults, 1) +
+        EB_ARENA_SIZE(MeCandidate*, maxNumberOfPusPerLcu) +
+        EB_ARENA_SIZE(MvCandidate*, maxNumberOfPusPerLcu) +
+        EB_ARENA_SIZE(MeCandidate, maxNumberOfPusPerLcu * maxNumberOfMeCandidatesPerPU) +
+        EB_ARENA_SIZE(MvCandidate, maxNumberOfPusPerLcu * count) +
+        3 * EB_ARENA_SIZE(uint8_t, maxNumberOfPusPerLcu);
 }
 
+/* The ME results of a SB live in the arena of the PPCS, they have no dctor */
 EbErrorType me_sb_results_ctor(
     MeLcuResults      *objectPtr,
+    EbArena           *arena,
     uint32_t           maxNumberOfPusPerLcu,
     uint8_t            mrp_mode,
     uint32_t           maxNumberOfMeCandidatesPerPU){
     uint32_t  puIndex;
 
     size_t count = ((mrp_mode == 0) ? ME_MV_MRP_MODE_0 : ME_MV_MRP_MODE_1);
-    objectPtr->dctor = me_sb_results_dctor;
+    objectPtr->dctor = NULL;
     objectPtr->max_number_of_pus_per_lcu = maxNumberOfPusPerLcu;
 
-    EB_MALLOC_ARRAY(objectPtr->me_candidate, maxNumberOfPusPerLcu);
-    EB_MALLOC_ARRAY(objectPtr->me_mv_array, maxNumberOfPusPerLcu);
-#if ALIGN_MEM
-    objectPtr->meCandidateArray = (MeCandidate_t*)EB_aligned_malloc(sizeof(MeCandidate_t) * maxNumberOfPusPerLcu * maxNumberOfMeCandidatesPerPU, 64);
-#else
-    EB_MALLOC_ARRAY(objectPtr->me_candidate_array, maxNumberOfPusPerLcu * maxNumberOfMeCandidatesPerPU);
-#endif
-    EB_MALLOC_ARRAY(objectPtr->me_mv_array[0], maxNumberOfPusPerLcu * count);
+    EB_ARENA_MALLOC_ARRAY(arena, objectPtr->me_candidate, maxNumberOfPusPerLcu);
+    EB_ARENA_MALLOC_ARRAY(arena, objectPtr->me_mv_array, maxNumberOfPusPerLcu);
+    EB_ARENA_MALLOC_ARRAY(arena, objectPtr->me_candidate_array, maxNumberOfPusPerLcu * maxNumberOfMeCandidatesPerPU);
+    EB_ARENA_MALLOC_ARRAY(arena, objectPtr->me_mv_array[0], maxNumberOfPusPerLcu * count);
 
     for (puIndex = 0; puIndex < maxNumberOfPusPerLcu; ++puIndex) {
         objectPtr->me_candidate[puIndex] = &objectPtr->me_candidate_array[puIndex * maxNumberOfMeCandidatesPerPU];
@@ -114,10 +110,10 @@ EbErrorType me_sb_results_ctor(
         objectPtr->me_candidate[puIndex][2].direction = 2;
         objectPtr->me_mv_array[puIndex] = objectPtr->me_mv_array[0] + puIndex * count;
     }
-    EB_MALLOC_ARRAY(objectPtr->total_me_candidate_index, maxNumberOfPusPerLcu);
+    EB_ARENA_MALLOC_ARRAY(arena, objectPtr->total_me_candidate_index, maxNumberOfPusPerLcu);
 
-    EB_MALLOC_ARRAY(objectPtr->me_nsq_0, maxNumberOfPusPerLcu);
-    EB_MALLOC_ARRAY(objectPtr->me_nsq_1, maxNumberOfPusPerLcu);
+    EB_ARENA_MALLOC_ARRAY(arena, objectPtr->me_nsq_0, maxNumberOfPusPerLcu);
+    EB_ARENA_MALLOC_ARRAY(arena, objectPtr->me_nsq_1, maxNumberOfPusPerLcu);
 
     //objectPtr->lcuDistortion = 0;
     return EB_ErrorNone;
@@ -200,7 +196,6 @@ void picture_control_set_dctor(EbPtr p)
         EB_DELETE(obj->md_ref_frame_type_neighbor_array[depth]);
         EB_DELETE(obj->md_interpolation_type_neighbor_array[depth]);
     }
-    EB_DELETE_PTR_ARRAY(obj->sb_ptr_array, obj->sb_total_count);
     EB_DELETE(obj->coeff_est_entropy_coder_ptr);
     EB_DELETE(obj->bitstream_ptr);
     EB_DELETE(obj->entropy_coder_ptr);
@@ -230,7 +225,7 @@ void picture_control_set_dctor(EbPtr p)
     EB_DESTROY_MUTEX(obj->intra_mutex);
     EB_DESTROY_MUTEX(obj->cdef_search_mutex);
     EB_DESTROY_MUTEX(obj->rest_search_mutex);
-
+    EB_DELETE(obj->arena);
 }
 #if PAL_SUP
 // Token buffer is only used for palette tokens.
@@ -417,7 +412,6 @@ EbErrorType picture_control_set_ctor(
     // SB Array
     object_ptr->sb_max_depth = (uint8_t)initDataPtr->max_depth;
     object_ptr->sb_total_count = pictureLcuWidth * pictureLcuHeight;
-    EB_ALLOC_PTR_ARRAY(object_ptr->sb_ptr_array, object_ptr->sb_total_count);
 
     sb_origin_x = 0;
     sb_origin_y = 0;
@@ -426,15 +420,25 @@ EbErrorType picture_control_set_ctor(
     const uint16_t picture_sb_h   = (uint16_t)((initDataPtr->picture_height + initDataPtr->sb_size_pix - 1) / initDataPtr->sb_size_pix);
     const uint16_t all_sb = picture_sb_w * picture_sb_h;
 
+    // One slab for the SBs and their arrays
+    EB_NEW(
+        object_ptr->arena,
+        eb_arena_ctor,
+        all_sb * largest_coding_unit_arena_size((uint8_t)initDataPtr->sb_size_pix, initDataPtr->color_format) +
+        EB_ARENA_SIZE(LargestCodingUnit*, object_ptr->sb_total_count));
+    EB_ARENA_CALLOC_ARRAY(object_ptr->arena, object_ptr->sb_ptr_array, object_ptr->sb_total_count);
+
     for (sb_index = 0; sb_index < all_sb; ++sb_index) {
-        EB_NEW(
+        EB_ARENA_CALLOC_ARRAY(object_ptr->arena, object_ptr->sb_ptr_array[sb_index], 1);
+        return_error = largest_coding_unit_ctor(
             object_ptr->sb_ptr_array[sb_index],
-            largest_coding_unit_ctor,
             (uint8_t)initDataPtr->sb_size_pix,
             (uint16_t)(sb_origin_x * maxCuSize),
             (uint16_t)(sb_origin_y * maxCuSize),
             (uint16_t)sb_index,
             object_ptr);
+        if (return_error != EB_ErrorNone)
+            return return_error;
         // Increment the Order in coding order (Raster Scan Order)
         sb_origin_y = (sb_origin_x == picture_sb_w - 1) ? sb_origin_y + 1 : sb_origin_y;
         sb_origin_x = (sb_origin_x == picture_sb_w - 1) ? 0 : sb_origin_x + 1;
@@ -1083,56 +1087,38 @@ EbErrorType picture_control_set_creator(
     return EB_ErrorNone;
 }
 
+/*****************************************
+ * picture_parent_control_set_arena_size
+ *  One slab for the per SB arrays and the
+ *  ME results, the histograms fit in the
+ *  slack.
+ *****************************************/
+size_t picture_parent_control_set_arena_size(
+    uint32_t sb_total_count,
+    uint8_t  nsq_present,
+    uint8_t  mrp_mode)
+{
+    const uint32_t me_pu_count = nsq_present ? MAX_ME_PU_COUNT : SQUARE_PU_COUNT;
+    const uint32_t me_candidates = (mrp_mode == 0) ? ME_RES_CAND_MRP_MODE_0 : ME_RES_CAND_MRP_MODE_1;
+    const size_t sb_arena_size =
+        me_sb_results_size(me_pu_count, mrp_mode, me_candidates) +
+        sizeof(uint16_t) * MAX_ME_PU_COUNT + sizeof(uint8_t) * (MAX_ME_PU_COUNT + 2 * 21) +
+        sizeof(OisSbResults) + sizeof(OisCandidate) * MAX_OIS_CANDIDATES * CU_MAX_COUNT +
+        7 * sizeof(void*) + 3 * sizeof(uint32_t) + 3 * sizeof(uint8_t) + sizeof(EdgeLcuResults) +
+        sizeof(SbStat) + sizeof(EbSbComplexityStatus) + sizeof(EB_SB_DEPTH_MODE) +
+        sizeof(TfHmeCenter) * ALTREF_MAX_NFRAMES;
+    return sb_total_count * sb_arena_size + EB_ARENA_GROW_SIZE;
+}
+
 static void picture_parent_control_set_dctor(EbPtr p)
 {
     PictureParentControlSet *obj = (PictureParentControlSet*)p;
-    uint32_t regionInPictureWidthIndex;
-    uint32_t regionInPictureHeightIndex;
 
     EB_DELETE(obj->denoise_and_model);
 
-    EB_DELETE_PTR_ARRAY(obj->me_results, obj->sb_total_count);
     if (obj->is_chroma_downsampled_picture_ptr_owner)
         EB_DELETE(obj->chroma_downsampled_picture_ptr);
 
-    EB_FREE_2D(obj->variance);
-    EB_FREE_2D(obj->y_mean);
-    EB_FREE_2D(obj->cbMean);
-    EB_FREE_2D(obj->crMean);
-
-    if (obj->picture_histogram) {
-        for (regionInPictureWidthIndex = 0; regionInPictureWidthIndex < MAX_NUMBER_OF_REGIONS_IN_WIDTH; regionInPictureWidthIndex++) {
-            if (obj->picture_histogram[regionInPictureWidthIndex]) {
-                for (regionInPictureHeightIndex = 0; regionInPictureHeightIndex < MAX_NUMBER_OF_REGIONS_IN_HEIGHT; regionInPictureHeightIndex++) {
-                    EB_FREE_2D(obj->picture_histogram[regionInPictureWidthIndex][regionInPictureHeightIndex]);
-                }
-            }
-            EB_FREE_PTR_ARRAY(obj->picture_histogram[regionInPictureWidthIndex], MAX_NUMBER_OF_REGIONS_IN_HEIGHT);
-        }
-        EB_FREE_PTR_ARRAY(obj->picture_histogram, MAX_NUMBER_OF_REGIONS_IN_WIDTH);
-    }
-
-    EB_FREE_2D(obj->ois_sb_results);
-    EB_FREE_2D(obj->ois_candicate);
-    EB_FREE_ARRAY(obj->rc_me_distortion);
-    // ME and OIS Distortion Histograms
-    EB_FREE_ARRAY(obj->me_distortion_histogram);
-    EB_FREE_ARRAY(obj->ois_distortion_histogram);
-    EB_FREE_ARRAY(obj->intra_sad_interval_index);
-    EB_FREE_ARRAY(obj->inter_sad_interval_index);
-    // Non moving index array
-    EB_FREE_ARRAY(obj->non_moving_index_array);
-    // SB noise variance array
-    EB_FREE_ARRAY(obj->sb_flat_noise_array);
-    EB_FREE_ARRAY(obj->edge_results_ptr);
-
-    EB_FREE_ARRAY(obj->sharp_edge_sb_flag);
-    EB_FREE_ARRAY(obj->sb_stat_array);
-
-    EB_FREE_ARRAY(obj->complex_sb_array);
-
-    EB_FREE_ARRAY(obj->sb_depth_mode_array);
-
     if (obj->av1_cm) {
         const int32_t num_planes = 3;// av1_num_planes(cm);
         for (int32_t p = 0; p < num_planes; ++p) {
@@ -1157,8 +1143,8 @@ static void picture_parent_control_set_dctor(EbPtr p)
 
     EB_DESTROY_MUTEX(obj->rc_distortion_histogram_mutex);
     EB_DESTROY_SEMAPHORE(obj->temp_filt_done_semaphore);
-    EB_DESTROY_MUTEX(obj->temp_filt_mutex);
     EB_DESTROY_MUTEX(obj->debug_mutex);
+    EB_DELETE(obj->arena);
 }
 EbErrorType picture_parent_control_set_ctor(
     PictureParentControlSet *object_ptr,
@@ -1213,23 +1199,31 @@ EbErrorType picture_parent_control_set_ctor(
 
     object_ptr->data_ll_head_ptr = (EbLinkedListNode *)EB_NULL;
     object_ptr->app_out_data_ll_head_ptr = (EbLinkedListNode *)EB_NULL;
-    EB_MALLOC_2D(object_ptr->variance, object_ptr->sb_total_count, MAX_ME_PU_COUNT);
-    EB_MALLOC_2D(object_ptr->y_mean, object_ptr->sb_total_count, MAX_ME_PU_COUNT);
-    EB_MALLOC_2D(object_ptr->cbMean, object_ptr->sb_total_count, 21);
-    EB_MALLOC_2D(object_ptr->crMean, object_ptr->sb_total_count, 21);
 
+    object_ptr->max_number_of_candidates_per_block = (initDataPtr->mrp_mode == 0) ?
+        ME_RES_CAND_MRP_MODE_0 : // [Single Ref = 7] + [BiDir = 12 = 3*4 ] + [UniDir = 4 = 3+1]
+        ME_RES_CAND_MRP_MODE_1 ; // [BiDir = 1] + [UniDir = 2 = 1 + 1]
+    const uint32_t me_pu_count = (initDataPtr->nsq_present) ? MAX_ME_PU_COUNT : SQUARE_PU_COUNT;
+
+    EB_NEW(object_ptr->arena, eb_arena_ctor,
+        picture_parent_control_set_arena_size(object_ptr->sb_total_count, initDataPtr->nsq_present, initDataPtr->mrp_mode));
 
-    EB_ALLOC_PTR_ARRAY(object_ptr->picture_histogram, MAX_NUMBER_OF_REGIONS_IN_WIDTH);
+    EB_ARENA_MALLOC_2D(object_ptr->arena, object_ptr->variance, object_ptr->sb_total_count, MAX_ME_PU_COUNT);
+    EB_ARENA_MALLOC_2D(object_ptr->arena, object_ptr->y_mean, object_ptr->sb_total_count, MAX_ME_PU_COUNT);
+    EB_ARENA_MALLOC_2D(object_ptr->arena, object_ptr->cbMean, object_ptr->sb_total_count, 21);
+    EB_ARENA_MALLOC_2D(object_ptr->arena, object_ptr->crMean, object_ptr->sb_total_count, 21);
+
+    EB_ARENA_CALLOC_ARRAY(object_ptr->arena, object_ptr->picture_histogram, MAX_NUMBER_OF_REGIONS_IN_WIDTH);
 
     for (regionInPictureWidthIndex = 0; regionInPictureWidthIndex < MAX_NUMBER_OF_REGIONS_IN_WIDTH; regionInPictureWidthIndex++) {  // loop over horizontal regions
-        EB_ALLOC_PTR_ARRAY(object_ptr->picture_histogram[regionInPictureWidthIndex], MAX_NUMBER_OF_REGIONS_IN_HEIGHT);
+        EB_ARENA_CALLOC_ARRAY(object_ptr->arena, object_ptr->picture_histogram[regionInPictureWidthIndex], MAX_NUMBER_OF_REGIONS_IN_HEIGHT);
         for (regionInPictureHeightIndex = 0; regionInPictureHeightIndex < MAX_NUMBER_OF_REGIONS_IN_HEIGHT; regionInPictureHeightIndex++) {
-            EB_MALLOC_2D(object_ptr->picture_histogram[regionInPictureWidthIndex][regionInPictureHeightIndex], 3, HISTOGRAM_NUMBER_OF_BINS);
+            EB_ARENA_MALLOC_2D(object_ptr->arena, object_ptr->picture_histogram[regionInPictureWidthIndex][regionInPictureHeightIndex], 3, HISTOGRAM_NUMBER_OF_BINS);
         }
     }
 
-    EB_MALLOC_2D(object_ptr->ois_sb_results, object_ptr->sb_total_count, 1);
-    EB_MALLOC_2D(object_ptr->ois_candicate, object_ptr->sb_total_count,  MAX_OIS_CANDIDATES * CU_MAX_COUNT);
+    EB_ARENA_MALLOC_2D(object_ptr->arena, object_ptr->ois_sb_results, object_ptr->sb_total_count, 1);
+    EB_ARENA_MALLOC_2D(object_ptr->arena, object_ptr->ois_candicate, object_ptr->sb_total_count,  MAX_OIS_CANDIDATES * CU_MAX_COUNT);
 
     for (sb_index = 0; sb_index < object_ptr->sb_total_count; ++sb_index) {
         uint32_t cuIdx;
@@ -1237,44 +1231,44 @@ EbErrorType picture_parent_control_set_ctor(
             object_ptr->ois_sb_results[sb_index]->ois_candidate_array[cuIdx] = &object_ptr->ois_candicate[sb_index][cuIdx*MAX_OIS_CANDIDATES];
     }
 
-    object_ptr->max_number_of_candidates_per_block = (initDataPtr->mrp_mode == 0) ?
-        ME_RES_CAND_MRP_MODE_0 : // [Single Ref = 7] + [BiDir = 12 = 3*4 ] + [UniDir = 4 = 3+1]
-        ME_RES_CAND_MRP_MODE_1 ; // [BiDir = 1] + [UniDir = 2 = 1 + 1]
-
-    EB_ALLOC_PTR_ARRAY(object_ptr->me_results, object_ptr->sb_total_count);
+    EB_ARENA_MALLOC_ARRAY(object_ptr->arena, object_ptr->me_results, object_ptr->sb_total_count);
 
     for (sb_index = 0; sb_index < object_ptr->sb_total_count; ++sb_index) {
-        EB_NEW(
+        EB_ARENA_CALLOC_ARRAY(object_ptr->arena, object_ptr->me_results[sb_index], 1);
+        return_error = me_sb_results_ctor(
             object_ptr->me_results[sb_index],
-            me_sb_results_ctor,
-            (initDataPtr->nsq_present) ? MAX_ME_PU_COUNT : SQUARE_PU_COUNT,
+            object_ptr->arena,
+            me_pu_count,
             initDataPtr->mrp_mode,
             object_ptr->max_number_of_candidates_per_block);
+        if (return_error != EB_ErrorNone)
+            return return_error;
     }
 
-    EB_MALLOC_ARRAY(object_ptr->rc_me_distortion, object_ptr->sb_total_count);
+    EB_ARENA_MALLOC_ARRAY(object_ptr->arena, object_ptr->rc_me_distortion, object_ptr->sb_total_count);
     // ME and OIS Distortion Histograms
-    EB_MALLOC_ARRAY(object_ptr->me_distortion_histogram, NUMBER_OF_SAD_INTERVALS);
-    EB_MALLOC_ARRAY(object_ptr->ois_distortion_histogram, NUMBER_OF_INTRA_SAD_INTERVALS);
-    EB_MALLOC_ARRAY(object_ptr->intra_sad_interval_index, object_ptr->sb_total_count);
-    EB_MALLOC_ARRAY(object_ptr->inter_sad_interval_index, object_ptr->sb_total_count);
+    EB_ARENA_MALLOC_ARRAY(object_ptr->arena, object_ptr->me_distortion_histogram, NUMBER_OF_SAD_INTERVALS);
+    EB_ARENA_MALLOC_ARRAY(object_ptr->arena, object_ptr->ois_distortion_histogram, NUMBER_OF_INTRA_SAD_INTERVALS);
+    EB_ARENA_MALLOC_ARRAY(object_ptr->arena, object_ptr->intra_sad_interval_index, object_ptr->sb_total_count);
+    EB_ARENA_MALLOC_ARRAY(object_ptr->arena, object_ptr->inter_sad_interval_index, object_ptr->sb_total_count);
     // Non moving index array
-    EB_MALLOC_ARRAY(object_ptr->non_moving_index_array, object_ptr->sb_total_count);
+    EB_ARENA_MALLOC_ARRAY(object_ptr->arena, object_ptr->non_moving_index_array, object_ptr->sb_total_count);
     // SB noise variance array
-    EB_MALLOC_ARRAY(object_ptr->sb_flat_noise_array, object_ptr->sb_total_count);
-    EB_MALLOC_ARRAY(object_ptr->edge_results_ptr, object_ptr->sb_total_count);
+    EB_ARENA_MALLOC_ARRAY(object_ptr->arena, object_ptr->sb_flat_noise_array, object_ptr->sb_total_count);
+    EB_ARENA_MALLOC_ARRAY(object_ptr->arena, object_ptr->edge_results_ptr, object_ptr->sb_total_count);
 
-    EB_MALLOC_ARRAY(object_ptr->sharp_edge_sb_flag, object_ptr->sb_total_count);
-    EB_MALLOC_ARRAY(object_ptr->sb_stat_array, object_ptr->sb_total_count);
+    EB_ARENA_MALLOC_ARRAY(object_ptr->arena, object_ptr->sharp_edge_sb_flag, object_ptr->sb_total_count);
+    EB_ARENA_MALLOC_ARRAY(object_ptr->arena, object_ptr->sb_stat_array, object_ptr->sb_total_count);
 
-    EB_MALLOC_ARRAY(object_ptr->complex_sb_array, object_ptr->sb_total_count);
+    EB_ARENA_MALLOC_ARRAY(object_ptr->arena, object_ptr->complex_sb_array, object_ptr->sb_total_count);
 
     EB_CREATE_MUTEX(object_ptr->rc_distortion_histogram_mutex);
 
-    EB_MALLOC_ARRAY(object_ptr->sb_depth_mode_array, object_ptr->sb_total_count);
+    EB_ARENA_MALLOC_ARRAY(object_ptr->arena, object_ptr->sb_depth_mode_array, object_ptr->sb_total_count);
+
+    EB_ARENA_MALLOC_2D(object_ptr->arena, object_ptr->tf_hme_center, ALTREF_MAX_NFRAMES, object_ptr->sb_total_count);
 
     EB_CREATE_SEMAPHORE(object_ptr->temp_filt_done_semaphore, 0, 1);
-    EB_CREATE_MUTEX(object_ptr->temp_filt_mutex);
     EB_CREATE_MUTEX(object_ptr->debug_mutex);
 
     EB_MALLOC_ARRAY(object_ptr->av1_cm, 1);
@@ -22,6 +22,7 @@
 #include "EbRateControlTables.h"
 #include "EbRestoration.h"
 #include "EbObject.h"
+#include "EbArena.h"
 #include "noise_model.h"
 #include "EbSegmentationParams.h"
 #include "EbAv1Structs.h"
@@ -42,6 +43,8 @@ extern "C" {
 #define HISTOGRAM_NUMBER_OF_BINS            256
 #define MAX_NUMBER_OF_REGIONS_IN_WIDTH      4
 #define MAX_NUMBER_OF_REGIONS_IN_HEIGHT     4
+#define SCD_SIGNATURE_GRID_SIZE             8
+#define SCD_SIGNATURE_NUMBER_OF_BINS        32
 #define MAX_REF_QP_NUM                      81
     // Segment Macros
 #define SEGMENT_MAX_COUNT   64
@@ -13700,6 +13703,7 @@ extern "C" {
     typedef struct PictureControlSet
     {
         EbDctor                            dctor;
+        EbArena                            *arena;  // per SB arrays, freed with the PCS
         EbObjectWrapper                    *sequence_control_set_wrapper_ptr;
 
         EbPictureBufferDesc                *recon_picture_ptr;
@@ -13945,6 +13949,25 @@ extern "C" {
         uint8_t           low_dist_logo;
     } SbStat;
 
+    // HME search center of a SB found by the temporal filtering against one of its frames
+    typedef struct TfHmeCenter
+    {
+        int16_t           x;
+        int16_t           y;
+        uint8_t           valid;
+    } TfHmeCenter;
+
+    // Statistics of the temporal filtering of a segment
+    typedef struct TfSegmentStats
+    {
+        uint64_t          filtered_sse;
+        uint64_t          filtered_sse_uv;
+        uint32_t          skipped_blocks;
+        uint32_t          total_blocks;
+        uint32_t          skipped_filter_blocks;
+        uint32_t          total_filter_blocks;
+    } TfSegmentStats;
+
     //CHKN
     // Add the concept of PictureParentControlSet which is a subset of the old PictureControlSet.
     // It actually holds only high level Picture based control data:(GOP management,when to start a picture, when to release the PCS, ....).
@@ -13953,6 +13976,7 @@ extern "C" {
     typedef struct PictureParentControlSet
     {
         EbDctor                            dctor;
+        EbArena                            *arena;  // per SB analysis and ME results, freed with the PCS
         EbObjectWrapper                    *sequence_control_set_wrapper_ptr;
         EbObjectWrapper                    *input_picture_wrapper_ptr;
         EbObjectWrapper                    *reference_picture_wrapper_ptr;
@@ -14087,6 +14111,10 @@ extern "C" {
         // Histograms
         uint32_t                          ****picture_histogram;
         uint64_t                              average_intensity_per_region[MAX_NUMBER_OF_REGIONS_IN_WIDTH][MAX_NUMBER_OF_REGIONS_IN_HEIGHT][3];
+        // Scene change signature of the 1/16 decimated luma
+        uint8_t                               scd_signature_mean[SCD_SIGNATURE_GRID_SIZE][SCD_SIGNATURE_GRID_SIZE];
+        uint32_t                              scd_signature_histogram[SCD_SIGNATURE_NUMBER_OF_BINS];
+        uint32_t                              scd_signature_sample_count;
 
         // Segments
         uint16_t                              me_segments_total_count;
@@ -14175,10 +14203,12 @@ extern "C" {
         // Global quant matrix tables
         const QmVal                       *giqmatrix[NUM_QM_LEVELS][3][TX_SIZES_ALL];
         const QmVal                       *gqmatrix[NUM_QM_LEVELS][3][TX_SIZES_ALL];
-        Quants                                quants;
-        Dequants                              deq;
-        Quants                                quantsMd;
-        Dequants                              deqMd;
+        // Quantizer tables of the picture and MD bit depths, shared by
+        // all the pictures and encoder handles (see quants_bd in the SCS)
+        Quants                               *quants;
+        Dequants                             *deq;
+        Quants                               *quantsMd;
+        Dequants                             *deqMd;
         int32_t                               min_qmlevel;
         int32_t                               max_qmlevel;
         // Encoder
@@ -14270,11 +14300,12 @@ extern "C" {
         EbByte                               save_enhanced_picture_ptr[3];
         EbByte                               save_enhanced_picture_bit_inc_ptr[3];
         EbHandle temp_filt_done_semaphore;
-        EbHandle temp_filt_mutex;
         EbHandle debug_mutex;
 
-        uint8_t  temp_filt_prep_done;
-        uint16_t temp_filt_seg_acc;
+        // Completion of the filtering segments: completed segments per segment row, and completed segment rows
+        volatile int32_t                      tf_segment_row_done_count[SEGMENT_MAX_COUNT];
+        volatile int32_t                      tf_segment_rows_done;
+        TfSegmentStats                        tf_segment_stats[SEGMENT_MAX_COUNT];
 
         int16_t                               tf_segments_total_count;
         uint8_t                               tf_segments_column_count;
@@ -14282,9 +14313,20 @@ extern "C" {
         uint8_t                               past_altref_nframes;
         uint8_t                               future_altref_nframes;
         EbBool                                temporal_filtering_on;
+        // HME search centers of the temporal filtering, [frame][sb], reused by the ME of the picture
+        uint8_t                               tf_hme_frame_count;
+        uint64_t                              tf_hme_picture_number[ALTREF_MAX_NFRAMES];
+        TfHmeCenter                         **tf_hme_center;
         uint64_t                              filtered_sse; // the normalized SSE between filtered and original alt_ref with 8 bit precision.
                                                             // I Slice has the value of the next ALT_REF picture
         uint64_t                              filtered_sse_uv;
+        // Adaptive skipping of the temporal filtering
+        EbBool                                tf_adaptive_skip;
+        EbBool                                tf_window_skipped;
+        uint32_t                              tf_skipped_blocks;        // 64x64 neighbour blocks not motion compensated nor filtered
+        uint32_t                              tf_total_blocks;
+        uint32_t                              tf_skipped_filter_blocks; // 32x32 neighbour blocks with null filter weights
+        uint32_t                              tf_total_filter_blocks;
         FrameHeader                           frm_hdr;
         MD_COMP_TYPE                          compound_types_to_try;
         uint8_t                               compound_mode;
@@ -14584,8 +14626,14 @@ extern "C" {
         EbPtr *object_dbl_ptr,
         EbPtr  object_init_data_ptr);
 
+    extern size_t picture_parent_control_set_arena_size(
+        uint32_t           sb_total_count,
+        uint8_t            nsq_present,
+        uint8_t            mrp_mode);
+
     extern EbErrorType me_sb_results_ctor(
         MeLcuResults      *objectPtr,
+        EbArena           *arena,
         uint32_t           maxNumberOfPusPerLcu,
         uint8_t            mrp_mode,
         uint32_t           maxNumberOfMeCandidatesPerPU);
@@ -222,6 +222,8 @@ uint8_t  circ_inc(uint8_t max, uint8_t off, uint8_t input)
 #define SCENE_TH                            3000
 #define NOISY_SCENE_TH                      4500    // SCD TH in presence of noise
 #define HIGH_PICTURE_VARIANCE_TH            1500
+#define SCD_STATIC_MEAN_TH                  1       // Max average block mean difference of a static picture
+#define SCD_STATIC_HISTOGRAM_RATIO          32      // Max histogram difference of a static picture, as a fraction of the samples
 #define NUM64x64INPIC(w,h)          ((w*h)>> (LOG2F(BLOCK_SIZE_64)<<1))
 #define QUEUE_GET_PREVIOUS_SPOT(h)  ((h == 0) ? PICTURE_DECISION_REORDER_QUEUE_MAX_DEPTH - 1 : h - 1)
 #define QUEUE_GET_NEXT_SPOT(h,off)  (( (h+off) >= PICTURE_DECISION_REORDER_QUEUE_MAX_DEPTH) ? h+off - PICTURE_DECISION_REORDER_QUEUE_MAX_DEPTH  : h + off)
@@ -273,6 +275,33 @@ EbErrorType picture_decision_context_ctor(
     return EB_ErrorNone;
 }
 
+/***************************************************************************************************
+* IsStaticSceneTransition
+* Compares the 1/16 decimated luma signatures of the past and current pictures, and signals a
+* clearly static transition for which the per-region histogram analysis can be skipped
+***************************************************************************************************/
+static EbBool IsStaticSceneTransition(
+    PictureParentControlSet           *previousPictureControlSetPtr,
+    PictureParentControlSet           *currentPictureControlSetPtr)
+{
+    uint32_t meanDifference = 0;
+    uint32_t histogramDifference = 0;
+    uint32_t cellX, cellY, bin;
+
+    for (cellY = 0; cellY < SCD_SIGNATURE_GRID_SIZE; cellY++) {
+        for (cellX = 0; cellX < SCD_SIGNATURE_GRID_SIZE; cellX++)
+            meanDifference += ABS((int32_t)currentPictureControlSetPtr->scd_signature_mean[cellY][cellX] - (int32_t)previousPictureControlSetPtr->scd_signature_mean[cellY][cellX]);
+    }
+    // Early exit as soon as the block means moved
+    if (meanDifference > SCD_STATIC_MEAN_TH * SCD_SIGNATURE_GRID_SIZE * SCD_SIGNATURE_GRID_SIZE)
+        return EB_FALSE;
+
+    for (bin = 0; bin < SCD_SIGNATURE_NUMBER_OF_BINS; bin++)
+        histogramDifference += ABS((int32_t)currentPictureControlSetPtr->scd_signature_histogram[bin] - (int32_t)previousPictureControlSetPtr->scd_signature_histogram[bin]);
+
+    return (histogramDifference * SCD_STATIC_HISTOGRAM_RATIO <= currentPictureControlSetPtr->scd_signature_sample_count) ? EB_TRUE : EB_FALSE;
+}
+
 EbBool SceneTransitionDetector(
     PictureDecisionContext *context_ptr,
     SequenceControlSet                 *sequence_control_set_ptr,
@@ -330,6 +359,16 @@ EbBool SceneTransitionDetector(
         (uint32_t)(((float)((sequence_control_set_ptr->picture_analysis_number_of_regions_per_width * sequence_control_set_ptr->picture_analysis_number_of_regions_per_height) * 75) / 100) + 0.5) :
         (uint32_t)(((float)((sequence_control_set_ptr->picture_analysis_number_of_regions_per_width * sequence_control_set_ptr->picture_analysis_number_of_regions_per_height) * 50) / 100) + 0.5);
 
+    // Static pictures carry no abrupt change: age the running averages as the
+    // histogram analysis would for a near zero ahd, and skip it
+    if (!context_ptr->reset_running_avg && IsStaticSceneTransition(previousPictureControlSetPtr, currentPictureControlSetPtr)) {
+        for (regionInPictureWidthIndex = 0; regionInPictureWidthIndex < sequence_control_set_ptr->picture_analysis_number_of_regions_per_width; regionInPictureWidthIndex++) {
+            for (regionInPictureHeightIndex = 0; regionInPictureHeightIndex < sequence_control_set_ptr->picture_analysis_number_of_regions_per_height; regionInPictureHeightIndex++)
+                ahd_running_avg[regionInPictureWidthIndex][regionInPictureHeightIndex] = (3 * ahd_running_avg[regionInPictureWidthIndex][regionInPictureHeightIndex]) / 4;
+        }
+        return(EB_FALSE);
+    }
+
     regionWidth = ParentPcsWindow[1]->enhanced_picture_ptr->width / sequence_control_set_ptr->picture_analysis_number_of_regions_per_width;
     regionHeight = ParentPcsWindow[1]->enhanced_picture_ptr->height / sequence_control_set_ptr->picture_analysis_number_of_regions_per_height;
 
@@ -2925,6 +2964,9 @@ void perform_simple_picture_analysis_for_overlay(PictureParentControlSet     *pi
     // Pad input picture to complete border LCUs
     PadPictureToMultipleOfLcuDimensions(
         input_padded_picture_ptr);
+    // Block sums for the successive elimination of the ME
+    GenerateMeBlockSums(
+        paReferenceObject);
     // 1/4 & 1/16 input picture decimation
     DownsampleDecimationInputPicture(
         picture_control_set_ptr,
@@ -3939,10 +3981,15 @@ void* picture_decision_kernel(void *input_ptr)
                                 }
                                 }
 
-                                picture_control_set_ptr->temp_filt_prep_done = 0;
+                                // The siblings of an analysis group take the filtered picture of the primary
+                                const SharedAnalysisRecord *shared_filtering_ptr = NULL;
+                                if (sequence_control_set_ptr->analysis_group_ptr && !sequence_control_set_ptr->static_config.analysis_primary)
+                                    shared_filtering_ptr = shared_analysis_get_filtered_picture(sequence_control_set_ptr->analysis_group_ptr, picture_control_set_ptr->picture_number);
 
-                                // Start Filtering in ME processes
-                                {
+                                if (shared_filtering_ptr)
+                                    svt_av1_apply_shared_temporal_filtering(picture_control_set_ptr, shared_filtering_ptr);
+                                else {
+                                    // Start Filtering in ME processes
                                     int16_t seg_idx;
 
                                     // Initialize Segments
@@ -3950,7 +3997,6 @@ void* picture_decision_kernel(void *input_ptr)
                                     picture_control_set_ptr->tf_segments_row_count    = sequence_control_set_ptr->tf_segment_row_count;
                                     picture_control_set_ptr->tf_segments_total_count = (uint16_t)(picture_control_set_ptr->tf_segments_column_count  * picture_control_set_ptr->tf_segments_row_count);
 
-                                    picture_control_set_ptr->temp_filt_seg_acc = 0;
 #if  TWO_PASS
                                     if (picture_control_set_ptr->temporal_layer_index == 0)
                                         picture_control_set_ptr->altref_strength = sequence_control_set_ptr->static_config.altref_strength;
@@ -3959,6 +4005,13 @@ void* picture_decision_kernel(void *input_ptr)
 #else
                                     picture_control_set_ptr->altref_strength = sequence_control_set_ptr->static_config.altref_strength;
 #endif
+                                    // The ME of the picture reuses the HME search centers of the filtering
+                                    picture_control_set_ptr->tf_hme_frame_count = picture_control_set_ptr->past_altref_nframes + picture_control_set_ptr->future_altref_nframes + 1;
+                                    for (int pic_itr = 0; pic_itr < picture_control_set_ptr->tf_hme_frame_count; pic_itr++)
+                                        picture_control_set_ptr->tf_hme_picture_number[pic_itr] = picture_control_set_ptr->temp_filt_pcs_list[pic_itr]->picture_number;
+
+                                    // The segments complete independently once the picture is prepared
+                                    svt_av1_prepare_temporal_filtering(picture_control_set_ptr->temp_filt_pcs_list, picture_control_set_ptr);
 
                                     for (seg_idx = 0; seg_idx < picture_control_set_ptr->tf_segments_total_count; ++seg_idx) {
                                         eb_get_empty_object(
@@ -3972,6 +4025,9 @@ void* picture_decision_kernel(void *input_ptr)
                                     }
 
                                     eb_block_on_semaphore(picture_control_set_ptr->temp_filt_done_semaphore);
+
+                                    if (sequence_control_set_ptr->analysis_group_ptr && sequence_control_set_ptr->static_config.analysis_primary)
+                                        shared_analysis_put_filtered_picture(sequence_control_set_ptr->analysis_group_ptr, picture_control_set_ptr);
                                 }
 
                             }else
@@ -4128,6 +4184,13 @@ void* picture_decision_kernel(void *input_ptr)
                             picture_control_set_ptr->me_segments_total_count = (uint16_t)(picture_control_set_ptr->me_segments_column_count  * picture_control_set_ptr->me_segments_row_count);
                             picture_control_set_ptr->me_segments_completion_mask = 0;
 
+                            // The picture is decided, the siblings of an analysis group no longer wait on it
+                            if (sequence_control_set_ptr->analysis_group_ptr && !picture_control_set_ptr->is_overlay)
+                                shared_analysis_picture_done(
+                                    sequence_control_set_ptr->analysis_group_ptr,
+                                    picture_control_set_ptr->picture_number,
+                                    sequence_control_set_ptr->static_config.analysis_primary);
+
                             // Post the results to the ME processes
                             {
                                 uint32_t segment_index;
@@ -11,6 +11,7 @@
 #include "EbPictureControlSet.h"
 #include "EbSequenceControlSet.h"
 #include "EbObject.h"
+#include "EbReferenceObject.h"
 
 /**************************************
  * Context
@@ -69,6 +70,17 @@ void DownsampleDecimationInputPicture(
     EbPictureBufferDesc     *inputPaddedPicturePtr,
     EbPictureBufferDesc     *quarterDecimatedPicturePtr,
     EbPictureBufferDesc     *sixteenthDecimatedPicturePtr);
+void DownsampleDecimationInputPictureRows(
+    PictureParentControlSet *picture_control_set_ptr,
+    EbPictureBufferDesc     *inputPaddedPicturePtr,
+    EbPictureBufferDesc     *quarterDecimatedPicturePtr,
+    EbPictureBufferDesc     *sixteenthDecimatedPicturePtr,
+    uint32_t                 y_start,
+    uint32_t                 y_end);
+void PadDecimatedInputPicture(
+    PictureParentControlSet *picture_control_set_ptr,
+    EbPictureBufferDesc     *quarterDecimatedPicturePtr,
+    EbPictureBufferDesc     *sixteenthDecimatedPicturePtr);
 
 void PadPictureToMultipleOfMinCuSizeDimensions(
         SequenceControlSet            *sequence_control_set_ptr,
@@ -79,6 +91,8 @@ void PicturePreProcessingOperations(
     uint32_t                       sb_total_count);
 void PadPictureToMultipleOfLcuDimensions(
         EbPictureBufferDesc   *input_padded_picture_ptr);
+void GenerateMeBlockSums(
+        EbPaReferenceObject   *pa_reference_object);
 
 void GatheringPictureStatistics(
         SequenceControlSet            *sequence_control_set_ptr,
@@ -7754,6 +7754,115 @@ void interintra_class_pruning_2(ModeDecisionContext *context_ptr, uint64_t best_
 
 #endif
 
+/*******************************************
+* MD recon reuse: store the quantized coefficients and the reconstruction
+* of the block winner so that the encode pass can commit them as is.
+* A skipped inter block is reconstructed from its prediction only, as the
+* encode pass signals it.
+*******************************************/
+static void md_recon_reuse_store(
+    ModeDecisionContext            *context_ptr,
+    ModeDecisionCandidateBuffer    *candidate_buffer,
+    CodingUnit                     *cu_ptr)
+{
+    const BlockGeom       *blk_geom = context_ptr->blk_geom;
+    ModeDecisionCandidate *candidate_ptr = candidate_buffer->candidate_ptr;
+    EbPictureBufferDesc   *recon_ptr = candidate_buffer->recon_ptr;
+    EbPictureBufferDesc   *coeff_ptr = candidate_buffer->residual_quant_coeff_ptr;
+    const uint32_t         blk_idx = blk_geom->blkidx_mds;
+    const uint8_t          tx_depth = cu_ptr->tx_depth;
+    const EbBool           skip = candidate_ptr->type == INTER_MODE &&
+        (cu_ptr->block_has_coeff == 0 || (candidate_ptr->merge_flag &&
+        context_ptr->md_ep_pipe_sb[blk_idx].skip_cost <= context_ptr->md_ep_pipe_sb[blk_idx].merge_cost));
+    const uint32_t         luma_offset = blk_geom->origin_x + blk_geom->origin_y * recon_ptr->stride_y;
+    const uint32_t         chroma_offset = (ROUND_UV(blk_geom->origin_x) + ROUND_UV(blk_geom->origin_y) * recon_ptr->stride_cb) >> 1;
+    uint32_t               txb_1d_offset = 0, txb_1d_offset_uv = 0;
+
+    if (skip)
+        picture_copy(
+            candidate_buffer->prediction_ptr,
+            luma_offset,
+            chroma_offset,
+            recon_ptr,
+            luma_offset,
+            chroma_offset,
+            blk_geom->bwidth,
+            blk_geom->bheight,
+            blk_geom->bwidth_uv,
+            blk_geom->bheight_uv,
+            blk_geom->has_uv ? PICTURE_BUFFER_DESC_FULL_MASK : PICTURE_BUFFER_DESC_LUMA_MASK,
+            EB_FALSE);
+
+    uint8_t *dst = context_ptr->md_recon_reuse_recon[0] + context_ptr->md_recon_reuse_offset[blk_idx];
+    for (uint32_t j = 0; j < blk_geom->bheight; ++j)
+        memcpy(dst + j * blk_geom->bwidth, recon_ptr->buffer_y + luma_offset + j * recon_ptr->stride_y, blk_geom->bwidth);
+    if (blk_geom->has_uv) {
+        uint8_t *dst_cb = context_ptr->md_recon_reuse_recon[1] + context_ptr->md_recon_reuse_offset_uv[blk_idx];
+        uint8_t *dst_cr = context_ptr->md_recon_reuse_recon[2] + context_ptr->md_recon_reuse_offset_uv[blk_idx];
+        for (uint32_t j = 0; j < blk_geom->bheight_uv; ++j) {
+            memcpy(dst_cb + j * blk_geom->bwidth_uv, recon_ptr->buffer_cb + chroma_offset + j * recon_ptr->stride_cb, blk_geom->bwidth_uv);
+            memcpy(dst_cr + j * blk_geom->bwidth_uv, recon_ptr->buffer_cr + chroma_offset + j * recon_ptr->stride_cr, blk_geom->bwidth_uv);
+        }
+    }
+
+    for (uint32_t txb_itr = 0; txb_itr < blk_geom->txb_count[tx_depth]; ++txb_itr) {
+        TransformUnit *txb_ptr = &cu_ptr->transform_unit_array[txb_itr];
+        const TxSize   tx_size = blk_geom->txsize[tx_depth][txb_itr];
+
+        txb_ptr->nz_coef_count[0] = !skip && txb_ptr->y_has_coeff ? candidate_ptr->eob[0][txb_itr] : 0;
+        if (txb_ptr->nz_coef_count[0])
+            memcpy(
+                context_ptr->md_recon_reuse_coeff[0] + context_ptr->md_recon_reuse_offset[blk_idx] + txb_1d_offset,
+                ((int32_t*)coeff_ptr->buffer_y) + txb_1d_offset,
+                av1_get_max_eob(tx_size) * sizeof(int32_t));
+        txb_1d_offset += blk_geom->tx_width[tx_depth][txb_itr] * blk_geom->tx_height[tx_depth][txb_itr];
+
+        if (blk_geom->has_uv && (tx_depth == 0 || txb_itr == 0)) {
+            const TxSize tx_size_uv = blk_geom->txsize_uv[tx_depth][txb_itr];
+            txb_ptr->nz_coef_count[1] = !skip && txb_ptr->u_has_coeff ? candidate_ptr->eob[1][txb_itr] : 0;
+            txb_ptr->nz_coef_count[2] = !skip && txb_ptr->v_has_coeff ? candidate_ptr->eob[2][txb_itr] : 0;
+            if (txb_ptr->nz_coef_count[1])
+                memcpy(
+                    context_ptr->md_recon_reuse_coeff[1] + context_ptr->md_recon_reuse_offset_uv[blk_idx] + txb_1d_offset_uv,
+                    ((int32_t*)coeff_ptr->buffer_cb) + txb_1d_offset_uv,
+                    av1_get_max_eob(tx_size_uv) * sizeof(int32_t));
+            if (txb_ptr->nz_coef_count[2])
+                memcpy(
+                    context_ptr->md_recon_reuse_coeff[2] + context_ptr->md_recon_reuse_offset_uv[blk_idx] + txb_1d_offset_uv,
+                    ((int32_t*)coeff_ptr->buffer_cr) + txb_1d_offset_uv,
+                    av1_get_max_eob(tx_size_uv) * sizeof(int32_t));
+            txb_1d_offset_uv += blk_geom->tx_width_uv[tx_depth][txb_itr] * blk_geom->tx_height_uv[tx_depth][txb_itr];
+        }
+    }
+}
+
+/*******************************************
+* MD recon reuse: a redundant block takes the stored data of the block it
+* was copied from
+*******************************************/
+static void md_recon_reuse_copy(
+    ModeDecisionContext            *context_ptr,
+    uint32_t                        src_blk_mds,
+    uint32_t                        dst_blk_mds)
+{
+    const BlockGeom *blk_geom = get_blk_geom_mds(dst_blk_mds);
+    const uint32_t   luma_size = blk_geom->bwidth * blk_geom->bheight;
+    const uint32_t   chroma_size = blk_geom->has_uv ? blk_geom->bwidth_uv * blk_geom->bheight_uv : 0;
+
+    for (int plane = 0; plane < MAX_MB_PLANE; ++plane) {
+        const uint32_t *offset = plane ? context_ptr->md_recon_reuse_offset_uv : context_ptr->md_recon_reuse_offset;
+        const uint32_t  size = plane ? chroma_size : luma_size;
+        memcpy(
+            context_ptr->md_recon_reuse_recon[plane] + offset[dst_blk_mds],
+            context_ptr->md_recon_reuse_recon[plane] + offset[src_blk_mds],
+            size);
+        memcpy(
+            context_ptr->md_recon_reuse_coeff[plane] + offset[dst_blk_mds],
+            context_ptr->md_recon_reuse_coeff[plane] + offset[src_blk_mds],
+            size * sizeof(int32_t));
+    }
+}
+
 void md_encode_block(
     SequenceControlSet             *sequence_control_set_ptr,
     PictureControlSet              *picture_control_set_ptr,
@@ -8275,6 +8384,12 @@ void md_encode_block(
             cu_ptr,
             context_ptr->blk_geom);
 
+        if (context_ptr->md_recon_reuse)
+            md_recon_reuse_store(
+                context_ptr,
+                candidate_buffer,
+                cu_ptr);
+
         if (!context_ptr->blk_geom->has_uv) {
             // Store the luma data for 4x* and *x4 blocks to be used for CFL
             EbPictureBufferDesc  *recon_ptr = candidate_buffer->recon_ptr;
@@ -8705,6 +8820,8 @@ EB_EXTERN EbErrorType mode_decision_sb(
             }
 
             memcpy(&context_ptr->md_ep_pipe_sb[cu_ptr->mds_idx], &context_ptr->md_ep_pipe_sb[redundant_blk_mds], sizeof(MdEncPassCuData));
+            if (context_ptr->md_recon_reuse)
+                md_recon_reuse_copy(context_ptr, redundant_blk_mds, cu_ptr->mds_idx);
 
             if (context_ptr->blk_geom->shape == PART_N) {
                 uint8_t sq_index = LOG2F(context_ptr->blk_geom->sq_size) - 2;
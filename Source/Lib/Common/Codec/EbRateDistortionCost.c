@@ -800,7 +800,7 @@ uint64_t av1_intra_fast_cost(
     candidate_ptr->fast_chroma_rate = chromaRate;
     if (use_ssd) {
         int32_t current_q_index = frm_hdr->quantization_params.base_q_idx;
-        Dequants *const dequants = &picture_control_set_ptr->parent_pcs_ptr->deq;
+        Dequants *const dequants = picture_control_set_ptr->parent_pcs_ptr->deq;
 
         int16_t quantizer = dequants->y_dequant_Q3[current_q_index][1];
         rate = 0;
@@ -1580,7 +1580,7 @@ uint64_t mdc_av1_inter_fast_cost(
 
     if (use_ssd) {
         int32_t current_q_index = MAX(0, MIN(QINDEX_RANGE - 1, picture_control_set_ptr->parent_pcs_ptr->base_qindex));
-        Dequants *const dequants = &picture_control_set_ptr->parent_pcs_ptr->deq;
+        Dequants *const dequants = picture_control_set_ptr->parent_pcs_ptr->deq;
 
         int16_t quantizer = dequants->y_dequant_Q3[current_q_index][1];
         rate = 0;
@@ -1983,7 +1983,7 @@ uint64_t av1_inter_fast_cost(
 
     if (use_ssd) {
         int32_t current_q_index = frm_hdr->quantization_params.base_q_idx;
-        Dequants *const dequants = &picture_control_set_ptr->parent_pcs_ptr->deq;
+        Dequants *const dequants = picture_control_set_ptr->parent_pcs_ptr->deq;
 
         int16_t quantizer = dequants->y_dequant_Q3[current_q_index][1];
         rate = 0;
@@ -218,6 +218,7 @@ static void eb_pa_reference_object_dctor(EbPtr p)
     EB_DELETE(obj->sixteenth_decimated_picture_ptr);
     EB_DELETE(obj->quarter_filtered_picture_ptr);
     EB_DELETE(obj->sixteenth_filtered_picture_ptr);
+    EB_FREE_ARRAY(obj->me_block_sum);
 }
 
 /*****************************************
@@ -262,6 +263,8 @@ EbErrorType eb_pa_reference_object_ctor(
             eb_picture_buffer_desc_ctor,
             (EbPtr)(pictureBufferDescInitDataPtr + 2));
     }
+    if (((EbPaReferenceObjectDescInitData*)object_init_data_ptr)->me_block_sum)
+        EB_CALLOC_ARRAY(paReferenceObject->me_block_sum, paReferenceObject->input_padded_picture_ptr->luma_size);
 
     return EB_ErrorNone;
 }
@@ -59,6 +59,9 @@ typedef struct EbPaReferenceObject
     EbPictureBufferDesc          *sixteenth_decimated_picture_ptr;
     EbPictureBufferDesc          *quarter_filtered_picture_ptr;
     EbPictureBufferDesc          *sixteenth_filtered_picture_ptr;
+    // Sum of the 8x4 block of the rows y, y + 2, y + 4 and y + 6 at each
+    // position of the padded picture, for the successive elimination of the ME
+    uint16_t                     *me_block_sum;
     uint16_t                      variance[MAX_NUMBER_OF_TREEBLOCKS_PER_PICTURE];
     uint8_t                       y_mean[MAX_NUMBER_OF_TREEBLOCKS_PER_PICTURE];
     EB_SLICE                      slice_type;
@@ -71,6 +74,7 @@ typedef struct EbPaReferenceObjectDescInitData
     EbPictureBufferDescInitData   reference_picture_desc_init_data;
     EbPictureBufferDescInitData   quarter_picture_desc_init_data;
     EbPictureBufferDescInitData   sixteenth_picture_desc_init_data;
+    EbBool                        me_block_sum;
 } EbPaReferenceObjectDescInitData;
 
 /**************************************
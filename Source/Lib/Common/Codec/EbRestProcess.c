@@ -197,9 +197,11 @@ void   get_own_recon(
 }
 
 /******************************************************
- * Rest Kernel
+ * Rest Task
+ *   Processes one input object, called by rest_kernel or
+ *   by a worker of the encoder task pool
  ******************************************************/
-void* rest_kernel(void *input_ptr)
+void rest_task(void *input_ptr, EbObjectWrapper *cdef_results_wrapper_ptr)
 {
     // Context & SCS & PCS
     RestContext                            *context_ptr = (RestContext*)input_ptr;
@@ -208,7 +210,6 @@ void* rest_kernel(void *input_ptr)
     FrameHeader                           *frm_hdr;
 
     //// Input
-    EbObjectWrapper                       *cdef_results_wrapper_ptr;
     CdefResults                         *cdef_results_ptr;
 
     //// Output
@@ -218,141 +219,153 @@ void* rest_kernel(void *input_ptr)
     PictureDemuxResults                   *picture_demux_results_rtr;
     // SB Loop variables
 
-    for (;;) {
-        // Get Cdef Results
-        eb_get_full_object(
-            context_ptr->rest_input_fifo_ptr,
-            &cdef_results_wrapper_ptr);
+    cdef_results_ptr = (CdefResults*)cdef_results_wrapper_ptr->object_ptr;
+    picture_control_set_ptr = (PictureControlSet*)cdef_results_ptr->picture_control_set_wrapper_ptr->object_ptr;
+    sequence_control_set_ptr = (SequenceControlSet*)picture_control_set_ptr->sequence_control_set_wrapper_ptr->object_ptr;
+    frm_hdr = &picture_control_set_ptr->parent_pcs_ptr->frm_hdr;
+    uint8_t lcuSizeLog2 = (uint8_t)Log2f(sequence_control_set_ptr->sb_size_pix);
+    EbBool  is16bit = (EbBool)(sequence_control_set_ptr->static_config.encoder_bit_depth > EB_8BIT);
+    Av1Common* cm = picture_control_set_ptr->parent_pcs_ptr->av1_cm;
 
-        cdef_results_ptr = (CdefResults*)cdef_results_wrapper_ptr->object_ptr;
-        picture_control_set_ptr = (PictureControlSet*)cdef_results_ptr->picture_control_set_wrapper_ptr->object_ptr;
-        sequence_control_set_ptr = (SequenceControlSet*)picture_control_set_ptr->sequence_control_set_wrapper_ptr->object_ptr;
-        frm_hdr = &picture_control_set_ptr->parent_pcs_ptr->frm_hdr;
-        uint8_t lcuSizeLog2 = (uint8_t)Log2f(sequence_control_set_ptr->sb_size_pix);
-        EbBool  is16bit = (EbBool)(sequence_control_set_ptr->static_config.encoder_bit_depth > EB_8BIT);
-        Av1Common* cm = picture_control_set_ptr->parent_pcs_ptr->av1_cm;
+    if (sequence_control_set_ptr->seq_header.enable_restoration && frm_hdr->allow_intrabc == 0)
+    {
+        get_own_recon(sequence_control_set_ptr, picture_control_set_ptr, context_ptr, is16bit);
 
-        if (sequence_control_set_ptr->seq_header.enable_restoration && frm_hdr->allow_intrabc == 0)
-        {
-            get_own_recon(sequence_control_set_ptr, picture_control_set_ptr, context_ptr, is16bit);
-
-            Yv12BufferConfig cpi_source;
-            link_eb_to_aom_buffer_desc(
-                is16bit ? picture_control_set_ptr->input_frame16bit : picture_control_set_ptr->parent_pcs_ptr->enhanced_picture_ptr,
-                &cpi_source);
-
-            Yv12BufferConfig trial_frame_rst;
-            link_eb_to_aom_buffer_desc(
-                context_ptr->trial_frame_rst,
-                &trial_frame_rst);
-
-            Yv12BufferConfig org_fts;
-            link_eb_to_aom_buffer_desc(
-                context_ptr->org_rec_frame,
-                &org_fts);
-
-            restoration_seg_search(
-                context_ptr,
-                &org_fts,
-                &cpi_source,
-                &trial_frame_rst,
-                picture_control_set_ptr,
-                cdef_results_ptr->segment_index);
-        }
+        Yv12BufferConfig cpi_source;
+        link_eb_to_aom_buffer_desc(
+            is16bit ? picture_control_set_ptr->input_frame16bit : picture_control_set_ptr->parent_pcs_ptr->enhanced_picture_ptr,
+            &cpi_source);
 
-        //all seg based search is done. update total processed segments. if all done, finish the search and perfrom application.
-        eb_block_on_mutex(picture_control_set_ptr->rest_search_mutex);
+        Yv12BufferConfig trial_frame_rst;
+        link_eb_to_aom_buffer_desc(
+            context_ptr->trial_frame_rst,
+            &trial_frame_rst);
 
-        picture_control_set_ptr->tot_seg_searched_rest++;
-        if (picture_control_set_ptr->tot_seg_searched_rest == picture_control_set_ptr->rest_segments_total_count)
-        {
-            if (sequence_control_set_ptr->seq_header.enable_restoration && frm_hdr->allow_intrabc == 0) {
-                rest_finish_search(
-                    picture_control_set_ptr->parent_pcs_ptr->av1x,
-                    picture_control_set_ptr->parent_pcs_ptr->av1_cm);
-
-                if (cm->rst_info[0].frame_restoration_type != RESTORE_NONE ||
-                    cm->rst_info[1].frame_restoration_type != RESTORE_NONE ||
-                    cm->rst_info[2].frame_restoration_type != RESTORE_NONE)
-                {
-                    eb_av1_loop_restoration_filter_frame(
-                        cm->frame_to_show,
-                        cm,
-                        0);
-                }
-            }
-            else {
-                cm->rst_info[0].frame_restoration_type = RESTORE_NONE;
-                cm->rst_info[1].frame_restoration_type = RESTORE_NONE;
-                cm->rst_info[2].frame_restoration_type = RESTORE_NONE;
-            }
+        Yv12BufferConfig org_fts;
+        link_eb_to_aom_buffer_desc(
+            context_ptr->org_rec_frame,
+            &org_fts);
+
+        restoration_seg_search(
+            context_ptr,
+            &org_fts,
+            &cpi_source,
+            &trial_frame_rst,
+            picture_control_set_ptr,
+            cdef_results_ptr->segment_index);
+    }
 
-            uint8_t best_ep_cnt = 0;
-            uint8_t best_ep = 0;
-            for (uint8_t i = 0; i < SGRPROJ_PARAMS; i++) {
-                if (cm->sg_frame_ep_cnt[i] > best_ep_cnt) {
-                    best_ep = i;
-                    best_ep_cnt = cm->sg_frame_ep_cnt[i];
-                }
-            }
-            cm->sg_frame_ep = best_ep;
+    //all seg based search is done. update total processed segments. if all done, finish the search and perfrom application.
+    eb_block_on_mutex(picture_control_set_ptr->rest_search_mutex);
 
-            if (picture_control_set_ptr->parent_pcs_ptr->reference_picture_wrapper_ptr != NULL) {
-                // copy stat to ref object (intra_coded_area, Luminance, Scene change detection flags)
-                CopyStatisticsToRefObject(
-                    picture_control_set_ptr,
-                    sequence_control_set_ptr);
+    picture_control_set_ptr->tot_seg_searched_rest++;
+    if (picture_control_set_ptr->tot_seg_searched_rest == picture_control_set_ptr->rest_segments_total_count)
+    {
+        if (sequence_control_set_ptr->seq_header.enable_restoration && frm_hdr->allow_intrabc == 0) {
+            rest_finish_search(
+                picture_control_set_ptr->parent_pcs_ptr->av1x,
+                picture_control_set_ptr->parent_pcs_ptr->av1_cm);
+
+            if (cm->rst_info[0].frame_restoration_type != RESTORE_NONE ||
+                cm->rst_info[1].frame_restoration_type != RESTORE_NONE ||
+                cm->rst_info[2].frame_restoration_type != RESTORE_NONE)
+            {
+                eb_av1_loop_restoration_filter_frame(
+                    cm->frame_to_show,
+                    cm,
+                    0);
             }
+        }
+        else {
+            cm->rst_info[0].frame_restoration_type = RESTORE_NONE;
+            cm->rst_info[1].frame_restoration_type = RESTORE_NONE;
+            cm->rst_info[2].frame_restoration_type = RESTORE_NONE;
+        }
 
-            // PSNR Calculation
-            if (sequence_control_set_ptr->static_config.stat_report)
-                psnr_calculations(
-                    picture_control_set_ptr,
-                    sequence_control_set_ptr);
-
-            // Pad the reference picture and set ref POC
-            if (picture_control_set_ptr->parent_pcs_ptr->is_used_as_reference_flag == EB_TRUE)
-                PadRefAndSetFlags(
-                    picture_control_set_ptr,
-                    sequence_control_set_ptr);
-            if (sequence_control_set_ptr->static_config.recon_enabled) {
-                ReconOutput(
-                    picture_control_set_ptr,
-                    sequence_control_set_ptr);
+        uint8_t best_ep_cnt = 0;
+        uint8_t best_ep = 0;
+        for (uint8_t i = 0; i < SGRPROJ_PARAMS; i++) {
+            if (cm->sg_frame_ep_cnt[i] > best_ep_cnt) {
+                best_ep = i;
+                best_ep_cnt = cm->sg_frame_ep_cnt[i];
             }
+        }
+        cm->sg_frame_ep = best_ep;
 
-            if (picture_control_set_ptr->parent_pcs_ptr->is_used_as_reference_flag)
-            {
-                // Get Empty PicMgr Results
-                eb_get_empty_object(
-                    context_ptr->picture_demux_fifo_ptr,
-                    &picture_demux_results_wrapper_ptr);
-
-                picture_demux_results_rtr = (PictureDemuxResults*)picture_demux_results_wrapper_ptr->object_ptr;
-                picture_demux_results_rtr->reference_picture_wrapper_ptr = picture_control_set_ptr->parent_pcs_ptr->reference_picture_wrapper_ptr;
-                picture_demux_results_rtr->sequence_control_set_wrapper_ptr = picture_control_set_ptr->sequence_control_set_wrapper_ptr;
-                picture_demux_results_rtr->picture_number = picture_control_set_ptr->picture_number;
-                picture_demux_results_rtr->picture_type = EB_PIC_REFERENCE;
-
-                // Post Reference Picture
-                eb_post_full_object(picture_demux_results_wrapper_ptr);
-            }
+        if (picture_control_set_ptr->parent_pcs_ptr->reference_picture_wrapper_ptr != NULL) {
+            // copy stat to ref object (intra_coded_area, Luminance, Scene change detection flags)
+            CopyStatisticsToRefObject(
+                picture_control_set_ptr,
+                sequence_control_set_ptr);
+        }
 
-            // Get Empty rest Results to EC
+        // PSNR Calculation
+        if (sequence_control_set_ptr->static_config.stat_report)
+            psnr_calculations(
+                picture_control_set_ptr,
+                sequence_control_set_ptr);
+
+        // Pad the reference picture and set ref POC
+        if (picture_control_set_ptr->parent_pcs_ptr->is_used_as_reference_flag == EB_TRUE)
+            PadRefAndSetFlags(
+                picture_control_set_ptr,
+                sequence_control_set_ptr);
+        if (sequence_control_set_ptr->static_config.recon_enabled) {
+            ReconOutput(
+                picture_control_set_ptr,
+                sequence_control_set_ptr);
+        }
+
+        if (picture_control_set_ptr->parent_pcs_ptr->is_used_as_reference_flag)
+        {
+            // Get Empty PicMgr Results
             eb_get_empty_object(
-                context_ptr->rest_output_fifo_ptr,
-                &rest_results_wrapper_ptr);
-            rest_results_ptr = (struct RestResults*)rest_results_wrapper_ptr->object_ptr;
-            rest_results_ptr->picture_control_set_wrapper_ptr = cdef_results_ptr->picture_control_set_wrapper_ptr;
-            rest_results_ptr->completed_lcu_row_index_start = 0;
-            rest_results_ptr->completed_lcu_row_count = ((sequence_control_set_ptr->seq_header.max_frame_height + sequence_control_set_ptr->sb_size_pix - 1) >> lcuSizeLog2);
-            // Post Rest Results
-            eb_post_full_object(rest_results_wrapper_ptr);
+                context_ptr->picture_demux_fifo_ptr,
+                &picture_demux_results_wrapper_ptr);
+
+            picture_demux_results_rtr = (PictureDemuxResults*)picture_demux_results_wrapper_ptr->object_ptr;
+            picture_demux_results_rtr->reference_picture_wrapper_ptr = picture_control_set_ptr->parent_pcs_ptr->reference_picture_wrapper_ptr;
+            picture_demux_results_rtr->sequence_control_set_wrapper_ptr = picture_control_set_ptr->sequence_control_set_wrapper_ptr;
+            picture_demux_results_rtr->picture_number = picture_control_set_ptr->picture_number;
+            picture_demux_results_rtr->picture_type = EB_PIC_REFERENCE;
+
+            // Post Reference Picture
+            eb_post_full_object(picture_demux_results_wrapper_ptr);
         }
-        eb_release_mutex(picture_control_set_ptr->rest_search_mutex);
 
-        // Release input Results
-        eb_release_object(cdef_results_wrapper_ptr);
+        // Get Empty rest Results to EC
+        eb_get_empty_object(
+            context_ptr->rest_output_fifo_ptr,
+            &rest_results_wrapper_ptr);
+        rest_results_ptr = (struct RestResults*)rest_results_wrapper_ptr->object_ptr;
+        rest_results_ptr->picture_control_set_wrapper_ptr = cdef_results_ptr->picture_control_set_wrapper_ptr;
+        rest_results_ptr->completed_lcu_row_index_start = 0;
+        rest_results_ptr->completed_lcu_row_count = ((sequence_control_set_ptr->seq_header.max_frame_height + sequence_control_set_ptr->sb_size_pix - 1) >> lcuSizeLog2);
+        // Post Rest Results
+        eb_post_full_object(rest_results_wrapper_ptr);
+    }
+    eb_release_mutex(picture_control_set_ptr->rest_search_mutex);
+
+    // Release input Results
+    eb_release_object(cdef_results_wrapper_ptr);
+}
+
+/******************************************************
+ * Rest Kernel
+ ******************************************************/
+void* rest_kernel(void *input_ptr)
+{
+    RestContext                            *context_ptr = (RestContext*)input_ptr;
+
+    EbObjectWrapper                       *cdef_results_wrapper_ptr;
+
+    for (;;) {
+        // Get Cdef Results
+        eb_get_full_object(
+            context_ptr->rest_input_fifo_ptr,
+            &cdef_results_wrapper_ptr);
+
+        rest_task(input_ptr, cdef_results_wrapper_ptr);
     }
 
     return EB_NULL;
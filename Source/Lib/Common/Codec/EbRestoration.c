@@ -1654,9 +1654,12 @@ static void save_cdef_boundary_lines(uint8_t *src_buf, int32_t src_stride,
         RESTORATION_EXTRA_HORZ, use_highbd);
 }
 
-void save_tile_row_boundary_lines(uint8_t *src, int32_t src_stride,
+// Saves the boundary lines of a single stripe of the frame. Returns 0 when
+// the stripe lies below the frame.
+int32_t save_stripe_boundary_lines(uint8_t *src, int32_t src_stride,
     int32_t src_width, int32_t src_height, int32_t use_highbd, int32_t plane,
-    Av1Common *cm, int32_t after_cdef, RestorationStripeBoundaries *boundaries)
+    Av1Common *cm, int32_t after_cdef, int32_t tile_stripe,
+    RestorationStripeBoundaries *boundaries)
 {
     const int32_t is_uv = plane > 0;
     const int32_t ss_y = is_uv && cm->subsampling_y;
@@ -1671,53 +1674,61 @@ void save_tile_row_boundary_lines(uint8_t *src, int32_t src_stride,
 
     int32_t plane_height = ROUND_POWER_OF_TWO(cm->frm_size.frame_height, ss_y);
 
-    int32_t tile_stripe;
-    for (tile_stripe = 0;; ++tile_stripe) {
-        const int32_t rel_y0 = AOMMAX(0, tile_stripe * stripe_height - stripe_off);
-        const int32_t y0 = tile_rect.top + rel_y0;
-        if (y0 >= tile_rect.bottom) break;
-
-        const int32_t rel_y1 = (tile_stripe + 1) * stripe_height - stripe_off;
-        const int32_t y1 = AOMMIN(tile_rect.top + rel_y1, tile_rect.bottom);
-
-        const int32_t frame_stripe = stripe0 + tile_stripe;
-
-        int32_t use_deblock_above, use_deblock_below;
-        // In this case, we should only use CDEF pixels at the top
-        // and bottom of the frame as a whole; internal tile boundaries
-        // can use deblocked pixels from adjacent tiles for context.
-        use_deblock_above = (frame_stripe > 0);
-        use_deblock_below = (y1 < plane_height);
-
-        if (!after_cdef) {
-            // Save deblocked context where needed.
-            if (use_deblock_above) {
-                save_deblock_boundary_lines(src, src_stride, src_width, src_height,
-                    cm, plane, y0 - RESTORATION_CTX_VERT,
-                    frame_stripe, use_highbd, 1, boundaries);
-            }
-            if (use_deblock_below) {
-                save_deblock_boundary_lines(src, src_stride, src_width, src_height,
-                    cm, plane, y1, frame_stripe, use_highbd, 0, boundaries);
-            }
+    const int32_t rel_y0 = AOMMAX(0, tile_stripe * stripe_height - stripe_off);
+    const int32_t y0 = tile_rect.top + rel_y0;
+    if (y0 >= tile_rect.bottom) return 0;
+
+    const int32_t rel_y1 = (tile_stripe + 1) * stripe_height - stripe_off;
+    const int32_t y1 = AOMMIN(tile_rect.top + rel_y1, tile_rect.bottom);
+
+    const int32_t frame_stripe = stripe0 + tile_stripe;
+
+    int32_t use_deblock_above, use_deblock_below;
+    // In this case, we should only use CDEF pixels at the top
+    // and bottom of the frame as a whole; internal tile boundaries
+    // can use deblocked pixels from adjacent tiles for context.
+    use_deblock_above = (frame_stripe > 0);
+    use_deblock_below = (y1 < plane_height);
+
+    if (!after_cdef) {
+        // Save deblocked context where needed.
+        if (use_deblock_above) {
+            save_deblock_boundary_lines(src, src_stride, src_width, src_height,
+                cm, plane, y0 - RESTORATION_CTX_VERT,
+                frame_stripe, use_highbd, 1, boundaries);
         }
-        else {
-            // Save CDEF context where needed. Note that we need to save the CDEF
-            // context for a particular boundary iff we *didn't* save deblocked
-            // context for that boundary.
-            //
-            // In addition, we need to save copies of the outermost line within
-            // the tile, rather than using data from outside the tile.
-            if (!use_deblock_above) {
-                save_cdef_boundary_lines(src, src_stride, src_width,
-                    cm, plane, y0, frame_stripe, use_highbd, 1, boundaries);
-            }
-            if (!use_deblock_below) {
-                save_cdef_boundary_lines(src, src_stride, src_width,
-                    cm, plane, y1 - 1, frame_stripe, use_highbd, 0, boundaries);
-            }
+        if (use_deblock_below) {
+            save_deblock_boundary_lines(src, src_stride, src_width, src_height,
+                cm, plane, y1, frame_stripe, use_highbd, 0, boundaries);
+        }
+    }
+    else {
+        // Save CDEF context where needed. Note that we need to save the CDEF
+        // context for a particular boundary iff we *didn't* save deblocked
+        // context for that boundary.
+        //
+        // In addition, we need to save copies of the outermost line within
+        // the tile, rather than using data from outside the tile.
+        if (!use_deblock_above) {
+            save_cdef_boundary_lines(src, src_stride, src_width,
+                cm, plane, y0, frame_stripe, use_highbd, 1, boundaries);
+        }
+        if (!use_deblock_below) {
+            save_cdef_boundary_lines(src, src_stride, src_width,
+                cm, plane, y1 - 1, frame_stripe, use_highbd, 0, boundaries);
         }
     }
+    return 1;
+}
+
+void save_tile_row_boundary_lines(uint8_t *src, int32_t src_stride,
+    int32_t src_width, int32_t src_height, int32_t use_highbd, int32_t plane,
+    Av1Common *cm, int32_t after_cdef, RestorationStripeBoundaries *boundaries)
+{
+    int32_t tile_stripe = 0;
+    while (save_stripe_boundary_lines(src, src_stride, src_width, src_height,
+        use_highbd, plane, cm, after_cdef, tile_stripe, boundaries))
+        ++tile_stripe;
 }
 
 // For each RESTORATION_PROC_UNIT_SIZE pixel high stripe, save 4 scan
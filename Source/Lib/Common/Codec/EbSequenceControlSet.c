@@ -270,6 +270,7 @@ EbErrorType copy_sequence_control_set(
     dst->enc_dec_process_init_count = src->enc_dec_process_init_count; writeCount += sizeof(int32_t);
     dst->entropy_coding_process_init_count = src->entropy_coding_process_init_count; writeCount += sizeof(int32_t);
     dst->total_process_init_count = src->total_process_init_count; writeCount += sizeof(int32_t);
+    dst->task_pool_worker_count = src->task_pool_worker_count; writeCount += sizeof(int32_t);
     dst->left_padding = src->left_padding; writeCount += sizeof(int16_t);
     dst->right_padding = src->right_padding; writeCount += sizeof(int16_t);
     dst->top_padding = src->top_padding; writeCount += sizeof(int16_t);
@@ -291,10 +292,16 @@ EbErrorType copy_sequence_control_set(
     dst->nsq_present    = src->nsq_present;
     dst->cdf_mode       = src->cdf_mode;
     dst->down_sampling_method_me_search = src->down_sampling_method_me_search;
+    dst->me_successive_elimination = src->me_successive_elimination;
     dst->tf_segment_column_count = src->tf_segment_column_count;
     dst->tf_segment_row_count = src->tf_segment_row_count;
     dst->over_boundary_block_mode = src->over_boundary_block_mode;
     dst->mfmv_enabled = src->mfmv_enabled;
+    dst->quants_bd[0] = src->quants_bd[0];
+    dst->quants_bd[1] = src->quants_bd[1];
+    dst->deq_bd[0] = src->deq_bd[0];
+    dst->deq_bd[1] = src->deq_bd[1];
+    dst->analysis_group_ptr = src->analysis_group_ptr;
 #if TWO_PASS
     dst->use_input_stat_file = src->use_input_stat_file;
     dst->use_output_stat_file = src->use_output_stat_file;
@@ -160,6 +160,7 @@ extern "C" {
         uint32_t                                cdef_process_init_count;
         uint32_t                                rest_process_init_count;
         uint32_t                                total_process_init_count;
+        uint32_t                                task_pool_worker_count;
 
         uint16_t                                film_grain_random_seed;
         SbParams                               *sb_params_array;
@@ -194,6 +195,10 @@ extern "C" {
         *
         * Default is 0. */
         uint8_t                                 down_sampling_method_me_search;
+        /* Successive elimination of the full-pel ME positions from the block sums of the PA references (0: OFF, 1: ON)
+        *
+        * Default is 1 for 1080p and above. */
+        uint8_t                                 me_successive_elimination;
         uint8_t                                 mfmv_enabled; // 1:Enabled  0:Disabled
         uint8_t                                 trans_coeff_shape_array[2][8][4];    // [componantTypeIndex][resolutionIndex][levelIndex][tuSizeIndex]
         EbBlockMeanPrec                         block_mean_calc_prec;
@@ -217,6 +222,14 @@ extern "C" {
         SeqHeader                               seq_header;
         uint8_t                                 compound_mode;
 
+        // Quantizer tables of the 8 bit [0] and 10 bit [1] paths, built once
+        // and shared by all the encoder handles of the process
+        struct Quants                          *quants_bd[2];
+        struct Dequants                        *deq_bd[2];
+
+        // Analysis group of the channel (static_config.analysis_group), NULL when it does its own analysis
+        struct SharedAnalysisGroup             *analysis_group_ptr;
+
 #if TWO_PASS
         EbBool                                  use_input_stat_file;
         EbBool                                  use_output_stat_file;
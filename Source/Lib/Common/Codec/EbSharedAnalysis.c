@@ -0,0 +1,329 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include <string.h>
+
+#include "EbSharedAnalysis.h"
+#include "EbThreads.h"
+
+static void shared_analysis_record_dctor(EbPtr p)
+{
+    SharedAnalysisRecord *obj = (SharedAnalysisRecord*)p;
+    EB_DESTROY_SEMAPHORE(obj->statistics_semaphore);
+    EB_DESTROY_SEMAPHORE(obj->done_semaphore);
+    EB_FREE_ARRAY(obj->variance);
+    EB_FREE_ARRAY(obj->y_mean);
+    EB_FREE_ARRAY(obj->cb_mean);
+    EB_FREE_ARRAY(obj->cr_mean);
+    EB_FREE_ARRAY(obj->picture_histogram);
+    EB_FREE_ARRAY(obj->edge_results);
+    EB_FREE_ARRAY(obj->sharp_edge_sb_flag);
+    EB_FREE_ARRAY(obj->sb_stat_array);
+    for (int32_t plane = 0; plane < 3; ++plane) {
+        EB_FREE_ARRAY(obj->filtered_buffer[plane]);
+        EB_FREE_ARRAY(obj->filtered_bit_inc_buffer[plane]);
+    }
+}
+
+static EbErrorType shared_analysis_record_ctor(
+    SharedAnalysisRecord     *record_ptr,
+    SharedAnalysisGroup      *group_ptr,
+    uint64_t                  picture_number)
+{
+    const uint32_t sb_total_count = group_ptr->sb_total_count;
+
+    record_ptr->dctor = shared_analysis_record_dctor;
+    record_ptr->picture_number = picture_number;
+    record_ptr->wait_count = group_ptr->member_count;
+
+    EB_CREATE_SEMAPHORE(record_ptr->statistics_semaphore, 0, record_ptr->wait_count);
+    EB_CREATE_SEMAPHORE(record_ptr->done_semaphore, 0, record_ptr->wait_count);
+
+    EB_MALLOC_ARRAY(record_ptr->variance, sb_total_count * MAX_ME_PU_COUNT);
+    EB_MALLOC_ARRAY(record_ptr->y_mean, sb_total_count * MAX_ME_PU_COUNT);
+    EB_MALLOC_ARRAY(record_ptr->cb_mean, sb_total_count * 21);
+    EB_MALLOC_ARRAY(record_ptr->cr_mean, sb_total_count * 21);
+    EB_MALLOC_ARRAY(record_ptr->picture_histogram,
+        MAX_NUMBER_OF_REGIONS_IN_WIDTH * MAX_NUMBER_OF_REGIONS_IN_HEIGHT * 3 * HISTOGRAM_NUMBER_OF_BINS);
+    EB_MALLOC_ARRAY(record_ptr->edge_results, sb_total_count);
+    EB_MALLOC_ARRAY(record_ptr->sharp_edge_sb_flag, sb_total_count);
+    EB_MALLOC_ARRAY(record_ptr->sb_stat_array, sb_total_count);
+
+    return EB_ErrorNone;
+}
+
+static void shared_analysis_group_dctor(EbPtr p)
+{
+    SharedAnalysisGroup *obj = (SharedAnalysisGroup*)p;
+    while (obj->record_list) {
+        SharedAnalysisRecord *record_ptr = obj->record_list;
+        obj->record_list = record_ptr->next_ptr;
+        EB_DELETE(record_ptr);
+    }
+    EB_DESTROY_MUTEX(obj->mutex);
+}
+
+EbErrorType shared_analysis_group_ctor(
+    SharedAnalysisGroup      *group_ptr,
+    uint32_t                  group_id,
+    uint16_t                  width,
+    uint16_t                  height,
+    uint32_t                  encoder_bit_depth,
+    EbColorFormat             color_format,
+    uint32_t                  sb_total_count)
+{
+    group_ptr->dctor = shared_analysis_group_dctor;
+    group_ptr->group_id = group_id;
+    group_ptr->width = width;
+    group_ptr->height = height;
+    group_ptr->encoder_bit_depth = encoder_bit_depth;
+    group_ptr->color_format = color_format;
+    group_ptr->sb_total_count = sb_total_count;
+    EB_CREATE_MUTEX(group_ptr->mutex);
+
+    return EB_ErrorNone;
+}
+
+// Call with the group mutex held
+static SharedAnalysisRecord *find_record(
+    SharedAnalysisGroup      *group_ptr,
+    uint64_t                  picture_number)
+{
+    SharedAnalysisRecord *record_ptr = group_ptr->record_list;
+    while (record_ptr && record_ptr->picture_number != picture_number)
+        record_ptr = record_ptr->next_ptr;
+    return record_ptr;
+}
+
+/**********************************
+* get_record
+*   Finds the record of the picture, the first member to reach the
+*   picture creates it. The record stays valid until the caller
+*   calls shared_analysis_picture_done() for the picture.
+**********************************/
+static EbErrorType get_record(
+    SharedAnalysisGroup      *group_ptr,
+    uint64_t                  picture_number,
+    SharedAnalysisRecord    **record_ptr)
+{
+    SharedAnalysisRecord *new_record_ptr;
+
+    eb_block_on_mutex(group_ptr->mutex);
+    *record_ptr = find_record(group_ptr, picture_number);
+    eb_release_mutex(group_ptr->mutex);
+    if (*record_ptr)
+        return EB_ErrorNone;
+
+    EB_NEW(new_record_ptr, shared_analysis_record_ctor, group_ptr, picture_number);
+
+    eb_block_on_mutex(group_ptr->mutex);
+    *record_ptr = find_record(group_ptr, picture_number);
+    if (*record_ptr == NULL) {
+        new_record_ptr->next_ptr = group_ptr->record_list;
+        group_ptr->record_list = new_record_ptr;
+        *record_ptr = new_record_ptr;
+        new_record_ptr = NULL;
+    }
+    eb_release_mutex(group_ptr->mutex);
+    EB_DELETE(new_record_ptr);
+
+    return EB_ErrorNone;
+}
+
+// Call with the group mutex held
+static void post_record(EbHandle semaphore, EbBool *posted, uint32_t wait_count)
+{
+    if (*posted)
+        return;
+    *posted = EB_TRUE;
+    for (uint32_t i = 0; i < wait_count; ++i)
+        eb_post_semaphore(semaphore);
+}
+
+void shared_analysis_primary_leave(
+    SharedAnalysisGroup      *group_ptr)
+{
+    eb_block_on_mutex(group_ptr->mutex);
+    group_ptr->primary_left = EB_TRUE;
+    for (SharedAnalysisRecord *record_ptr = group_ptr->record_list; record_ptr; record_ptr = record_ptr->next_ptr) {
+        post_record(record_ptr->statistics_semaphore, &record_ptr->statistics_posted, record_ptr->wait_count);
+        post_record(record_ptr->done_semaphore, &record_ptr->done_posted, record_ptr->wait_count);
+    }
+    eb_release_mutex(group_ptr->mutex);
+}
+
+void shared_analysis_put_statistics(
+    SharedAnalysisGroup      *group_ptr,
+    PictureParentControlSet  *picture_control_set_ptr)
+{
+    SharedAnalysisRecord *record_ptr;
+    const uint32_t sb_total_count = group_ptr->sb_total_count;
+
+    if (get_record(group_ptr, picture_control_set_ptr->picture_number, &record_ptr) != EB_ErrorNone)
+        return;
+
+    // the 2D arrays of the PPCS are carved in one block
+    EB_MEMCPY(record_ptr->variance, picture_control_set_ptr->variance[0], sizeof(uint16_t) * sb_total_count * MAX_ME_PU_COUNT);
+    EB_MEMCPY(record_ptr->y_mean, picture_control_set_ptr->y_mean[0], sizeof(uint8_t) * sb_total_count * MAX_ME_PU_COUNT);
+    EB_MEMCPY(record_ptr->cb_mean, picture_control_set_ptr->cbMean[0], sizeof(uint8_t) * sb_total_count * 21);
+    EB_MEMCPY(record_ptr->cr_mean, picture_control_set_ptr->crMean[0], sizeof(uint8_t) * sb_total_count * 21);
+    for (uint32_t region_width_index = 0; region_width_index < MAX_NUMBER_OF_REGIONS_IN_WIDTH; region_width_index++) {
+        for (uint32_t region_height_index = 0; region_height_index < MAX_NUMBER_OF_REGIONS_IN_HEIGHT; region_height_index++) {
+            EB_MEMCPY(
+                &record_ptr->picture_histogram[(region_width_index * MAX_NUMBER_OF_REGIONS_IN_HEIGHT + region_height_index) * 3 * HISTOGRAM_NUMBER_OF_BINS],
+                picture_control_set_ptr->picture_histogram[region_width_index][region_height_index][0],
+                sizeof(uint32_t) * 3 * HISTOGRAM_NUMBER_OF_BINS);
+        }
+    }
+    EB_MEMCPY(record_ptr->average_intensity_per_region, picture_control_set_ptr->average_intensity_per_region, sizeof(record_ptr->average_intensity_per_region));
+    EB_MEMCPY(record_ptr->average_intensity, picture_control_set_ptr->average_intensity, sizeof(record_ptr->average_intensity));
+    record_ptr->pic_avg_variance = picture_control_set_ptr->pic_avg_variance;
+    EB_MEMCPY(record_ptr->edge_results, picture_control_set_ptr->edge_results_ptr, sizeof(EdgeLcuResults) * sb_total_count);
+    EB_MEMCPY(record_ptr->sharp_edge_sb_flag, picture_control_set_ptr->sharp_edge_sb_flag, sizeof(uint8_t) * sb_total_count);
+    EB_MEMCPY(record_ptr->sb_stat_array, picture_control_set_ptr->sb_stat_array, sizeof(SbStat) * sb_total_count);
+    record_ptr->very_low_var_pic_flag = picture_control_set_ptr->very_low_var_pic_flag;
+    record_ptr->logo_pic_flag = picture_control_set_ptr->logo_pic_flag;
+    record_ptr->sc_content_detected = picture_control_set_ptr->sc_content_detected;
+
+    eb_block_on_mutex(group_ptr->mutex);
+    record_ptr->statistics_ready = EB_TRUE;
+    post_record(record_ptr->statistics_semaphore, &record_ptr->statistics_posted, record_ptr->wait_count);
+    eb_release_mutex(group_ptr->mutex);
+}
+
+EbBool shared_analysis_get_statistics(
+    SharedAnalysisGroup      *group_ptr,
+    PictureParentControlSet  *picture_control_set_ptr)
+{
+    SharedAnalysisRecord *record_ptr;
+    const uint32_t sb_total_count = group_ptr->sb_total_count;
+    EbBool wait;
+
+    if (get_record(group_ptr, picture_control_set_ptr->picture_number, &record_ptr) != EB_ErrorNone)
+        return EB_FALSE;
+
+    eb_block_on_mutex(group_ptr->mutex);
+    wait = !group_ptr->primary_left || record_ptr->statistics_posted;
+    eb_release_mutex(group_ptr->mutex);
+    if (!wait)
+        return EB_FALSE;
+    eb_block_on_semaphore(record_ptr->statistics_semaphore);
+    if (!record_ptr->statistics_ready)
+        return EB_FALSE;
+
+    EB_MEMCPY(picture_control_set_ptr->variance[0], record_ptr->variance, sizeof(uint16_t) * sb_total_count * MAX_ME_PU_COUNT);
+    EB_MEMCPY(picture_control_set_ptr->y_mean[0], record_ptr->y_mean, sizeof(uint8_t) * sb_total_count * MAX_ME_PU_COUNT);
+    EB_MEMCPY(picture_control_set_ptr->cbMean[0], record_ptr->cb_mean, sizeof(uint8_t) * sb_total_count * 21);
+    EB_MEMCPY(picture_control_set_ptr->crMean[0], record_ptr->cr_mean, sizeof(uint8_t) * sb_total_count * 21);
+    for (uint32_t region_width_index = 0; region_width_index < MAX_NUMBER_OF_REGIONS_IN_WIDTH; region_width_index++) {
+        for (uint32_t region_height_index = 0; region_height_index < MAX_NUMBER_OF_REGIONS_IN_HEIGHT; region_height_index++) {
+            EB_MEMCPY(
+                picture_control_set_ptr->picture_histogram[region_width_index][region_height_index][0],
+                &record_ptr->picture_histogram[(region_width_index * MAX_NUMBER_OF_REGIONS_IN_HEIGHT + region_height_index) * 3 * HISTOGRAM_NUMBER_OF_BINS],
+                sizeof(uint32_t) * 3 * HISTOGRAM_NUMBER_OF_BINS);
+        }
+    }
+    EB_MEMCPY(picture_control_set_ptr->average_intensity_per_region, record_ptr->average_intensity_per_region, sizeof(record_ptr->average_intensity_per_region));
+    EB_MEMCPY(picture_control_set_ptr->average_intensity, record_ptr->average_intensity, sizeof(record_ptr->average_intensity));
+    picture_control_set_ptr->pic_avg_variance = record_ptr->pic_avg_variance;
+    EB_MEMCPY(picture_control_set_ptr->edge_results_ptr, record_ptr->edge_results, sizeof(EdgeLcuResults) * sb_total_count);
+    EB_MEMCPY(picture_control_set_ptr->sharp_edge_sb_flag, record_ptr->sharp_edge_sb_flag, sizeof(uint8_t) * sb_total_count);
+    EB_MEMCPY(picture_control_set_ptr->sb_stat_array, record_ptr->sb_stat_array, sizeof(SbStat) * sb_total_count);
+    picture_control_set_ptr->very_low_var_pic_flag = record_ptr->very_low_var_pic_flag;
+    picture_control_set_ptr->logo_pic_flag = record_ptr->logo_pic_flag;
+    picture_control_set_ptr->sc_content_detected = record_ptr->sc_content_detected;
+
+    return EB_TRUE;
+}
+
+static EbErrorType copy_filtered_picture(
+    SharedAnalysisRecord     *record_ptr,
+    EbPictureBufferDesc      *picture_ptr,
+    EbBool                    is_highbd)
+{
+    EbByte buffer[3] = { picture_ptr->buffer_y, picture_ptr->buffer_cb, picture_ptr->buffer_cr };
+    EbByte bit_inc_buffer[3] = { picture_ptr->buffer_bit_inc_y, picture_ptr->buffer_bit_inc_cb, picture_ptr->buffer_bit_inc_cr };
+
+    record_ptr->filtered_luma_size = picture_ptr->luma_size;
+    record_ptr->filtered_chroma_size = picture_ptr->chroma_size;
+    for (int32_t plane = 0; plane < 3; ++plane) {
+        const uint32_t plane_size = plane ? picture_ptr->chroma_size : picture_ptr->luma_size;
+        EB_MALLOC_ARRAY(record_ptr->filtered_buffer[plane], plane_size);
+        EB_MEMCPY(record_ptr->filtered_buffer[plane], buffer[plane], plane_size);
+        if (is_highbd) {
+            EB_MALLOC_ARRAY(record_ptr->filtered_bit_inc_buffer[plane], plane_size);
+            EB_MEMCPY(record_ptr->filtered_bit_inc_buffer[plane], bit_inc_buffer[plane], plane_size);
+        }
+    }
+
+    return EB_ErrorNone;
+}
+
+void shared_analysis_put_filtered_picture(
+    SharedAnalysisGroup      *group_ptr,
+    PictureParentControlSet  *picture_control_set_ptr)
+{
+    SharedAnalysisRecord *record_ptr;
+
+    if (get_record(group_ptr, picture_control_set_ptr->picture_number, &record_ptr) != EB_ErrorNone)
+        return;
+
+    // the siblings filter the picture themselves when it can not be kept
+    if (copy_filtered_picture(record_ptr, picture_control_set_ptr->enhanced_picture_ptr, (EbBool)(group_ptr->encoder_bit_depth > EB_8BIT)) != EB_ErrorNone)
+        return;
+    record_ptr->altref_strength = picture_control_set_ptr->altref_strength;
+    record_ptr->filtered_sse = picture_control_set_ptr->filtered_sse;
+    record_ptr->filtered_sse_uv = picture_control_set_ptr->filtered_sse_uv;
+
+    eb_block_on_mutex(group_ptr->mutex);
+    record_ptr->filtered_ready = EB_TRUE;
+    eb_release_mutex(group_ptr->mutex);
+}
+
+const SharedAnalysisRecord *shared_analysis_get_filtered_picture(
+    SharedAnalysisGroup      *group_ptr,
+    uint64_t                  picture_number)
+{
+    SharedAnalysisRecord *record_ptr;
+    EbBool wait;
+
+    if (get_record(group_ptr, picture_number, &record_ptr) != EB_ErrorNone)
+        return NULL;
+
+    eb_block_on_mutex(group_ptr->mutex);
+    wait = !group_ptr->primary_left || record_ptr->done_posted;
+    eb_release_mutex(group_ptr->mutex);
+    if (!wait)
+        return NULL;
+    eb_block_on_semaphore(record_ptr->done_semaphore);
+
+    return record_ptr->filtered_ready ? record_ptr : NULL;
+}
+
+void shared_analysis_picture_done(
+    SharedAnalysisGroup      *group_ptr,
+    uint64_t                  picture_number,
+    EbBool                    is_primary)
+{
+    SharedAnalysisRecord *record_ptr;
+
+    // the primary creates the record when it failed to publish, the siblings may wait on it
+    if (get_record(group_ptr, picture_number, &record_ptr) != EB_ErrorNone)
+        return;
+
+    eb_block_on_mutex(group_ptr->mutex);
+    if (is_primary) {
+        post_record(record_ptr->statistics_semaphore, &record_ptr->statistics_posted, record_ptr->wait_count);
+        post_record(record_ptr->done_semaphore, &record_ptr->done_posted, record_ptr->wait_count);
+    }
+    if (++record_ptr->done_count == record_ptr->wait_count) {
+        SharedAnalysisRecord **link_ptr = &group_ptr->record_list;
+        while (*link_ptr != record_ptr)
+            link_ptr = &(*link_ptr)->next_ptr;
+        *link_ptr = record_ptr->next_ptr;
+        EB_DELETE(record_ptr);
+    }
+    eb_release_mutex(group_ptr->mutex);
+}
@@ -0,0 +1,136 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#ifndef EbSharedAnalysis_h
+#define EbSharedAnalysis_h
+
+#include "EbDefinitions.h"
+#include "EbObject.h"
+#include "EbCodingUnit.h"
+#include "EbPictureControlSet.h"
+#ifdef __cplusplus
+extern "C" {
+#endif
+    /*********************************************************************
+     * Shared Analysis
+     *   The encoder channels of a process that code the same source at
+     *   the same resolution (the renditions of an ABR ladder) can join an
+     *   analysis group. The primary channel of the group publishes, per
+     *   picture, the statistics of the picture analysis and the
+     *   temporally filtered alt-ref pictures. The other channels (the
+     *   siblings) wait for them in place of computing their own.
+     *
+     *   The scene change detection of the siblings runs on the shared
+     *   histograms and intensities, so it takes the decisions of the
+     *   primary and the siblings filter the same pictures.
+     *
+     *   A record lives until every member of the group has decided the
+     *   picture. When the primary leaves the group, the siblings go back
+     *   to their own analysis for the pictures it did not publish.
+     *********************************************************************/
+    typedef struct SharedAnalysisRecord
+    {
+        EbDctor                   dctor;
+        struct SharedAnalysisRecord *next_ptr;
+        uint64_t                  picture_number;
+        uint32_t                  wait_count;           // members of the group when the record was created
+        uint32_t                  done_count;           // members that decided the picture
+
+        // posted wait_count times when the statistics are published / the primary decided the picture
+        EbHandle                  statistics_semaphore;
+        EbHandle                  done_semaphore;
+        EbBool                    statistics_posted;
+        EbBool                    done_posted;
+
+        // Picture analysis
+        EbBool                    statistics_ready;
+        uint16_t                 *variance;
+        uint8_t                  *y_mean;
+        uint8_t                  *cb_mean;
+        uint8_t                  *cr_mean;
+        uint32_t                 *picture_histogram;
+        uint64_t                  average_intensity_per_region[MAX_NUMBER_OF_REGIONS_IN_WIDTH][MAX_NUMBER_OF_REGIONS_IN_HEIGHT][3];
+        uint8_t                   average_intensity[3];
+        uint16_t                  pic_avg_variance;
+        EdgeLcuResults           *edge_results;
+        uint8_t                  *sharp_edge_sb_flag;
+        SbStat                   *sb_stat_array;
+        uint8_t                   very_low_var_pic_flag;
+        EbBool                    logo_pic_flag;
+        uint8_t                   sc_content_detected;
+
+        // Temporal filtering: the filtered enhanced picture of an alt-ref
+        EbBool                    filtered_ready;
+        EbByte                    filtered_buffer[3];
+        EbByte                    filtered_bit_inc_buffer[3];
+        uint32_t                  filtered_luma_size;
+        uint32_t                  filtered_chroma_size;
+        uint8_t                   altref_strength;
+        uint64_t                  filtered_sse;
+        uint64_t                  filtered_sse_uv;
+    } SharedAnalysisRecord;
+
+    typedef struct SharedAnalysisGroup
+    {
+        EbDctor                   dctor;
+        struct SharedAnalysisGroup *next_ptr;
+        uint32_t                  group_id;
+        EbHandle                  mutex;                // guards the members and the record list
+        uint32_t                  member_count;
+        EbBool                    has_primary;
+        EbBool                    primary_left;
+
+        // every member codes the same picture layout
+        uint16_t                  width;
+        uint16_t                  height;
+        uint32_t                  encoder_bit_depth;
+        EbColorFormat             color_format;
+        uint32_t                  sb_total_count;
+
+        SharedAnalysisRecord     *record_list;
+    } SharedAnalysisGroup;
+
+    extern EbErrorType shared_analysis_group_ctor(
+        SharedAnalysisGroup      *group_ptr,
+        uint32_t                  group_id,
+        uint16_t                  width,
+        uint16_t                  height,
+        uint32_t                  encoder_bit_depth,
+        EbColorFormat             color_format,
+        uint32_t                  sb_total_count);
+
+    // Called by the primary once its pipeline is stopped
+    extern void shared_analysis_primary_leave(
+        SharedAnalysisGroup      *group_ptr);
+
+    // Primary: publishes the statistics of GatheringPictureStatistics() and the screen content detection
+    extern void shared_analysis_put_statistics(
+        SharedAnalysisGroup      *group_ptr,
+        PictureParentControlSet  *picture_control_set_ptr);
+
+    // Sibling: waits for the statistics of the primary, returns EB_FALSE when they will not come
+    extern EbBool shared_analysis_get_statistics(
+        SharedAnalysisGroup      *group_ptr,
+        PictureParentControlSet  *picture_control_set_ptr);
+
+    // Primary: publishes the temporally filtered picture once the filtering is done
+    extern void shared_analysis_put_filtered_picture(
+        SharedAnalysisGroup      *group_ptr,
+        PictureParentControlSet  *picture_control_set_ptr);
+
+    // Sibling: waits until the primary decided the picture, returns NULL when it did not filter it
+    extern const SharedAnalysisRecord *shared_analysis_get_filtered_picture(
+        SharedAnalysisGroup      *group_ptr,
+        uint64_t                  picture_number);
+
+    // Every member, once the picture decision of the picture is done
+    extern void shared_analysis_picture_done(
+        SharedAnalysisGroup      *group_ptr,
+        uint64_t                  picture_number,
+        EbBool                    is_primary);
+#ifdef __cplusplus
+}
+#endif
+#endif // EbSharedAnalysis_h
@@ -181,6 +181,131 @@ static EbErrorType EbCircularBufferPushFront(
     return return_error;
 }
 
+#if LOCK_FREE_FIFO
+#define LOCK_FREE_SPIN_COUNT 1024
+
+void EbLockFreeRingDctor(EbPtr p)
+{
+    EbLockFreeRing* obj = (EbLockFreeRing*)p;
+    EB_FREE_ARRAY(obj->cell_array);
+    EB_DESTROY_SEMAPHORE(obj->park_semaphore);
+}
+
+/**************************************
+ * EbLockFreeRingCtor
+ **************************************/
+static EbErrorType EbLockFreeRingCtor(
+    EbLockFreeRing    *ringPtr,
+    uint32_t           object_total_count,
+    uint32_t           process_total_count)
+{
+    uint32_t cellCount = 1;
+    uint32_t cellIndex;
+
+    ringPtr->dctor = EbLockFreeRingDctor;
+
+    // Power of two, large enough to hold every object of the resource
+    while (cellCount < object_total_count)
+        cellCount <<= 1;
+    ringPtr->cell_mask = cellCount - 1;
+
+    EB_MALLOC_ARRAY(ringPtr->cell_array, cellCount);
+    for (cellIndex = 0; cellIndex < cellCount; ++cellIndex) {
+        ringPtr->cell_array[cellIndex].sequence = (int32_t)cellIndex;
+        ringPtr->cell_array[cellIndex].object_ptr = EB_NULL;
+    }
+
+    // At most one pending post per parked consumer
+    EB_CREATE_SEMAPHORE(ringPtr->park_semaphore, 0, process_total_count + object_total_count);
+
+    return EB_ErrorNone;
+}
+
+// Position arithmetic wraps around, done on unsigned values
+#define LOCK_FREE_POS_ADD(pos, n)  ((int32_t)((uint32_t)(pos) + (uint32_t)(n)))
+#define LOCK_FREE_POS_DIFF(a, b)   ((int32_t)((uint32_t)(a) - (uint32_t)(b)))
+
+/**************************************
+ * EbLockFreeRingPush
+ **************************************/
+static void EbLockFreeRingPush(
+    EbLockFreeRing   *ringPtr,
+    EbPtr             object_ptr)
+{
+    EbLockFreeCell *cellPtr;
+    int32_t         pos = eb_atomic_load(&ringPtr->enqueue_pos);
+
+    // Claim the cell at enqueue_pos. The ring never fills up since it
+    // can hold every object of the resource.
+    for (;;) {
+        int32_t diff;
+        cellPtr = &ringPtr->cell_array[(uint32_t)pos & ringPtr->cell_mask];
+        diff = LOCK_FREE_POS_DIFF(eb_atomic_load(&cellPtr->sequence), pos);
+        if (diff == 0) {
+            if (eb_atomic_compare_exchange(&ringPtr->enqueue_pos, pos, LOCK_FREE_POS_ADD(pos, 1)))
+                break;
+        }
+        else if (diff < 0)
+            eb_cpu_pause();
+        pos = eb_atomic_load(&ringPtr->enqueue_pos);
+    }
+
+    // Publish the object
+    cellPtr->object_ptr = object_ptr;
+    eb_atomic_store(&cellPtr->sequence, LOCK_FREE_POS_ADD(pos, 1));
+
+    // Wake up a parked consumer, if any
+    if (eb_atomic_fetch_add(&ringPtr->available_count, 1) < 0)
+        eb_post_semaphore(ringPtr->park_semaphore);
+}
+
+/**************************************
+ * EbLockFreeRingPop
+ **************************************/
+static EbPtr EbLockFreeRingPop(
+    EbLockFreeRing   *ringPtr)
+{
+    EbLockFreeCell *cellPtr;
+    EbPtr           object_ptr;
+    EbBool          reserved = EB_FALSE;
+    uint32_t        spin;
+    int32_t         pos;
+
+    // Reserve one object, spin first and park if the ring stays empty
+    for (spin = 0; spin < LOCK_FREE_SPIN_COUNT && reserved == EB_FALSE; ++spin) {
+        int32_t count = eb_atomic_load(&ringPtr->available_count);
+        if (count > 0)
+            reserved = eb_atomic_compare_exchange(&ringPtr->available_count, count, count - 1);
+        else
+            eb_cpu_pause();
+    }
+    if (reserved == EB_FALSE && eb_atomic_fetch_add(&ringPtr->available_count, -1) <= 0)
+        eb_block_on_semaphore(ringPtr->park_semaphore);
+
+    // Take the cell at dequeue_pos. Its producer may not have published
+    // it yet, in which case wait for it.
+    pos = eb_atomic_load(&ringPtr->dequeue_pos);
+    for (;;) {
+        int32_t diff;
+        cellPtr = &ringPtr->cell_array[(uint32_t)pos & ringPtr->cell_mask];
+        diff = LOCK_FREE_POS_DIFF(eb_atomic_load(&cellPtr->sequence), LOCK_FREE_POS_ADD(pos, 1));
+        if (diff == 0) {
+            if (eb_atomic_compare_exchange(&ringPtr->dequeue_pos, pos, LOCK_FREE_POS_ADD(pos, 1)))
+                break;
+        }
+        else if (diff < 0)
+            eb_cpu_pause();
+        pos = eb_atomic_load(&ringPtr->dequeue_pos);
+    }
+
+    // Hand the cell back to the producers, one lap later
+    object_ptr = cellPtr->object_ptr;
+    eb_atomic_store(&cellPtr->sequence, LOCK_FREE_POS_ADD(pos, ringPtr->cell_mask + 1));
+
+    return object_ptr;
+}
+#endif
+
 void EbMuxingQueueDctor(EbPtr p)
 {
     EbMuxingQueue* obj = (EbMuxingQueue*)p;
@@ -188,6 +313,9 @@ void EbMuxingQueueDctor(EbPtr p)
     EB_DELETE(obj->object_queue);
     EB_DELETE(obj->process_queue);
     EB_DESTROY_MUTEX(obj->lockout_mutex);
+#if LOCK_FREE_FIFO
+    EB_DELETE(obj->ring_ptr);
+#endif
 }
 
 /**************************************
@@ -234,9 +362,47 @@ static EbErrorType EbMuxingQueueCtor(
 
     *processFifoPtrArrayPtr = queue_ptr->process_fifo_ptr_array;
 
+#if LOCK_FREE_FIFO
+    queue_ptr->lock_free = EB_TRUE;
+    EB_NEW(
+        queue_ptr->ring_ptr,
+        EbLockFreeRingCtor,
+        object_total_count,
+        process_total_count);
+#endif
+
     return return_error;
 }
 
+static EbErrorType EbReleaseProcess(
+    EbFifo   *processFifoPtr);
+
+/**************************************
+ * EbFifoTask
+ *   Pool side of a fifo attached with
+ *   eb_fifo_attach_task_pool.
+ **************************************/
+static void EbFifoTask(
+    void *input_ptr)
+{
+    EbFifo          *fifoPtr = (EbFifo*)input_ptr;
+    EbObjectWrapper *wrapper_ptr;
+
+    // The task is only submitted once the object is on the fifo
+    eb_block_on_semaphore(fifoPtr->counting_semaphore);
+
+    eb_block_on_mutex(fifoPtr->lockout_mutex);
+    EbFifoPopFront(
+        fifoPtr,
+        &wrapper_ptr);
+    eb_release_mutex(fifoPtr->lockout_mutex);
+
+    fifoPtr->task_fn(fifoPtr->task_context, wrapper_ptr);
+
+    // Ready for the next object
+    EbReleaseProcess(fifoPtr);
+}
+
 /**************************************
  * EbMuxingQueueAssignation
  **************************************/
@@ -273,6 +439,10 @@ static EbErrorType EbMuxingQueueAssignation(
 
         // Post the semaphore
         eb_post_semaphore(processFifoPtr->counting_semaphore);
+
+        // No thread waits on a task fifo, queue the work to the pool
+        if (processFifoPtr->task_pool_ptr)
+            eb_thread_pool_submit(processFifoPtr->task_pool_ptr, EbFifoTask, processFifoPtr);
     }
 
     return return_error;
@@ -512,9 +682,15 @@ EbErrorType eb_system_resource_ctor(
         producer_fifo_ptr_array_ptr);
     // Fill the Empty Fifo with every ObjectWrapper
     for (wrapperIndex = 0; wrapperIndex < resource_ptr->object_total_count; ++wrapperIndex) {
+#if LOCK_FREE_FIFO
+        EbLockFreeRingPush(
+            resource_ptr->empty_queue->ring_ptr,
+            resource_ptr->wrapper_ptr_pool[wrapperIndex]);
+#else
         EbMuxingQueueObjectPushBack(
             resource_ptr->empty_queue,
             resource_ptr->wrapper_ptr_pool[wrapperIndex]);
+#endif
     }
 
     // Initialize the Full Queue
@@ -557,6 +733,29 @@ static EbErrorType EbReleaseProcess(
     return return_error;
 }
 
+/*********************************************************************
+ * eb_fifo_attach_task_pool
+ *********************************************************************/
+EbErrorType eb_fifo_attach_task_pool(
+    EbFifo        *fifo_ptr,
+    EbThreadPool  *pool_ptr,
+    EbFifoTaskFn   task_fn,
+    void          *task_context)
+{
+    fifo_ptr->task_pool_ptr = pool_ptr;
+    fifo_ptr->task_fn = task_fn;
+    fifo_ptr->task_context = task_context;
+
+#if LOCK_FREE_FIFO
+    // Tasks are assigned per process fifo, which the ring does not do.
+    // Attaching happens before any object is posted to the queue.
+    fifo_ptr->queue_ptr->lock_free = EB_FALSE;
+#endif
+
+    // Queue the Fifo, as a waiting thread would do
+    return EbReleaseProcess(fifo_ptr);
+}
+
 /*********************************************************************
  * EbSystemResourcePostObject
  *   Queues a full EbObjectWrapper to the SystemResource. This
@@ -576,6 +775,15 @@ EbErrorType eb_post_full_object(
 {
     EbErrorType return_error = EB_ErrorNone;
 
+#if LOCK_FREE_FIFO
+    if (object_ptr->system_resource_ptr->full_queue->lock_free) {
+        EbLockFreeRingPush(
+            object_ptr->system_resource_ptr->full_queue->ring_ptr,
+            object_ptr);
+        return return_error;
+    }
+#endif
+
     eb_block_on_mutex(object_ptr->system_resource_ptr->full_queue->lockout_mutex);
 
     EbMuxingQueueObjectPushBack(
@@ -611,6 +819,14 @@ EbErrorType eb_release_object(
         // Set live_count to EB_ObjectWrapperReleasedValue
         object_ptr->live_count = EB_ObjectWrapperReleasedValue;
 
+#if LOCK_FREE_FIFO
+        // The mutex only protects live_count then
+        if (object_ptr->system_resource_ptr->empty_queue->lock_free)
+            EbLockFreeRingPush(
+                object_ptr->system_resource_ptr->empty_queue->ring_ptr,
+                object_ptr);
+        else
+#endif
         EbMuxingQueueObjectPushFront(
             object_ptr->system_resource_ptr->empty_queue,
             object_ptr);
@@ -642,6 +858,18 @@ EbErrorType eb_get_empty_object(
 {
     EbErrorType return_error = EB_ErrorNone;
 
+#if LOCK_FREE_FIFO
+    if (empty_fifo_ptr->queue_ptr->lock_free) {
+        // Any producer takes the next empty object
+        *wrapper_dbl_ptr = (EbObjectWrapper*)EbLockFreeRingPop(empty_fifo_ptr->queue_ptr->ring_ptr);
+
+        // The object is owned by the caller from here on
+        (*wrapper_dbl_ptr)->live_count = 0;
+        (*wrapper_dbl_ptr)->release_enable = EB_TRUE;
+        return return_error;
+    }
+#endif
+
     // Queue the Fifo requesting the empty fifo
     EbReleaseProcess(empty_fifo_ptr);
 
@@ -689,6 +917,14 @@ EbErrorType eb_get_full_object(
 {
     EbErrorType return_error = EB_ErrorNone;
 
+#if LOCK_FREE_FIFO
+    if (full_fifo_ptr->queue_ptr->lock_free) {
+        // Any consumer takes the next full object
+        *wrapper_dbl_ptr = (EbObjectWrapper*)EbLockFreeRingPop(full_fifo_ptr->queue_ptr->ring_ptr);
+        return return_error;
+    }
+#endif
+
     // Queue the Fifo requesting the full fifo
     EbReleaseProcess(full_fifo_ptr);
 
@@ -9,6 +9,7 @@
 #include "EbDefinitions.h"
 #include "EbThreads.h"
 #include "EbObject.h"
+#include "EbThreadPool.h"
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -50,6 +51,8 @@ extern "C" {
         struct EbObjectWrapper *next_ptr;
     } EbObjectWrapper;
 
+    typedef void(*EbFifoTaskFn)(void *task_context, EbObjectWrapper *wrapper_ptr);
+
     /*********************************************************************
      * Fifo
      *   Defines a static (i.e. no dynamic memory allocation) single
@@ -79,6 +82,13 @@ extern "C" {
         // queue_ptr - pointer to MuxingQueue that the EbFifo is
         //   associated with.
         struct EbMuxingQueue *queue_ptr;
+
+        // task_pool_ptr - when set, no thread waits on the EbFifo. Each
+        //   object assigned to it is handed to task_fn on a worker of
+        //   the pool instead (see eb_fifo_attach_task_pool).
+        EbThreadPool         *task_pool_ptr;
+        EbFifoTaskFn          task_fn;
+        void                 *task_context;
     } EbFifo;
 
     /*********************************************************************
@@ -94,6 +104,43 @@ extern "C" {
         uint32_t  current_count;
     } EbCircularBuffer;
 
+#if LOCK_FREE_FIFO
+    /*********************************************************************
+     * LockFreeRing
+     *   Bounded multi-producer multi-consumer ring of object pointers.
+     *   Each cell carries a sequence number telling whether it is ready
+     *   to be written (seq == pos) or read (seq == pos + 1), so producers
+     *   and consumers only race on their own position counter.
+     *
+     *   available_count counts the objects in the ring minus the parked
+     *   consumers. Consumers spin on it for a while before parking on
+     *   park_semaphore; producers only post the semaphore when a consumer
+     *   is parked.
+     *********************************************************************/
+    typedef struct EbLockFreeCell
+    {
+        volatile int32_t  sequence;
+        EbPtr             object_ptr;
+    } EbLockFreeCell;
+
+    typedef struct EbLockFreeRing
+    {
+        EbDctor           dctor;
+        EbLockFreeCell   *cell_array;
+        uint32_t          cell_mask;
+        EbHandle          park_semaphore;
+
+        // keep the hot counters on separate cache lines
+        uint8_t           pad0[64];
+        volatile int32_t  enqueue_pos;
+        uint8_t           pad1[64];
+        volatile int32_t  dequeue_pos;
+        uint8_t           pad2[64];
+        volatile int32_t  available_count;
+        uint8_t           pad3[64];
+    } EbLockFreeRing;
+#endif
+
     /*********************************************************************
      * MuxingQueue
      *********************************************************************/
@@ -105,6 +152,13 @@ extern "C" {
         EbCircularBuffer *process_queue;
         uint32_t              process_total_count;
         EbFifo          **process_fifo_ptr_array;
+#if LOCK_FREE_FIFO
+        // lock_free - objects go through ring_ptr and any process fifo
+        //   takes the next one, the queues above are only used once a
+        //   task pool is attached to one of the process fifos.
+        EbBool             lock_free;
+        EbLockFreeRing    *ring_ptr;
+#endif
     } EbMuxingQueue;
 
     /*********************************************************************
@@ -134,6 +188,22 @@ extern "C" {
         EbMuxingQueue     *full_queue;
     } EbSystemResource;
 
+    /*********************************************************************
+     * eb_fifo_attach_task_pool
+     *   Turns a consumer EbFifo into a task source. Every object later
+     *   assigned to the fifo is popped on a worker of pool_ptr and passed
+     *   to task_fn together with task_context; the fifo is re-queued for
+     *   the next object once task_fn returns.  This replaces a thread
+     *   looping on eb_get_full_object, which must not be used on the
+     *   fifo afterwards.  task_fn must not block on other tasks of the
+     *   same pool.
+     *********************************************************************/
+    extern EbErrorType eb_fifo_attach_task_pool(
+        EbFifo        *fifo_ptr,
+        EbThreadPool  *pool_ptr,
+        EbFifoTaskFn   task_fn,
+        void          *task_context);
+
     /*********************************************************************
      * eb_object_release_enable
      *   Enables the release_enable member of EbObjectWrapper.  Used by
@@ -203,57 +203,40 @@ static void pack_highbd_pic(EbPictureBufferDesc *pic_ptr,
 
 }
 
-static void unpack_highbd_pic(uint16_t *buffer_highbd[3],
-                              EbPictureBufferDesc *pic_ptr,
-                              uint32_t ss_x,
-                              uint32_t ss_y,
-                              EbBool include_padding)
+// unpack the luma rows [row_start, row_end) of the padded 16 bit buffers, and the corresponding chroma rows
+static void unpack_highbd_pic_rows(uint16_t *buffer_highbd[3],
+                                   EbPictureBufferDesc *pic_ptr,
+                                   uint32_t ss_x,
+                                   uint32_t ss_y,
+                                   uint32_t row_start,
+                                   uint32_t row_end)
 {
-
-    uint32_t input_y_offset = 0;
-    uint32_t input_bit_inc_y_offset = 0;
-    uint32_t input_cb_offset = 0;
-    uint32_t input_bit_inc_cb_offset = 0;
-    uint32_t input_cr_offset = 0;
-    uint32_t input_bit_inc_cr_offset = 0;
     uint16_t width = pic_ptr->stride_y;
-    uint16_t height = (uint16_t)(pic_ptr->origin_y*2 + pic_ptr->height);
-
-    if(!include_padding){
-        input_y_offset = ((pic_ptr->origin_y) * pic_ptr->stride_y) + (pic_ptr->origin_x);
-        input_bit_inc_y_offset = ((pic_ptr->origin_y)      * pic_ptr->stride_bit_inc_y) + (pic_ptr->origin_x);
-        input_cb_offset = (((pic_ptr->origin_y) >> ss_y) * pic_ptr->stride_cb) + ((pic_ptr->origin_x) >> ss_x);
-        input_bit_inc_cb_offset = (((pic_ptr->origin_y) >> ss_y) * pic_ptr->stride_bit_inc_cb) + ((pic_ptr->origin_x) >> ss_x);
-        input_cr_offset = (((pic_ptr->origin_y) >> ss_y) * pic_ptr->stride_cr) + ((pic_ptr->origin_x) >> ss_x);
-        input_bit_inc_cr_offset = (((pic_ptr->origin_y) >> ss_y) * pic_ptr->stride_bit_inc_cr) + ((pic_ptr->origin_x) >> ss_x);
-
-        width = pic_ptr->width;
-        height = pic_ptr->height;
-    }
+    uint16_t height = (uint16_t)(row_end - row_start);
 
-    un_pack2d(buffer_highbd[C_Y],
+    un_pack2d(buffer_highbd[C_Y] + row_start * pic_ptr->stride_y,
               pic_ptr->stride_y,
-              pic_ptr->buffer_y + input_y_offset,
+              pic_ptr->buffer_y + row_start * pic_ptr->stride_y,
               pic_ptr->stride_y,
-              pic_ptr->buffer_bit_inc_y + input_bit_inc_y_offset,
+              pic_ptr->buffer_bit_inc_y + row_start * pic_ptr->stride_bit_inc_y,
               pic_ptr->stride_bit_inc_y,
               width,
               height);
 
-    un_pack2d(buffer_highbd[C_U],
+    un_pack2d(buffer_highbd[C_U] + (row_start >> ss_y) * pic_ptr->stride_cb,
               pic_ptr->stride_cb,
-              pic_ptr->buffer_cb + input_cb_offset,
+              pic_ptr->buffer_cb + (row_start >> ss_y) * pic_ptr->stride_cb,
               pic_ptr->stride_cb,
-              pic_ptr->buffer_bit_inc_cb + input_bit_inc_cb_offset,
+              pic_ptr->buffer_bit_inc_cb + (row_start >> ss_y) * pic_ptr->stride_bit_inc_cb,
               pic_ptr->stride_bit_inc_cb,
               width >> ss_x,
               height >> ss_y);
 
-    un_pack2d(buffer_highbd[C_V],
+    un_pack2d(buffer_highbd[C_V] + (row_start >> ss_y) * pic_ptr->stride_cr,
               pic_ptr->stride_cr,
-              pic_ptr->buffer_cr + input_cr_offset,
+              pic_ptr->buffer_cr + (row_start >> ss_y) * pic_ptr->stride_cr,
               pic_ptr->stride_cr,
-              pic_ptr->buffer_bit_inc_cr + input_bit_inc_cr_offset,
+              pic_ptr->buffer_bit_inc_cr + (row_start >> ss_y) * pic_ptr->stride_bit_inc_cr,
               pic_ptr->stride_bit_inc_cr,
               width >> ss_x,
               height >> ss_y);
@@ -1142,6 +1125,16 @@ static void apply_filtering_block(int block_row,
 
 }
 
+// Check whether all the sub-block filter weights are null
+static INLINE EbBool is_null_filter_weight(const int *blk_fw,
+                                           int num_blocks) {
+    for (int blk_idx = 0; blk_idx < num_blocks; blk_idx++) {
+        if (blk_fw[blk_idx])
+            return EB_FALSE;
+    }
+    return EB_TRUE;
+}
+
 // Apply filtering to the central picture
 static void apply_filtering_central(EbByte *pred,
                                     uint32_t **accum,
@@ -1483,6 +1476,44 @@ static void tf_inter_prediction(PictureParentControlSet *picture_control_set_ptr
 
 }
 
+// Normalize the filter output of a plane and accumulate the squared error
+// against the source it replaces
+void svt_av1_get_final_filtered_pixels_c(const uint32_t *accum,
+                                         const uint16_t *count,
+                                         uint32_t width,
+                                         uint32_t height,
+                                         uint8_t *dst,
+                                         uint32_t dst_stride,
+                                         uint64_t *sse) {
+    for (uint32_t i = 0, k = 0; i < height; i++) {
+        for (uint32_t j = 0; j < width; j++, k++) {
+            const int32_t filtered = (int32_t)OD_DIVU(accum[k] + (count[k] >> 1), count[k]);
+            const int32_t diff = (int32_t)dst[j] - filtered;
+            *sse += (uint64_t)((int64_t)diff * diff);
+            dst[j] = (uint8_t)filtered;
+        }
+        dst += dst_stride;
+    }
+}
+
+void svt_av1_get_final_filtered_pixels_highbd_c(const uint32_t *accum,
+                                                const uint16_t *count,
+                                                uint32_t width,
+                                                uint32_t height,
+                                                uint16_t *dst,
+                                                uint32_t dst_stride,
+                                                uint64_t *sse) {
+    for (uint32_t i = 0, k = 0; i < height; i++) {
+        for (uint32_t j = 0; j < width; j++, k++) {
+            const int32_t filtered = (int32_t)OD_DIVU(accum[k] + (count[k] >> 1), count[k]);
+            const int32_t diff = (int32_t)dst[j] - filtered;
+            *sse += (uint64_t)((int64_t)diff * diff);
+            dst[j] = (uint16_t)filtered;
+        }
+        dst += dst_stride;
+    }
+}
+
 static void get_final_filtered_pixels(EbByte *src_center_ptr_start,
                                       uint16_t **altref_buffer_highbd_start,
                                       uint32_t **accum,
@@ -1496,54 +1527,20 @@ static void get_final_filtered_pixels(EbByte *src_center_ptr_start,
                                       uint64_t *filtered_sse_uv,
                                       EbBool is_highbd){
 
-            int i, j, k;
-
             if(!is_highbd){
-                // Process luma
-                int pos = blk_y_src_offset;
-                for (i = 0, k = 0; i < BH; i++) {
-                    for (j = 0; j < BW; j++, k++) {
-                        (*filtered_sse) += (uint64_t)((int32_t)src_center_ptr_start[C_Y][pos] - (int32_t)OD_DIVU(accum[C_Y][k] + (count[C_Y][k] >> 1), count[C_Y][k]))* ((int32_t)src_center_ptr_start[C_Y][pos] - (int32_t)OD_DIVU(accum[C_Y][k] + (count[C_Y][k] >> 1), count[C_Y][k]));
-                        src_center_ptr_start[C_Y][pos] = (uint8_t)OD_DIVU(accum[C_Y][k] + (count[C_Y][k] >> 1), count[C_Y][k]);
-                        pos++;
-                    }
-                    pos += stride[C_Y] - BW;
-                }
-                // Process chroma
-                pos = blk_ch_src_offset;
-                for (i = 0, k = 0; i < blk_height_ch; i++) {
-                    for (j = 0; j < blk_width_ch; j++, k++) {
-                        (*filtered_sse_uv) += (uint64_t)((int32_t)src_center_ptr_start[C_U][pos] - (int32_t)OD_DIVU(accum[C_U][k] + (count[C_U][k] >> 1), count[C_U][k]))* ((int32_t)src_center_ptr_start[C_U][pos] - (int32_t)OD_DIVU(accum[C_U][k] + (count[C_U][k] >> 1), count[C_U][k]));
-                        (*filtered_sse_uv) += (uint64_t)((int32_t)src_center_ptr_start[C_V][pos] - (int32_t)OD_DIVU(accum[C_V][k] + (count[C_V][k] >> 1), count[C_V][k]))* ((int32_t)src_center_ptr_start[C_V][pos] - (int32_t)OD_DIVU(accum[C_V][k] + (count[C_V][k] >> 1), count[C_V][k]));
-                        src_center_ptr_start[C_U][pos] = (uint8_t)OD_DIVU(accum[C_U][k] + (count[C_U][k] >> 1), count[C_U][k]);
-                        src_center_ptr_start[C_V][pos] = (uint8_t)OD_DIVU(accum[C_V][k] + (count[C_V][k] >> 1), count[C_V][k]);
-                        pos++;
-                    }
-                    pos += stride[C_U] - blk_width_ch;
-                }
+                svt_av1_get_final_filtered_pixels(accum[C_Y], count[C_Y], BW, BH,
+                    src_center_ptr_start[C_Y] + blk_y_src_offset, stride[C_Y], filtered_sse);
+                svt_av1_get_final_filtered_pixels(accum[C_U], count[C_U], blk_width_ch, blk_height_ch,
+                    src_center_ptr_start[C_U] + blk_ch_src_offset, stride[C_U], filtered_sse_uv);
+                svt_av1_get_final_filtered_pixels(accum[C_V], count[C_V], blk_width_ch, blk_height_ch,
+                    src_center_ptr_start[C_V] + blk_ch_src_offset, stride[C_V], filtered_sse_uv);
             }else{
-                // Process luma
-                int pos = blk_y_src_offset;
-                for (i = 0, k = 0; i < BH; i++) {
-                    for (j = 0; j < BW; j++, k++) {
-                        (*filtered_sse) += (uint64_t)((int32_t)altref_buffer_highbd_start[C_Y][pos] - (int32_t)OD_DIVU(accum[C_Y][k] + (count[C_Y][k] >> 1), count[C_Y][k]))* ((int32_t)altref_buffer_highbd_start[C_Y][pos] - (int32_t)OD_DIVU(accum[C_Y][k] + (count[C_Y][k] >> 1), count[C_Y][k]));
-                        altref_buffer_highbd_start[C_Y][pos] = (uint16_t)OD_DIVU(accum[C_Y][k] + (count[C_Y][k] >> 1), count[C_Y][k]);
-                        pos++;
-                    }
-                    pos += stride[C_Y] - BW;
-                }
-                // Process chroma
-                pos = blk_ch_src_offset;
-                for (i = 0, k = 0; i < blk_height_ch; i++) {
-                    for (j = 0; j < blk_width_ch; j++, k++) {
-                        (*filtered_sse_uv) += (uint64_t)((int32_t)altref_buffer_highbd_start[C_U][pos] - (int32_t)OD_DIVU(accum[C_U][k] + (count[C_U][k] >> 1), count[C_U][k]))* ((int32_t)altref_buffer_highbd_start[C_U][pos] - (int32_t)OD_DIVU(accum[C_U][k] + (count[C_U][k] >> 1), count[C_U][k]));
-                        (*filtered_sse_uv) += (uint64_t)((int32_t)altref_buffer_highbd_start[C_V][pos] - (int32_t)OD_DIVU(accum[C_V][k] + (count[C_V][k] >> 1), count[C_V][k]))* ((int32_t)altref_buffer_highbd_start[C_V][pos] - (int32_t)OD_DIVU(accum[C_V][k] + (count[C_V][k] >> 1), count[C_V][k]));
-                        altref_buffer_highbd_start[C_U][pos] = (uint16_t)OD_DIVU(accum[C_U][k] + (count[C_U][k] >> 1), count[C_U][k]);
-                        altref_buffer_highbd_start[C_V][pos] = (uint16_t)OD_DIVU(accum[C_V][k] + (count[C_V][k] >> 1), count[C_V][k]);
-                        pos++;
-                    }
-                    pos += stride[C_U] - blk_width_ch;
-                }
+                svt_av1_get_final_filtered_pixels_highbd(accum[C_Y], count[C_Y], BW, BH,
+                    altref_buffer_highbd_start[C_Y] + blk_y_src_offset, stride[C_Y], filtered_sse);
+                svt_av1_get_final_filtered_pixels_highbd(accum[C_U], count[C_U], blk_width_ch, blk_height_ch,
+                    altref_buffer_highbd_start[C_U] + blk_ch_src_offset, stride[C_U], filtered_sse_uv);
+                svt_av1_get_final_filtered_pixels_highbd(accum[C_V], count[C_V], blk_width_ch, blk_height_ch,
+                    altref_buffer_highbd_start[C_V] + blk_ch_src_offset, stride[C_V], filtered_sse_uv);
             }
 }
 
@@ -1553,12 +1550,11 @@ static EbErrorType produce_temporally_filtered_pic(PictureParentControlSet **lis
                                                    EbPictureBufferDesc **list_input_picture_ptr,
                                                    uint8_t altref_strength,
                                                    uint8_t index_center,
-                                                   uint64_t *filtered_sse,
-                                                   uint64_t *filtered_sse_uv,
+                                                   TfSegmentStats *segment_stats,
                                                    MotionEstimationContext_t *me_context_ptr,
                                                    int32_t segment_index,
                                                    EbBool is_highbd) {
-    int frame_index;
+    int frame_index, frame_itr;
     DECLARE_ALIGNED(16, uint32_t, accumulator[BLK_PELS * COLOR_CHANNELS]);
     DECLARE_ALIGNED(16, uint16_t, counter[BLK_PELS * COLOR_CHANNELS]);
     uint32_t *accum[COLOR_CHANNELS] = { accumulator, accumulator + BLK_PELS, accumulator + (BLK_PELS<<1) };
@@ -1636,8 +1632,36 @@ static EbErrorType produce_temporally_filtered_pic(PictureParentControlSet **lis
                                 (input_picture_ptr_central->origin_y>>ss_y)*input_picture_ptr_central->stride_bit_inc_cr +
                                 (input_picture_ptr_central->origin_x>>ss_x);
 
+    uint64_t *filtered_sse = &segment_stats->filtered_sse;
+    uint64_t *filtered_sse_uv = &segment_stats->filtered_sse_uv;
+    uint32_t *skipped_blocks = &segment_stats->skipped_blocks;
+    uint32_t *total_blocks = &segment_stats->total_blocks;
+    uint32_t *skipped_filter_blocks = &segment_stats->skipped_filter_blocks;
+    uint32_t *total_filter_blocks = &segment_stats->total_filter_blocks;
+
     *filtered_sse       = 0;
     *filtered_sse_uv    = 0;
+    *skipped_blocks     = 0;
+    *total_blocks       = 0;
+    *skipped_filter_blocks = 0;
+    *total_filter_blocks   = 0;
+
+    // The adaptive skip filters the neighbours from the nearest to the farthest on each side
+    // of the central frame, to stop at the first one that cannot be motion compensated
+    int frame_count = picture_control_set_ptr_central->past_altref_nframes + picture_control_set_ptr_central->future_altref_nframes + 1;
+    int frame_order[ALTREF_MAX_NFRAMES];
+    if (picture_control_set_ptr_central->tf_adaptive_skip) {
+        frame_itr = 0;
+        frame_order[frame_itr++] = index_center;
+        for (frame_index = index_center - 1; frame_index >= 0; frame_index--)
+            frame_order[frame_itr++] = frame_index;
+        for (frame_index = index_center + 1; frame_index < frame_count; frame_index++)
+            frame_order[frame_itr++] = frame_index;
+    }
+    else {
+        for (frame_index = 0; frame_index < frame_count; frame_index++)
+            frame_order[frame_index] = frame_index;
+    }
 
     for (blk_row = y_b64_start_idx; blk_row < y_b64_end_idx; blk_row++) {
         for (blk_col = x_b64_start_idx; blk_col < x_b64_end_idx; blk_col++) {
@@ -1656,8 +1680,21 @@ static EbErrorType produce_temporally_filtered_pic(PictureParentControlSet **lis
 
             populate_list_with_value(blk_fw, 16, INIT_WEIGHT);
 
+            // past and future sides left unfiltered by the adaptive skip
+            EbBool side_skipped[2] = { picture_control_set_ptr_central->tf_window_skipped, picture_control_set_ptr_central->tf_window_skipped };
+
             // for every frame to filter
-            for (frame_index = 0; frame_index < (picture_control_set_ptr_central->past_altref_nframes + picture_control_set_ptr_central->future_altref_nframes + 1); frame_index++) {
+            for (frame_itr = 0; frame_itr < frame_count; frame_itr++) {
+                frame_index = frame_order[frame_itr];
+
+                if (frame_index != index_center) {
+                    (*total_blocks)++;
+                    if (side_skipped[frame_index > index_center]) {
+                        picture_control_set_ptr_central->tf_hme_center[frame_index][blk_row * blk_cols + blk_col].valid = 0;
+                        (*skipped_blocks)++;
+                        continue;
+                    }
+                }
 
                 if(!is_highbd){
                     src_center_ptr[C_Y] = src_center_ptr_start[C_Y] + blk_y_src_offset;
@@ -1710,6 +1747,12 @@ static EbErrorType produce_temporally_filtered_pic(PictureParentControlSet **lis
                                         context_ptr,
                                         input_picture_ptr_central); // source picture
 
+                    // Keep the HME search center for the ME of the picture
+                    TfHmeCenter *tf_hme_center = &picture_control_set_ptr_central->tf_hme_center[frame_index][blk_row * blk_cols + blk_col];
+                    tf_hme_center->x = context_ptr->tf_hme_center_x;
+                    tf_hme_center->y = context_ptr->tf_hme_center_y;
+                    tf_hme_center->valid = (uint8_t)context_ptr->tf_hme_center_valid;
+
                     EbBool use_16x16_subblocks_only = EB_TRUE; // TODO: hardcoded to use 16x16 subblocks only, however,
                                                                // the support for the use of 32x32 subblocks as well is almost complete
                                                                // experiments have shown low gains by adding this possibility
@@ -1754,6 +1797,10 @@ static EbErrorType produce_temporally_filtered_pic(PictureParentControlSet **lis
                                           use_16x16_subblocks_only,
                                           blk_fw,
                                           is_highbd);
+
+                    // The farther neighbours of a side are not expected to compensate better
+                    if (picture_control_set_ptr_central->tf_adaptive_skip && is_null_filter_weight(blk_fw, N_16X16_BLOCKS))
+                        side_skipped[frame_index > index_center] = EB_TRUE;
                 }
 
                 // ------------
@@ -1783,6 +1830,16 @@ static EbErrorType produce_temporally_filtered_pic(PictureParentControlSet **lis
                     // TODO: implement a 64x64 SIMD version
                     for(int block_row = 0; block_row<2; block_row++){
                         for(int block_col = 0; block_col<2; block_col++) {
+                            int blk_fw_32x32[4];
+                            for (int ifw = 0; ifw < 4; ifw++)
+                                blk_fw_32x32[ifw] = blk_fw[index_16x16_from_subindexes[block_row * 2 + block_col][ifw]];
+
+                            // null weights leave the accumulators untouched
+                            (*total_filter_blocks)++;
+                            if (is_null_filter_weight(blk_fw_32x32, 4)) {
+                                (*skipped_filter_blocks)++;
+                                continue;
+                            }
                             apply_filtering_block(block_row,
                                                   block_col,
                                                   src_center_ptr,
@@ -1990,6 +2047,9 @@ static void pad_and_decimate_filtered_pic(PictureParentControlSet *picture_contr
         padded_pic_ptr->origin_x,
         padded_pic_ptr->origin_y);
 
+    // Block sums for the successive elimination of the ME
+    GenerateMeBlockSums(src_object);
+
     // 1/4 & 1/16 input picture decimation
     DownsampleDecimationInputPicture(
         picture_control_set_ptr_central,
@@ -2091,23 +2151,42 @@ static EbErrorType save_src_pic_buffers(PictureParentControlSet *picture_control
 
 }
 
-EbErrorType svt_av1_init_temporal_filtering(PictureParentControlSet **list_picture_control_set_ptr,
-                                            PictureParentControlSet *picture_control_set_ptr_central,
-                                            MotionEstimationContext_t *me_context_ptr,
-                                            int32_t segment_index) {
-    uint8_t *altref_strength_ptr, index_center;
-    EbPictureBufferDesc *central_picture_ptr;
+void svt_av1_apply_shared_temporal_filtering(PictureParentControlSet *picture_control_set_ptr_central,
+                                             const SharedAnalysisRecord *record_ptr) {
+    EbPictureBufferDesc *central_picture_ptr = picture_control_set_ptr_central->enhanced_picture_ptr;
+    EbBool is_highbd = (EbBool)(picture_control_set_ptr_central->sequence_control_set_ptr->static_config.encoder_bit_depth > EB_8BIT);
+    uint32_t ss_y = picture_control_set_ptr_central->sequence_control_set_ptr->subsampling_y;
 
-    altref_strength_ptr = &(picture_control_set_ptr_central->altref_strength);
+    assert(record_ptr->filtered_luma_size == central_picture_ptr->luma_size);
+    assert(record_ptr->filtered_chroma_size == central_picture_ptr->chroma_size);
 
-    // index of the central source frame
-    index_center = picture_control_set_ptr_central->past_altref_nframes;
+    picture_control_set_ptr_central->temporal_filtering_on = EB_TRUE;
+    picture_control_set_ptr_central->altref_strength = record_ptr->altref_strength;
+    picture_control_set_ptr_central->filtered_sse = record_ptr->filtered_sse;
+    picture_control_set_ptr_central->filtered_sse_uv = record_ptr->filtered_sse_uv;
 
-    // if this assertion does not fail (as I think it should not, then remove picture_control_set_ptr_central from the input parameters of init_temporal_filtering())
-    assert(list_picture_control_set_ptr[index_center] == picture_control_set_ptr_central);
+    if (picture_control_set_ptr_central->sequence_control_set_ptr->static_config.stat_report)
+        save_src_pic_buffers(picture_control_set_ptr_central, ss_y, is_highbd);
+
+    EB_MEMCPY(central_picture_ptr->buffer_y, record_ptr->filtered_buffer[C_Y], central_picture_ptr->luma_size);
+    EB_MEMCPY(central_picture_ptr->buffer_cb, record_ptr->filtered_buffer[C_U], central_picture_ptr->chroma_size);
+    EB_MEMCPY(central_picture_ptr->buffer_cr, record_ptr->filtered_buffer[C_V], central_picture_ptr->chroma_size);
+    if (is_highbd) {
+        EB_MEMCPY(central_picture_ptr->buffer_bit_inc_y, record_ptr->filtered_bit_inc_buffer[C_Y], central_picture_ptr->luma_size);
+        EB_MEMCPY(central_picture_ptr->buffer_bit_inc_cb, record_ptr->filtered_bit_inc_buffer[C_U], central_picture_ptr->chroma_size);
+        EB_MEMCPY(central_picture_ptr->buffer_bit_inc_cr, record_ptr->filtered_bit_inc_buffer[C_V], central_picture_ptr->chroma_size);
+    }
 
-    // source central frame picture buffer
-    central_picture_ptr = picture_control_set_ptr_central->enhanced_picture_ptr;
+    pad_and_decimate_filtered_pic(picture_control_set_ptr_central);
+}
+
+EbErrorType svt_av1_prepare_temporal_filtering(PictureParentControlSet **list_picture_control_set_ptr,
+                                               PictureParentControlSet *picture_control_set_ptr_central) {
+    uint8_t *altref_strength_ptr = &(picture_control_set_ptr_central->altref_strength);
+    EbPictureBufferDesc *central_picture_ptr = picture_control_set_ptr_central->enhanced_picture_ptr;
+
+    // if this assertion does not fail (as I think it should not, then remove picture_control_set_ptr_central from the input parameters of init_temporal_filtering())
+    assert(list_picture_control_set_ptr[picture_control_set_ptr_central->past_altref_nframes] == picture_control_set_ptr_central);
 
     uint32_t encoder_bit_depth = picture_control_set_ptr_central->sequence_control_set_ptr->static_config.encoder_bit_depth;
     EbBool is_highbd = (encoder_bit_depth == 8) ? (uint8_t)EB_FALSE : (uint8_t)EB_TRUE;
@@ -2116,161 +2195,276 @@ EbErrorType svt_av1_init_temporal_filtering(PictureParentControlSet **list_pictu
     uint32_t ss_x = picture_control_set_ptr_central->sequence_control_set_ptr->subsampling_x;
     uint32_t ss_y = picture_control_set_ptr_central->sequence_control_set_ptr->subsampling_y;
 
-    //only one performs any picture based prep
-    eb_block_on_mutex(picture_control_set_ptr_central->temp_filt_mutex);
-    if (picture_control_set_ptr_central->temp_filt_prep_done == 0){
-
-        picture_control_set_ptr_central->temp_filt_prep_done = 1;
+    // allocate 16 bit buffer
+    if (is_highbd) {
+        EB_MALLOC_ARRAY(picture_control_set_ptr_central->altref_buffer_highbd[C_Y], central_picture_ptr->luma_size);
+        EB_MALLOC_ARRAY(picture_control_set_ptr_central->altref_buffer_highbd[C_U], central_picture_ptr->chroma_size);
+        EB_MALLOC_ARRAY(picture_control_set_ptr_central->altref_buffer_highbd[C_V], central_picture_ptr->chroma_size);
 
-        // allocate 16 bit buffer
-        if (is_highbd) {
-            EB_MALLOC_ARRAY(picture_control_set_ptr_central->altref_buffer_highbd[C_Y], central_picture_ptr->luma_size);
-            EB_MALLOC_ARRAY(picture_control_set_ptr_central->altref_buffer_highbd[C_U], central_picture_ptr->chroma_size);
-            EB_MALLOC_ARRAY(picture_control_set_ptr_central->altref_buffer_highbd[C_V], central_picture_ptr->chroma_size);
-
-            // pack byte buffers to 16 bit buffer
-            pack_highbd_pic(central_picture_ptr, picture_control_set_ptr_central->altref_buffer_highbd, ss_x, ss_y, EB_TRUE);
-        }
+        // pack byte buffers to 16 bit buffer
+        pack_highbd_pic(central_picture_ptr, picture_control_set_ptr_central->altref_buffer_highbd, ss_x, ss_y, EB_TRUE);
+    }
 
-        // Estimate source noise level
-        double noise_level;
-        if(is_highbd){
-            noise_level = estimate_noise_highbd(picture_control_set_ptr_central->altref_buffer_highbd[C_Y], // Y only
-                                                central_picture_ptr->width,
-                                                central_picture_ptr->height,
-                                                central_picture_ptr->stride_y,
-                                                encoder_bit_depth);
-        }
-        else{
-            EbByte buffer_y = central_picture_ptr->buffer_y + central_picture_ptr->origin_y*central_picture_ptr->stride_y + central_picture_ptr->origin_x;
-            noise_level = estimate_noise(buffer_y, // Y only
-                                         central_picture_ptr->width,
-                                         central_picture_ptr->height,
-                                         central_picture_ptr->stride_y);
-        }
+    // Estimate source noise level
+    double noise_level;
+    if(is_highbd){
+        noise_level = estimate_noise_highbd(picture_control_set_ptr_central->altref_buffer_highbd[C_Y], // Y only
+                                            central_picture_ptr->width,
+                                            central_picture_ptr->height,
+                                            central_picture_ptr->stride_y,
+                                            encoder_bit_depth);
+    }
+    else{
+        EbByte buffer_y = central_picture_ptr->buffer_y + central_picture_ptr->origin_y*central_picture_ptr->stride_y + central_picture_ptr->origin_x;
+        noise_level = estimate_noise(buffer_y, // Y only
+                                     central_picture_ptr->width,
+                                     central_picture_ptr->height,
+                                     central_picture_ptr->stride_y);
+    }
 
-        // adjust filter parameter based on the estimated noise of the picture
+    // adjust filter parameter based on the estimated noise of the picture
 #if TWO_PASS
-        adjust_filter_strength( picture_control_set_ptr_central,
-                                noise_level,
-                                altref_strength_ptr,
-                                is_highbd,
-                                encoder_bit_depth);
+    adjust_filter_strength( picture_control_set_ptr_central,
+                            noise_level,
+                            altref_strength_ptr,
+                            is_highbd,
+                            encoder_bit_depth);
 #else
-        adjust_filter_strength(noise_level, altref_strength_ptr, is_highbd, encoder_bit_depth);
+    adjust_filter_strength(noise_level, altref_strength_ptr, is_highbd, encoder_bit_depth);
 #endif
 
-        // Pad chroma reference samples - once only per picture
-        for (int i = 0; i < (picture_control_set_ptr_central->past_altref_nframes + picture_control_set_ptr_central->future_altref_nframes + 1); i++) {
-            EbPictureBufferDesc *pic_ptr_ref = list_picture_control_set_ptr[i]->enhanced_picture_ptr;
+    // Adaptive skip: the window of a clean source is left unfiltered
+    int32_t tf_adaptive_skip = picture_control_set_ptr_central->sequence_control_set_ptr->static_config.tf_adaptive_skip;
+    picture_control_set_ptr_central->tf_adaptive_skip = (tf_adaptive_skip == -1) ?
+        (EbBool)(picture_control_set_ptr_central->sc_content_detected != 0) :
+        (EbBool)tf_adaptive_skip;
+    picture_control_set_ptr_central->tf_window_skipped = (EbBool)(picture_control_set_ptr_central->tf_adaptive_skip &&
+        noise_level >= 0 && noise_level < TF_SKIP_NOISE_TH);
+
+    // Pad chroma reference samples - once only per picture
+    for (int i = 0; i < (picture_control_set_ptr_central->past_altref_nframes + picture_control_set_ptr_central->future_altref_nframes + 1); i++) {
+        EbPictureBufferDesc *pic_ptr_ref = list_picture_control_set_ptr[i]->enhanced_picture_ptr;
 #if FIX_ALTREF
-            if (i != picture_control_set_ptr_central->past_altref_nframes)
+        if (i != picture_control_set_ptr_central->past_altref_nframes)
 #endif
-                generate_padding_pic(pic_ptr_ref,
-                    ss_x,
-                    ss_y,
-                    is_highbd);
-        }
+            generate_padding_pic(pic_ptr_ref,
+                ss_x,
+                ss_y,
+                is_highbd);
+    }
 
-        picture_control_set_ptr_central->temporal_filtering_on = EB_TRUE; // set temporal filtering flag ON for current picture
+    picture_control_set_ptr_central->temporal_filtering_on = EB_TRUE; // set temporal filtering flag ON for current picture
 
-        // save original source picture (to be replaced by the temporally filtered pic)
-        // if stat_report is enabled for PSNR computation
-        if(picture_control_set_ptr_central->sequence_control_set_ptr->static_config.stat_report){
-            save_src_pic_buffers(picture_control_set_ptr_central,
-                                 ss_y,
-                                 is_highbd);
-        }
+    // save original source picture (to be replaced by the temporally filtered pic)
+    // if stat_report is enabled for PSNR computation
+    if(picture_control_set_ptr_central->sequence_control_set_ptr->static_config.stat_report){
+        save_src_pic_buffers(picture_control_set_ptr_central,
+                             ss_y,
+                             is_highbd);
+    }
+
+    // Reset the completion counters of the segments
+    for (int row_idx = 0; row_idx < picture_control_set_ptr_central->tf_segments_row_count; row_idx++)
+        picture_control_set_ptr_central->tf_segment_row_done_count[row_idx] = 0;
+    picture_control_set_ptr_central->tf_segment_rows_done = 0;
 
+    return EB_ErrorNone;
+}
+
+// Unpack, then decimate the filtered rows of a segment row
+static void finalize_filtered_segment_row(PictureParentControlSet *picture_control_set_ptr_central,
+                                          uint32_t y_seg_idx,
+                                          uint32_t ss_x,
+                                          uint32_t ss_y,
+                                          EbBool is_highbd) {
+    EbPictureBufferDesc *central_picture_ptr = picture_control_set_ptr_central->enhanced_picture_ptr;
+    EbPaReferenceObject *src_object = (EbPaReferenceObject*)picture_control_set_ptr_central->pa_reference_picture_wrapper_ptr->object_ptr;
+    EbPictureBufferDesc *padded_pic_ptr = src_object->input_padded_picture_ptr;
+    EbBool last_row = (EbBool)(y_seg_idx == (uint32_t)picture_control_set_ptr_central->tf_segments_row_count - 1);
+
+    uint32_t blk_rows = (uint32_t)(central_picture_ptr->height + BH - 1) / BH;
+    uint32_t y_start = SEGMENT_START_IDX(y_seg_idx, blk_rows, picture_control_set_ptr_central->tf_segments_row_count) * BH;
+    uint32_t y_end = SEGMENT_END_IDX(y_seg_idx, blk_rows, picture_control_set_ptr_central->tf_segments_row_count) * BH;
+
+    if (is_highbd) {
+        // the first and last segment rows also take the top and bottom padding
+        unpack_highbd_pic_rows(picture_control_set_ptr_central->altref_buffer_highbd,
+                               central_picture_ptr,
+                               ss_x,
+                               ss_y,
+                               y_seg_idx == 0 ? 0 : (uint32_t)central_picture_ptr->origin_y + y_start,
+                               last_row ? (uint32_t)(central_picture_ptr->origin_y * 2 + central_picture_ptr->height) : (uint32_t)central_picture_ptr->origin_y + y_end);
     }
-    eb_release_mutex(picture_control_set_ptr_central->temp_filt_mutex);
+
+    // decimation: even if highbd src, this is only performed on the 8 bit buffer (excluding the LSBs)
+    DownsampleDecimationInputPictureRows(
+        picture_control_set_ptr_central,
+        padded_pic_ptr,
+        src_object->quarter_decimated_picture_ptr,
+        src_object->sixteenth_decimated_picture_ptr,
+        y_start,
+        last_row ? padded_pic_ptr->height : MIN(y_end, (uint32_t)padded_pic_ptr->height));
+}
+
+// Pad the filtered picture, gather the statistics of the segments and signal the end of the filtering
+static void finalize_filtered_pic(PictureParentControlSet *picture_control_set_ptr_central,
+                                  uint32_t ss_x,
+                                  uint32_t ss_y,
+                                  EbBool is_highbd) {
+    EbPictureBufferDesc *central_picture_ptr = picture_control_set_ptr_central->enhanced_picture_ptr;
+    EbPaReferenceObject *src_object = (EbPaReferenceObject*)picture_control_set_ptr_central->pa_reference_picture_wrapper_ptr->object_ptr;
+    EbPictureBufferDesc *padded_pic_ptr = src_object->input_padded_picture_ptr;
+    SequenceControlSet *sequence_control_set_ptr = (SequenceControlSet*)picture_control_set_ptr_central->sequence_control_set_wrapper_ptr->object_ptr;
+
+#if DEBUG_TF
+    if(!is_highbd)
+        save_YUV_to_file("filtered_picture.yuv",
+                         central_picture_ptr->buffer_y,
+                         central_picture_ptr->buffer_cb,
+                         central_picture_ptr->buffer_cr,
+                         central_picture_ptr->width,
+                         central_picture_ptr->height,
+                         central_picture_ptr->stride_y,
+                         central_picture_ptr->stride_cb,
+                         central_picture_ptr->stride_cr,
+                         central_picture_ptr->origin_y,
+                         central_picture_ptr->origin_x,
+                         ss_x,
+                         ss_y);
+    else
+        save_YUV_to_file_highbd("filtered_picture.yuv",
+                                picture_control_set_ptr_central->altref_buffer_highbd[C_Y],
+                                picture_control_set_ptr_central->altref_buffer_highbd[C_U],
+                                picture_control_set_ptr_central->altref_buffer_highbd[C_V],
+                                central_picture_ptr->width,
+                                central_picture_ptr->height,
+                                central_picture_ptr->stride_y,
+                                central_picture_ptr->stride_cb,
+                                central_picture_ptr->stride_cb,
+                                central_picture_ptr->origin_y,
+                                central_picture_ptr->origin_x,
+                                ss_x,
+                                ss_y);
+#endif
+
+    if(is_highbd) {
+        EB_FREE_ARRAY(picture_control_set_ptr_central->altref_buffer_highbd[C_Y]);
+        EB_FREE_ARRAY(picture_control_set_ptr_central->altref_buffer_highbd[C_U]);
+        EB_FREE_ARRAY(picture_control_set_ptr_central->altref_buffer_highbd[C_V]);
+    }
+
+    // padding: even if highbd src, this is only performed on the 8 bit buffer (excluding the LSBs)
+    generate_padding(
+        &(padded_pic_ptr->buffer_y[C_Y]),
+        padded_pic_ptr->stride_y,
+        padded_pic_ptr->width,
+        padded_pic_ptr->height,
+        padded_pic_ptr->origin_x,
+        padded_pic_ptr->origin_y);
+
+    // Block sums for the successive elimination of the ME
+    GenerateMeBlockSums(src_object);
+
+    PadDecimatedInputPicture(
+        picture_control_set_ptr_central,
+        src_object->quarter_decimated_picture_ptr,
+        src_object->sixteenth_decimated_picture_ptr);
+
+    // 1/4 & 1/16 input picture downsampling through filtering
+    if (sequence_control_set_ptr->down_sampling_method_me_search == ME_FILTERED_DOWNSAMPLED)
+        DownsampleFilteringInputPicture(
+            picture_control_set_ptr_central,
+            padded_pic_ptr,
+            src_object->quarter_filtered_picture_ptr,
+            src_object->sixteenth_filtered_picture_ptr);
+
+    // Gather the statistics of the segments, in the segment order
+    picture_control_set_ptr_central->filtered_sse = 0;
+    picture_control_set_ptr_central->filtered_sse_uv = 0;
+    picture_control_set_ptr_central->tf_skipped_blocks = 0;
+    picture_control_set_ptr_central->tf_total_blocks = 0;
+    picture_control_set_ptr_central->tf_skipped_filter_blocks = 0;
+    picture_control_set_ptr_central->tf_total_filter_blocks = 0;
+    for (int seg_idx = 0; seg_idx < picture_control_set_ptr_central->tf_segments_total_count; seg_idx++) {
+        const TfSegmentStats *segment_stats = &picture_control_set_ptr_central->tf_segment_stats[seg_idx];
+        if(!is_highbd){
+            picture_control_set_ptr_central->filtered_sse += segment_stats->filtered_sse;
+            picture_control_set_ptr_central->filtered_sse_uv += segment_stats->filtered_sse_uv;
+        }else{
+            picture_control_set_ptr_central->filtered_sse += segment_stats->filtered_sse >> 4;
+            picture_control_set_ptr_central->filtered_sse_uv += segment_stats->filtered_sse_uv >> 4;
+        }
+        picture_control_set_ptr_central->tf_skipped_blocks += segment_stats->skipped_blocks;
+        picture_control_set_ptr_central->tf_total_blocks += segment_stats->total_blocks;
+        picture_control_set_ptr_central->tf_skipped_filter_blocks += segment_stats->skipped_filter_blocks;
+        picture_control_set_ptr_central->tf_total_filter_blocks += segment_stats->total_filter_blocks;
+    }
+
+    // Normalize the filtered SSE. Add 8 bit precision.
+    picture_control_set_ptr_central->filtered_sse = (picture_control_set_ptr_central->filtered_sse << 8) / central_picture_ptr->width / central_picture_ptr->height;
+    picture_control_set_ptr_central->filtered_sse_uv = ((picture_control_set_ptr_central->filtered_sse_uv << 8) / (central_picture_ptr->width >> ss_x) / (central_picture_ptr->height >> ss_y)) / 2;
+
+    // Report the share of the filtering skipped
+    if (picture_control_set_ptr_central->sequence_control_set_ptr->static_config.stat_report)
+        SVT_LOG("TF picture %llu: noise %s, skipped %u of %u neighbour blocks, %u of %u filtering blocks\n",
+                (unsigned long long)picture_control_set_ptr_central->picture_number,
+                picture_control_set_ptr_central->tf_window_skipped ? "low" : "normal",
+                picture_control_set_ptr_central->tf_skipped_blocks,
+                picture_control_set_ptr_central->tf_total_blocks,
+                picture_control_set_ptr_central->tf_skipped_filter_blocks,
+                picture_control_set_ptr_central->tf_total_filter_blocks);
+
+    // signal that temp filt is done
+    eb_post_semaphore(picture_control_set_ptr_central->temp_filt_done_semaphore);
+}
+
+EbErrorType svt_av1_init_temporal_filtering(PictureParentControlSet **list_picture_control_set_ptr,
+                                            PictureParentControlSet *picture_control_set_ptr_central,
+                                            MotionEstimationContext_t *me_context_ptr,
+                                            int32_t segment_index) {
+    // index of the central source frame
+    uint8_t index_center = picture_control_set_ptr_central->past_altref_nframes;
+
+    EbBool is_highbd = (picture_control_set_ptr_central->sequence_control_set_ptr->static_config.encoder_bit_depth == 8) ? (uint8_t)EB_FALSE : (uint8_t)EB_TRUE;
+
+    // chroma subsampling
+    uint32_t ss_x = picture_control_set_ptr_central->sequence_control_set_ptr->subsampling_x;
+    uint32_t ss_y = picture_control_set_ptr_central->sequence_control_set_ptr->subsampling_y;
 
     // populate source frames picture buffer list
     EbPictureBufferDesc *list_input_picture_ptr[ALTREF_MAX_NFRAMES] = { NULL };
     for (int i = 0; i < (picture_control_set_ptr_central->past_altref_nframes + picture_control_set_ptr_central->future_altref_nframes + 1); i++)
         list_input_picture_ptr[i] = list_picture_control_set_ptr[i]->enhanced_picture_ptr;
 
-    uint64_t filtered_sse, filtered_sse_uv;
-
+    // each segment keeps its own statistics, gathered once the picture is filtered
     produce_temporally_filtered_pic(list_picture_control_set_ptr,
                                     list_input_picture_ptr,
-                                    *altref_strength_ptr,
+                                    picture_control_set_ptr_central->altref_strength,
                                     index_center,
-                                    &filtered_sse,
-                                    &filtered_sse_uv,
+                                    &picture_control_set_ptr_central->tf_segment_stats[segment_index],
                                     me_context_ptr,
                                     segment_index,
                                     is_highbd);
 
-    eb_block_on_mutex(picture_control_set_ptr_central->temp_filt_mutex);
-    picture_control_set_ptr_central->temp_filt_seg_acc++;
-
-    if(!is_highbd){
-        picture_control_set_ptr_central->filtered_sse += filtered_sse;
-        picture_control_set_ptr_central->filtered_sse_uv += filtered_sse_uv;
-    }else{
-        picture_control_set_ptr_central->filtered_sse += filtered_sse >> 4;
-        picture_control_set_ptr_central->filtered_sse_uv += filtered_sse_uv >> 4;
-    }
-
-    if (picture_control_set_ptr_central->temp_filt_seg_acc == picture_control_set_ptr_central->tf_segments_total_count){
-
-#if DEBUG_TF
-        if(!is_highbd)
-            save_YUV_to_file("filtered_picture.yuv",
-                             central_picture_ptr->buffer_y,
-                             central_picture_ptr->buffer_cb,
-                             central_picture_ptr->buffer_cr,
-                             central_picture_ptr->width,
-                             central_picture_ptr->height,
-                             central_picture_ptr->stride_y,
-                             central_picture_ptr->stride_cb,
-                             central_picture_ptr->stride_cr,
-                             central_picture_ptr->origin_y,
-                             central_picture_ptr->origin_x,
-                             ss_x,
-                             ss_y);
-        else
-            save_YUV_to_file_highbd("filtered_picture.yuv",
-                                    picture_control_set_ptr_central->altref_buffer_highbd[C_Y],
-                                    picture_control_set_ptr_central->altref_buffer_highbd[C_U],
-                                    picture_control_set_ptr_central->altref_buffer_highbd[C_V],
-                                    central_picture_ptr->width,
-                                    central_picture_ptr->height,
-                                    central_picture_ptr->stride_y,
-                                    central_picture_ptr->stride_cb,
-                                    central_picture_ptr->stride_cb,
-                                    central_picture_ptr->origin_y,
-                                    central_picture_ptr->origin_x,
-                                    ss_x,
-                                    ss_y);
-#endif
-
-        if(is_highbd) {
-            unpack_highbd_pic(picture_control_set_ptr_central->altref_buffer_highbd,
-                              central_picture_ptr,
-                              ss_x,
-                              ss_y,
-                              EB_TRUE);
-
-            EB_FREE_ARRAY(picture_control_set_ptr_central->altref_buffer_highbd[C_Y]);
-            EB_FREE_ARRAY(picture_control_set_ptr_central->altref_buffer_highbd[C_U]);
-            EB_FREE_ARRAY(picture_control_set_ptr_central->altref_buffer_highbd[C_V]);
-        }
-
-        // padding + decimation: even if highbd src, this is only performed on the 8 bit buffer (excluding the LSBs)
-        pad_and_decimate_filtered_pic(picture_control_set_ptr_central);
-
-        // Normalize the filtered SSE. Add 8 bit precision.
-        picture_control_set_ptr_central->filtered_sse = (picture_control_set_ptr_central->filtered_sse << 8) / central_picture_ptr->width / central_picture_ptr->height;
-        picture_control_set_ptr_central->filtered_sse_uv = ((picture_control_set_ptr_central->filtered_sse_uv << 8) / (central_picture_ptr->width >> ss_x) / (central_picture_ptr->height >> ss_y)) / 2;
+    // The last segment to complete a segment row finalizes its rows,
+    // and the last segment row to complete finalizes the picture
+    uint32_t x_seg_idx, y_seg_idx;
+    SEGMENT_CONVERT_IDX_TO_XY(segment_index, x_seg_idx, y_seg_idx, picture_control_set_ptr_central->tf_segments_column_count);
+    (void)x_seg_idx;
+    if (eb_atomic_fetch_add(&picture_control_set_ptr_central->tf_segment_row_done_count[y_seg_idx], 1) + 1 == picture_control_set_ptr_central->tf_segments_column_count) {
+        finalize_filtered_segment_row(picture_control_set_ptr_central,
+                                      y_seg_idx,
+                                      ss_x,
+                                      ss_y,
+                                      is_highbd);
 
-        // signal that temp filt is done
-        eb_post_semaphore(picture_control_set_ptr_central->temp_filt_done_semaphore);
+        if (eb_atomic_fetch_add(&picture_control_set_ptr_central->tf_segment_rows_done, 1) + 1 == picture_control_set_ptr_central->tf_segments_row_count)
+            finalize_filtered_pic(picture_control_set_ptr_central,
+                                  ss_x,
+                                  ss_y,
+                                  is_highbd);
     }
 
-    eb_release_mutex(picture_control_set_ptr_central->temp_filt_mutex);
-
     return EB_ErrorNone;
 
 }
@@ -28,6 +28,7 @@
 #include "EbSequenceControlSet.h"
 #include "EbDefinitions.h"
 #include "EbBitstreamUnit.h"
+#include "EbSharedAnalysis.h"
 
 // ALT-REF debug-specific defines
 #define DEBUG_TF 0
@@ -58,6 +59,7 @@
 #define THRES_HIGH 20000
 #define THRES_DIFF_LOW 6000
 #define THRES_DIFF_HIGH 12000
+#define TF_SKIP_NOISE_TH 0.5 // noise level under which the window is left unfiltered by the adaptive skip
 
 #define OD_DIVU_DMAX (1024)
 #define AHD_TH_WEIGHT 20
@@ -66,11 +68,19 @@
 extern "C" {
 #endif
 
+// Picture level preparation of the filtering, performed before the segments are posted
+EbErrorType svt_av1_prepare_temporal_filtering(PictureParentControlSet **list_picture_control_set_ptr,
+                                               PictureParentControlSet *picture_control_set_ptr_central);
+
 int svt_av1_init_temporal_filtering(PictureParentControlSet **list_picture_control_set_ptr,
                                     PictureParentControlSet *picture_control_set_ptr_central,
                                     MotionEstimationContext_t *me_context_ptr,
                                     int32_t segment_index);
 
+// Takes the filtered picture published by the primary of the analysis group in place of filtering it
+void svt_av1_apply_shared_temporal_filtering(PictureParentControlSet *picture_control_set_ptr_central,
+                                             const SharedAnalysisRecord *record_ptr);
+
 void svt_av1_apply_filtering_c(const uint8_t *y_src,
                             int y_src_stride,
                             const uint8_t *y_pre,
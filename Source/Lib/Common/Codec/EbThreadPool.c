@@ -0,0 +1,252 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include <stdlib.h>
+
+#include "EbThreadPool.h"
+
+#ifdef _WIN32
+#define EB_THREAD_LOCAL __declspec(thread)
+#else
+#define EB_THREAD_LOCAL __thread
+#endif
+
+// Worker running on the calling thread, NULL outside of any pool
+static EB_THREAD_LOCAL EbThreadPoolWorker *current_worker = NULL;
+
+static void eb_thread_pool_worker_dctor(EbPtr p)
+{
+    EbThreadPoolWorker *obj = (EbThreadPoolWorker*)p;
+    EB_FREE_ARRAY(obj->task_array);
+    EB_DESTROY_MUTEX(obj->lockout_mutex);
+    EB_DESTROY_MUTEX(obj->task_mutex);
+}
+
+/**************************************
+ * eb_thread_pool_worker_ctor
+ **************************************/
+static EbErrorType eb_thread_pool_worker_ctor(
+    EbThreadPoolWorker *worker_ptr,
+    EbThreadPool       *pool_ptr,
+    uint32_t            worker_index,
+    uint32_t            task_capacity)
+{
+    worker_ptr->dctor = eb_thread_pool_worker_dctor;
+    worker_ptr->pool_ptr = pool_ptr;
+    worker_ptr->worker_index = worker_index;
+
+    EB_CREATE_MUTEX(worker_ptr->lockout_mutex);
+    EB_CREATE_MUTEX(worker_ptr->task_mutex);
+
+    worker_ptr->task_capacity = task_capacity;
+    EB_MALLOC_ARRAY(worker_ptr->task_array, task_capacity);
+
+    return EB_ErrorNone;
+}
+
+/**************************************
+ * eb_thread_pool_worker_push_back
+ *   Owner side, adds a task at the tail.
+ **************************************/
+static EbErrorType eb_thread_pool_worker_push_back(
+    EbThreadPoolWorker *worker_ptr,
+    EbThreadPoolTask   *task_ptr)
+{
+    EbErrorType return_error = EB_ErrorNone;
+
+    eb_block_on_mutex(worker_ptr->lockout_mutex);
+
+    if (worker_ptr->task_count < worker_ptr->task_capacity) {
+        uint32_t tail_index = worker_ptr->task_head + worker_ptr->task_count;
+        if (tail_index >= worker_ptr->task_capacity)
+            tail_index -= worker_ptr->task_capacity;
+        worker_ptr->task_array[tail_index] = *task_ptr;
+        ++worker_ptr->task_count;
+    }
+    else
+        return_error = EB_ErrorInsufficientResources;
+
+    eb_release_mutex(worker_ptr->lockout_mutex);
+
+    return return_error;
+}
+
+/**************************************
+ * eb_thread_pool_worker_pop_back
+ *   Owner side, takes the newest task.
+ **************************************/
+static EbBool eb_thread_pool_worker_pop_back(
+    EbThreadPoolWorker *worker_ptr,
+    EbThreadPoolTask   *task_ptr)
+{
+    EbBool found = EB_FALSE;
+
+    eb_block_on_mutex(worker_ptr->lockout_mutex);
+
+    if (worker_ptr->task_count) {
+        uint32_t tail_index = worker_ptr->task_head + worker_ptr->task_count - 1;
+        if (tail_index >= worker_ptr->task_capacity)
+            tail_index -= worker_ptr->task_capacity;
+        *task_ptr = worker_ptr->task_array[tail_index];
+        --worker_ptr->task_count;
+        found = EB_TRUE;
+    }
+
+    eb_release_mutex(worker_ptr->lockout_mutex);
+
+    return found;
+}
+
+/**************************************
+ * eb_thread_pool_worker_pop_front
+ *   Thief side, takes the oldest task.
+ **************************************/
+static EbBool eb_thread_pool_worker_pop_front(
+    EbThreadPoolWorker *worker_ptr,
+    EbThreadPoolTask   *task_ptr)
+{
+    EbBool found = EB_FALSE;
+
+    eb_block_on_mutex(worker_ptr->lockout_mutex);
+
+    if (worker_ptr->task_count) {
+        *task_ptr = worker_ptr->task_array[worker_ptr->task_head];
+        worker_ptr->task_head = (worker_ptr->task_head == worker_ptr->task_capacity - 1) ?
+            0 : worker_ptr->task_head + 1;
+        --worker_ptr->task_count;
+        found = EB_TRUE;
+    }
+
+    eb_release_mutex(worker_ptr->lockout_mutex);
+
+    return found;
+}
+
+static void eb_thread_pool_dctor(EbPtr p)
+{
+    EbThreadPool *obj = (EbThreadPool*)p;
+    EB_DELETE_PTR_ARRAY(obj->worker_ptr_array, obj->worker_count);
+    EB_DESTROY_SEMAPHORE(obj->task_semaphore);
+    EB_DESTROY_MUTEX(obj->submit_mutex);
+}
+
+/*********************************************************************
+ * eb_thread_pool_ctor
+ *********************************************************************/
+EbErrorType eb_thread_pool_ctor(
+    EbThreadPool *pool_ptr,
+    uint32_t      worker_count,
+    uint32_t      task_capacity)
+{
+    uint32_t worker_index;
+
+    pool_ptr->dctor = eb_thread_pool_dctor;
+    pool_ptr->worker_count = worker_count ? worker_count : 1;
+
+    EB_CREATE_SEMAPHORE(pool_ptr->task_semaphore, 0, task_capacity);
+    EB_CREATE_MUTEX(pool_ptr->submit_mutex);
+
+    EB_ALLOC_PTR_ARRAY(pool_ptr->worker_ptr_array, pool_ptr->worker_count);
+    for (worker_index = 0; worker_index < pool_ptr->worker_count; ++worker_index) {
+        EB_NEW(
+            pool_ptr->worker_ptr_array[worker_index],
+            eb_thread_pool_worker_ctor,
+            pool_ptr,
+            worker_index,
+            task_capacity);
+    }
+
+    return EB_ErrorNone;
+}
+
+/*********************************************************************
+ * eb_thread_pool_submit
+ *********************************************************************/
+EbErrorType eb_thread_pool_submit(
+    EbThreadPool       *pool_ptr,
+    EbThreadPoolTaskFn  task_fn,
+    void               *task_arg)
+{
+    EbErrorType         return_error;
+    EbThreadPoolTask    task;
+    EbThreadPoolWorker *worker_ptr = current_worker;
+
+    task.task_fn = task_fn;
+    task.task_arg = task_arg;
+
+    if (worker_ptr == NULL || worker_ptr->pool_ptr != pool_ptr) {
+        eb_block_on_mutex(pool_ptr->submit_mutex);
+        worker_ptr = pool_ptr->worker_ptr_array[pool_ptr->next_worker_index];
+        pool_ptr->next_worker_index = (pool_ptr->next_worker_index + 1 == pool_ptr->worker_count) ?
+            0 : pool_ptr->next_worker_index + 1;
+        eb_release_mutex(pool_ptr->submit_mutex);
+    }
+
+    return_error = eb_thread_pool_worker_push_back(worker_ptr, &task);
+
+    // One post per queued task, whoever wakes up will find it (or steal it)
+    if (return_error == EB_ErrorNone)
+        eb_post_semaphore(pool_ptr->task_semaphore);
+
+    return return_error;
+}
+
+/*********************************************************************
+ * eb_thread_pool_wait_running_tasks
+ *   Taking the task mutex of a worker waits for the task it runs, if
+ *   any. Tasks that start later are not waited for.
+ *********************************************************************/
+void eb_thread_pool_wait_running_tasks(
+    EbThreadPool *pool_ptr)
+{
+    uint32_t worker_index;
+
+    for (worker_index = 0; worker_index < pool_ptr->worker_count; ++worker_index) {
+        eb_block_on_mutex(pool_ptr->worker_ptr_array[worker_index]->task_mutex);
+        eb_release_mutex(pool_ptr->worker_ptr_array[worker_index]->task_mutex);
+    }
+}
+
+/*********************************************************************
+ * eb_thread_pool_kernel
+ *   Every post of task_semaphore matches exactly one queued task, so a
+ *   worker that got through the semaphore is guaranteed to find a task
+ *   in one of the queues: its own first, then the others, starting
+ *   with its right neighbour to spread the thieves.
+ *********************************************************************/
+void* eb_thread_pool_kernel(void *input_ptr)
+{
+    EbThreadPoolWorker *worker_ptr = (EbThreadPoolWorker*)input_ptr;
+    EbThreadPool       *pool_ptr = worker_ptr->pool_ptr;
+    EbThreadPoolTask    task;
+    uint32_t            victim_offset;
+
+    current_worker = worker_ptr;
+
+    for (;;) {
+        eb_block_on_semaphore(pool_ptr->task_semaphore);
+
+        while (eb_thread_pool_worker_pop_back(worker_ptr, &task) == EB_FALSE) {
+            EbBool stolen = EB_FALSE;
+            for (victim_offset = 1; victim_offset < pool_ptr->worker_count && stolen == EB_FALSE; ++victim_offset) {
+                uint32_t victim_index = worker_ptr->worker_index + victim_offset;
+                if (victim_index >= pool_ptr->worker_count)
+                    victim_index -= pool_ptr->worker_count;
+                stolen = eb_thread_pool_worker_pop_front(pool_ptr->worker_ptr_array[victim_index], &task);
+            }
+            if (stolen) {
+                ++worker_ptr->stolen_task_count;
+                break;
+            }
+        }
+
+        eb_block_on_mutex(worker_ptr->task_mutex);
+        task.task_fn(task.task_arg);
+        eb_release_mutex(worker_ptr->task_mutex);
+        ++worker_ptr->executed_task_count;
+    }
+
+    return EB_NULL;
+}
@@ -0,0 +1,116 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#ifndef EbThreadPool_h
+#define EbThreadPool_h
+
+#include "EbDefinitions.h"
+#include "EbThreads.h"
+#include "EbObject.h"
+#ifdef __cplusplus
+extern "C" {
+#endif
+    /*********************************************************************
+     * Thread Pool
+     *   Fixed set of worker threads executing short, non-blocking tasks.
+     *   Each worker owns a double ended task queue: the owner pushes and
+     *   pops at the tail (LIFO, cache warm), idle workers steal from the
+     *   head of the other queues (FIFO, oldest first).  A pool-wide
+     *   counting semaphore counts the queued tasks so that idle workers
+     *   sleep in the OS instead of spinning.
+     *
+     *   The pool does not create its threads. The owner creates
+     *   worker_count threads running eb_thread_pool_kernel, one per entry
+     *   of worker_ptr_array, the same way stage kernels are created.
+     *********************************************************************/
+    typedef void(*EbThreadPoolTaskFn)(void *task_arg);
+
+    typedef struct EbThreadPoolTask
+    {
+        EbThreadPoolTaskFn   task_fn;
+        void                *task_arg;
+    } EbThreadPoolTask;
+
+    typedef struct EbThreadPoolWorker
+    {
+        EbDctor              dctor;
+        struct EbThreadPool *pool_ptr;
+        uint32_t             worker_index;
+
+        // lockout_mutex - protects the task queue below
+        EbHandle             lockout_mutex;
+        EbThreadPoolTask    *task_array;
+        uint32_t             task_head;
+        uint32_t             task_count;
+        uint32_t             task_capacity;
+
+        // task_mutex - held by the worker while it runs a task
+        EbHandle             task_mutex;
+
+        // statistics, only written by the owning worker
+        uint64_t             executed_task_count;
+        uint64_t             stolen_task_count;
+    } EbThreadPoolWorker;
+
+    typedef struct EbThreadPool
+    {
+        EbDctor              dctor;
+        uint32_t             worker_count;
+        EbThreadPoolWorker **worker_ptr_array;
+
+        // task_semaphore - counts the tasks queued over all workers
+        EbHandle             task_semaphore;
+
+        // submit_mutex - protects next_worker_index for submissions
+        //   coming from threads outside of the pool
+        EbHandle             submit_mutex;
+        uint32_t             next_worker_index;
+    } EbThreadPool;
+
+    /*********************************************************************
+     * eb_thread_pool_ctor
+     *   worker_count
+     *     Number of workers (threads) of the pool.
+     *
+     *   task_capacity
+     *     Maximum number of tasks that can be queued at the same time.
+     *     Every worker queue is sized to hold all of them.
+     *********************************************************************/
+    extern EbErrorType eb_thread_pool_ctor(
+        EbThreadPool *pool_ptr,
+        uint32_t      worker_count,
+        uint32_t      task_capacity);
+
+    /*********************************************************************
+     * eb_thread_pool_submit
+     *   Queues task_fn(task_arg). When called from a worker of the pool
+     *   the task goes to the caller's own queue, otherwise the queues are
+     *   filled round-robin.
+     *********************************************************************/
+    extern EbErrorType eb_thread_pool_submit(
+        EbThreadPool       *pool_ptr,
+        EbThreadPoolTaskFn  task_fn,
+        void               *task_arg);
+
+    /*********************************************************************
+     * eb_thread_pool_wait_running_tasks
+     *   Returns once every task running at the time of the call is done.
+     *   A pool shared by several owners calls it before an owner frees
+     *   the objects its tasks use, once it no longer submits tasks: the
+     *   pool keeps running the tasks of the other owners.
+     *********************************************************************/
+    extern void eb_thread_pool_wait_running_tasks(
+        EbThreadPool *pool_ptr);
+
+    /*********************************************************************
+     * eb_thread_pool_kernel
+     *   Worker thread entry, input_ptr is an EbThreadPoolWorker.
+     *********************************************************************/
+    extern void* eb_thread_pool_kernel(void *input_ptr);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // EbThreadPool_h
@@ -10,6 +10,10 @@
 
 #ifdef _WIN32
 #include <Windows.h>
+#include <intrin.h>
+#endif
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+#include <emmintrin.h>
 #endif
 
 #ifdef __cplusplus
@@ -70,6 +74,50 @@ extern "C" {
     extern EbErrorType eb_destroy_mutex(
         EbHandle mutex_handle);
 
+    /**************************************
+     * Atomics
+     *   Sequentially consistent read-modify-write
+     *   operations on 32 bit words, acquire loads
+     *   and release stores.
+     **************************************/
+#ifdef _WIN32
+    static INLINE int32_t eb_atomic_fetch_add(volatile int32_t *ptr, int32_t value) {
+        return (int32_t)_InterlockedExchangeAdd((volatile long*)ptr, (long)value);
+    }
+    static INLINE EbBool eb_atomic_compare_exchange(volatile int32_t *ptr, int32_t expected, int32_t desired) {
+        return (EbBool)(_InterlockedCompareExchange((volatile long*)ptr, (long)desired, (long)expected) == (long)expected);
+    }
+    static INLINE int32_t eb_atomic_load(volatile int32_t *ptr) {
+        int32_t value = *ptr;
+        _ReadWriteBarrier();
+        return value;
+    }
+    static INLINE void eb_atomic_store(volatile int32_t *ptr, int32_t value) {
+        _ReadWriteBarrier();
+        *ptr = value;
+    }
+#else
+    static INLINE int32_t eb_atomic_fetch_add(volatile int32_t *ptr, int32_t value) {
+        return __atomic_fetch_add(ptr, value, __ATOMIC_SEQ_CST);
+    }
+    static INLINE EbBool eb_atomic_compare_exchange(volatile int32_t *ptr, int32_t expected, int32_t desired) {
+        return (EbBool)__atomic_compare_exchange_n(ptr, &expected, desired, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+    }
+    static INLINE int32_t eb_atomic_load(volatile int32_t *ptr) {
+        return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+    }
+    static INLINE void eb_atomic_store(volatile int32_t *ptr, int32_t value) {
+        __atomic_store_n(ptr, value, __ATOMIC_RELEASE);
+    }
+#endif
+
+    // Hint for spin-wait loops
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+#define eb_cpu_pause() _mm_pause()
+#else
+#define eb_cpu_pause()
+#endif
+
     extern    EbMemoryMapEntry *memory_map;                // library Memory table
     extern    uint32_t         *memory_map_index;          // library memory index
     extern    uint64_t         *total_lib_memory;          // library Memory malloc'd
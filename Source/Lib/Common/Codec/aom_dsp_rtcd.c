@@ -1843,12 +1843,24 @@ void setup_rtcd_internal(EbAsm asm_type)
     SET_AVX2(noise_extract_chroma_weak,
              noise_extract_chroma_weak_c,
              noise_extract_chroma_weak_avx2_intrin);
-    SET_SSE41(svt_av1_apply_filtering,
-              svt_av1_apply_filtering_c,
-              svt_av1_apply_temporal_filter_sse4_1);
-    SET_SSE41(svt_av1_apply_filtering_highbd,
-              svt_av1_apply_filtering_highbd_c,
-              svt_av1_highbd_apply_temporal_filter_sse4_1);
+    SET_SSE41_AVX2_AVX512(svt_av1_apply_filtering,
+                          svt_av1_apply_filtering_c,
+                          svt_av1_apply_temporal_filter_sse4_1,
+                          svt_av1_apply_temporal_filter_avx2,
+                          svt_av1_apply_temporal_filter_avx512);
+    SET_SSE41_AVX2_AVX512(svt_av1_apply_filtering_highbd,
+                          svt_av1_apply_filtering_highbd_c,
+                          svt_av1_highbd_apply_temporal_filter_sse4_1,
+                          svt_av1_highbd_apply_temporal_filter_avx2,
+                          svt_av1_highbd_apply_temporal_filter_avx512);
+    SET_AVX2_AVX512(svt_av1_get_final_filtered_pixels,
+                    svt_av1_get_final_filtered_pixels_c,
+                    svt_av1_get_final_filtered_pixels_avx2,
+                    svt_av1_get_final_filtered_pixels_avx512);
+    SET_AVX2_AVX512(svt_av1_get_final_filtered_pixels_highbd,
+                    svt_av1_get_final_filtered_pixels_highbd_c,
+                    svt_av1_get_final_filtered_pixels_highbd_avx2,
+                    svt_av1_get_final_filtered_pixels_highbd_avx512);
     SET_AVX2_AVX512(combined_averaging_ssd,
                     combined_averaging_ssd_c,
                     combined_averaging_ssd_avx2,
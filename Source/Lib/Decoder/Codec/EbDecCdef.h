@@ -23,6 +23,20 @@
 extern "C" {
 #endif
 
+/* CDEF state carried from one 64x64 filter block row to the next */
+typedef struct DecCdefCtxt {
+    /* Pre CDEF bottom lines of the previous row */
+    uint16_t *linebuf[MAX_MB_PLANE];
+    /* Pre CDEF right columns of the previous 64x64 block */
+    uint16_t *colbuf[MAX_MB_PLANE];
+    /* Per 64x64 block flags of the previous and current row */
+    uint8_t  *row_cdef;
+    uint8_t  *prev_row_cdef;
+    uint8_t  *curr_row_cdef;
+} DecCdefCtxt;
+
+void svt_cdef_init(EbDecHandle *dec_handle);
+void svt_cdef_row(EbDecHandle *dec_handle, int32_t fbr);
 void svt_cdef_frame(EbDecHandle *dec_handle);
 
 #ifdef __cplusplus
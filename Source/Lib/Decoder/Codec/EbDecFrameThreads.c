@@ -0,0 +1,384 @@
+/*
+* Copyright(c) 2019 Netflix, Inc.
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+// SUMMARY
+//   Frame parallel decoding.
+//   The main handle reads the OBUs and keeps the reference frame maps. Each
+//   frame is handed to a frame ctxt, a handle of its own with its decoding
+//   ctxts and tile threads, which decodes it on its frame thread while the
+//   main handle goes on with the next frames. The frame ctxts share the
+//   picture manager, the pictures publish their decode progress :
+//   - parse_done : the CDFs, segment ids and MVs a later frame starts with
+//   - sb_rows_done : the SB rows post filtered and padded, inter prediction
+//     waits for the rows its MVs reach only
+//   Headers, reference counts and the memory map stay on the main thread.
+
+#include <string.h>
+
+#include "EbDefinitions.h"
+#include "EbThreads.h"
+#include "EbDecHandle.h"
+#include "EbDecMemInit.h"
+#include "EbDecPicMgr.h"
+#include "EbDecUtils.h"
+#include "EbObuParse.h"
+#include "EbDecFrameThreads.h"
+
+/* The bitstream reader reads ahead, its buf_max is 8 bytes past the data */
+#define BITS_READ_AHEAD 8
+
+/* Decodes the frame of a frame ctxt once the reference frames it predicts
+   its CDFs and MVs from are parsed */
+static EbErrorType decode_frame_job(EbDecHandle *dec_handle_ptr)
+{
+    FrameHeader *frame_header = &dec_handle_ptr->frame_header;
+    EbDecPicBuf *cur_pic_buf = dec_handle_ptr->cur_pic_buf[0];
+    EbErrorType status;
+
+    if (frame_header->primary_ref_frame != PRIMARY_REF_NONE) {
+        EbDecPicBuf *ref_buf = get_ref_frame_buf(dec_handle_ptr,
+            frame_header->primary_ref_frame + 1);
+        if (ref_buf != NULL)
+            dec_pic_wait_parse(ref_buf);
+    }
+    if (frame_header->use_ref_frame_mvs) {
+        for (int32_t ref = LAST_FRAME; ref <= ALTREF_FRAME; ref++) {
+            EbDecPicBuf *ref_buf = get_ref_frame_buf(dec_handle_ptr, ref);
+            if (ref_buf != NULL)
+                dec_pic_wait_parse(ref_buf);
+        }
+    }
+
+    setup_ref_frame_ctxts(dec_handle_ptr);
+
+    status = decode_frame_tiles(dec_handle_ptr, 1);
+
+    /* A corrupt frame still releases the frames waiting on it */
+    if (status != EB_ErrorNone) {
+        dec_pic_publish_progress(cur_pic_buf, &cur_pic_buf->parse_done, 1);
+        dec_pic_publish_progress(cur_pic_buf, &cur_pic_buf->sb_rows_done,
+                                 cur_pic_buf->sb_rows);
+    }
+    return status;
+}
+
+/* Frame thread kernel, one frame per start */
+void *dec_frame_thread_kernel(void *input_ptr)
+{
+    DecFrameJob *frame_job = (DecFrameJob *)input_ptr;
+
+    for (;;) {
+        eb_block_on_semaphore(frame_job->start_semaphore);
+        frame_job->status = decode_frame_job(frame_job->dec_handle_ptr);
+        eb_post_semaphore(frame_job->done_semaphore);
+    }
+    return NULL;
+}
+
+/* Waits for the frame of a job and releases its pictures */
+static EbErrorType reap_frame_job(DecFrameJob *frame_job)
+{
+    if (!frame_job->in_flight)
+        return EB_ErrorNone;
+
+    eb_block_on_semaphore(frame_job->done_semaphore);
+    frame_job->in_flight = 0;
+    for (int32_t i = 0; i < frame_job->num_held_pic_bufs; i++)
+        dec_pic_mgr_release(frame_job->held_pic_bufs[i]);
+    frame_job->num_held_pic_bufs = 0;
+
+    return frame_job->status;
+}
+
+/* Waits for all the frames in flight */
+EbErrorType dec_frame_thrd_wait_all(EbDecHandle *dec_handle_ptr)
+{
+    DecFrameThrdCtxt *frame_thrd_ctxt =
+        (DecFrameThrdCtxt *)dec_handle_ptr->pv_frame_thrd_ctxt;
+    EbErrorType status = EB_ErrorNone;
+
+    for (int32_t i = 0; i < frame_thrd_ctxt->num_frame_jobs; i++) {
+        DecFrameJob *frame_job = &frame_thrd_ctxt->frame_jobs[
+            (frame_thrd_ctxt->next_frame_job + i) %
+            frame_thrd_ctxt->num_frame_jobs];
+        EbErrorType job_status = reap_frame_job(frame_job);
+        if (status == EB_ErrorNone)
+            status = job_status;
+    }
+    return status;
+}
+
+static void hold_pic_buf(DecFrameJob *frame_job, EbDecPicBuf *pic_buf)
+{
+    dec_pic_mgr_add_ref(pic_buf);
+    frame_job->held_pic_bufs[frame_job->num_held_pic_bufs++] = pic_buf;
+}
+
+/* The main handle carries the reference frame maps from frame to frame, the
+   frame ctxt parses the next frame header from them */
+static void sync_frame_ctxt(EbDecHandle *frame_ctxt,
+                            EbDecHandle *dec_handle_ptr)
+{
+    frame_ctxt->dec_cnt      = dec_handle_ptr->dec_cnt;
+    frame_ctxt->dec_config   = dec_handle_ptr->dec_config;
+    frame_ctxt->seq_header   = dec_handle_ptr->seq_header;
+    frame_ctxt->frame_header = dec_handle_ptr->frame_header;
+    memcpy(frame_ctxt->remapped_ref_idx, dec_handle_ptr->remapped_ref_idx,
+           sizeof(dec_handle_ptr->remapped_ref_idx));
+    memcpy(frame_ctxt->ref_frame_map, dec_handle_ptr->ref_frame_map,
+           sizeof(dec_handle_ptr->ref_frame_map));
+}
+
+static void sync_main_handle(EbDecHandle *dec_handle_ptr,
+                             EbDecHandle *frame_ctxt)
+{
+    dec_handle_ptr->frame_header = frame_ctxt->frame_header;
+    dec_handle_ptr->dec_config.max_color_format =
+        frame_ctxt->dec_config.max_color_format;
+    memcpy(dec_handle_ptr->next_ref_frame_map, frame_ctxt->next_ref_frame_map,
+           sizeof(frame_ctxt->next_ref_frame_map));
+    dec_handle_ptr->cur_pic_buf[0]      = frame_ctxt->cur_pic_buf[0];
+    dec_handle_ptr->show_existing_frame = frame_ctxt->show_existing_frame;
+    dec_handle_ptr->show_frame          = frame_ctxt->show_frame;
+    dec_handle_ptr->showable_frame      = frame_ctxt->showable_frame;
+}
+
+/* Reads a frame header with the oldest frame ctxt. data holds the OBUs left
+   in the input buffer, the tile groups of the frame are copied from it */
+EbErrorType dec_frame_thrd_read_frame_header(EbDecHandle *dec_handle_ptr,
+    bitstrm_t *bs, ObuHeader *obu_header, int trailing_bit,
+    const uint8_t *data, size_t data_size)
+{
+    DecFrameThrdCtxt *frame_thrd_ctxt =
+        (DecFrameThrdCtxt *)dec_handle_ptr->pv_frame_thrd_ctxt;
+    EbDecPicMgr *pic_mgr = (EbDecPicMgr *)dec_handle_ptr->pv_pic_mgr;
+    DecFrameJob *frame_job =
+        &frame_thrd_ctxt->frame_jobs[frame_thrd_ctxt->next_frame_job];
+    EbDecHandle *frame_ctxt = frame_job->dec_handle_ptr;
+    EbErrorType status;
+
+    /* The frame ctxt is free once its previous frame is decoded, and the
+       frame needs a free picture : older frames are reaped until one is */
+    status = reap_frame_job(frame_job);
+    for (int32_t i = 1; i < frame_thrd_ctxt->num_frame_jobs &&
+         !dec_pic_mgr_has_free_pic(pic_mgr); i++)
+    {
+        EbErrorType job_status = reap_frame_job(&frame_thrd_ctxt->frame_jobs[
+            (frame_thrd_ctxt->next_frame_job + i) %
+            frame_thrd_ctxt->num_frame_jobs]);
+        if (status == EB_ErrorNone)
+            status = job_status;
+    }
+    if (status != EB_ErrorNone)
+        return status;
+    if (!dec_pic_mgr_has_free_pic(pic_mgr))
+        return EB_ErrorInsufficientResources;
+
+    sync_frame_ctxt(frame_ctxt, dec_handle_ptr);
+    status = read_frame_header_obu(bs, frame_ctxt, obu_header, trailing_bit);
+    sync_main_handle(dec_handle_ptr, frame_ctxt);
+    if (status != EB_ErrorNone)
+        return status;
+
+    frame_thrd_ctxt->output_pending = frame_ctxt->show_frame;
+
+    /* A shown existing frame has nothing to decode */
+    if (frame_ctxt->show_existing_frame)
+        return EB_ErrorNone;
+
+    if (frame_job->data_alloc_size < data_size + BITS_READ_AHEAD) {
+        frame_job->data_alloc_size = AOMMAX(data_size + BITS_READ_AHEAD,
+            2 * frame_job->data_alloc_size);
+        EB_MALLOC_DEC(uint8_t*, frame_job->data, frame_job->data_alloc_size,
+                      EB_N_PTR);
+    }
+    memcpy(frame_job->data, data, data_size);
+    memset(frame_job->data + data_size, 0, BITS_READ_AHEAD);
+    frame_job->src_data = data;
+    frame_job->src_data_size = data_size;
+
+    frame_ctxt->num_tile_jobs = 0;
+    frame_thrd_ctxt->cur_frame_job = frame_job;
+
+    return EB_ErrorNone;
+}
+
+/* Starts the frame on its frame thread, with its pictures held */
+static EbErrorType dispatch_frame_job(DecFrameThrdCtxt *frame_thrd_ctxt,
+                                      DecFrameJob *frame_job)
+{
+    EbDecHandle *frame_ctxt = frame_job->dec_handle_ptr;
+
+    hold_pic_buf(frame_job, frame_ctxt->cur_pic_buf[0]);
+    for (int32_t ref = LAST_FRAME; ref <= ALTREF_FRAME; ref++) {
+        EbDecPicBuf *ref_buf = get_ref_frame_buf(frame_ctxt, ref);
+        if (ref_buf != NULL)
+            hold_pic_buf(frame_job, ref_buf);
+    }
+
+    frame_job->rows_published = 0;
+    frame_job->status = EB_ErrorNone;
+    frame_job->in_flight = 1;
+    frame_thrd_ctxt->next_frame_job = (frame_thrd_ctxt->next_frame_job + 1) %
+        frame_thrd_ctxt->num_frame_jobs;
+    eb_post_semaphore(frame_job->start_semaphore);
+
+    /* Superres upscaling allocates from the memory map, which is not thread
+       safe : the frame is decoded before the next header is read */
+    if (!av1_superres_unscaled(&frame_ctxt->frame_header.frame_size))
+        return reap_frame_job(frame_job);
+
+    return EB_ErrorNone;
+}
+
+/* Reads a tile group of the current frame, the frame is dispatched once its
+   last tile group is in */
+EbErrorType dec_frame_thrd_read_tile_group(EbDecHandle *dec_handle_ptr,
+    bitstrm_t *bs, ObuHeader *obu_header, int *is_last_tg)
+{
+    DecFrameThrdCtxt *frame_thrd_ctxt =
+        (DecFrameThrdCtxt *)dec_handle_ptr->pv_frame_thrd_ctxt;
+    DecFrameJob *frame_job = frame_thrd_ctxt->cur_frame_job;
+    EbDecHandle *frame_ctxt;
+    EbErrorType status;
+    int32_t first_tile_job;
+
+    if (frame_job == NULL)
+        return EB_Corrupt_Frame;
+    frame_ctxt = frame_job->dec_handle_ptr;
+    first_tile_job = frame_ctxt->num_tile_jobs;
+
+    status = read_tile_group_header(bs, frame_ctxt,
+        &frame_ctxt->frame_header.tiles_info, obu_header, is_last_tg);
+    if (status != EB_ErrorNone)
+        return status;
+
+    /* The tiles point into the copy of the input buffer. The OBUs of a
+       frame come in one input buffer */
+    for (int32_t i = first_tile_job; i < frame_ctxt->num_tile_jobs; i++) {
+        DecTileJob *tile_job = &frame_ctxt->tile_jobs[i];
+        const size_t offset = tile_job->data - frame_job->src_data;
+        const size_t end_offset = tile_job->data_end - frame_job->src_data;
+
+        if (tile_job->data < frame_job->src_data ||
+            end_offset > frame_job->src_data_size + BITS_READ_AHEAD)
+            return EB_Corrupt_Frame;
+        tile_job->data = frame_job->data + offset;
+        tile_job->data_end = frame_job->data + end_offset;
+    }
+
+    if (!*is_last_tg)
+        return EB_ErrorNone;
+
+    frame_thrd_ctxt->cur_frame_job = NULL;
+    return dispatch_frame_job(frame_thrd_ctxt, frame_job);
+}
+
+/* Queues the frame just read for output, if shown */
+EbErrorType dec_frame_thrd_queue_output(EbDecHandle *dec_handle_ptr)
+{
+    DecFrameThrdCtxt *frame_thrd_ctxt =
+        (DecFrameThrdCtxt *)dec_handle_ptr->pv_frame_thrd_ctxt;
+    EbDecPicBuf *pic_buf = dec_handle_ptr->cur_pic_buf[0];
+    DecOutputPic *output_pic;
+
+    if (!frame_thrd_ctxt->output_pending)
+        return EB_ErrorNone;
+    frame_thrd_ctxt->output_pending = 0;
+
+    if (frame_thrd_ctxt->num_output_pics == MAX_PIC_BUFS)
+        return EB_ErrorInsufficientResources;
+
+    output_pic = &frame_thrd_ctxt->output_pics[
+        (frame_thrd_ctxt->output_head + frame_thrd_ctxt->num_output_pics) %
+        MAX_PIC_BUFS];
+    frame_thrd_ctxt->num_output_pics++;
+
+    dec_pic_mgr_add_ref(pic_buf);
+    output_pic->pic_buf = pic_buf;
+    output_pic->width = pic_buf->superres_upscaled_width;
+    output_pic->height = pic_buf->frame_height;
+    output_pic->film_grain_params = pic_buf->film_grain_params;
+
+    return EB_ErrorNone;
+}
+
+/* The next frame in output order once decoded. While the input goes on, it
+   is waited for only when num_frms_prll frames wait for output, so that
+   the frames in flight overlap */
+DecOutputPic *dec_frame_thrd_get_output(EbDecHandle *dec_handle_ptr)
+{
+    DecFrameThrdCtxt *frame_thrd_ctxt =
+        (DecFrameThrdCtxt *)dec_handle_ptr->pv_frame_thrd_ctxt;
+    DecOutputPic *output_pic;
+    EbDecPicBuf *pic_buf;
+
+    if (frame_thrd_ctxt == NULL || frame_thrd_ctxt->num_output_pics == 0)
+        return NULL;
+
+    output_pic = &frame_thrd_ctxt->output_pics[frame_thrd_ctxt->output_head];
+    pic_buf = output_pic->pic_buf;
+    if (eb_atomic_load(&pic_buf->sb_rows_done) < pic_buf->sb_rows) {
+        if (!frame_thrd_ctxt->flushing &&
+            frame_thrd_ctxt->num_output_pics < dec_handle_ptr->num_frms_prll)
+            return NULL;
+        dec_pic_wait_progress(pic_buf, &pic_buf->sb_rows_done,
+                              pic_buf->sb_rows);
+    }
+    return output_pic;
+}
+
+void dec_frame_thrd_release_output(EbDecHandle *dec_handle_ptr)
+{
+    DecFrameThrdCtxt *frame_thrd_ctxt =
+        (DecFrameThrdCtxt *)dec_handle_ptr->pv_frame_thrd_ctxt;
+
+    dec_pic_mgr_release(
+        frame_thrd_ctxt->output_pics[frame_thrd_ctxt->output_head].pic_buf);
+    frame_thrd_ctxt->output_head =
+        (frame_thrd_ctxt->output_head + 1) % MAX_PIC_BUFS;
+    frame_thrd_ctxt->num_output_pics--;
+}
+
+static INLINE int32_t plane_rows(int32_t luma_rows, int32_t height,
+                                 int32_t sub_y)
+{
+    return luma_rows == height ? (height + sub_y) >> sub_y : luma_rows >> sub_y;
+}
+
+/* Pads the luma rows [rows_published, luma_rows) of the current picture and
+   the chroma rows under them, then publishes the SB rows they complete.
+   Called in row order, by the post filter chain and at the frame end */
+void dec_frame_publish_rows(EbDecHandle *dec_handle_ptr, int32_t luma_rows)
+{
+    DecFrameJob *frame_job = (DecFrameJob *)dec_handle_ptr->pv_frame_job;
+    EbDecPicBuf *cur_pic_buf = dec_handle_ptr->cur_pic_buf[0];
+    FrameHeader *frame_header = &dec_handle_ptr->frame_header;
+    EbColorConfig *color_config = &dec_handle_ptr->seq_header.color_config;
+    const int32_t height = frame_header->frame_size.frame_height;
+    const int32_t num_planes = av1_num_planes(color_config);
+
+    luma_rows = AOMMIN(luma_rows, height);
+    if (luma_rows <= frame_job->rows_published)
+        return;
+
+    for (int32_t plane = 0; plane < num_planes; plane++) {
+        const int32_t sub_x = plane ? color_config->subsampling_x : 0;
+        const int32_t sub_y = plane ? color_config->subsampling_y : 0;
+        const int32_t row_start =
+            plane_rows(frame_job->rows_published, height, sub_y);
+        const int32_t row_end = plane_rows(luma_rows, height, sub_y);
+
+        if (row_start < row_end) {
+            pad_rows(cur_pic_buf->ps_pic_buf, frame_header, plane, sub_x,
+                     sub_y, row_start, row_end);
+        }
+    }
+    frame_job->rows_published = luma_rows;
+
+    dec_pic_publish_progress(cur_pic_buf, &cur_pic_buf->sb_rows_done,
+        luma_rows == height ? cur_pic_buf->sb_rows :
+        luma_rows >> cur_pic_buf->sb_size_log2);
+}
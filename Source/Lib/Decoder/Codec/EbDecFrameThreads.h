@@ -0,0 +1,97 @@
+/*
+* Copyright(c) 2019 Netflix, Inc.
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#ifndef EbDecFrameThreads_h
+#define EbDecFrameThreads_h
+
+#include "EbDecHandle.h"
+#include "EbDecBitstream.h"
+#include "EbObuParse.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* A frame ctxt and the frame it decodes on its frame thread */
+typedef struct DecFrameJob {
+    /* Frame ctxt : a handle of its own, sharing the picture manager */
+    EbDecHandle     *dec_handle_ptr;
+
+    EbHandle        frame_thread;
+    EbHandle        start_semaphore;
+    EbHandle        done_semaphore;
+
+    /* Set from the dispatch of the frame until it is reaped */
+    int32_t         in_flight;
+    EbErrorType     status;
+
+    /* The OBUs of the frame, copied from the input buffer at src_data */
+    uint8_t         *data;
+    size_t          data_alloc_size;
+    const uint8_t   *src_data;
+    size_t          src_data_size;
+
+    /* The current picture and its references, held until the frame is
+       decoded */
+    EbDecPicBuf     *held_pic_bufs[INTER_REFS_PER_FRAME + 1];
+    int32_t         num_held_pic_bufs;
+
+    /* Luma rows padded and published so far */
+    int32_t         rows_published;
+} DecFrameJob;
+
+/* A shown frame waiting for eb_svt_dec_get_picture */
+typedef struct DecOutputPic {
+    EbDecPicBuf         *pic_buf;
+    uint32_t            width;
+    uint32_t            height;
+    aom_film_grain_t    film_grain_params;
+} DecOutputPic;
+
+/* Frame parallel decoding ctxt of the main handle */
+typedef struct DecFrameThrdCtxt {
+    DecFrameJob     *frame_jobs;
+    int32_t         num_frame_jobs;
+
+    /* The jobs are used round robin in decode order, next_frame_job is
+       the oldest one */
+    int32_t         next_frame_job;
+
+    /* Job of the frame whose tile groups are being read, NULL between
+       frames */
+    DecFrameJob     *cur_frame_job;
+
+    /* Set by a shown frame header, until the frame is queued for output */
+    int32_t         output_pending;
+
+    /* Shown frames in output order */
+    DecOutputPic    output_pics[MAX_PIC_BUFS];
+    int32_t         output_head;
+    int32_t         num_output_pics;
+
+    /* End of stream, the output no longer waits for more input */
+    int32_t         flushing;
+} DecFrameThrdCtxt;
+
+void *dec_frame_thread_kernel(void *input_ptr);
+
+EbErrorType dec_frame_thrd_read_frame_header(EbDecHandle *dec_handle_ptr,
+    bitstrm_t *bs, ObuHeader *obu_header, int trailing_bit,
+    const uint8_t *data, size_t data_size);
+EbErrorType dec_frame_thrd_read_tile_group(EbDecHandle *dec_handle_ptr,
+    bitstrm_t *bs, ObuHeader *obu_header, int *is_last_tg);
+
+EbErrorType dec_frame_thrd_wait_all(EbDecHandle *dec_handle_ptr);
+EbErrorType dec_frame_thrd_queue_output(EbDecHandle *dec_handle_ptr);
+DecOutputPic *dec_frame_thrd_get_output(EbDecHandle *dec_handle_ptr);
+void dec_frame_thrd_release_output(EbDecHandle *dec_handle_ptr);
+
+void dec_frame_publish_rows(EbDecHandle *dec_handle_ptr, int32_t luma_rows);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // EbDecFrameThreads_h
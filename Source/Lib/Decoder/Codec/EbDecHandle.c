@@ -18,6 +18,7 @@
 #include "EbDecHandle.h"
 #include "EbDecMemInit.h"
 #include "EbDecPicMgr.h"
+#include "EbDecFrameThreads.h"
 #include "grainSynthesis.h"
 
 #ifndef _WIN32
@@ -25,6 +26,9 @@
 #include <errno.h>
 #include <sys/stat.h>
 #include <fcntl.h>
+#include <unistd.h>
+#else
+#include <windows.h>
 #endif
 
 #if defined(_MSC_VER)
@@ -95,6 +99,18 @@ static EbAsm get_cpu_asm_type()
     return asm_type;
 }
 
+//Get Number of logical processors
+static uint32_t get_num_processors()
+{
+#ifdef _WIN32
+    SYSTEM_INFO sysinfo;
+    GetSystemInfo(&sysinfo);
+    return sysinfo.dwNumberOfProcessors;
+#else
+    return sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+}
+
 /***********************************
 * Decoder Library Handle Constructor
 ************************************/
@@ -125,25 +141,21 @@ static EbErrorType eb_dec_handle_ctor(
 }
 
 /* Copy from recon buffer to out buffer! */
-int svt_dec_out_buf(
+static int copy_pic_to_out_buf(
     EbDecHandle         *dec_handle_ptr,
+    EbDecPicBuf         *pic_buf,
+    uint32_t             wd,
+    uint32_t             ht,
+    aom_film_grain_t    *film_grain_ptr,
     EbBufferHeaderType  *p_buffer)
 {
-    EbPictureBufferDesc *recon_picture_buf = dec_handle_ptr->cur_pic_buf[0]->ps_pic_buf;
+    EbPictureBufferDesc *recon_picture_buf = pic_buf->ps_pic_buf;
     EbSvtIOFormat       *out_img = (EbSvtIOFormat*)p_buffer->p_buffer;
 
     uint8_t *luma = NULL;
     uint8_t *cb   = NULL;
     uint8_t *cr   = NULL;
 
-    /* TODO: Should add logic for show_existing_frame */
-    if (0 == dec_handle_ptr->show_frame) {
-        assert(0 == dec_handle_ptr->show_existing_frame);
-        return 0;
-    }
-
-    uint32_t wd = dec_handle_ptr->frame_header.frame_size.superres_upscaled_width;
-    uint32_t ht = dec_handle_ptr->frame_header.frame_size.frame_height;
     uint32_t i, sx = 0, sy = 0;
 
     if (out_img->height != ht || out_img->width != wd ||
@@ -315,8 +327,6 @@ int svt_dec_out_buf(
 
     if (!dec_handle_ptr->dec_config.skip_film_grain) {
         /* Need to fill the dst buf with recon data before calling film_grain */
-        aom_film_grain_t *film_grain_ptr = &dec_handle_ptr->cur_pic_buf[0]->
-            film_grain_params;
         if (film_grain_ptr->apply_grain) {
 
             switch (recon_picture_buf->bit_depth) {
@@ -338,6 +348,23 @@ int svt_dec_out_buf(
     return 1;
 }
 
+/* Copy the current frame to the out buffer, if shown */
+int svt_dec_out_buf(
+    EbDecHandle         *dec_handle_ptr,
+    EbBufferHeaderType  *p_buffer)
+{
+    /* TODO: Should add logic for show_existing_frame */
+    if (0 == dec_handle_ptr->show_frame) {
+        assert(0 == dec_handle_ptr->show_existing_frame);
+        return 0;
+    }
+
+    return copy_pic_to_out_buf(dec_handle_ptr, dec_handle_ptr->cur_pic_buf[0],
+        dec_handle_ptr->frame_header.frame_size.superres_upscaled_width,
+        dec_handle_ptr->frame_header.frame_size.frame_height,
+        &dec_handle_ptr->cur_pic_buf[0]->film_grain_params, p_buffer);
+}
+
 /**********************************
 Set Default Library Params
 **********************************/
@@ -364,6 +391,7 @@ EbErrorType eb_svt_dec_set_default_parameter(
     config_ptr->max_color_format = EB_YUV420;
     config_ptr->asm_type = 0;
     config_ptr->threads = 1;
+    config_ptr->frame_threads = 1;
 
     // Application Specific parameters
     config_ptr->channel_id = 0;
@@ -480,12 +508,23 @@ EB_API EbErrorType eb_init_decoder(
     EbDecHandle     *dec_handle_ptr = (EbDecHandle   *)svt_dec_component->p_component_private;
 
     dec_handle_ptr->dec_cnt = -1;
-    dec_handle_ptr->num_frms_prll   = 1;
+    dec_handle_ptr->num_frms_prll   = dec_handle_ptr->dec_config.frame_threads ?
+        dec_handle_ptr->dec_config.frame_threads : 1;
     if(dec_handle_ptr->num_frms_prll > DEC_MAX_NUM_FRM_PRLL)
         dec_handle_ptr->num_frms_prll = DEC_MAX_NUM_FRM_PRLL;
+    dec_handle_ptr->pv_frame_thrd_ctxt = NULL;
+    dec_handle_ptr->pv_frame_job = NULL;
     dec_handle_ptr->seq_header_done = 0;
     dec_handle_ptr->mem_init_done   = 0;
 
+    /* Tiles of a frame are parsed and decoded by up to num_threads threads */
+    dec_handle_ptr->num_threads = dec_handle_ptr->dec_config.threads ?
+        dec_handle_ptr->dec_config.threads : get_num_processors();
+    if (dec_handle_ptr->num_threads > MAX_TILE_ROWS * MAX_TILE_COLS)
+        dec_handle_ptr->num_threads = MAX_TILE_ROWS * MAX_TILE_COLS;
+    if (dec_handle_ptr->num_threads < 1)
+        dec_handle_ptr->num_threads = 1;
+
     dec_handle_ptr->seen_frame_header   = 0;
     dec_handle_ptr->show_existing_frame = 0;
     dec_handle_ptr->show_frame          = 0;
@@ -528,10 +567,25 @@ EB_API EbErrorType eb_svt_decode_frame(
         return EB_ErrorBadParameter;
 
     EbDecHandle *dec_handle_ptr = (EbDecHandle *)svt_dec_component->p_component_private;
+    DecFrameThrdCtxt *frame_thrd_ctxt =
+        (DecFrameThrdCtxt *)dec_handle_ptr->pv_frame_thrd_ctxt;
     uint8_t *data_start = (uint8_t *)data;
     uint8_t *data_end = (uint8_t *)data + data_size;
     dec_handle_ptr->seen_frame_header = 0;
 
+    /* End of stream : no more frames to output but the ones in flight */
+    if (data_size == 0) {
+        if (frame_thrd_ctxt) {
+            frame_thrd_ctxt->flushing = 1;
+            return dec_frame_thrd_wait_all(dec_handle_ptr);
+        }
+        dec_handle_ptr->show_existing_frame = 0;
+        dec_handle_ptr->show_frame = 0;
+        return EB_ErrorNone;
+    }
+    if (frame_thrd_ctxt)
+        frame_thrd_ctxt->flushing = 0;
+
     while (data_start < data_end)
     {
         /*TODO : Remove or move. For Test purpose only */
@@ -546,6 +600,11 @@ EB_API EbErrorType eb_svt_decode_frame(
         if (return_error != EB_ErrorNone)
             assert(0);
 
+        /* Frame parallel decoding : mem init may have come with the frame */
+        frame_thrd_ctxt = (DecFrameThrdCtxt *)dec_handle_ptr->pv_frame_thrd_ctxt;
+        if (frame_thrd_ctxt && return_error == EB_ErrorNone)
+            return_error = dec_frame_thrd_queue_output(dec_handle_ptr);
+
         dec_pic_mgr_update_ref_pic(dec_handle_ptr, (EB_ErrorNone == return_error)
                     ? 1 : 0, dec_handle_ptr->frame_header.refresh_frame_flags);
 
@@ -583,6 +642,19 @@ EB_API EbErrorType eb_svt_dec_get_picture(
         return EB_ErrorBadParameter;
 
     EbDecHandle     *dec_handle_ptr = (EbDecHandle   *)svt_dec_component->p_component_private;
+
+    /* Frame parallel decoding : the shown frames are queued in output order */
+    if (dec_handle_ptr->num_frms_prll > 1) {
+        DecOutputPic *output_pic = dec_frame_thrd_get_output(dec_handle_ptr);
+        if (output_pic == NULL)
+            return EB_DecNoOutputPicture;
+        copy_pic_to_out_buf(dec_handle_ptr, output_pic->pic_buf,
+            output_pic->width, output_pic->height,
+            &output_pic->film_grain_params, p_buffer);
+        dec_frame_thrd_release_output(dec_handle_ptr);
+        return return_error;
+    }
+
     /* Copy from recon pointer and return! TODO: Should remove the memcpy! */
     if (0 == svt_dec_out_buf(dec_handle_ptr, p_buffer))
         return_error = EB_DecNoOutputPicture;
@@ -601,6 +673,10 @@ EB_API EbErrorType eb_deinit_decoder(
     EbErrorType return_error    = EB_ErrorNone;
 
     if (dec_handle_ptr) {
+        /* The frame threads are idle before they are destroyed */
+        if (dec_handle_ptr->pv_frame_thrd_ctxt)
+            dec_frame_thrd_wait_all(dec_handle_ptr);
+
         if (svt_dec_memory_map) {
             // Loop through the ptr table and free all malloc'd pointers per channel
             EbMemoryMapEntry*    memory_entry = svt_dec_memory_map;
@@ -25,9 +25,10 @@ extern "C" {
 #include "EbDecBlock.h"
 
 /* Maximum number of frames in parallel */
-#define DEC_MAX_NUM_FRM_PRLL    1
-/** Maximum picture buffers needed **/
-#define MAX_PIC_BUFS (REF_FRAMES + 1 + DEC_MAX_NUM_FRM_PRLL)
+#define DEC_MAX_NUM_FRM_PRLL    8
+/** Maximum picture buffers needed : the references, the current frame and,
+    in frame parallel decoding, the frames in flight or waiting for output **/
+#define MAX_PIC_BUFS (REF_FRAMES + 1 + 2 * DEC_MAX_NUM_FRM_PRLL)
 
 /*Optimisation of Coeff Buffer in Single Thread*/
 #define SINGLE_THRD_COEFF_BUF_OPT   1
@@ -74,6 +75,20 @@ typedef struct EbDecPicBuf {
     /* film grain */
     aom_film_grain_t    film_grain_params;
 
+    /* Decode progress, published by the frame thread decoding the picture
+       in frame parallel decoding, see EbDecFrameThreads.c. parse_done once
+       the CDFs, MVs and segment ids are final, sb_rows_done once SB rows
+       [0, sb_rows_done) are post filtered and padded */
+    volatile int32_t    parse_done;
+    volatile int32_t    sb_rows_done;
+    int32_t             sb_rows;
+    uint8_t             sb_size_log2;
+
+    /* Readers waiting for the progress sleep on progress_semaphore */
+    EbHandle            progress_mutex;
+    EbHandle            progress_semaphore;
+    int32_t             num_waiters;
+
 } EbDecPicBuf;
 
 /* Frame level buffers */
@@ -148,6 +163,46 @@ typedef struct MasterFrameBuf {
 
 } MasterFrameBuf;
 
+/* Tile of the current tile group, parsed and reconstructed by one thread */
+typedef struct DecTileJob {
+    int32_t         tile_num;
+    int32_t         tile_row;
+    int32_t         tile_col;
+
+    /* Tile data in the bitstream */
+    const uint8_t   *data;
+    const uint8_t   *data_end;
+    size_t          size;
+
+    EbErrorType     status;
+} DecTileJob;
+
+/* Work the decoder threads are woken up for */
+typedef enum DecThreadStage {
+    DEC_STAGE_TILES,
+    DEC_STAGE_POST_FILTER
+} DecThreadStage;
+
+/* Row pipelined LF, CDEF and LR of the current frame, see EbDecPostFilter.c */
+typedef struct DecPostFilterJob {
+    int32_t         do_lf;
+    int32_t         do_cdef;
+    int32_t         do_lr;
+    int32_t         opt_lr;
+
+    /* Frame parallel decoding : the rows are padded and published as they
+       are done, in order */
+    int32_t         publish_rows;
+
+    /* SB rows, handed out through next_sb_row */
+    volatile int32_t next_sb_row;
+
+    /* lf_row_semaphores[r] is posted for each deblocked SB of row r,
+       pf_row_semaphores[r] once the rows above r are CDEF'd and restored */
+    EbHandle        *lf_row_semaphores;
+    EbHandle        *pf_row_semaphores;
+} DecPostFilterJob;
+
 /**************************************
  * Component Private Data
  **************************************/
@@ -177,6 +232,21 @@ typedef struct EbDecHandle {
     uint8_t showable_frame;  // frame can be used as show existing frame in future
 
     // Thread Handles
+    /** Number of decoding threads, the calling thread included.
+        pv_parse_ctxt and pv_dec_mod_ctxt hold one context per thread */
+    int32_t num_threads;
+
+    /* Workers : thread i > 0 works on context i, on thread_stage */
+    DecThreadStage thread_stage;
+    EbHandle    thread_start_semaphore;
+    EbHandle    thread_done_semaphore;
+
+    /* Tiles of the current tile group, handed out through next_tile_job */
+    DecTileJob      *tile_jobs;
+    int32_t         num_tile_jobs;
+    volatile int32_t next_tile_job;
+
+    DecPostFilterJob post_filter_job;
 
     // Module Contexts
     void   *pv_parse_ctxt;
@@ -185,11 +255,19 @@ typedef struct EbDecHandle {
 
     void   *pv_lf_ctxt;
 
+    void   *pv_cdef_ctxt;
+
     void   *pv_lr_ctxt;
 
     /** Pointer to Picture manager structure **/
     void   *pv_pic_mgr;
 
+    /* Frame parallel decoding, see EbDecFrameThreads.c : the frame threads
+       ctxt of the main handle, and the frame job of a frame ctxt */
+    void   *pv_frame_thrd_ctxt;
+
+    void   *pv_frame_job;
+
     // * 'remapped_ref_idx[i - 1]' maps reference type 'i' (range: LAST_FRAME ...
     // EXTREF_FRAME) to a remapped index 'j' (in range: 0 ... REF_FRAMES - 1)
     // * Later, 'cm->ref_frame_map[j]' maps the remapped index 'j' to a pointer to
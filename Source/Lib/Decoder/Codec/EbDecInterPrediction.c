@@ -90,6 +90,8 @@ void svt_make_inter_predictor(PartitionInfo_t *part_info, int32_t ref,
     MV mv_q4;
     void *src_mod;
     SubpelParams subpel_params;
+    /* Last row of the reference plane read by the filters */
+    int32_t last_row;
     do_warp = do_warp && !av1_is_scaled(sf);
 
     const int32_t is_scaled = av1_is_scaled(sf);
@@ -136,6 +138,9 @@ void svt_make_inter_predictor(PartitionInfo_t *part_info, int32_t ref,
 
         int32_t src_offset = ( pos_y * src_stride ) + pos_x ;
         src_mod = (void *)((uint8_t *)src + (src_offset << highbd));
+
+        last_row = pos_y + ((subpel_params.subpel_y + (bh - 1) *
+            subpel_params.ys) >> SCALE_SUBPEL_BITS) + AOM_INTERP_EXTEND;
     }
     else {
         mv_q4 = dec_clamp_mv_to_umv_border_sb(
@@ -153,13 +158,14 @@ void svt_make_inter_predictor(PartitionInfo_t *part_info, int32_t ref,
         subpel_params.ys = SCALE_SUBPEL_SHIFTS;
         subpel_params.subpel_x = (mv_q4.col & SUBPEL_MASK) << SCALE_EXTRA_BITS;
         subpel_params.subpel_y = (mv_q4.row & SUBPEL_MASK) << SCALE_EXTRA_BITS;
+
+        last_row = pre_y + (mv_q4.row >> SUBPEL_BITS) + bh - 1 + AOM_INTERP_EXTEND;
     }
 
     assert(IMPLIES(is_intrabc, !do_warp));
 
+    const EbWarpedMotionParams *wm_params = &default_warp_params;
     if (do_warp) {
-        const EbWarpedMotionParams *wm_params = &default_warp_params;
-
         const EbWarpedMotionParams *const wm_global =
             &part_info->ps_global_motion[mi->ref_frame[ref]];
         const EbWarpedMotionParams *const wm_local =
@@ -167,6 +173,25 @@ void svt_make_inter_predictor(PartitionInfo_t *part_info, int32_t ref,
 
         wm_params = (mi->motion_mode == WARPED_CAUSAL) ? wm_local : wm_global;
 
+        /* The model is affine, the lowest projected row is one of the
+           projected corners of the block, in luma units */
+        const int32_t *mat = wm_params->wmmat;
+        int64_t max_y = INT64_MIN;
+        for (int32_t i = 0; i < 4; i++) {
+            const int64_t x = (int64_t)(pre_x + (i & 1) * bw) << ss_x;
+            const int64_t y = (int64_t)(pre_y + (i >> 1) * bh) << ss_y;
+            max_y = AOMMAX(max_y, mat[4] * x + mat[5] * y + mat[1]);
+        }
+        last_row = (int32_t)AOMMIN(max_y >> (WARPEDMODEL_PREC_BITS + ss_y),
+            ref_buf->ps_pic_buf->height) + 8;
+    }
+
+    /* Frame parallel decoding : the reference frame may still be decoding,
+       the SB rows down to the last row read are waited for */
+    if (!is_intrabc)
+        dec_pic_wait_rows(ref_buf, last_row * (1 << ss_y) + ss_y);
+
+    if (do_warp) {
         eb_av1_warp_plane((EbWarpedMotionParams *)wm_params,
             highbd, bit_depth, src,
             ref_buf->ps_pic_buf->width >> ss_x,
@@ -266,14 +291,14 @@ void av1_combine_interintra(PartitionInfo_t *part_info, BlockSize bsize,
         inter_stride, intra_pred, intra_stride);
 }
 
-void av1_build_intra_predictors_for_interintra(EbDecHandle *dec_hdl,
+void av1_build_intra_predictors_for_interintra(DecModCtxt *dec_mod_ctxt,
     PartitionInfo_t *part_info, void *pv_blk_recon_buf, int32_t recon_stride,
     BlockSize bsize, int32_t plane, uint8_t *dst, int dst_stride,
     EbBitDepthEnum bit_depth)
 {
     BlockModeInfo *mi = part_info->mi;
     int32_t i, wpx, hpx;
-    DecModCtxt *dec_mod_ctxt = (DecModCtxt *)dec_hdl->pv_dec_mod_ctxt;
+    EbDecHandle *dec_hdl = (EbDecHandle *)dec_mod_ctxt->dec_handle_ptr;
     int32_t sub_x = (plane > 0) ? part_info->subsampling_x : 0;
     int32_t sub_y = (plane > 0) ? part_info->subsampling_y : 0;
     BlockSize plane_bsize = get_plane_block_size(bsize, sub_x, sub_y);
@@ -325,13 +350,13 @@ void av1_build_intra_predictors_for_interintra(EbDecHandle *dec_hdl,
 }
 
 /* Build interintra_predictors */
-void av1_build_interintra_predictors(EbDecHandle *dec_hdl,
+void av1_build_interintra_predictors(DecModCtxt *dec_mod_ctxt,
     PartitionInfo_t *part_info, void *pred, int32_t stride, int plane,
     BlockSize bsize, EbBitDepthEnum bit_depth)
 {
     if (bit_depth > EB_8BIT) {
         DECLARE_ALIGNED(16, uint16_t, intrapredictor[MAX_SB_SQUARE]);
-        av1_build_intra_predictors_for_interintra(dec_hdl, part_info, pred,
+        av1_build_intra_predictors_for_interintra(dec_mod_ctxt, part_info, pred,
             stride, bsize, plane, (uint8_t *)intrapredictor,
             MAX_SB_SIZE, bit_depth);
         av1_combine_interintra(part_info, bsize, plane, pred, stride,
@@ -339,7 +364,7 @@ void av1_build_interintra_predictors(EbDecHandle *dec_hdl,
     }
     else {
         DECLARE_ALIGNED(16, uint8_t, intrapredictor[MAX_SB_SQUARE]);
-        av1_build_intra_predictors_for_interintra(dec_hdl, part_info, pred,
+        av1_build_intra_predictors_for_interintra(dec_mod_ctxt, part_info, pred,
             stride, bsize, plane, intrapredictor, MAX_SB_SIZE, bit_depth);
         av1_combine_interintra(part_info, bsize, plane, pred, stride,
             intrapredictor, MAX_SB_SIZE, bit_depth);
@@ -350,14 +375,14 @@ void av1_build_interintra_predictors(EbDecHandle *dec_hdl,
 
 
 void svtav1_predict_inter_block_plane(
-    EbDecHandle *dec_hdl, PartitionInfo_t *part_info, int32_t plane,
+    DecModCtxt *dec_mod_ctx, PartitionInfo_t *part_info, int32_t plane,
     int32_t build_for_obmc, int32_t mi_x, int32_t mi_y,
     void *dst, int32_t dst_stride,
     int32_t some_use_intra, int32_t bit_depth)
 {
+    EbDecHandle *dec_hdl = (EbDecHandle *)dec_mod_ctx->dec_handle_ptr;
     const BlockModeInfo *mi = part_info->mi;
     const FrameHeader *cur_frm_hdr = &dec_hdl->frame_header;
-    DecModCtxt *dec_mod_ctx = (DecModCtxt*) dec_hdl->pv_dec_mod_ctxt;
     SeqHeader *seq_header = &dec_hdl->seq_header;
     int32_t is_compound = has_second_ref(mi);
     int32_t ref;
@@ -475,9 +500,10 @@ void svtav1_predict_inter_block_plane(
 }
 
 void svtav1_predict_inter_block(
-    EbDecHandle *dec_hdl, PartitionInfo_t *part_info,
+    DecModCtxt *dec_mod_ctxt, PartitionInfo_t *part_info,
     int32_t mi_row, int32_t mi_col, int32_t num_planes)
 {
+    EbDecHandle *dec_hdl = (EbDecHandle *)dec_mod_ctxt->dec_handle_ptr;
     void *blk_recon_buf;
     int32_t recon_stride;
     int32_t sub_x, sub_y;
@@ -518,21 +544,21 @@ void svtav1_predict_inter_block(
             mi_col*MI_SIZE >> sub_x, mi_row*MI_SIZE >> sub_y,
             &blk_recon_buf, &recon_stride, sub_x, sub_y);
 
-        svtav1_predict_inter_block_plane(dec_hdl, part_info, plane,
+        svtav1_predict_inter_block_plane(dec_mod_ctxt, part_info, plane,
             0/*OBMC_FLAG*/, mi_col*MI_SIZE, mi_row*MI_SIZE, blk_recon_buf,
             recon_stride, some_use_intra, recon_picture_buf->bit_depth);
 
 #if COMP_INTERINTRA
         if (is_interintra_pred(part_info->mi)) {
 /*Inter prd is done in above function, In the below function Intra prd happens follwed by interintra blending */
-            av1_build_interintra_predictors(dec_hdl, part_info, blk_recon_buf,
+            av1_build_interintra_predictors(dec_mod_ctxt, part_info, blk_recon_buf,
                 recon_stride, plane, bsize, recon_picture_buf->bit_depth);
         }
 
 #endif //comp_interitra
     }
     if (part_info->mi->motion_mode == OBMC_CAUSAL) {
-        dec_build_obmc_inter_predictors_sb(dec_hdl, part_info, mi_row, mi_col);
+        dec_build_obmc_inter_predictors_sb(dec_mod_ctxt, part_info, mi_row, mi_col);
     }
 
     return;
@@ -10,12 +10,14 @@
 extern "C" {
 #endif
 
+struct DecModCtxt;
+
 void svtav1_predict_inter_block(
-    EbDecHandle *dec_hdl, PartitionInfo_t *part_info,
+    struct DecModCtxt *dec_mod_ctxt, PartitionInfo_t *part_info,
     int32_t mi_row, int32_t mi_col, int32_t num_planes);
 
 void svtav1_predict_inter_block_plane(
-    EbDecHandle *dec_hdl, PartitionInfo_t *part_info, int32_t plane,
+    struct DecModCtxt *dec_mod_ctx, PartitionInfo_t *part_info, int32_t plane,
     int32_t build_for_obmc, int32_t mi_x, int32_t mi_y,
     void *dst, int32_t dst_stride,
     int32_t some_use_intra, int32_t bit_depth);
@@ -43,11 +43,13 @@ void setup_segmentation_dequant(EbDecHandle *dec_handle_ptr, EbColorConfig *colo
     (void)color_config;
     SeqHeader *seq_header = &dec_handle_ptr->seq_header;
     FrameHeader *frame_info = &dec_handle_ptr->frame_header;
-    DecModCtxt *dec_mod_ctxt = (DecModCtxt*)dec_handle_ptr->pv_dec_mod_ctxt;
     int bit_depth = seq_header->color_config.bit_depth;
     /*int max_segments = frame_info->segmentation_params.segmentation_enabled ?
         MAX_SEGMENTS : 1;*/
     int32_t qindex;
+    /* Every tile thread dequantizes with its own copy */
+    for (int32_t thread_idx = 0; thread_idx < dec_handle_ptr->num_threads; thread_idx++) {
+    DecModCtxt *dec_mod_ctxt = (DecModCtxt*)dec_handle_ptr->pv_dec_mod_ctxt + thread_idx;
     for (int i = 0; i < MAX_SEGMENTS; i++) {
         qindex = get_qindex(&frame_info->segmentation_params, i,
             frame_info->quantization_params.base_q_idx);
@@ -70,12 +72,12 @@ void setup_segmentation_dequant(EbDecHandle *dec_handle_ptr, EbColorConfig *colo
         dec_mod_ctxt->dequants.v_dequant_QTX[i][1] = get_ac_quant(qindex,
             frame_info->quantization_params.delta_q_v_ac, bit_depth);
     }
+    }
 }
 
-void av1_inverse_qm_init(EbDecHandle *dec_handle_ptr)
+void av1_inverse_qm_init(DecModCtxt *dec_mod_ctxt, EbColorConfig *color_config)
 {
-    DecModCtxt *dec_mod_ctxt = (DecModCtxt*)dec_handle_ptr->pv_dec_mod_ctxt;
-    const int num_planes = av1_num_planes(&dec_handle_ptr->seq_header.color_config);
+    const int num_planes = av1_num_planes(color_config);
     int q, c;
     uint8_t t;
     int current;
@@ -113,13 +115,13 @@ void av1_init_sb(FrameHeader *frame)
 
 // Called in parse_decode_block()
 // Update de-quantization parameter based on delta qp param
-void update_dequant(EbDecHandle *dec_handle, SBInfo *sb_info)
+void update_dequant(DecModCtxt *dec_mod_ctxt, SBInfo *sb_info)
 {
     int32_t current_qindex;
     int dc_delta_q, ac_delta_q;
+    EbDecHandle *dec_handle = (EbDecHandle *)dec_mod_ctxt->dec_handle_ptr;
     SeqHeader *seq_header = &dec_handle->seq_header;
     FrameHeader *frame = &dec_handle->frame_header;
-    DecModCtxt *dec_mod_ctxt = (DecModCtxt*)dec_handle->pv_dec_mod_ctxt;
 
     dec_mod_ctxt->dequants_delta_q = &dec_mod_ctxt->dequants;
     if (frame->delta_q_params.delta_q_present) {
@@ -162,13 +164,13 @@ int get_dqv(const int16_t *dequant, int coeff_idx, const QmVal *iqmatrix) {
     return dqv;
 }
 
-int32_t inverse_quantize(EbDecHandle * dec_handle, PartitionInfo_t *part, BlockModeInfo *mode,
+int32_t inverse_quantize(DecModCtxt *dec_mod_ctxt, PartitionInfo_t *part, BlockModeInfo *mode,
     int32_t *level, int32_t *qcoeffs, TxType tx_type, TxSize tx_size, int plane)
 {
     (void)part;
+    EbDecHandle *dec_handle = (EbDecHandle *)dec_mod_ctxt->dec_handle_ptr;
     SeqHeader *seq = &dec_handle->seq_header;
     FrameHeader *frame = &dec_handle->frame_header;
-    DecModCtxt *dec_mod_ctxt = (DecModCtxt*)dec_handle->pv_dec_mod_ctxt;
     const ScanOrder *const scan_order = &av1_scan_orders[tx_size][tx_type]; //get_scan(tx_size, tx_type);
     const int16_t *scan = scan_order->scan;
     const int32_t max_value = (1 << (7 + seq->color_config.bit_depth)) - 1;
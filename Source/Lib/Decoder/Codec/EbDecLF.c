@@ -561,59 +561,65 @@ void dec_loop_filter_sb(
     }
 }
 
-/*Frame level function to trigger loop filter for each superblock*/
-void dec_av1_loop_filter_frame(EbDecHandle *dec_handle_ptr,
-    EbPictureBufferDesc *recon_picture_buf, LFCtxt *lf_ctxt,
-    int32_t plane_start, int32_t plane_end)
+/*Frame level LF setup, before the first dec_av1_loop_filter_sb*/
+void dec_av1_loop_filter_frame_init(EbDecHandle *dec_handle_ptr,
+    LFCtxt *lf_ctxt, int32_t plane_start, int32_t plane_end)
 {
     FrameHeader *frm_hdr = &dec_handle_ptr->frame_header;
-    SeqHeader *seq_header = &dec_handle_ptr->seq_header;
-    uint8_t     sb_size_Log2 = seq_header->sb_size_log2;
-    uint32_t    x_lcu_index;
-    uint32_t    y_lcu_index;
-    uint32_t    sb_origin_x;
-    uint32_t    sb_origin_y;
-    EbBool      endOfRowFlag;
-
     LoopFilterInfoN *lf_info = &lf_ctxt->lf_info;
+
     lf_ctxt->delta_lf_stride = dec_handle_ptr->master_frame_buf.sb_cols *
                                FRAME_LF_COUNT;
 
-    int32_t sb_size_w = block_size_wide[seq_header->sb_size];
-    int32_t sb_size_h = block_size_high[seq_header->sb_size];
-    uint32_t picture_width_in_sb    =
-        (seq_header->max_frame_width + sb_size_w - 1) / sb_size_w;
-    uint32_t picture_height_in_sb   =
-        (seq_header->max_frame_height + sb_size_h- 1) / sb_size_h;
-
     frm_hdr->loop_filter_params.combine_vert_horz_lf = 1;
     /*init hev threshold const vectors*/
     for (int lvl = 0; lvl <= MAX_LOOP_FILTER; lvl++)
         memset(lf_info->lfthr[lvl].hev_thr, (lvl >> 4), SIMD_WIDTH);
 
     eb_av1_loop_filter_frame_init(frm_hdr, lf_info, plane_start, plane_end);
+}
+
+/*LF of a SB of the frame. SBs of a row are filtered left to right and the
+  horizontal edges of a SB are filtered with the SB on its right, so a SB
+  can be filtered once the row above is done up to the SB above right*/
+void dec_av1_loop_filter_sb(EbDecHandle *dec_handle_ptr,
+    EbPictureBufferDesc *recon_picture_buf, LFCtxt *lf_ctxt,
+    uint32_t sb_row, uint32_t sb_col, int32_t plane_start, int32_t plane_end)
+{
+    FrameHeader *frm_hdr = &dec_handle_ptr->frame_header;
+    SeqHeader *seq_header = &dec_handle_ptr->seq_header;
+    MasterFrameBuf *master_frame_buf = &dec_handle_ptr->master_frame_buf;
+    CurFrameBuf    *frame_buf = &master_frame_buf->cur_frame_bufs[0];
+    uint8_t     sb_size_Log2 = seq_header->sb_size_log2;
+    uint32_t    sb_origin_x = sb_col << sb_size_Log2;
+    uint32_t    sb_origin_y = sb_row << sb_size_Log2;
+    EbBool      endOfRowFlag = (sb_col == (uint32_t)master_frame_buf->sb_cols - 1) ?
+                               EB_TRUE : EB_FALSE;
+
+    SBInfo  *sb_info = frame_buf->sb_info + (
+        ((sb_row * master_frame_buf->sb_cols) + sb_col));
+
+    /*LF function for a SB*/
+    dec_loop_filter_sb(frm_hdr, seq_header, recon_picture_buf,
+        lf_ctxt, &lf_ctxt->lf_info, sb_origin_y >> 2, sb_origin_x >> 2,
+        plane_start, plane_end, endOfRowFlag, sb_info->sb_delta_lf);
+}
+
+/*Frame level function to trigger loop filter for each superblock*/
+void dec_av1_loop_filter_frame(EbDecHandle *dec_handle_ptr,
+    EbPictureBufferDesc *recon_picture_buf, LFCtxt *lf_ctxt,
+    int32_t plane_start, int32_t plane_end)
+{
+    MasterFrameBuf *master_frame_buf = &dec_handle_ptr->master_frame_buf;
+
+    dec_av1_loop_filter_frame_init(dec_handle_ptr, lf_ctxt, plane_start,
+        plane_end);
 
     /*Loop over a frame : tregger dec_loop_filter_sb for each SB*/
-    for (y_lcu_index = 0; y_lcu_index < picture_height_in_sb; ++y_lcu_index) {
-        for (x_lcu_index = 0; x_lcu_index < picture_width_in_sb; ++x_lcu_index) {
-            sb_origin_x = x_lcu_index << sb_size_Log2;
-            sb_origin_y = y_lcu_index << sb_size_Log2;
-            endOfRowFlag = (x_lcu_index == picture_width_in_sb - 1) ?
-                EB_TRUE : EB_FALSE;
-
-            MasterFrameBuf *master_frame_buf = &dec_handle_ptr->master_frame_buf;
-            CurFrameBuf    *frame_buf = &master_frame_buf->cur_frame_bufs[0];
-
-            SBInfo  *sb_info = frame_buf->sb_info + (
-                ((y_lcu_index * master_frame_buf->sb_cols) + x_lcu_index));
-
-            /*sb_info->sb_delta_lf = frame_buf->delta_lf + (FRAME_LF_COUNT *
-                ((y_lcu_index * master_frame_buf->sb_cols) + x_lcu_index));*/
-
-            /*LF function for a SB*/
-            dec_loop_filter_sb(frm_hdr, seq_header, recon_picture_buf,
-                lf_ctxt, lf_info, sb_origin_y >> 2, sb_origin_x >> 2,
-                plane_start, plane_end, endOfRowFlag, sb_info->sb_delta_lf);
+    for (int32_t sb_row = 0; sb_row < master_frame_buf->sb_rows; ++sb_row) {
+        for (int32_t sb_col = 0; sb_col < master_frame_buf->sb_cols; ++sb_col) {
+            dec_av1_loop_filter_sb(dec_handle_ptr, recon_picture_buf, lf_ctxt,
+                sb_row, sb_col, plane_start, plane_end);
         }
     }
 }
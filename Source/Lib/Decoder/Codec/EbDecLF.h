@@ -51,6 +51,13 @@ void fill_4x4_param_luma(LFBlockParamL* lf_block_l,
 void fill_4x4_param_uv(LFBlockParamUV* lf_block_uv, int32_t tu_x, int32_t tu_y,
     int32_t stride, TxSize tx_size, int32_t sub_x, int32_t sub_y);
 
+void dec_av1_loop_filter_frame_init(EbDecHandle *dec_handle_ptr,
+    LFCtxt *lf_ctxt, int32_t plane_start, int32_t plane_end);
+
+void dec_av1_loop_filter_sb(EbDecHandle *dec_handle_ptr,
+    EbPictureBufferDesc *recon_picture_buf, LFCtxt *lf_ctxt,
+    uint32_t sb_row, uint32_t sb_col, int32_t plane_start, int32_t plane_end);
+
 void dec_av1_loop_filter_frame(
     EbDecHandle *dec_handle_ptr,
     EbPictureBufferDesc *recon_picture_buf, LFCtxt *lf_ctxt,
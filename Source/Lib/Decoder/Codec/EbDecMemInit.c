@@ -12,6 +12,7 @@
 #include <stdlib.h>
 
 #include "EbDefinitions.h"
+#include "EbThreads.h"
 #include "EbPictureBufferDesc.h"
 
 #include "EbSvtAv1Dec.h"
@@ -24,7 +25,10 @@
 #include "EbDecInverseQuantize.h"
 
 #include "EbDecPicMgr.h"
+#include "EbDecFrameThreads.h"
 #include "EbDecLF.h"
+#include "EbDecCdef.h"
+#include "EbCdef.h"
 
 /*TODO: Remove and harmonize with encoder. Globals prevent harmonization now! */
 /*****************************************
@@ -167,9 +171,9 @@ static EbErrorType init_master_frame_ctxt(EbDecHandle  *dec_handle_ptr) {
             /*TODO : Change to macro */
             /* (16+1) : 1 for Length and 16 for all coeffs in 4x4 */
 #if SINGLE_THRD_COEFF_BUF_OPT
-        /*Size of coeff buf reduced to sb_sizesss*/
+        /*Size of coeff buf reduced to sb_sizesss, one SB per tile thread*/
         EB_MALLOC_DEC(int32_t*, cur_frame_buf->coeff[AOM_PLANE_Y],
-            (num_mis_in_sb * sizeof(int32_t) * (16 + 1)), EB_N_PTR);
+            (dec_handle_ptr->num_threads * num_mis_in_sb * sizeof(int32_t) * (16 + 1)), EB_N_PTR);
 #else
         EB_MALLOC_DEC(int32_t*, cur_frame_buf->coeff[AOM_PLANE_Y],
             (num_sb * num_mis_in_sb * sizeof(int32_t) * (16 + 1)), EB_N_PTR);
@@ -188,9 +192,9 @@ static EbErrorType init_master_frame_ctxt(EbDecHandle  *dec_handle_ptr) {
         {
 #if SINGLE_THRD_COEFF_BUF_OPT
             EB_MALLOC_DEC(int32_t*, cur_frame_buf->coeff[AOM_PLANE_U],
-                (num_mis_in_sb * sizeof(int32_t) * (16 + 1) >> 2), EB_N_PTR);
+                (dec_handle_ptr->num_threads * num_mis_in_sb * sizeof(int32_t) * (16 + 1) >> 2), EB_N_PTR);
             EB_MALLOC_DEC(int32_t*, cur_frame_buf->coeff[AOM_PLANE_V],
-                (num_mis_in_sb * sizeof(int32_t) * (16 + 1) >> 2), EB_N_PTR);
+                (dec_handle_ptr->num_threads * num_mis_in_sb * sizeof(int32_t) * (16 + 1) >> 2), EB_N_PTR);
 #else
             EB_MALLOC_DEC(int32_t*, cur_frame_buf->coeff[AOM_PLANE_U],
                 (num_sb * num_mis_in_sb * sizeof(int32_t) * (16 + 1) >> 2), EB_N_PTR);
@@ -203,9 +207,9 @@ static EbErrorType init_master_frame_ctxt(EbDecHandle  *dec_handle_ptr) {
         {
 #if SINGLE_THRD_COEFF_BUF_OPT
             EB_MALLOC_DEC(int32_t*, cur_frame_buf->coeff[AOM_PLANE_U],
-                (num_mis_in_sb * sizeof(int32_t) * (16 + 1) >> 1), EB_N_PTR);
+                (dec_handle_ptr->num_threads * num_mis_in_sb * sizeof(int32_t) * (16 + 1) >> 1), EB_N_PTR);
             EB_MALLOC_DEC(int32_t*, cur_frame_buf->coeff[AOM_PLANE_V],
-                (num_mis_in_sb * sizeof(int32_t) * (16 + 1) >> 1), EB_N_PTR);
+                (dec_handle_ptr->num_threads * num_mis_in_sb * sizeof(int32_t) * (16 + 1) >> 1), EB_N_PTR);
 #else
             EB_MALLOC_DEC(int32_t*, cur_frame_buf->coeff[AOM_PLANE_U],
                 (num_sb * num_mis_in_sb * sizeof(int32_t) * (16 + 1) >> 1), EB_N_PTR);
@@ -218,9 +222,9 @@ static EbErrorType init_master_frame_ctxt(EbDecHandle  *dec_handle_ptr) {
         {
 #if SINGLE_THRD_COEFF_BUF_OPT
             EB_MALLOC_DEC(int32_t*, cur_frame_buf->coeff[AOM_PLANE_U],
-                (num_mis_in_sb * sizeof(int32_t) * (16 + 1)), EB_N_PTR);
+                (dec_handle_ptr->num_threads * num_mis_in_sb * sizeof(int32_t) * (16 + 1)), EB_N_PTR);
             EB_MALLOC_DEC(int32_t*, cur_frame_buf->coeff[AOM_PLANE_V],
-                (num_mis_in_sb * sizeof(int32_t) * (16 + 1)), EB_N_PTR);
+                (dec_handle_ptr->num_threads * num_mis_in_sb * sizeof(int32_t) * (16 + 1)), EB_N_PTR);
 #else
             EB_MALLOC_DEC(int32_t*, cur_frame_buf->coeff[AOM_PLANE_U],
                 (num_sb * num_mis_in_sb * sizeof(int32_t) * (16 + 1)), EB_N_PTR);
@@ -230,6 +234,24 @@ static EbErrorType init_master_frame_ctxt(EbDecHandle  *dec_handle_ptr) {
         }
         else
             assert(0);
+#if SINGLE_THRD_COEFF_BUF_OPT
+        if (i == 0) {
+            int32_t coeff_y_size = num_mis_in_sb * (16 + 1);
+            int32_t coeff_uv_size = coeff_y_size >>
+                (seq_header->color_config.subsampling_x +
+                 seq_header->color_config.subsampling_y);
+
+            for (int32_t thread_idx = 0; thread_idx < dec_handle_ptr->num_threads; thread_idx++) {
+                ParseCtxt *parse_ctx = (ParseCtxt*)dec_handle_ptr->pv_parse_ctxt + thread_idx;
+                parse_ctx->sb_coeff_buf[AOM_PLANE_Y] =
+                    cur_frame_buf->coeff[AOM_PLANE_Y] + thread_idx * coeff_y_size;
+                parse_ctx->sb_coeff_buf[AOM_PLANE_U] =
+                    cur_frame_buf->coeff[AOM_PLANE_U] + thread_idx * coeff_uv_size;
+                parse_ctx->sb_coeff_buf[AOM_PLANE_V] =
+                    cur_frame_buf->coeff[AOM_PLANE_V] + thread_idx * coeff_uv_size;
+            }
+        }
+#endif
 
         /* delta_q allocation at SB level */
         EB_MALLOC_DEC(int32_t*, cur_frame_buf->delta_q,
@@ -319,9 +341,8 @@ static EbErrorType init_master_frame_ctxt(EbDecHandle  *dec_handle_ptr) {
 static EbErrorType init_parse_context (EbDecHandle  *dec_handle_ptr) {
     EbErrorType return_error = EB_ErrorNone;
 
-    EB_MALLOC_DEC(void *, dec_handle_ptr->pv_parse_ctxt, sizeof(ParseCtxt), EB_N_PTR);
-
-    ParseCtxt *parse_ctx = (ParseCtxt*)dec_handle_ptr->pv_parse_ctxt;
+    EB_MALLOC_DEC(void *, dec_handle_ptr->pv_parse_ctxt,
+        dec_handle_ptr->num_threads * sizeof(ParseCtxt), EB_N_PTR);
 
     SeqHeader   *seq_header = &dec_handle_ptr->seq_header;
 
@@ -338,38 +359,45 @@ static EbErrorType init_parse_context (EbDecHandle  *dec_handle_ptr) {
     //int32_t sb_rows             = sb_aligned_height >> sb_size_log2;
     int8_t num_planes           = seq_header->color_config.mono_chrome ? 1 : MAX_MB_PLANE;
 
-    ParseNbr4x4Ctxt *neigh_ctx = &parse_ctx->parse_nbr4x4_ctxt;
-
     num_mi_col = sb_cols * num_4x4_neigh_sb;
     num_mi_row = num_4x4_neigh_sb;
     //num_mi_frame = sb_cols * sb_rows * num_4x4_neigh_sb;
 
     int num4_64x64 = mi_size_wide[BLOCK_64X64];
 
-    EB_MALLOC_DEC(uint8_t*, neigh_ctx->above_tx_wd, num_mi_col * sizeof(uint8_t), EB_N_PTR);
-    EB_MALLOC_DEC(uint8_t*, neigh_ctx->left_tx_ht, num_mi_row * sizeof(uint8_t), EB_N_PTR);
+    /* Each thread parses its tiles with its own nbr ctxt */
+    for (int32_t thread_idx = 0; thread_idx < dec_handle_ptr->num_threads; thread_idx++) {
+        ParseCtxt *parse_ctx = (ParseCtxt*)dec_handle_ptr->pv_parse_ctxt + thread_idx;
 
-    EB_MALLOC_DEC(uint8_t*, neigh_ctx->above_part_wd, num_mi_col * sizeof(uint8_t), EB_N_PTR);
-    EB_MALLOC_DEC(uint8_t*, neigh_ctx->left_part_ht, num_mi_row * sizeof(uint8_t), EB_N_PTR);
-    /* TODO : Optimize the size for Chroma */
-    for (int i = 0; i < num_planes; i++) {
-        EB_MALLOC_DEC(uint8_t*, neigh_ctx->above_dc_ctx[i], num_mi_col * sizeof(uint8_t), EB_N_PTR);
-        EB_MALLOC_DEC(uint8_t*, neigh_ctx->left_dc_ctx[i], num_mi_row * sizeof(uint8_t), EB_N_PTR);
+        ParseNbr4x4Ctxt *neigh_ctx = &parse_ctx->parse_nbr4x4_ctxt;
 
-        EB_MALLOC_DEC(uint8_t*, neigh_ctx->above_level_ctx[i], num_mi_col * sizeof(uint8_t), EB_N_PTR);
-        EB_MALLOC_DEC(uint8_t*, neigh_ctx->left_level_ctx[i], num_mi_row * sizeof(uint8_t), EB_N_PTR);
+        parse_ctx->dec_handle_ptr = (void *)dec_handle_ptr;
 
-        EB_MALLOC_DEC(uint16_t*, neigh_ctx->above_palette_colors[i],
-            num4_64x64 * PALETTE_MAX_SIZE *sizeof(uint16_t), EB_N_PTR);
-        EB_MALLOC_DEC(uint16_t*, neigh_ctx->left_palette_colors[i],
-            num_4x4_neigh_sb * PALETTE_MAX_SIZE *sizeof(uint16_t), EB_N_PTR);
-    }
+        EB_MALLOC_DEC(uint8_t*, neigh_ctx->above_tx_wd, num_mi_col * sizeof(uint8_t), EB_N_PTR);
+        EB_MALLOC_DEC(uint8_t*, neigh_ctx->left_tx_ht, num_mi_row * sizeof(uint8_t), EB_N_PTR);
+
+        EB_MALLOC_DEC(uint8_t*, neigh_ctx->above_part_wd, num_mi_col * sizeof(uint8_t), EB_N_PTR);
+        EB_MALLOC_DEC(uint8_t*, neigh_ctx->left_part_ht, num_mi_row * sizeof(uint8_t), EB_N_PTR);
+        /* TODO : Optimize the size for Chroma */
+        for (int i = 0; i < num_planes; i++) {
+            EB_MALLOC_DEC(uint8_t*, neigh_ctx->above_dc_ctx[i], num_mi_col * sizeof(uint8_t), EB_N_PTR);
+            EB_MALLOC_DEC(uint8_t*, neigh_ctx->left_dc_ctx[i], num_mi_row * sizeof(uint8_t), EB_N_PTR);
 
-    EB_MALLOC_DEC(int8_t*, neigh_ctx->above_comp_grp_idx, num_mi_col * sizeof(int8_t), EB_N_PTR);
-    EB_MALLOC_DEC(int8_t*, neigh_ctx->left_comp_grp_idx, num_mi_row * sizeof(int8_t), EB_N_PTR);
+            EB_MALLOC_DEC(uint8_t*, neigh_ctx->above_level_ctx[i], num_mi_col * sizeof(uint8_t), EB_N_PTR);
+            EB_MALLOC_DEC(uint8_t*, neigh_ctx->left_level_ctx[i], num_mi_row * sizeof(uint8_t), EB_N_PTR);
+
+            EB_MALLOC_DEC(uint16_t*, neigh_ctx->above_palette_colors[i],
+                num4_64x64 * PALETTE_MAX_SIZE *sizeof(uint16_t), EB_N_PTR);
+            EB_MALLOC_DEC(uint16_t*, neigh_ctx->left_palette_colors[i],
+                num_4x4_neigh_sb * PALETTE_MAX_SIZE *sizeof(uint16_t), EB_N_PTR);
+        }
 
-    EB_MALLOC_DEC(uint8_t*, neigh_ctx->above_seg_pred_ctx, num_mi_col * sizeof(uint8_t), EB_N_PTR);
-    EB_MALLOC_DEC(uint8_t*, neigh_ctx->left_seg_pred_ctx, num_mi_row * sizeof(uint8_t), EB_N_PTR);
+        EB_MALLOC_DEC(int8_t*, neigh_ctx->above_comp_grp_idx, num_mi_col * sizeof(int8_t), EB_N_PTR);
+        EB_MALLOC_DEC(int8_t*, neigh_ctx->left_comp_grp_idx, num_mi_row * sizeof(int8_t), EB_N_PTR);
+
+        EB_MALLOC_DEC(uint8_t*, neigh_ctx->above_seg_pred_ctx, num_mi_col * sizeof(uint8_t), EB_N_PTR);
+        EB_MALLOC_DEC(uint8_t*, neigh_ctx->left_seg_pred_ctx, num_mi_row * sizeof(uint8_t), EB_N_PTR);
+    }
 
     return return_error;
 }
@@ -381,11 +409,8 @@ static EbErrorType init_dec_mod_ctxt(EbDecHandle  *dec_handle_ptr)
     SeqHeader   *seq_header = &dec_handle_ptr->seq_header;
     EbColorConfig *color_config = &seq_header->color_config;
 
-    EB_MALLOC_DEC(void *, dec_handle_ptr->pv_dec_mod_ctxt, sizeof(DecModCtxt), EB_N_PTR);
-
-    DecModCtxt *dec_mod_ctxt = (DecModCtxt*)dec_handle_ptr->pv_dec_mod_ctxt;
-
-    dec_mod_ctxt->dec_handle_ptr = (void *)dec_handle_ptr;
+    EB_MALLOC_DEC(void *, dec_handle_ptr->pv_dec_mod_ctxt,
+        dec_handle_ptr->num_threads * sizeof(DecModCtxt), EB_N_PTR);
 
     int32_t sb_size_log2 = dec_handle_ptr->seq_header.sb_size_log2;
 
@@ -394,9 +419,17 @@ static EbErrorType init_dec_mod_ctxt(EbDecHandle  *dec_handle_ptr)
         (color_config->subsampling_x ? y_size >> 2 : y_size) +
         (color_config->subsampling_y ? y_size >> 2 : y_size);
 
-    EB_MALLOC_DEC(int32_t*, dec_mod_ctxt->sb_iquant_ptr,
-        iq_size * sizeof(int32_t), EB_N_PTR);
-    av1_inverse_qm_init(dec_handle_ptr);
+    for (int32_t thread_idx = 0; thread_idx < dec_handle_ptr->num_threads; thread_idx++) {
+        DecModCtxt *dec_mod_ctxt = (DecModCtxt*)dec_handle_ptr->pv_dec_mod_ctxt + thread_idx;
+        ParseCtxt *parse_ctx = (ParseCtxt*)dec_handle_ptr->pv_parse_ctxt + thread_idx;
+
+        dec_mod_ctxt->dec_handle_ptr = (void *)dec_handle_ptr;
+        parse_ctx->pv_dec_mod_ctxt = (void *)dec_mod_ctxt;
+
+        EB_MALLOC_DEC(int32_t*, dec_mod_ctxt->sb_iquant_ptr,
+            iq_size * sizeof(int32_t), EB_N_PTR);
+        av1_inverse_qm_init(dec_mod_ctxt, &seq_header->color_config);
+    }
 
     return return_error;
 }
@@ -475,20 +508,90 @@ static EbErrorType init_lr_ctxt(EbDecHandle  *dec_handle_ptr)
     // expects width to be multiple of 16 for filtering.
     lr_ctxt->dst_stride = ALIGN_POWER_OF_TWO(frame_width, 4);
 
+    // Restored stripes wait in dst until the stripe below is restored,
+    // so two stripes per plane are kept
     EB_MALLOC_DEC(uint8_t *, lr_ctxt->dst, lr_ctxt->dst_stride *
-        (frame_height) * sizeof(uint8_t) << use_highbd, EB_N_PTR);
+        LR_DST_STRIPES * RESTORATION_PROC_UNIT_SIZE * MAX_MB_PLANE *
+        sizeof(uint8_t) << use_highbd, EB_N_PTR);
 
     return return_error;
 }
 
-EbErrorType dec_mem_init(EbDecHandle  *dec_handle_ptr) {
+static EbErrorType init_cdef_ctxt(EbDecHandle  *dec_handle_ptr)
+{
     EbErrorType return_error = EB_ErrorNone;
+    EB_MALLOC_DEC(void *, dec_handle_ptr->pv_cdef_ctxt, sizeof(DecCdefCtxt),
+                  EB_N_PTR);
 
-    if (0 == dec_handle_ptr->seq_header_done)
-        return EB_ErrorNone;
+    DecCdefCtxt *cdef_ctxt = (DecCdefCtxt *)dec_handle_ptr->pv_cdef_ctxt;
 
-    /* init module ctxts */
-    return_error |= dec_pic_mgr_init(dec_handle_ptr);
+    /* Sized for the largest frame, mi_cols covers 8 aligned widths */
+    const int32_t mi_cols = ALIGN_POWER_OF_TWO(
+        dec_handle_ptr->seq_header.max_frame_width, 3) >> MI_SIZE_LOG2;
+    const int32_t nhfb = (mi_cols + MI_SIZE_64X64 - 1) / MI_SIZE_64X64;
+    const int32_t stride = (mi_cols << MI_SIZE_LOG2) + 2 * CDEF_HBORDER;
+    const int num_planes = av1_num_planes(&dec_handle_ptr->seq_header.color_config);
+
+    EB_MALLOC_DEC(uint8_t *, cdef_ctxt->row_cdef,
+                  sizeof(*cdef_ctxt->row_cdef) * (nhfb + 2) * 2, EB_N_PTR);
+
+    for (int plane = 0; plane < num_planes; plane++) {
+        EB_MALLOC_DEC(uint16_t *, cdef_ctxt->linebuf[plane],
+            sizeof(uint16_t) * CDEF_VBORDER * stride, EB_N_PTR);
+        EB_MALLOC_DEC(uint16_t *, cdef_ctxt->colbuf[plane],
+            sizeof(uint16_t) * ((CDEF_BLOCKSIZE << MI_SIZE_LOG2) +
+            2 * CDEF_VBORDER) * CDEF_HBORDER, EB_N_PTR);
+    }
+
+    return return_error;
+}
+
+/* Decoder threads, created after all the ctxts they use */
+static EbErrorType init_tile_threads(EbDecHandle  *dec_handle_ptr) {
+    EbErrorType return_error = EB_ErrorNone;
+    DecPostFilterJob *post_filter_job = &dec_handle_ptr->post_filter_job;
+    const int32_t sb_rows = dec_handle_ptr->master_frame_buf.sb_rows;
+    const int32_t sb_cols = dec_handle_ptr->master_frame_buf.sb_cols;
+
+    EB_MALLOC_DEC(DecTileJob*, dec_handle_ptr->tile_jobs,
+        MAX_TILE_ROWS * MAX_TILE_COLS * sizeof(DecTileJob), EB_N_PTR);
+    dec_handle_ptr->num_tile_jobs = 0;
+    dec_handle_ptr->next_tile_job = 0;
+
+    /* SB row dependencies of the post filters */
+    EB_MALLOC_DEC(EbHandle*, post_filter_job->lf_row_semaphores,
+        sb_rows * sizeof(EbHandle), EB_N_PTR);
+    EB_MALLOC_DEC(EbHandle*, post_filter_job->pf_row_semaphores,
+        sb_rows * sizeof(EbHandle), EB_N_PTR);
+    for (int32_t sb_row = 0; sb_row < sb_rows; sb_row++) {
+        EB_CREATE_SEMAPHORE_DEC(post_filter_job->lf_row_semaphores[sb_row], 0,
+            sb_cols);
+        EB_CREATE_SEMAPHORE_DEC(post_filter_job->pf_row_semaphores[sb_row], 0,
+            1);
+    }
+    post_filter_job->next_sb_row = 0;
+
+    if (dec_handle_ptr->num_threads == 1)
+        return return_error;
+
+    EB_CREATE_SEMAPHORE_DEC(dec_handle_ptr->thread_start_semaphore, 0,
+        dec_handle_ptr->num_threads);
+    EB_CREATE_SEMAPHORE_DEC(dec_handle_ptr->thread_done_semaphore, 0,
+        dec_handle_ptr->num_threads);
+
+    /* ctxt 0 is used by the calling thread */
+    for (int32_t thread_idx = 1; thread_idx < dec_handle_ptr->num_threads; thread_idx++) {
+        EbHandle dec_thread;
+        EB_CREATE_THREAD_DEC(dec_thread, dec_thread_kernel,
+            (ParseCtxt*)dec_handle_ptr->pv_parse_ctxt + thread_idx);
+    }
+
+    return return_error;
+}
+
+/* Ctxts, frame buffers and tile threads decoding the frames of a handle */
+static EbErrorType init_decode_ctxts(EbDecHandle  *dec_handle_ptr) {
+    EbErrorType return_error = EB_ErrorNone;
 
     return_error |= init_parse_context(dec_handle_ptr);
 
@@ -496,11 +599,92 @@ EbErrorType dec_mem_init(EbDecHandle  *dec_handle_ptr) {
 
     return_error |= init_lf_ctxt(dec_handle_ptr);
 
+    return_error |= init_cdef_ctxt(dec_handle_ptr);
+
     return_error |= init_lr_ctxt(dec_handle_ptr);
 
     /* init frame buffers */
     return_error |= init_master_frame_ctxt(dec_handle_ptr);
 
+    return_error |= init_tile_threads(dec_handle_ptr);
+
+    return return_error;
+}
+
+/* Frame parallel decoding : num_frms_prll frame ctxts, handles of their own
+   sharing the picture manager of the main handle, each with its decoding
+   ctxts, tile threads and frame thread */
+static EbErrorType init_frame_threads(EbDecHandle  *dec_handle_ptr) {
+    EbErrorType return_error = EB_ErrorNone;
+    DecFrameThrdCtxt *frame_thrd_ctxt =
+        (DecFrameThrdCtxt *)dec_handle_ptr->pv_frame_thrd_ctxt;
+
+    /* The frames waiting for output are kept over a new sequence */
+    if (frame_thrd_ctxt == NULL) {
+        EB_MALLOC_DEC(DecFrameThrdCtxt*, frame_thrd_ctxt,
+            sizeof(DecFrameThrdCtxt), EB_N_PTR);
+        frame_thrd_ctxt->output_head = 0;
+        frame_thrd_ctxt->num_output_pics = 0;
+        frame_thrd_ctxt->flushing = 0;
+        dec_handle_ptr->pv_frame_thrd_ctxt = frame_thrd_ctxt;
+    }
+    frame_thrd_ctxt->num_frame_jobs = dec_handle_ptr->num_frms_prll;
+    frame_thrd_ctxt->next_frame_job = 0;
+    frame_thrd_ctxt->cur_frame_job = NULL;
+    frame_thrd_ctxt->output_pending = 0;
+
+    EB_MALLOC_DEC(DecFrameJob*, frame_thrd_ctxt->frame_jobs,
+        frame_thrd_ctxt->num_frame_jobs * sizeof(DecFrameJob), EB_N_PTR);
+
+    for (int32_t i = 0; i < frame_thrd_ctxt->num_frame_jobs; i++) {
+        DecFrameJob *frame_job = &frame_thrd_ctxt->frame_jobs[i];
+        EbDecHandle *frame_ctxt;
+
+        EB_MALLOC_DEC(EbDecHandle*, frame_ctxt, sizeof(EbDecHandle), EB_N_PTR);
+        *frame_ctxt = *dec_handle_ptr;
+        frame_ctxt->num_frms_prll = 1;
+        frame_ctxt->pv_frame_thrd_ctxt = NULL;
+        frame_ctxt->pv_frame_job = frame_job;
+
+        frame_job->dec_handle_ptr = frame_ctxt;
+        frame_job->in_flight = 0;
+        frame_job->status = EB_ErrorNone;
+        frame_job->data = NULL;
+        frame_job->data_alloc_size = 0;
+        frame_job->src_data = NULL;
+        frame_job->src_data_size = 0;
+        frame_job->num_held_pic_bufs = 0;
+        frame_job->rows_published = 0;
+
+        return_error |= init_decode_ctxts(frame_ctxt);
+
+        EB_CREATE_SEMAPHORE_DEC(frame_job->start_semaphore, 0, 1);
+        EB_CREATE_SEMAPHORE_DEC(frame_job->done_semaphore, 0, 1);
+        EB_CREATE_THREAD_DEC(frame_job->frame_thread, dec_frame_thread_kernel,
+            frame_job);
+    }
+
+    return return_error;
+}
+
+EbErrorType dec_mem_init(EbDecHandle  *dec_handle_ptr) {
+    EbErrorType return_error = EB_ErrorNone;
+
+    if (0 == dec_handle_ptr->seq_header_done)
+        return EB_ErrorNone;
+
+    /* The frames in flight finish with the ctxts of the previous sequence */
+    if (dec_handle_ptr->pv_frame_thrd_ctxt)
+        return_error |= dec_frame_thrd_wait_all(dec_handle_ptr);
+
+    /* init module ctxts */
+    return_error |= dec_pic_mgr_init(dec_handle_ptr);
+
+    if (dec_handle_ptr->num_frms_prll > 1)
+        return_error |= init_frame_threads(dec_handle_ptr);
+    else
+        return_error |= init_decode_ctxts(dec_handle_ptr);
+
     /* Initialize the references to NULL */
     for (int i = 0; i < REF_FRAMES; i++) {
         dec_handle_ptr->ref_frame_map[i] = NULL;
@@ -34,11 +34,11 @@ void update_nbrs_after_sb(FrameMiMap *frame_mi_map, int32_t sb_col) {
 }
 #endif
 
-void update_block_nbrs(EbDecHandle *dec_handle,
+void update_block_nbrs(ParseCtxt *parse_ctx,
     int mi_row, int mi_col,
     BlockSize subsize)
 {
-    ParseCtxt   *parse_ctx = (ParseCtxt*)dec_handle->pv_parse_ctxt;
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     FrameMiMap  *frame_mi_map = &dec_handle->master_frame_buf.frame_mi_map;
 
     int32_t offset = parse_ctx->cur_mode_info_cnt;
@@ -238,11 +238,11 @@ static void read_palette_colors_uv(ParseCtxt *parse_ctx, PartitionInfo_t *pi,
     }
 }
 
-void palette_mode_info(EbDecHandle *dec_handle, PartitionInfo_t *pi,
+void palette_mode_info(ParseCtxt *parse_ctx, PartitionInfo_t *pi,
     int mi_row, int mi_col, SvtReader *r)
 {
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
-    FRAME_CONTEXT *frm_ctx = &parse_ctxt->cur_tile_ctx;
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
+    FRAME_CONTEXT *frm_ctx = &parse_ctx->cur_tile_ctx;
     EbColorConfig *color_info = &dec_handle->seq_header.color_config;
     const int num_planes = color_info->mono_chrome ? 1 : MAX_MB_PLANE;
     BlockModeInfo *const mbmi = pi->mi;
@@ -261,7 +261,7 @@ void palette_mode_info(EbDecHandle *dec_handle, PartitionInfo_t *pi,
                 svt_read_symbol(r, frm_ctx->palette_y_size_cdf[bsize_ctx],
                     PALETTE_SIZES, ACCT_STR) +
                 2;
-            read_palette_colors_y(parse_ctxt, pi, dec_handle->seq_header.
+            read_palette_colors_y(parse_ctx, pi, dec_handle->seq_header.
                 color_config.bit_depth, mi_row, mi_col, r);
         }
     }
@@ -277,7 +277,7 @@ void palette_mode_info(EbDecHandle *dec_handle, PartitionInfo_t *pi,
                 svt_read_symbol(r, frm_ctx->palette_uv_size_cdf[bsize_ctx],
                     PALETTE_SIZES, ACCT_STR) +
                 2;
-            read_palette_colors_uv(parse_ctxt, pi, dec_handle->
+            read_palette_colors_uv(parse_ctx, pi, dec_handle->
                 seq_header.color_config.bit_depth, mi_row, mi_col, r);
         }
     }
@@ -296,14 +296,14 @@ static INLINE int filter_intra_allowed(EbDecHandle *dec_handle, const BlockModeI
         filter_intra_allowed_bsize(dec_handle, mbmi->sb_type);
 }
 
-void filter_intra_mode_info(EbDecHandle *dec_handle,
+void filter_intra_mode_info(ParseCtxt *parse_ctx,
     PartitionInfo_t *xd, SvtReader *r)
 {
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     BlockModeInfo *const mbmi = xd->mi;
     FilterIntraModeInfo_t *filter_intra_mode_info =
         &mbmi->filter_intra_mode_info;
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
-    FRAME_CONTEXT *frm_ctx = &parse_ctxt->cur_tile_ctx;
+    FRAME_CONTEXT *frm_ctx = &parse_ctx->cur_tile_ctx;
 
     if (filter_intra_allowed(dec_handle, mbmi)) {
         filter_intra_mode_info->use_filter_intra = svt_read_symbol(
@@ -369,16 +369,16 @@ void read_cdef(EbDecHandle *dec_handle, SvtReader *r, PartitionInfo_t *xd,
     }
 }
 
-void read_delta_qindex(EbDecHandle *dec_handle, SvtReader *r,
+void read_delta_qindex(ParseCtxt *parse_ctx, SvtReader *r,
     BlockModeInfo *const mbmi, int32_t *cur_qind, int32_t *sb_delta_q)
 {
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     int sign, abs, reduced_delta_qindex = 0;
     BlockSize bsize = mbmi->sb_type;
     DeltaQParams    *delta_q_params = &dec_handle->frame_header.delta_q_params;
 
     if ((bsize != dec_handle->seq_header.sb_size || mbmi->skip == 0)) {
-        ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
-        abs = svt_read_symbol(r, parse_ctxt->cur_tile_ctx.delta_q_cdf,
+        abs = svt_read_symbol(r, parse_ctx->cur_tile_ctx.delta_q_cdf,
             DELTA_Q_PROBS + 1, ACCT_STR);
 
         if (abs == DELTA_Q_SMALL) {
@@ -428,10 +428,10 @@ int read_delta_lflevel(EbDecHandle *dec_handle, SvtReader *r,
     return tmp_lvl;
 }
 
-int read_skip(EbDecHandle *dec_handle, PartitionInfo_t *xd,
+int read_skip(ParseCtxt *parse_ctx, PartitionInfo_t *xd,
     int segment_id, SvtReader *r)
 {
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     //uint8_t segIdPreSkip = dec_handle->frame_header.segmentation_params.seg_id_pre_skip;
     if (seg_feature_active(&dec_handle->frame_header.segmentation_params,
         segment_id, SEG_LVL_SKIP))
@@ -442,13 +442,14 @@ int read_skip(EbDecHandle *dec_handle, PartitionInfo_t *xd,
         const int above_skip = xd->above_mbmi ? xd->above_mbmi->skip : 0;
         const int left_skip = xd->left_mbmi ? xd->left_mbmi->skip : 0;
         int ctx = above_skip + left_skip;
-        return svt_read_symbol(r, parse_ctxt->cur_tile_ctx.skip_cdfs[ctx], 2, ACCT_STR);
+        return svt_read_symbol(r, parse_ctx->cur_tile_ctx.skip_cdfs[ctx], 2, ACCT_STR);
     }
 }
 
-int read_skip_mode(EbDecHandle *dec_handle, PartitionInfo_t *xd, int segment_id,
+int read_skip_mode(ParseCtxt *parse_ctx, PartitionInfo_t *xd, int segment_id,
     SvtReader *r)
 {
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     SegmentationParams *seg = &dec_handle->frame_header.segmentation_params;
     if (seg_feature_active(seg, segment_id, SEG_LVL_SKIP) ||
         seg_feature_active(seg, segment_id, SEG_LVL_REF_FRAME) ||
@@ -459,34 +460,33 @@ int read_skip_mode(EbDecHandle *dec_handle, PartitionInfo_t *xd, int segment_id,
     {
         return 0;
     }
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
     int above_skip_mode = xd->above_mbmi ? xd->above_mbmi->skip_mode : 0;
     int left_skip_mode = xd->left_mbmi ? xd->left_mbmi->skip_mode : 0;
     int ctx = above_skip_mode + left_skip_mode;
-    return svt_read_symbol(r, parse_ctxt->cur_tile_ctx.skip_mode_cdfs[ctx], 2, ACCT_STR);
+    return svt_read_symbol(r, parse_ctx->cur_tile_ctx.skip_mode_cdfs[ctx], 2, ACCT_STR);
 }
 
 // If delta q is present, reads delta_q index.
 // Also reads delta_q loop filter levels, if present.
-static void read_delta_params(EbDecHandle *dec_handle, SvtReader *r,
+static void read_delta_params(ParseCtxt *parse_ctx, SvtReader *r,
     PartitionInfo_t *xd)
 {
-    ParseCtxt       *parse_ctxt     = (ParseCtxt *)dec_handle->pv_parse_ctxt;
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     DeltaQParams    *delta_q_params = &dec_handle->frame_header.delta_q_params;
     DeltaLFParams   *delta_lf_params = &dec_handle->frame_header.delta_lf_params;
     SBInfo          *sb_info = xd->sb_info;
     BlockModeInfo *const mbmi = &xd->mi[0];
 
-    if (!parse_ctxt->read_deltas)
+    if (!parse_ctx->read_deltas)
         return;
 
     if (delta_q_params->delta_q_present) {
-        read_delta_qindex(dec_handle, r, mbmi,
-            &parse_ctxt->parse_nbr4x4_ctxt.cur_q_ind, &sb_info->sb_delta_q[0]);
+        read_delta_qindex(parse_ctx, r, mbmi,
+            &parse_ctx->parse_nbr4x4_ctxt.cur_q_ind, &sb_info->sb_delta_q[0]);
     }
 
 
-    FRAME_CONTEXT *const ec_ctx = &parse_ctxt->cur_tile_ctx;
+    FRAME_CONTEXT *const ec_ctx = &parse_ctx->cur_tile_ctx;
 
     int frame_lf_count = 1;
     if (delta_lf_params->delta_lf_present) {
@@ -497,17 +497,17 @@ static void read_delta_params(EbDecHandle *dec_handle, SvtReader *r,
                 num_planes > 1 ? FRAME_LF_COUNT : FRAME_LF_COUNT - 2;
 
             for (int lf_id = 0; lf_id < frame_lf_count; ++lf_id) {
-                parse_ctxt->parse_nbr4x4_ctxt.delta_lf[lf_id] =
+                parse_ctx->parse_nbr4x4_ctxt.delta_lf[lf_id] =
                     sb_info->sb_delta_lf[lf_id] = read_delta_lflevel(dec_handle, r,
                         ec_ctx->delta_lf_multi_cdf[lf_id], mbmi,
-                        parse_ctxt->parse_nbr4x4_ctxt.delta_lf[lf_id]);
+                        parse_ctx->parse_nbr4x4_ctxt.delta_lf[lf_id]);
             }
         }
         else {
-            parse_ctxt->parse_nbr4x4_ctxt.delta_lf[0] =
+            parse_ctx->parse_nbr4x4_ctxt.delta_lf[0] =
                 sb_info->sb_delta_lf[0] = read_delta_lflevel(dec_handle, r,
                     ec_ctx->delta_lf_cdf, mbmi,
-                    parse_ctxt->parse_nbr4x4_ctxt.delta_lf[0]);
+                    parse_ctx->parse_nbr4x4_ctxt.delta_lf[0]);
         }
     }
 }
@@ -540,11 +540,11 @@ int get_segment_id(FrameHeader *frm_info, uint8_t *segment_ids,
     return segment_id;
 }
 
-static int read_segment_id(EbDecHandle *dec_handle, PartitionInfo_t *xd, uint32_t mi_row,
+static int read_segment_id(ParseCtxt *parse_ctx, PartitionInfo_t *xd, uint32_t mi_row,
     uint32_t mi_col, SvtReader *r, int skip)
 {
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     int cdf_num = 0;
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
 
     int prev_ul = -1;  // top left segment_id
     int prev_l = -1;   // left segment_id
@@ -584,7 +584,7 @@ static int read_segment_id(EbDecHandle *dec_handle, PartitionInfo_t *xd, uint32_
 
     if (skip) return pred;
 
-    FRAME_CONTEXT *ec_ctx = &parse_ctxt->cur_tile_ctx;
+    FRAME_CONTEXT *ec_ctx = &parse_ctx->cur_tile_ctx;
     SegmentationParams *seg = &(dec_handle->frame_header.segmentation_params);
 
     struct segmentation_probs *segp = &ec_ctx->seg;
@@ -594,9 +594,10 @@ static int read_segment_id(EbDecHandle *dec_handle, PartitionInfo_t *xd, uint32_
     return neg_deinterleave(coded_id, pred, seg->last_active_seg_id + 1);
 }
 
-int intra_segment_id(EbDecHandle *dec_handle, PartitionInfo_t *xd, int mi_row, int mi_col,
+int intra_segment_id(ParseCtxt *parse_ctx, PartitionInfo_t *xd, int mi_row, int mi_col,
     int bsize, SvtReader *r, int skip)
 {
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     SegmentationParams *seg = &dec_handle->frame_header.segmentation_params;
     int segment_id = 0;
 
@@ -606,7 +607,7 @@ int intra_segment_id(EbDecHandle *dec_handle, PartitionInfo_t *xd, int mi_row, i
         const int bh = mi_size_high[bsize];
         const int x_mis = AOMMIN((int32_t)(dec_handle->frame_header.mi_cols - mi_col), bw);
         const int y_mis = AOMMIN((int32_t)(dec_handle->frame_header.mi_rows - mi_row), bh);
-        segment_id = read_segment_id(dec_handle, xd, mi_row, mi_col, r, skip);
+        segment_id = read_segment_id(parse_ctx, xd, mi_row, mi_col, r, skip);
         set_segment_id(dec_handle, mi_offset, x_mis, y_mis, segment_id);
     }
     return segment_id;
@@ -637,11 +638,10 @@ PredictionMode getMode(PredictionMode yMode, int refList) {
     return compMode;
 }
 
-static INLINE void update_palette_context(EbDecHandle *dec_handle,
+static INLINE void update_palette_context(ParseCtxt *parse_ctx,
     int mi_row, int mi_col, BlockModeInfo *mi)
 {
     BlockSize bsize = mi->sb_type;
-    ParseCtxt *parse_ctx = (ParseCtxt *)dec_handle->pv_parse_ctxt;
     ParseNbr4x4Ctxt *ngr_ctx = &parse_ctx->parse_nbr4x4_ctxt;
     const int bw = mi_size_wide[bsize];
     const int bh = mi_size_high[bsize];
@@ -675,10 +675,10 @@ static INLINE AomCdfProb *get_y_mode_cdf(FRAME_CONTEXT *tile_ctx,
     return tile_ctx->kf_y_cdf[above_ctx][left_ctx];
 }
 
-void intra_frame_mode_info(EbDecHandle *dec_handle, PartitionInfo_t *xd,
+void intra_frame_mode_info(ParseCtxt *parse_ctx, PartitionInfo_t *xd,
     int mi_row, int mi_col, SvtReader *r, int8_t *cdef_strength)
 {
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     BlockModeInfo *const mbmi = xd->mi;
     const BlockModeInfo *above_mi = xd->above_mbmi;
     const BlockModeInfo *left_mi = xd->left_mbmi;
@@ -692,20 +692,20 @@ void intra_frame_mode_info(EbDecHandle *dec_handle, PartitionInfo_t *xd,
 
     if (seg->seg_id_pre_skip) {
         mbmi->segment_id =
-            intra_segment_id(dec_handle, xd, mi_row, mi_col, bsize, r, 0);
+            intra_segment_id(parse_ctx, xd, mi_row, mi_col, bsize, r, 0);
     }
 
-    mbmi->skip = read_skip(dec_handle, xd, mbmi->segment_id, r);
+    mbmi->skip = read_skip(parse_ctx, xd, mbmi->segment_id, r);
 
     if (!seg->seg_id_pre_skip) {
         mbmi->segment_id =
-            intra_segment_id(dec_handle, xd, mi_row, mi_col, bsize, r, mbmi->skip);
+            intra_segment_id(parse_ctx, xd, mi_row, mi_col, bsize, r, mbmi->skip);
     }
 
     read_cdef(dec_handle, r, xd, mi_col, mi_row, cdef_strength);
 
-    read_delta_params(dec_handle, r, xd);
-    parse_ctxt->read_deltas = 0;
+    read_delta_params(parse_ctx, r, xd);
+    parse_ctx->read_deltas = 0;
 
     mbmi->ref_frame[0] = INTRA_FRAME;
     mbmi->ref_frame[1] = NONE_FRAME;
@@ -715,7 +715,7 @@ void intra_frame_mode_info(EbDecHandle *dec_handle, PartitionInfo_t *xd,
 
     mbmi->use_intrabc = 0;
     if (allow_intrabc(dec_handle))
-        mbmi->use_intrabc = svt_read_symbol(r, parse_ctxt->cur_tile_ctx.intrabc_cdf,
+        mbmi->use_intrabc = svt_read_symbol(r, parse_ctx->cur_tile_ctx.intrabc_cdf,
             2, ACCT_STR);
 
     mbmi->inter_inter_compound.type = COMPOUND_AVERAGE;
@@ -727,41 +727,41 @@ void intra_frame_mode_info(EbDecHandle *dec_handle, PartitionInfo_t *xd,
         mbmi->compound_mode = COMPOUND_AVERAGE;
         mbmi->interp_filters = av1_broadcast_interp_filter(BILINEAR);
         IntMv global_mvs[2];
-        av1_find_mv_refs(dec_handle, xd, INTRA_FRAME, xd->ref_mv_stack,
+        av1_find_mv_refs(parse_ctx, xd, INTRA_FRAME, xd->ref_mv_stack,
             ref_mvs, global_mvs, mi_row, mi_col,
             inter_mode_ctx, mv_cnt);
 
-        assign_intrabc_mv(dec_handle, ref_mvs, xd, mi_row, mi_col, r);
+        assign_intrabc_mv(parse_ctx, ref_mvs, xd, mi_row, mi_col, r);
     }
     else {
-        AomCdfProb *y_mode_cdf = get_y_mode_cdf(&parse_ctxt->cur_tile_ctx,
+        AomCdfProb *y_mode_cdf = get_y_mode_cdf(&parse_ctx->cur_tile_ctx,
             above_mi, left_mi);
         mbmi->mode = read_intra_mode(r, y_mode_cdf);
         mbmi->angle_delta[PLANE_TYPE_Y] = intra_angle_info(r,
-            &parse_ctxt->cur_tile_ctx.angle_delta_cdf[mbmi->mode - V_PRED][0],
+            &parse_ctx->cur_tile_ctx.angle_delta_cdf[mbmi->mode - V_PRED][0],
             mbmi->mode, bsize);
         const int has_chroma =
                 is_chroma_reference(mi_row, mi_col, bsize,
                     color_config.subsampling_x, color_config.subsampling_y);
         if (has_chroma && !color_config.mono_chrome) {
-            mbmi->uv_mode = read_intra_mode_uv(&parse_ctxt->cur_tile_ctx,
+            mbmi->uv_mode = read_intra_mode_uv(&parse_ctx->cur_tile_ctx,
                 r, is_cfl_allowed(xd, &color_config, lossless_array), mbmi->mode);
             if (mbmi->uv_mode == UV_CFL_PRED) {
-                mbmi->cfl_alpha_idx = read_cfl_alphas(&parse_ctxt->cur_tile_ctx,
+                mbmi->cfl_alpha_idx = read_cfl_alphas(&parse_ctx->cur_tile_ctx,
                     r, &mbmi->cfl_alpha_signs);
             }
             mbmi->angle_delta[PLANE_TYPE_UV] = intra_angle_info(r,
-                &parse_ctxt->cur_tile_ctx.angle_delta_cdf[mbmi->uv_mode - V_PRED][0],
+                &parse_ctx->cur_tile_ctx.angle_delta_cdf[mbmi->uv_mode - V_PRED][0],
                 get_uv_mode(mbmi->uv_mode), bsize);
         }
         else
             mbmi->uv_mode = UV_DC_PRED;
 
         if (allow_palette(dec_handle->frame_header.allow_screen_content_tools, bsize)) {
-            palette_mode_info(dec_handle, xd, mi_row, mi_col, r);
-            update_palette_context(dec_handle, mi_row, mi_col, mbmi);
+            palette_mode_info(parse_ctx, xd, mi_row, mi_col, r);
+            update_palette_context(parse_ctx, mi_row, mi_col, mbmi);
         }
-        filter_intra_mode_info(dec_handle, xd, r);
+        filter_intra_mode_info(parse_ctx, xd, r);
     }
     free(mv_cnt);
 }
@@ -799,13 +799,13 @@ static void copy_segment_id(EbDecHandle *dec_handle,
         }
 }
 
-int read_inter_segment_id(EbDecHandle *dec_handle, PartitionInfo_t *xd,
+int read_inter_segment_id(ParseCtxt *parse_ctx, PartitionInfo_t *xd,
                         uint32_t mi_row, uint32_t mi_col, int preskip, SvtReader *r)
 {
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     SegmentationParams *seg = &dec_handle->frame_header.segmentation_params;
     BlockModeInfo *const mbmi = xd->mi;
     FrameHeader *frame_header = &dec_handle->frame_header;
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
     const int mi_offset = mi_row * frame_header->mi_cols + mi_col;
     const uint32_t bw = mi_size_wide[mbmi->sb_type];
     const uint32_t bh = mi_size_high[mbmi->sb_type];
@@ -837,9 +837,9 @@ int read_inter_segment_id(EbDecHandle *dec_handle, PartitionInfo_t *xd,
     else {
         if (mbmi->skip) {
             mbmi->seg_id_predicted = 0;
-            update_seg_ctx(&parse_ctxt->parse_nbr4x4_ctxt,
+            update_seg_ctx(&parse_ctx->parse_nbr4x4_ctxt,
                 mi_col, bw, bh, mbmi->seg_id_predicted);
-            segment_id = read_segment_id(dec_handle, xd, mi_row, mi_col, r, 1);
+            segment_id = read_segment_id(parse_ctx, xd, mi_row, mi_col, r, 1);
             set_segment_id(dec_handle, mi_offset, x_mis, y_mis, segment_id);
             return segment_id;
         }
@@ -847,20 +847,19 @@ int read_inter_segment_id(EbDecHandle *dec_handle, PartitionInfo_t *xd,
 
     if (seg->segmentation_temporal_update) {
         const int ctx = get_pred_context_seg_id(xd);
-        ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
-        struct segmentation_probs *const segp = &parse_ctxt->cur_tile_ctx.seg;
+        struct segmentation_probs *const segp = &parse_ctx->cur_tile_ctx.seg;
         mbmi->seg_id_predicted = svt_read_symbol(r, segp->pred_cdf[ctx], 2, ACCT_STR);
         if (mbmi->seg_id_predicted) {
             segment_id = prev_buf->segment_maps ? get_segment_id(frame_header,
                 prev_buf->segment_maps, mbmi->sb_type, mi_row, mi_col) : 0;
         }
         else
-            segment_id = read_segment_id(dec_handle, xd, mi_row, mi_col, r, 0);
-        update_seg_ctx(&parse_ctxt->parse_nbr4x4_ctxt,
+            segment_id = read_segment_id(parse_ctx, xd, mi_row, mi_col, r, 0);
+        update_seg_ctx(&parse_ctx->parse_nbr4x4_ctxt,
             mi_col, bw, bh, mbmi->seg_id_predicted);
     }
     else
-        segment_id = read_segment_id(dec_handle, xd, mi_row, mi_col, r, 0);
+        segment_id = read_segment_id(parse_ctx, xd, mi_row, mi_col, r, 0);
     set_segment_id(dec_handle, mi_offset, x_mis, y_mis, segment_id);
 
     return segment_id;
@@ -1021,6 +1020,10 @@ void svt_setup_motion_field(EbDecHandle *dec_handle) {
             dec_handle->master_frame_buf.ref_frame_side[ref_frame] = -1;
     }
 
+    /* The projected MVs are only read with use_ref_frame_mvs, the MVs of the
+       reference frames may not be decoded yet otherwise */
+    if (!dec_handle->frame_header.use_ref_frame_mvs) return;
+
     int ref_stamp = MFMV_STACK_SIZE - 1;
 
 
@@ -1057,10 +1060,10 @@ void svt_setup_motion_field(EbDecHandle *dec_handle) {
     if (ref_stamp >= 0) motion_field_projection(dec_handle, LAST2_FRAME, 2);
 }
 
-void intra_block_mode_info(EbDecHandle *dec_handle, int mi_row,
+void intra_block_mode_info(ParseCtxt *parse_ctx, int mi_row,
     int mi_col, PartitionInfo_t* xd, SvtReader *r)
 {
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     BlockModeInfo *mbmi = xd->mi;
     const BlockSize bsize = mbmi->sb_type;
     mbmi->ref_frame[0] = INTRA_FRAME;
@@ -1069,10 +1072,10 @@ void intra_block_mode_info(EbDecHandle *dec_handle, int mi_row,
     EbColorConfig *color_cfg = &dec_handle->seq_header.color_config;
     uint8_t     *lossless_array = &dec_handle->frame_header.lossless_array[0];
 
-    mbmi->mode = read_intra_mode(r, parse_ctxt->cur_tile_ctx.y_mode_cdf[size_group_lookup[bsize]]);
+    mbmi->mode = read_intra_mode(r, parse_ctx->cur_tile_ctx.y_mode_cdf[size_group_lookup[bsize]]);
 
     mbmi->angle_delta[PLANE_TYPE_Y] =
-        intra_angle_info(r, &parse_ctxt->cur_tile_ctx.
+        intra_angle_info(r, &parse_ctx->cur_tile_ctx.
             angle_delta_cdf[mbmi->mode - V_PRED][0], mbmi->mode, bsize);
     const int has_chroma =
         is_chroma_reference(mi_row, mi_col, bsize, color_cfg->subsampling_x,
@@ -1080,14 +1083,14 @@ void intra_block_mode_info(EbDecHandle *dec_handle, int mi_row,
     xd->has_chroma = has_chroma;
     if (has_chroma && !color_cfg->mono_chrome) {
         mbmi->uv_mode =
-            read_intra_mode_uv(&parse_ctxt->cur_tile_ctx, r,
+            read_intra_mode_uv(&parse_ctx->cur_tile_ctx, r,
                 is_cfl_allowed(xd, color_cfg, lossless_array), mbmi->mode);
         if (mbmi->uv_mode == UV_CFL_PRED) {
             mbmi->cfl_alpha_idx =
-                read_cfl_alphas(&parse_ctxt->cur_tile_ctx, r, &mbmi->cfl_alpha_signs);
+                read_cfl_alphas(&parse_ctx->cur_tile_ctx, r, &mbmi->cfl_alpha_signs);
         }
         mbmi->angle_delta[PLANE_TYPE_UV] = intra_angle_info(r,
-            &parse_ctxt->cur_tile_ctx.angle_delta_cdf[mbmi->uv_mode - V_PRED][0],
+            &parse_ctx->cur_tile_ctx.angle_delta_cdf[mbmi->uv_mode - V_PRED][0],
             get_uv_mode(mbmi->uv_mode), bsize);
     }
 
@@ -1095,17 +1098,17 @@ void intra_block_mode_info(EbDecHandle *dec_handle, int mi_row,
     mbmi->palette_size[1] = 0;
 
     if (allow_palette(dec_handle->frame_header.allow_screen_content_tools, bsize)) {
-        palette_mode_info(dec_handle, xd, mi_row, mi_col, r);
-        update_palette_context(dec_handle, mi_row, mi_col, mbmi);
+        palette_mode_info(parse_ctx, xd, mi_row, mi_col, r);
+        update_palette_context(parse_ctx, mi_row, mi_col, mbmi);
     }
 
-    filter_intra_mode_info(dec_handle, xd, r);
+    filter_intra_mode_info(parse_ctx, xd, r);
 }
 
-int read_is_inter(EbDecHandle* dec_handle, PartitionInfo_t * xd,
+int read_is_inter(ParseCtxt *parse_ctx, PartitionInfo_t * xd,
     int segment_id, SvtReader *r)
 {
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     int is_inter = 0;
     SegmentationParams *seg_params = &dec_handle->frame_header.segmentation_params;
     if (seg_feature_active(seg_params, segment_id, SEG_LVL_REF_FRAME))
@@ -1114,15 +1117,16 @@ int read_is_inter(EbDecHandle* dec_handle, PartitionInfo_t * xd,
         is_inter = 1;
     else {
         const int ctx = get_intra_inter_context(xd);
-        is_inter = svt_read_symbol(r, parse_ctxt->cur_tile_ctx.
+        is_inter = svt_read_symbol(r, parse_ctx->cur_tile_ctx.
             intra_inter_cdf[ctx], 2, ACCT_STR);
     }
     return is_inter;
 }
 
-void inter_frame_mode_info(EbDecHandle *dec_handle, PartitionInfo_t * pi,
+void inter_frame_mode_info(ParseCtxt *parse_ctx, PartitionInfo_t * pi,
     uint32_t mi_row, uint32_t mi_col, SvtReader *r, int8_t *cdef_strength)
 {
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     BlockModeInfo *mbmi = pi->mi;
     mbmi->use_intrabc = 0;
     int inter_block = 1;
@@ -1132,33 +1136,30 @@ void inter_frame_mode_info(EbDecHandle *dec_handle, PartitionInfo_t * pi,
 
     mbmi->inter_inter_compound.type = COMPOUND_AVERAGE;
 
-    mbmi->segment_id = read_inter_segment_id(dec_handle, pi, mi_row, mi_col, 1, r);
+    mbmi->segment_id = read_inter_segment_id(parse_ctx, pi, mi_row, mi_col, 1, r);
 
-    mbmi->skip_mode = read_skip_mode(dec_handle, pi, mbmi->segment_id, r);
+    mbmi->skip_mode = read_skip_mode(parse_ctx, pi, mbmi->segment_id, r);
 
     if (mbmi->skip_mode)
         mbmi->skip = 1;
     else
-        mbmi->skip = read_skip(dec_handle, pi, mbmi->segment_id, r);
+        mbmi->skip = read_skip(parse_ctx, pi, mbmi->segment_id, r);
 
     if (!dec_handle->frame_header.segmentation_params.seg_id_pre_skip)
-        mbmi->segment_id = read_inter_segment_id(dec_handle, pi, mi_row, mi_col, 0, r);
+        mbmi->segment_id = read_inter_segment_id(parse_ctx, pi, mi_row, mi_col, 0, r);
 
-    dec_handle->frame_header.coded_lossless = dec_handle->frame_header.
-        lossless_array[mbmi->segment_id];
     read_cdef(dec_handle, r, pi, mi_col, mi_row, cdef_strength);
 
-    read_delta_params(dec_handle, r, pi);
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
-    parse_ctxt->read_deltas = 0;
+    read_delta_params(parse_ctx, r, pi);
+    parse_ctx->read_deltas = 0;
 
     if (!mbmi->skip_mode)
-        inter_block = read_is_inter(dec_handle, pi, mbmi->segment_id, r);
+        inter_block = read_is_inter(parse_ctx, pi, mbmi->segment_id, r);
 
     if (inter_block)
-        inter_block_mode_info(dec_handle, pi, mi_row, mi_col, r);
+        inter_block_mode_info(parse_ctx, pi, mi_row, mi_col, r);
     else
-        intra_block_mode_info(dec_handle, mi_row, mi_col, pi, r);
+        intra_block_mode_info(parse_ctx, mi_row, mi_col, pi, r);
 }
 
 static void intra_copy_frame_mvs(EbDecHandle *dec_handle, int mi_row, int mi_col,
@@ -1217,9 +1218,10 @@ void inter_copy_frame_mvs(EbDecHandle *dec_handle, BlockModeInfo *mi,
     }
 }
 
-void mode_info(EbDecHandle *dec_handle, PartitionInfo_t *part_info, uint32_t mi_row,
+void mode_info(ParseCtxt *parse_ctx, PartitionInfo_t *part_info, uint32_t mi_row,
     uint32_t mi_col, SvtReader *r, int8_t *cdef_strength)
 {
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     BlockModeInfo *mi = part_info->mi;
     FrameHeader *frame_info = &dec_handle->frame_header;
     //BlockSize bsize = mi->sb_type
@@ -1234,27 +1236,28 @@ void mode_info(EbDecHandle *dec_handle, PartitionInfo_t *part_info, uint32_t mi_
     if (frame_info->frame_type == KEY_FRAME ||
         frame_info->frame_type == INTRA_ONLY_FRAME)
     {
-        intra_frame_mode_info(dec_handle, part_info, mi_row, mi_col, r,
+        intra_frame_mode_info(parse_ctx, part_info, mi_row, mi_col, r,
             cdef_strength);
         intra_copy_frame_mvs(dec_handle, mi_row, mi_col, x_mis, y_mis);
     }
     else {
-        inter_frame_mode_info(dec_handle, part_info, mi_row, mi_col, r,
+        inter_frame_mode_info(parse_ctx, part_info, mi_row, mi_col, r,
             cdef_strength);
         inter_copy_frame_mvs(dec_handle, mi, mi_row, mi_col, x_mis, y_mis);
     }
 }
 
-TxSize read_tx_size(EbDecHandle *dec_handle, PartitionInfo_t *xd,
+TxSize read_tx_size(ParseCtxt *parse_ctx, PartitionInfo_t *xd,
                     int allow_select, SvtReader *r)
 {
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     BlockModeInfo *mbmi = xd->mi;
     const TxMode tx_mode = dec_handle->frame_header.tx_mode;
     const BlockSize bsize = xd->mi->sb_type;
     if (dec_handle->frame_header.lossless_array[mbmi->segment_id]) return TX_4X4;
 
     if (bsize > BLOCK_4X4 && allow_select && tx_mode == TX_MODE_SELECT) {
-        const TxSize coded_tx_size = read_selected_tx_size(xd, r, dec_handle);
+        const TxSize coded_tx_size = read_selected_tx_size(xd, r, parse_ctx);
         return coded_tx_size;
     }
     assert(IMPLIES(tx_mode == ONLY_4X4, bsize == BLOCK_4X4));
@@ -1263,10 +1266,10 @@ TxSize read_tx_size(EbDecHandle *dec_handle, PartitionInfo_t *xd,
 }
 
 /* Update Chroma Transform Info for Inter Case! */
-void update_chroma_trans_info(EbDecHandle *dec_handle,
+void update_chroma_trans_info(ParseCtxt *parse_ctx,
     PartitionInfo_t *part_info, BlockSize bsize)
 {
-    ParseCtxt *parse_ctx = (ParseCtxt*)dec_handle->pv_parse_ctxt;
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     BlockModeInfo *mbmi = part_info->mi;
     SBInfo     *sb_info = part_info->sb_info;
     EbColorConfig color_config = dec_handle->seq_header.color_config;
@@ -1365,11 +1368,10 @@ int get_txfm_split_ctx(PartitionInfo_t *pi, ParseCtxt *parse_ctx,
              (TX_SIZES - 1 - max_tx_size) * 6 + above + left);
 }
 
-void read_var_tx_size(EbDecHandle *dec_handle, PartitionInfo_t *pi, SvtReader *r,
+void read_var_tx_size(ParseCtxt *parse_ctx, PartitionInfo_t *pi, SvtReader *r,
     TxSize tx_size, int blk_row, int blk_col, int depth, int *num_luma_tus) {
 
     BlockModeInfo *mbmi = pi->mi;
-    ParseCtxt *parse_ctx = (ParseCtxt*)dec_handle->pv_parse_ctxt;
     const BlockSize bsize = mbmi->sb_type;
     const int max_blocks_high = max_block_high(pi, bsize, 0);
     const int max_blocks_wide = max_block_wide(pi, bsize, 0);
@@ -1398,7 +1400,7 @@ void read_var_tx_size(EbDecHandle *dec_handle, PartitionInfo_t *pi, SvtReader *r
 
         for (i = 0; i < h4; i += step_h)
             for (j = 0; j < w4; j += step_w)
-                read_var_tx_size(dec_handle, pi, r, sub_tx_sz, blk_row + i,
+                read_var_tx_size(parse_ctx, pi, r, sub_tx_sz, blk_row + i,
                                  blk_col + j, depth + 1, num_luma_tus);
     }
     else {
@@ -1413,10 +1415,10 @@ void read_var_tx_size(EbDecHandle *dec_handle, PartitionInfo_t *pi, SvtReader *r
 }
 
 /* Update Flat Transform Info for Intra Case! */
-void update_flat_trans_info(EbDecHandle *dec_handle, PartitionInfo_t *part_info,
+void update_flat_trans_info(ParseCtxt *parse_ctx, PartitionInfo_t *part_info,
                             BlockSize bsize, TxSize tx_size)
 {
-    ParseCtxt *parse_ctx = (ParseCtxt*)dec_handle->pv_parse_ctxt;
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     BlockModeInfo *mbmi = part_info->mi;
     SBInfo     *sb_info = part_info->sb_info;
     EbColorConfig color_config = dec_handle->seq_header.color_config;
@@ -1534,11 +1536,11 @@ static INLINE void set_txfm_ctxs(ParseCtxt *parse_ctx, TxSize tx_size,
     memset(left_ctx, tx_high, n4_h);
 }
 
-void read_block_tx_size(EbDecHandle *dec_handle, SvtReader *r,
+void read_block_tx_size(ParseCtxt *parse_ctx, SvtReader *r,
     PartitionInfo_t *part_info, BlockSize bsize)
 {
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     BlockModeInfo *mbmi = part_info->mi;
-    ParseCtxt *parse_ctx = (ParseCtxt*)dec_handle->pv_parse_ctxt;
     SBInfo     *sb_info = part_info->sb_info;
     int inter_block_tx = is_inter_block(mbmi);
 
@@ -1563,19 +1565,19 @@ void read_block_tx_size(EbDecHandle *dec_handle, SvtReader *r,
             for (int idx = 0; idx < width; idx += bw)
             {
                 num_luma_tus = 0;
-                read_var_tx_size(dec_handle, part_info, r, max_tx_size, idy, idx, 0, &num_luma_tus);
+                read_var_tx_size(parse_ctx, part_info, r, max_tx_size, idy, idx, 0, &num_luma_tus);
                 parse_ctx->num_tus[AOM_PLANE_Y][force_split_cnt] = num_luma_tus;
                 force_split_cnt++;
             }
 
         // Chroma trans_info update
-        update_chroma_trans_info(dec_handle, part_info, bsize);
+        update_chroma_trans_info(parse_ctx, part_info, bsize);
 
         mbmi->num_luma_tus = parse_ctx->cur_blk_luma_count;
         parse_ctx->first_luma_tu_offset += parse_ctx->cur_blk_luma_count;
     }
     else {
-        TxSize tx_size = read_tx_size(dec_handle, part_info,
+        TxSize tx_size = read_tx_size(parse_ctx, part_info,
             !mbmi->skip || !inter_block_tx, r);
 
         int b4_w = mi_size_wide[mbmi->sb_type];
@@ -1585,20 +1587,20 @@ void read_block_tx_size(EbDecHandle *dec_handle, SvtReader *r,
             mbmi->skip && is_inter_block(mbmi), part_info);
 
         /* Update Flat Transform Info */
-        update_flat_trans_info(dec_handle, part_info, bsize, tx_size);
+        update_flat_trans_info(parse_ctx, part_info, bsize, tx_size);
     }
 }
 
-void parse_transform_type(EbDecHandle *dec_handle, PartitionInfo_t *xd,
+void parse_transform_type(ParseCtxt *parse_ctx, PartitionInfo_t *xd,
      TxSize tx_size, SvtReader *r, TransformInfo_t *trans_info)
 {
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     BlockModeInfo *mbmi = xd->mi;
 
     TxType *tx_type = &trans_info->txk_type;
     *tx_type = DCT_DCT;
 
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
-    FRAME_CONTEXT *frm_ctx = &parse_ctxt->cur_tile_ctx;
+    FRAME_CONTEXT *frm_ctx = &parse_ctx->cur_tile_ctx;
 
     // No need to read transform type if block is skipped.
     if (mbmi->skip || seg_feature_active(&dec_handle->frame_header.
@@ -1665,23 +1667,23 @@ TxType compute_tx_type(PlaneType plane_type,
     return tx_type;
 }
 
-void update_coeff_ctx(EbDecHandle *dec_handle, int plane, PartitionInfo_t *pi,
+void update_coeff_ctx(ParseCtxt *parse_ctx, int plane, PartitionInfo_t *pi,
     TxSize tx_size, uint32_t blk_row, uint32_t blk_col, int above_off,
     int left_off, int cul_level, int dc_val)
 {
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
-    ParseNbr4x4Ctxt *ngr_ctx = &parse_ctxt->parse_nbr4x4_ctxt;
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
+    ParseNbr4x4Ctxt *ngr_ctx = &parse_ctx->parse_nbr4x4_ctxt;
 
     uint8_t suby = plane ? dec_handle->seq_header.color_config.subsampling_y : 0;
     uint8_t subx = plane ? dec_handle->seq_header.color_config.subsampling_x : 0;
 
     uint8_t *const above_dc_ctx = ngr_ctx->above_dc_ctx[plane] + blk_col;
     uint8_t *const left_dc_ctx = ngr_ctx->left_dc_ctx[plane] +
-        (blk_row - (parse_ctxt->sb_row_mi >> suby));
+        (blk_row - (parse_ctx->sb_row_mi >> suby));
 
     uint8_t *const above_level_ctx = ngr_ctx->above_level_ctx[plane] + blk_col;
     uint8_t *const left_level_ctx = ngr_ctx->left_level_ctx[plane] +
-        (blk_row - (parse_ctxt->sb_row_mi >> suby));
+        (blk_row - (parse_ctx->sb_row_mi >> suby));
 
     const int txs_wide = tx_size_wide_unit[tx_size];
     const int txs_high = tx_size_high_unit[tx_size];
@@ -1827,16 +1829,16 @@ static INLINE void read_coeffs_reverse(SvtReader *r, TxSize tx_size,
     }
 }
 
-uint16_t parse_coeffs(EbDecHandle *dec_handle, PartitionInfo_t *xd, SvtReader *r,
+uint16_t parse_coeffs(ParseCtxt *parse_ctx, PartitionInfo_t *xd, SvtReader *r,
     uint32_t blk_row, uint32_t blk_col, int above_off, int left_off, int plane,
     int txb_skip_ctx, int dc_sign_ctx, TxSize tx_size, int32_t *coeff_buf,
     TransformInfo_t *trans_info)
 {
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     const int width = get_txb_wide(tx_size);
     const int height = get_txb_high(tx_size);
 
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
-    FRAME_CONTEXT *frm_ctx = &parse_ctxt->cur_tile_ctx;
+    FRAME_CONTEXT *frm_ctx = &parse_ctx->cur_tile_ctx;
 
     TxSize txs_ctx = (TxSize)((txsize_sqr_map[tx_size] +
         txsize_sqr_up_map[tx_size] + 1) >> 1);
@@ -1859,18 +1861,18 @@ uint16_t parse_coeffs(EbDecHandle *dec_handle, PartitionInfo_t *xd, SvtReader *r
             trans_info->cbf      = 0;
         }
 
-        update_coeff_ctx(dec_handle, plane, xd, tx_size, blk_row, blk_col,
+        update_coeff_ctx(parse_ctx, plane, xd, tx_size, blk_row, blk_col,
             above_off, left_off, cul_level, dc_val);
 
         return 0;
     }
 
     if (plane == AOM_PLANE_Y)
-        parse_transform_type(dec_handle, xd, tx_size, r, trans_info);
+        parse_transform_type(parse_ctx, xd, tx_size, r, trans_info);
 
     uint8_t     *lossless_array = &dec_handle->frame_header.lossless_array[0];
     TransformInfo_t *trans_buf = (is_inter_block(xd->mi) && plane) ?
-        parse_ctxt->inter_trans_chroma : trans_info;
+        parse_ctx->inter_trans_chroma : trans_info;
     trans_info->txk_type = compute_tx_type(plane_type, xd,
         tx_size, dec_handle->frame_header.reduced_tx_set,
         lossless_array, trans_buf);
@@ -2010,7 +2012,7 @@ uint16_t parse_coeffs(EbDecHandle *dec_handle, PartitionInfo_t *xd, SvtReader *r
 
     cul_level = AOMMIN(COEFF_CONTEXT_MASK, cul_level);
 
-    update_coeff_ctx(dec_handle, plane, xd, tx_size, blk_row, blk_col,
+    update_coeff_ctx(parse_ctx, plane, xd, tx_size, blk_row, blk_col,
         above_off, left_off, cul_level, dc_val);
 
     trans_info->cbf = 1; assert(eob);
@@ -2037,26 +2039,25 @@ int partition_plane_context(int mi_row,
 }
 
 PartitionType parse_partition_type(uint32_t blk_row, uint32_t blk_col, SvtReader *reader,
-    BlockSize bsize, int has_rows, int has_cols, EbDecHandle *dec_handle)
+    BlockSize bsize, int has_rows, int has_cols, ParseCtxt *parse_ctx)
 {
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
 
     int partition_cdf_length = bsize <= BLOCK_8X8 ? PARTITION_TYPES :
         (bsize == BLOCK_128X128 ? EXT_PARTITION_TYPES - 2 : EXT_PARTITION_TYPES);
-    int ctx = partition_plane_context(blk_row, blk_col, bsize, parse_ctxt);
+    int ctx = partition_plane_context(blk_row, blk_col, bsize, parse_ctx);
 
     if (bsize < BLOCK_8X8) return PARTITION_NONE;
     else if (has_rows && has_cols)
     {
         return (PartitionType)svt_read_symbol(
-            reader, parse_ctxt->cur_tile_ctx.partition_cdf[ctx],
+            reader, parse_ctx->cur_tile_ctx.partition_cdf[ctx],
             partition_cdf_length, ACCT_STR);
     }
     else if (has_cols)
     {
         assert(bsize > BLOCK_8X8);
         AomCdfProb cdf[3];
-        partition_gather_vert_alike(cdf, parse_ctxt->cur_tile_ctx.
+        partition_gather_vert_alike(cdf, parse_ctx->cur_tile_ctx.
             partition_cdf[ctx], bsize);
         assert(cdf[1] == AOM_ICDF(CDF_PROB_TOP));
         return svt_read_cdf(reader, cdf, 2, ACCT_STR) ? PARTITION_SPLIT : PARTITION_HORZ;
@@ -2066,7 +2067,7 @@ PartitionType parse_partition_type(uint32_t blk_row, uint32_t blk_col, SvtReader
         assert(has_rows && !has_cols);
         assert(bsize > BLOCK_8X8);
         AomCdfProb cdf[3];
-        partition_gather_horz_alike(cdf, parse_ctxt->cur_tile_ctx.
+        partition_gather_horz_alike(cdf, parse_ctx->cur_tile_ctx.
             partition_cdf[ctx], bsize);
         assert(cdf[1] == AOM_ICDF(CDF_PROB_TOP));
         return svt_read_cdf(reader, cdf, 2, ACCT_STR) ? PARTITION_SPLIT : PARTITION_VERT;
@@ -2074,13 +2075,13 @@ PartitionType parse_partition_type(uint32_t blk_row, uint32_t blk_col, SvtReader
     return  PARTITION_SPLIT;
 }
 
-static INLINE void dec_get_txb_ctx(EbDecHandle *dec_handle,
+static INLINE void dec_get_txb_ctx(ParseCtxt *parse_ctx,
     const TxSize tx_size, const int plane, int plane_bsize, int txb_h_unit,
     int txb_w_unit, int blk_row, int blk_col, TXB_CTX *const txb_ctx)
 {
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
 #define MAX_TX_SIZE_UNIT 16
 
-    ParseCtxt *parse_ctx = (ParseCtxt*)dec_handle->pv_parse_ctxt;
     ParseNbr4x4Ctxt *nbr_ctx = &parse_ctx->parse_nbr4x4_ctxt;
     EbColorConfig *clr_cfg = &dec_handle->seq_header.color_config;
 
@@ -2170,12 +2171,13 @@ static INLINE void dec_get_txb_ctx(EbDecHandle *dec_handle,
 #undef MAX_TX_SIZE_UNIT
 }
 
-uint16_t parse_transform_block(EbDecHandle *dec_handle,
+uint16_t parse_transform_block(ParseCtxt *parse_ctx,
     PartitionInfo_t *pi, SvtReader *r, int32_t *coeff,
     TransformInfo_t *trans_info, int plane, int blk_col,
     int blk_row, int mi_row, int mi_col,
     TxSize tx_size, int skip)
 {
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     uint16_t eob = 0 , sub_x, sub_y;
 
     sub_x = (plane > 0) ? dec_handle->seq_header.color_config.subsampling_x : 0;
@@ -2213,24 +2215,24 @@ uint16_t parse_transform_block(EbDecHandle *dec_handle,
         }
 
 
-        dec_get_txb_ctx(dec_handle, tx_size, plane, plane_bsize, txb_h_unit,
+        dec_get_txb_ctx(parse_ctx, tx_size, plane, plane_bsize, txb_h_unit,
             txb_w_unit, start_y, start_x, &txb_ctx);
 
-        eob = parse_coeffs(dec_handle, pi, r, start_y, start_x, blk_col,
+        eob = parse_coeffs(parse_ctx, pi, r, start_y, start_x, blk_col,
             blk_row, plane, txb_ctx.txb_skip_ctx, txb_ctx.dc_sign_ctx,
             tx_size, coeff, trans_info);
     }
     else{
-        update_coeff_ctx(dec_handle, plane, pi, tx_size,
+        update_coeff_ctx(parse_ctx, plane, pi, tx_size,
             start_y, start_x, blk_col, blk_row, 0, 0);
     }
     return eob;
 }
 
-void parse_residual(EbDecHandle *dec_handle, PartitionInfo_t *pi, SvtReader *r,
+void parse_residual(ParseCtxt *parse_ctx, PartitionInfo_t *pi, SvtReader *r,
                     int mi_row, int mi_col, BlockSize mi_size)
 {
-    ParseCtxt   *parse_ctx = (ParseCtxt*)dec_handle->pv_parse_ctxt;
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     EbColorConfig *color_info = &dec_handle->seq_header.color_config;
     SBInfo *sb_info = pi->sb_info;
     int num_planes = color_info->mono_chrome ? 1 : MAX_MB_PLANE;
@@ -2312,7 +2314,7 @@ void parse_residual(EbDecHandle *dec_handle, PartitionInfo_t *pi, SvtReader *r,
                     cur_coeff[1] = cur_loc;
                     }
 #endif
-                    int32_t eob = parse_transform_block(dec_handle, pi, r, coeff,
+                    int32_t eob = parse_transform_block(parse_ctx, pi, r, coeff,
                         trans_info[plane], plane,
                         trans_info[plane]->tu_x_offset, trans_info[plane]->tu_y_offset,
                         mi_row, mi_col, trans_info[plane]->tx_size, skip);
@@ -2333,11 +2335,11 @@ void parse_residual(EbDecHandle *dec_handle, PartitionInfo_t *pi, SvtReader *r,
     }
 }
 
-void parse_block(EbDecHandle *dec_handle, uint32_t mi_row, uint32_t mi_col,
+void parse_block(ParseCtxt *parse_ctx, uint32_t mi_row, uint32_t mi_col,
     SvtReader *r, BlockSize subsize, TileInfo *tile, SBInfo *sb_info,
     PartitionType partition)
 {
-    ParseCtxt *parse_ctx = (ParseCtxt*)dec_handle->pv_parse_ctxt;
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
 
     int8_t      *cdef_strength = sb_info->sb_cdef_strength;
 
@@ -2420,7 +2422,7 @@ void parse_block(EbDecHandle *dec_handle, uint32_t mi_row, uint32_t mi_col,
     else
         part_info.left_mbmi = NULL;
     mode->sb_type = subsize;
-    mode_info(dec_handle, &part_info, mi_row, mi_col, r, cdef_strength);
+    mode_info(parse_ctx, &part_info, mi_row, mi_col, r, cdef_strength);
 
     /* Replicating same chroma mode for block pairs or 4x4 blks
        when chroma is present in last block*/
@@ -2460,14 +2462,14 @@ void parse_block(EbDecHandle *dec_handle, uint32_t mi_row, uint32_t mi_col,
     ZERO_ARRAY(parse_ctx->num_tus[AOM_PLANE_V], 4);
 
     if (!is_inter_block(mode))
-        palette_tokens(dec_handle, &part_info, mi_row, mi_col, r);
+        palette_tokens(parse_ctx, &part_info, mi_row, mi_col, r);
 
-    read_block_tx_size(dec_handle, r, &part_info, subsize);
+    read_block_tx_size(parse_ctx, r, &part_info, subsize);
 
-    parse_residual(dec_handle, &part_info, r, mi_row, mi_col, subsize);
+    parse_residual(parse_ctx, &part_info, r, mi_row, mi_col, subsize);
 
     /* Update block level MI map */
-    update_block_nbrs(dec_handle, mi_row, mi_col, subsize);
+    update_block_nbrs(parse_ctx, mi_row, mi_col, subsize);
     parse_ctx->cur_mode_info_cnt++;
     parse_ctx->cur_mode_info++;
 }
@@ -2525,10 +2527,10 @@ static INLINE void update_ext_partition_context(ParseCtxt *parse_ctx, int mi_row
     }
 }
 
-void parse_partition(EbDecHandle *dec_handle, uint32_t blk_row, uint32_t blk_col,
+void parse_partition(ParseCtxt *parse_ctx, uint32_t blk_row, uint32_t blk_col,
     SvtReader *reader, BlockSize bsize, SBInfo *sb_info)
 {
-    ParseCtxt *parse_ctx = (ParseCtxt*)dec_handle->pv_parse_ctxt;
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
 
     if (blk_row >= dec_handle->frame_header.mi_rows ||
         blk_col >= dec_handle->frame_header.mi_cols)
@@ -2545,16 +2547,16 @@ void parse_partition(EbDecHandle *dec_handle, uint32_t blk_row, uint32_t blk_col
 
     partition = (bsize < BLOCK_8X8) ? PARTITION_NONE
         : parse_partition_type(blk_row, blk_col, reader, bsize,
-            has_rows, has_cols, dec_handle);
+            has_rows, has_cols, parse_ctx);
     int subSize = Partition_Subsize[(int)partition][bsize];
     int splitSize = Partition_Subsize[PARTITION_SPLIT][bsize];
 
 #define PARSE_BLOCK(db_r, db_c, db_subsize)                 \
-parse_block(dec_handle, db_r, db_c, reader, db_subsize,     \
+parse_block(parse_ctx, db_r, db_c, reader, db_subsize,     \
     &parse_ctx->cur_tile_info, sb_info, partition);
 
 #define PARSE_PARTITION(db_r, db_c, db_subsize)                 \
-  parse_partition(dec_handle, (db_r), (db_c), reader,           \
+  parse_partition(parse_ctx, (db_r), (db_c), reader,           \
                    (db_subsize), sb_info)
 
     switch ((int)partition) {
@@ -2738,37 +2740,37 @@ void read_sgrproj_filter(SgrprojInfo *sgrproj_info,
     memcpy(ref_sgrproj_info, sgrproj_info, sizeof(*sgrproj_info));
 }
 
-void read_lr_unit(EbDecHandle *dec_handle, int32_t row, int32_t col,
+void read_lr_unit(ParseCtxt *parse_ctx, int32_t row, int32_t col,
     int32_t plane, SvtReader *reader, RestorationUnitInfo *lr_unit)
 {
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     UNUSED(row);
     UNUSED(col);
 
     FrameHeader *frame_info = &dec_handle->frame_header;
     const LRParams *lrp = &frame_info->lr_params[plane];
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
     if (lrp->frame_restoration_type == RESTORE_NONE) return;
 
     lr_unit->restoration_type = RESTORE_NONE;
     if (lrp->frame_restoration_type == RESTORE_SWITCHABLE) {
         lr_unit->restoration_type =
-            svt_read_symbol(reader, parse_ctxt->cur_tile_ctx.switchable_restore_cdf,
+            svt_read_symbol(reader, parse_ctx->cur_tile_ctx.switchable_restore_cdf,
                 RESTORE_SWITCHABLE_TYPES, ACCT_STR);
     }
     else if (lrp->frame_restoration_type == RESTORE_WIENER) {
-        if (svt_read_symbol(reader, parse_ctxt->cur_tile_ctx.wiener_restore_cdf,
+        if (svt_read_symbol(reader, parse_ctx->cur_tile_ctx.wiener_restore_cdf,
             2, ACCT_STR)) {
             lr_unit->restoration_type = RESTORE_WIENER;
         }
     }
     else if (lrp->frame_restoration_type == RESTORE_SGRPROJ) {
-        if (svt_read_symbol(reader, parse_ctxt->cur_tile_ctx.sgrproj_restore_cdf,
+        if (svt_read_symbol(reader, parse_ctx->cur_tile_ctx.sgrproj_restore_cdf,
             2, ACCT_STR)) {
             lr_unit->restoration_type = RESTORE_SGRPROJ;
         }
     }
 
-    RestorationUnitInfo *ref_lr_plane = &parse_ctxt->ref_lr_unit[plane];
+    RestorationUnitInfo *ref_lr_plane = &parse_ctx->ref_lr_unit[plane];
     WienerInfo *wiener_info = &lr_unit->wiener_info;
     SgrprojInfo *sgrproj_info = &lr_unit->sgrproj_info;
     const int wiener_win = (plane > 0) ? WIENER_WIN_CHROMA : WIENER_WIN;
@@ -2786,9 +2788,10 @@ void read_lr_unit(EbDecHandle *dec_handle, int32_t row, int32_t col,
     }
 }
 
-void read_lr(EbDecHandle *dec_handle, int32_t row, int32_t col,
+void read_lr(ParseCtxt *parse_ctx, int32_t row, int32_t col,
              SvtReader *reader)
 {
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     FrameHeader *frame_info = &dec_handle->frame_header;
     SeqHeader *seq_header = &dec_handle->seq_header;
     EbColorConfig *color_config = &dec_handle->seq_header.color_config;
@@ -2831,7 +2834,7 @@ void read_lr(EbDecHandle *dec_handle, int32_t row, int32_t col,
                 for (int unit_col = unit_col_start; unit_col < unit_col_end; unit_col++) {
                     RestorationUnitInfo *cur_lr = lr_ctxt->lr_unit[plane] +
                         (unit_row * lr_ctxt->lr_stride[plane]) + unit_col;
-                    read_lr_unit(dec_handle, unit_row, unit_col, plane,
+                    read_lr_unit(parse_ctx, unit_row, unit_col, plane,
                                  reader, cur_lr);
                 }
             }
@@ -2839,17 +2842,17 @@ void read_lr(EbDecHandle *dec_handle, int32_t row, int32_t col,
     }
 }
 
-void parse_super_block(EbDecHandle *dec_handle, uint32_t blk_row,
+void parse_super_block(ParseCtxt *parse_ctx, uint32_t blk_row,
                        uint32_t blk_col, SBInfo *sbInfo)
 {
-    ParseCtxt *parse_ctx = (ParseCtxt*)dec_handle->pv_parse_ctxt;
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     SvtReader *reader = &parse_ctx->r;
 
     parse_ctx->read_deltas = dec_handle->frame_header.
                             delta_q_params.delta_q_present;
 
-    read_lr(dec_handle, blk_row, blk_col, reader);
+    read_lr(parse_ctx, blk_row, blk_col, reader);
 
-    parse_partition(dec_handle, blk_row, blk_col, reader,
+    parse_partition(parse_ctx, blk_row, blk_col, reader,
                     dec_handle->seq_header.sb_size, sbInfo);
 }
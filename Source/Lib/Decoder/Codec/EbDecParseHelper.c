@@ -127,15 +127,14 @@ void update_tx_context(ParseCtxt *parse_ctxt, PartitionInfo_t *pi,
 }
 
 TxSize read_selected_tx_size(PartitionInfo_t *xd, SvtReader *r,
-    EbDecHandle *dec_handle)
+    ParseCtxt *parse_ctx)
 {
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
     const BlockSize bsize = xd->mi->sb_type;
     const int32_t tx_size_cat = bsize_to_tx_size_cat(bsize);
     const int maxTxDepth = bsize_to_max_depth(bsize);
-    const int ctx = get_tx_size_context(xd, parse_ctxt);
+    const int ctx = get_tx_size_context(xd, parse_ctx);
     /*TODO : Change idx */
-    const int depth = svt_read_symbol(r, parse_ctxt->cur_tile_ctx
+    const int depth = svt_read_symbol(r, parse_ctx->cur_tile_ctx
         .tx_size_cdf[tx_size_cat][ctx],
         maxTxDepth + 1, ACCT_STR);
     assert(depth >= 0 && depth <= maxTxDepth);
@@ -61,7 +61,7 @@ static INLINE int max_block_high(PartitionInfo_t *part_info, int plane_bsize, in
 }
 
 TxSize read_selected_tx_size(PartitionInfo_t *xd, SvtReader *r,
-    EbDecHandle *dec_handle);
+    ParseCtxt *parse_ctx);
 PredictionMode read_intra_mode(SvtReader *r, AomCdfProb *cdf);
 UvPredictionMode read_intra_mode_uv(FRAME_CONTEXT *ec_ctx, SvtReader *r,
     CflAllowedType cfl_allowed, PredictionMode y_mode);
@@ -78,6 +78,6 @@ int get_intra_inter_context(PartitionInfo_t *xd);
 int get_comp_reference_type_context(const PartitionInfo_t *xd);
 int seg_feature_active(SegmentationParams *seg, int segment_id,
     SEG_LVL_FEATURES feature_id);
-int find_warp_samples(EbDecHandle *dec_handle, PartitionInfo_t *pi,
-    int mi_row, int mi_col, int *pts, int *pts_inref);
+int find_warp_samples(EbDecHandle *dec_handle, TileInfo *tile,
+    PartitionInfo_t *pi, int mi_row, int mi_col, int *pts, int *pts_inref);
 #endif  // EbDecParseHelper_h
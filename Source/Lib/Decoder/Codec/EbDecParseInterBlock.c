@@ -266,12 +266,12 @@ static int32_t get_pred_context_last3_or_gld(PartitionInfo_t *pi) {
     return pred_context;
 }
 
-static void read_ref_frames(EbDecHandle *dec_handle, PartitionInfo_t *const pi,
+static void read_ref_frames(ParseCtxt *parse_ctx, PartitionInfo_t *const pi,
     SvtReader *r)
 {
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     int segment_id = pi->mi->segment_id;
     MvReferenceFrame *ref_frame = pi->mi->ref_frame;
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
     AomCdfProb *cdf;
     SegmentationParams *seg_params = &dec_handle->frame_header.segmentation_params;
     if (pi->mi->skip_mode) {
@@ -300,7 +300,7 @@ static void read_ref_frames(EbDecHandle *dec_handle, PartitionInfo_t *const pi,
         {
             const int ctx = get_reference_mode_context(pi);
             mode = (ReferenceMode)svt_read_symbol(r,
-                parse_ctxt->cur_tile_ctx.comp_inter_cdf[ctx], 2, ACCT_STR);
+                parse_ctx->cur_tile_ctx.comp_inter_cdf[ctx], 2, ACCT_STR);
         }
 
         if (mode == COMPOUND_REFERENCE) {
@@ -308,12 +308,12 @@ static void read_ref_frames(EbDecHandle *dec_handle, PartitionInfo_t *const pi,
             const int ctx = get_comp_reference_type_context(pi);
             const CompReferenceType comp_ref_type =
                 (CompReferenceType)svt_read_symbol(
-                    r, parse_ctxt->cur_tile_ctx.comp_ref_type_cdf[ctx], 2, ACCT_STR);
+                    r, parse_ctx->cur_tile_ctx.comp_ref_type_cdf[ctx], 2, ACCT_STR);
 
             if (comp_ref_type == UNIDIR_COMP_REFERENCE) {
                 pred_context = get_pred_context_uni_comp_ref_p(pi);
                 uint16_t bit = (uint16_t)svt_read_symbol(r,
-                    parse_ctxt->cur_tile_ctx.uni_comp_ref_cdf[pred_context][0],
+                    parse_ctx->cur_tile_ctx.uni_comp_ref_cdf[pred_context][0],
                     2, ACCT_STR);
                 if (bit) {
                     ref_frame[0] = BWDREF_FRAME;
@@ -322,12 +322,12 @@ static void read_ref_frames(EbDecHandle *dec_handle, PartitionInfo_t *const pi,
                 else {
                     pred_context = get_pred_context_uni_comp_ref_p1(pi);
                     uint16_t bit1 = (uint16_t)svt_read_symbol(r,
-                        parse_ctxt->cur_tile_ctx.uni_comp_ref_cdf[pred_context][1],
+                        parse_ctx->cur_tile_ctx.uni_comp_ref_cdf[pred_context][1],
                         2, ACCT_STR);
                     if (bit1) {
                         pred_context = get_pred_context_uni_comp_ref_p2(pi);
                         uint16_t bit2 = (uint16_t)svt_read_symbol(r,
-                            parse_ctxt->cur_tile_ctx.uni_comp_ref_cdf[pred_context][2],
+                            parse_ctx->cur_tile_ctx.uni_comp_ref_cdf[pred_context][2],
                             2, ACCT_STR);
                         if (bit2) {
                             ref_frame[0] = LAST_FRAME;
@@ -351,26 +351,26 @@ static void read_ref_frames(EbDecHandle *dec_handle, PartitionInfo_t *const pi,
             const int idx = 1;
             pred_context = get_pred_context_comp_ref_p(pi);
             uint16_t bit = (uint16_t)svt_read_symbol(r,
-                parse_ctxt->cur_tile_ctx.comp_ref_cdf[pred_context][0], 2, ACCT_STR);
+                parse_ctx->cur_tile_ctx.comp_ref_cdf[pred_context][0], 2, ACCT_STR);
             // Decode forward references.
             if (!bit) {
-                uint16_t bit1 = (uint16_t)svt_read_symbol(r, parse_ctxt->cur_tile_ctx.
+                uint16_t bit1 = (uint16_t)svt_read_symbol(r, parse_ctx->cur_tile_ctx.
                     comp_ref_cdf[get_pred_context_single_ref_p4(pi)][1], 2, ACCT_STR);
                 ref_frame[!idx] = bit1 ? LAST2_FRAME : LAST_FRAME;
             }
             else {
-                uint16_t bit2 = (uint16_t)svt_read_symbol(r, parse_ctxt->cur_tile_ctx.
+                uint16_t bit2 = (uint16_t)svt_read_symbol(r, parse_ctx->cur_tile_ctx.
                     comp_ref_cdf[get_pred_context_last3_or_gld(pi)][2], 2, ACCT_STR);
                 ref_frame[!idx] = bit2 ? GOLDEN_FRAME : LAST3_FRAME;
             }
 
             // Decode backward references.
             pred_context = get_pred_context_comp_bwdref_p(pi);
-            uint16_t bit_bwd = (uint16_t)svt_read_symbol(r, parse_ctxt->cur_tile_ctx.
+            uint16_t bit_bwd = (uint16_t)svt_read_symbol(r, parse_ctx->cur_tile_ctx.
                 comp_bwdref_cdf[pred_context][0], 2, ACCT_STR);
             if (!bit_bwd) {
                 pred_context = get_pred_context_comp_bwdref_p1(pi);
-                uint16_t bit1_bwd = (uint16_t)svt_read_symbol(r, parse_ctxt->cur_tile_ctx.
+                uint16_t bit1_bwd = (uint16_t)svt_read_symbol(r, parse_ctx->cur_tile_ctx.
                     comp_bwdref_cdf[pred_context][1], 2, ACCT_STR);
                 ref_frame[idx] = bit1_bwd ? ALTREF2_FRAME : BWDREF_FRAME;
             }
@@ -380,16 +380,16 @@ static void read_ref_frames(EbDecHandle *dec_handle, PartitionInfo_t *const pi,
         }
         else if (mode == SINGLE_REFERENCE) {
 
-            cdf = parse_ctxt->cur_tile_ctx.
+            cdf = parse_ctx->cur_tile_ctx.
                 single_ref_cdf[get_pred_context_single_ref_p1(pi)][0];
             const int32_t bit0 = svt_read_symbol(r, cdf, 2, ACCT_STR);
 
             if (bit0) {
-                cdf = parse_ctxt->cur_tile_ctx.
+                cdf = parse_ctx->cur_tile_ctx.
                     single_ref_cdf[get_pred_context_comp_bwdref_p(pi)][1];
                 const int32_t bit1 = svt_read_symbol(r, cdf, 2, ACCT_STR);
                 if (!bit1) {
-                    cdf = parse_ctxt->cur_tile_ctx.
+                    cdf = parse_ctx->cur_tile_ctx.
                         single_ref_cdf[get_pred_context_comp_bwdref_p1(pi)][5];
                     const int32_t bit5 = svt_read_symbol(r, cdf, 2, ACCT_STR);
                     ref_frame[0] = bit5 ? ALTREF2_FRAME : BWDREF_FRAME;
@@ -399,17 +399,17 @@ static void read_ref_frames(EbDecHandle *dec_handle, PartitionInfo_t *const pi,
                 }
             }
             else {
-                cdf = parse_ctxt->cur_tile_ctx.
+                cdf = parse_ctx->cur_tile_ctx.
                     single_ref_cdf[get_pred_context_comp_ref_p(pi)][2];
                 const int32_t bit2 = svt_read_symbol(r, cdf, 2, ACCT_STR);
                 if (bit2) {
-                    cdf = parse_ctxt->cur_tile_ctx.
+                    cdf = parse_ctx->cur_tile_ctx.
                         single_ref_cdf[get_pred_context_last3_or_gld(pi)][4];
                     const int32_t bit4 = svt_read_symbol(r, cdf, 2, ACCT_STR);
                     ref_frame[0] = bit4 ? GOLDEN_FRAME : LAST3_FRAME;
                 }
                 else {
-                    cdf = parse_ctxt->cur_tile_ctx.
+                    cdf = parse_ctx->cur_tile_ctx.
                         single_ref_cdf[get_pred_context_single_ref_p4(pi)][3];
                     const int32_t bit3 = svt_read_symbol(r, cdf, 2, ACCT_STR);
                     ref_frame[0] = bit3 ? LAST2_FRAME : LAST_FRAME;
@@ -507,14 +507,14 @@ static void add_ref_mv_candidate(EbDecHandle *dec_handle,
     }
 }
 
-static void scan_row_mbmi(EbDecHandle *dec_handle, PartitionInfo_t *pi,
+static void scan_row_mbmi(ParseCtxt *parse_ctx, PartitionInfo_t *pi,
     int delta_row, int mi_row, int mi_col, const MvReferenceFrame rf[2],
     CandidateMv *ref_mv_stack, uint8_t *num_mv_found, uint8_t *found_match,
     uint8_t *newmv_count, IntMv *gm_mv_candidates, int max_row_offset,
     int *processed_rows)
 {
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     int bw4 = mi_size_wide[pi->mi->sb_type];
-    ParseCtxt *parse_ctx = (ParseCtxt*)dec_handle->pv_parse_ctxt;
     FrameHeader *frm_header = &dec_handle->frame_header;
     int end4 = AOMMIN(AOMMIN(bw4, (int)frm_header->mi_cols - mi_col), 16);
     int delta_col = 0;
@@ -556,14 +556,14 @@ static void scan_row_mbmi(EbDecHandle *dec_handle, PartitionInfo_t *pi,
     }
 }
 
-static void scan_col_mbmi(EbDecHandle *dec_handle, PartitionInfo_t *pi,
+static void scan_col_mbmi(ParseCtxt *parse_ctx, PartitionInfo_t *pi,
     int delta_col, int mi_row, int mi_col, const MvReferenceFrame rf[2],
     CandidateMv *ref_mv_stack, uint8_t *num_mv_found, uint8_t *found_match,
     uint8_t *newmv_count, IntMv *gm_mv_candidates, int max_col_offset,
     int *processed_cols)
 {
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     int bh4 = mi_size_high[pi->mi->sb_type];
-    ParseCtxt *parse_ctx = (ParseCtxt*)dec_handle->pv_parse_ctxt;
     FrameHeader *frm_header = &dec_handle->frame_header;
     int end4 = AOMMIN(AOMMIN(bh4, (int)frm_header->mi_rows - mi_row), 16);
     int delta_row = 0;
@@ -605,13 +605,13 @@ static void scan_col_mbmi(EbDecHandle *dec_handle, PartitionInfo_t *pi,
     }
 }
 
-static void scan_blk_mbmi(EbDecHandle *dec_handle, PartitionInfo_t *pi,
+static void scan_blk_mbmi(ParseCtxt *parse_ctx, PartitionInfo_t *pi,
     int delta_row, int delta_col, const int mi_row, const int mi_col,
     const MvReferenceFrame rf[2], CandidateMv *ref_mv_stack,
     uint8_t *found_match, uint8_t *newmv_count, IntMv *gm_mv_candidates,
     uint8_t num_mv_found[MODE_CTX_REF_FRAMES])
 {
-    ParseCtxt *parse_ctx = (ParseCtxt*)dec_handle->pv_parse_ctxt;
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
 
     int mv_row = mi_row + delta_row;
     int mv_col = mi_col + delta_col;
@@ -665,13 +665,13 @@ static int has_top_right(EbDecHandle *dec_handle, PartitionInfo_t *pi,
     return has_tr;
 }
 
-static int add_tpl_ref_mv(EbDecHandle *dec_handle, int mi_row, int mi_col,
+static int add_tpl_ref_mv(ParseCtxt *parse_ctx, int mi_row, int mi_col,
     MvReferenceFrame ref_frame, int blk_row, int blk_col,
     IntMv *gm_mv_candidates, uint8_t *num_mv_found,
     CandidateMv ref_mv_stacks[][MAX_REF_MV_STACK_SIZE], int16_t *mode_context)
 {
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     uint8_t idx;
-    ParseCtxt *parse_ctx = (ParseCtxt*)dec_handle->pv_parse_ctxt;
     FrameHeader *frm_header = &dec_handle->frame_header;
     int mv_row = (mi_row + blk_row) | 1;
     int mv_col = (mi_col + blk_col) | 1;
@@ -845,17 +845,17 @@ static INLINE void clamp_mv_ref(MV *mv, int bw, int bh, PartitionInfo_t *pi) {
 }
 
 static void dec_setup_ref_mv_list(
-    EbDecHandle *dec_handle, PartitionInfo_t *pi, MvReferenceFrame ref_frame,
+    ParseCtxt *parse_ctx, PartitionInfo_t *pi, MvReferenceFrame ref_frame,
     CandidateMv ref_mv_stack[][MAX_REF_MV_STACK_SIZE],
     IntMv mv_ref_list[][MAX_MV_REF_CANDIDATES], IntMv *gm_mv_candidates,
     int mi_row, int mi_col, int16_t *mode_context, MvCount *mv_cnt)
 {
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     int n4_w = mi_size_wide[pi->mi->sb_type];
     int n4_h = mi_size_high[pi->mi->sb_type];
     const int bs = AOMMAX(n4_w, n4_h);
     MvReferenceFrame rf[2];
 
-    ParseCtxt *parse_ctx = (ParseCtxt*)dec_handle->pv_parse_ctxt;
     FrameHeader *frame_info = &dec_handle->frame_header;
     const TileInfo *const tile = &parse_ctx->cur_tile_info;
     int max_row_offset = 0, max_col_offset = 0;
@@ -891,20 +891,20 @@ static void dec_setup_ref_mv_list(
 
     // Scan the first above row mode info. row_offset = -1;
     if (abs(max_row_offset) >= 1) {
-        scan_row_mbmi(dec_handle, pi, -1, mi_row, mi_col, rf, ref_mv_stack[ref_frame],
+        scan_row_mbmi(parse_ctx, pi, -1, mi_row, mi_col, rf, ref_mv_stack[ref_frame],
             &mv_cnt->num_mv_found[ref_frame], &mv_cnt->found_above_match,
             &mv_cnt->newmv_count, gm_mv_candidates, max_row_offset, &processed_rows);
     }
 
     // Scan the first left column mode info. col_offset = -1;
     if (abs(max_col_offset) >= 1) {
-        scan_col_mbmi(dec_handle, pi, -1, mi_row, mi_col, rf, ref_mv_stack[ref_frame],
+        scan_col_mbmi(parse_ctx, pi, -1, mi_row, mi_col, rf, ref_mv_stack[ref_frame],
             &mv_cnt->num_mv_found[ref_frame], &mv_cnt->found_left_match,
             &mv_cnt->newmv_count, gm_mv_candidates, max_col_offset, &processed_cols);
     }
 
     if (has_top_right(dec_handle, pi, mi_row, mi_col, bs)) {
-        scan_blk_mbmi(dec_handle, pi, -1, n4_w, mi_row, mi_col, rf,
+        scan_blk_mbmi(parse_ctx, pi, -1, n4_w, mi_row, mi_col, rf,
             ref_mv_stack[ref_frame], &mv_cnt->found_above_match, &mv_cnt->newmv_count,
             gm_mv_candidates, &mv_cnt->num_mv_found[ref_frame]);
     }
@@ -944,7 +944,7 @@ static void dec_setup_ref_mv_list(
         for (int blk_row = 0; blk_row < blk_row_end; blk_row += step_h) {
             for (int blk_col = 0; blk_col < blk_col_end; blk_col += step_w) {
 
-                int ret = add_tpl_ref_mv(dec_handle, mi_row, mi_col,
+                int ret = add_tpl_ref_mv(parse_ctx, mi_row, mi_col,
                     ref_frame, blk_row, blk_col, gm_mv_candidates,
                     &mv_cnt->num_mv_found[ref_frame], ref_mv_stack, mode_context);
                 if (blk_row == 0 && blk_col == 0) is_available = ret;
@@ -959,7 +959,7 @@ static void dec_setup_ref_mv_list(
                 const int blk_col = tpl_sample_pos[i][1];
 
                 if (check_sb_border(mi_row, mi_col, blk_row, blk_col)) {
-                    add_tpl_ref_mv(dec_handle, mi_row, mi_col, ref_frame, blk_row,
+                    add_tpl_ref_mv(parse_ctx, mi_row, mi_col, ref_frame, blk_row,
                         blk_col, gm_mv_candidates, &mv_cnt->num_mv_found[ref_frame],
                         ref_mv_stack, mode_context);
                 }
@@ -968,7 +968,7 @@ static void dec_setup_ref_mv_list(
     }
 
     // Scan the second outer area.
-    scan_blk_mbmi(dec_handle, pi, -1, -1, mi_row, mi_col, rf,
+    scan_blk_mbmi(parse_ctx, pi, -1, -1, mi_row, mi_col, rf,
         ref_mv_stack[ref_frame], &mv_cnt->found_above_match, &mv_cnt->newmv_count,
         gm_mv_candidates, &mv_cnt->num_mv_found[ref_frame]);
 
@@ -976,14 +976,14 @@ static void dec_setup_ref_mv_list(
         const int row_offset = -(idx << 1) + 1 + row_adj;
         const int col_offset = -(idx << 1) + 1 + col_adj;
         if (abs(row_offset) <= abs(max_row_offset) && abs(row_offset) > processed_rows) {
-            scan_row_mbmi(dec_handle, pi, row_offset, mi_row, mi_col, rf,
+            scan_row_mbmi(parse_ctx, pi, row_offset, mi_row, mi_col, rf,
                 ref_mv_stack[ref_frame], &mv_cnt->num_mv_found[ref_frame],
                 &mv_cnt->found_above_match, &mv_cnt->newmv_count,
                 gm_mv_candidates, max_row_offset, &processed_rows);
         }
 
         if (abs(col_offset) <= abs(max_col_offset) && abs(col_offset) > processed_cols) {
-            scan_col_mbmi(dec_handle, pi, col_offset, mi_row, mi_col, rf,
+            scan_col_mbmi(parse_ctx, pi, col_offset, mi_row, mi_col, rf,
                 ref_mv_stack[ref_frame], &mv_cnt->num_mv_found[ref_frame],
                 &mv_cnt->found_left_match, &mv_cnt->newmv_count,
                 gm_mv_candidates, max_col_offset, &processed_cols);
@@ -1202,11 +1202,12 @@ static INLINE int16_t svt_mode_context_analyzer(
     return comp_ctx;
 }
 
-void av1_find_mv_refs(EbDecHandle *dec_handle, PartitionInfo_t *pi,
+void av1_find_mv_refs(ParseCtxt *parse_ctx, PartitionInfo_t *pi,
     MvReferenceFrame ref_frame, CandidateMv ref_mv_stack[][MAX_REF_MV_STACK_SIZE],
     IntMv mv_ref_list[][MAX_MV_REF_CANDIDATES], IntMv global_mvs[2],
     int mi_row, int mi_col, int16_t *mode_context, MvCount *mv_cnt)
 {
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     BlockSize bsize = pi->mi->sb_type;
     MvReferenceFrame rf[2];
     av1_set_ref_frame(rf, ref_frame);
@@ -1225,16 +1226,15 @@ void av1_find_mv_refs(EbDecHandle *dec_handle, PartitionInfo_t *pi,
                 dec_handle->frame_header.allow_high_precision_mv, bsize,
                 mi_col, mi_row, dec_handle->frame_header.force_integer_mv).as_int : 0;
     }
-    dec_setup_ref_mv_list(dec_handle, pi, ref_frame, ref_mv_stack, mv_ref_list,
+    dec_setup_ref_mv_list(parse_ctx, pi, ref_frame, ref_mv_stack, mv_ref_list,
         global_mvs, mi_row, mi_col, mode_context, mv_cnt);
 }
 
-static PredictionMode read_inter_compound_mode(EbDecHandle *dec_handle,
+static PredictionMode read_inter_compound_mode(ParseCtxt *parse_ctx,
     SvtReader *r, int16_t ctx)
 {
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
     const int mode =
-        svt_read_symbol(r, parse_ctxt->cur_tile_ctx.inter_compound_mode_cdf[ctx],
+        svt_read_symbol(r, parse_ctx->cur_tile_ctx.inter_compound_mode_cdf[ctx],
             INTER_COMPOUND_MODES, ACCT_STR);
     assert(is_inter_compound_mode(NEAREST_NEARESTMV + mode));
     return NEAREST_NEARESTMV + mode;
@@ -1262,17 +1262,16 @@ static INLINE uint8_t get_drl_ctx(const CandidateMv *ref_mv_stack, int ref_idx)
     return 0;
 }
 
-static void read_drl_idx(EbDecHandle *dec_handle, PartitionInfo_t *pi,
+static void read_drl_idx(ParseCtxt *parse_ctx, PartitionInfo_t *pi,
     BlockModeInfo *mbmi, SvtReader *r, int num_mv_found)
 {
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
     uint8_t ref_frame_type = av1_ref_frame_type(mbmi->ref_frame);
     mbmi->ref_mv_idx = 0;
     if (mbmi->mode == NEWMV || mbmi->mode == NEW_NEWMV) {
         for (int idx = 0; idx < 2; ++idx) {
             if (num_mv_found > idx + 1) {
                 uint8_t drl_ctx = get_drl_ctx(pi->ref_mv_stack[ref_frame_type], idx);
-                int drl_idx = svt_read_symbol(r, parse_ctxt->cur_tile_ctx.
+                int drl_idx = svt_read_symbol(r, parse_ctx->cur_tile_ctx.
                     drl_cdf[drl_ctx], 2, ACCT_STR);
                 mbmi->ref_mv_idx = idx;
                 if (!drl_idx) return;
@@ -1284,7 +1283,7 @@ static void read_drl_idx(EbDecHandle *dec_handle, PartitionInfo_t *pi,
         for (int idx = 1; idx < 3; ++idx) {
             if (num_mv_found > idx + 1) {
                 uint8_t drl_ctx = get_drl_ctx(pi->ref_mv_stack[ref_frame_type], idx);
-                int drl_idx = svt_read_symbol(r, parse_ctxt->cur_tile_ctx.
+                int drl_idx = svt_read_symbol(r, parse_ctx->cur_tile_ctx.
                     drl_cdf[drl_ctx], 2, ACCT_STR);
                 mbmi->ref_mv_idx = idx + drl_idx - 1;
                 if (!drl_idx) return;
@@ -1355,20 +1354,20 @@ static INLINE void read_mv(SvtReader *r, MV *mv, MV *ref,
     mv->col = ref->col + diff.col;
 }
 
-static INLINE int assign_mv(EbDecHandle *dec_handle, PartitionInfo_t *pi,
+static INLINE int assign_mv(ParseCtxt *parse_ctx, PartitionInfo_t *pi,
     IntMv mv[2], IntMv *global_mvs, IntMv ref_mv[2],
     IntMv nearest_mv[2], IntMv near_mv[2],
     int is_compound, int allow_hp, SvtReader *r)
 {
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     BlockModeInfo *mbmi = pi->mi;
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
 
     if (dec_handle->frame_header.force_integer_mv)
         allow_hp = MV_SUBPEL_NONE;
 
     switch (mbmi->mode) {
     case NEWMV: {
-        NmvContext *const nmvc = &parse_ctxt->cur_tile_ctx.nmvc;
+        NmvContext *const nmvc = &parse_ctx->cur_tile_ctx.nmvc;
         read_mv(r, &mv[0].as_mv, &ref_mv[0].as_mv, nmvc, allow_hp);
         break;
     }
@@ -1387,7 +1386,7 @@ static INLINE int assign_mv(EbDecHandle *dec_handle, PartitionInfo_t *pi,
     case NEW_NEWMV: {
         assert(is_compound);
         for (int i = 0; i < 2; ++i) {
-            NmvContext *const nmvc = &parse_ctxt->cur_tile_ctx.nmvc;
+            NmvContext *const nmvc = &parse_ctx->cur_tile_ctx.nmvc;
             read_mv(r, &mv[i].as_mv, &ref_mv[i].as_mv, nmvc, allow_hp);
         }
         break;
@@ -1405,7 +1404,7 @@ static INLINE int assign_mv(EbDecHandle *dec_handle, PartitionInfo_t *pi,
         break;
     }
     case NEW_NEARESTMV: {
-        NmvContext *const nmvc = &parse_ctxt->cur_tile_ctx.nmvc;
+        NmvContext *const nmvc = &parse_ctx->cur_tile_ctx.nmvc;
         read_mv(r, &mv[0].as_mv, &ref_mv[0].as_mv, nmvc, allow_hp);
         assert(is_compound);
         mv[1].as_int = nearest_mv[1].as_int;
@@ -1413,20 +1412,20 @@ static INLINE int assign_mv(EbDecHandle *dec_handle, PartitionInfo_t *pi,
     }
     case NEAREST_NEWMV: {
         mv[0].as_int = nearest_mv[0].as_int;
-        NmvContext *const nmvc = &parse_ctxt->cur_tile_ctx.nmvc;
+        NmvContext *const nmvc = &parse_ctx->cur_tile_ctx.nmvc;
         read_mv(r, &mv[1].as_mv, &ref_mv[1].as_mv, nmvc, allow_hp);
         assert(is_compound);
         break;
     }
     case NEAR_NEWMV: {
         mv[0].as_int = near_mv[0].as_int;
-        NmvContext *const nmvc = &parse_ctxt->cur_tile_ctx.nmvc;
+        NmvContext *const nmvc = &parse_ctx->cur_tile_ctx.nmvc;
         read_mv(r, &mv[1].as_mv, &ref_mv[1].as_mv, nmvc, allow_hp);
         assert(is_compound);
         break;
     }
     case NEW_NEARMV: {
-        NmvContext *const nmvc = &parse_ctxt->cur_tile_ctx.nmvc;
+        NmvContext *const nmvc = &parse_ctx->cur_tile_ctx.nmvc;
         read_mv(r, &mv[0].as_mv, &ref_mv[0].as_mv, nmvc, allow_hp);
         assert(is_compound);
         mv[1].as_int = near_mv[1].as_int;
@@ -1447,9 +1446,10 @@ static INLINE int assign_mv(EbDecHandle *dec_handle, PartitionInfo_t *pi,
     return ret;
 }
 
-static INLINE int is_dv_valid(MV dv, EbDecHandle *dec_handle,
+static INLINE int is_dv_valid(MV dv, ParseCtxt *parse_ctx,
     PartitionInfo_t *pi, int mi_row, int mi_col, int mib_size_log2)
 {
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     int subsampling_x = dec_handle->seq_header.color_config.subsampling_x;
     int subsampling_y = dec_handle->seq_header.color_config.subsampling_y;
     BlockSize bsize = pi->mi->sb_type;
@@ -1459,7 +1459,6 @@ static INLINE int is_dv_valid(MV dv, EbDecHandle *dec_handle,
     if (((dv.row & (SCALE_PX_TO_MV - 1)) || (dv.col & (SCALE_PX_TO_MV - 1))))
         return 0;
 
-    ParseCtxt *parse_ctx = (ParseCtxt*)dec_handle->pv_parse_ctxt;
     TileInfo *tile = &parse_ctx->cur_tile_info;
     const int src_top_edge = mi_row * MI_SIZE * SCALE_PX_TO_MV + dv.row;
     const int tile_top_edge = tile->mi_row_start * MI_SIZE * SCALE_PX_TO_MV;
@@ -1509,11 +1508,11 @@ static INLINE int is_dv_valid(MV dv, EbDecHandle *dec_handle,
     return 1;
 }
 
-int dec_assign_dv(EbDecHandle *dec_handle, PartitionInfo_t *pi, IntMv *mv,
+int dec_assign_dv(ParseCtxt *parse_ctx, PartitionInfo_t *pi, IntMv *mv,
     IntMv *ref_mv, int mi_row, int mi_col, SvtReader *r)
 {
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
-    FRAME_CONTEXT *frm_ctx = &parse_ctxt->cur_tile_ctx;
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
+    FRAME_CONTEXT *frm_ctx = &parse_ctx->cur_tile_ctx;
     read_mv(r, &mv->as_mv, &ref_mv->as_mv, &frm_ctx->ndvc, MV_SUBPEL_NONE);
     // DV should not have sub-pel.
     assert((mv->as_mv.col & 7) == 0);
@@ -1521,38 +1520,38 @@ int dec_assign_dv(EbDecHandle *dec_handle, PartitionInfo_t *pi, IntMv *mv,
     mv->as_mv.col = (mv->as_mv.col >> 3) * 8;
     mv->as_mv.row = (mv->as_mv.row >> 3) * 8;
     int valid = is_mv_valid(&mv->as_mv) &&
-        is_dv_valid(mv->as_mv, dec_handle, pi, mi_row, mi_col,
+        is_dv_valid(mv->as_mv, parse_ctx, pi, mi_row, mi_col,
             dec_handle->seq_header.sb_size_log2);
     return valid;
 }
 
-void assign_intrabc_mv(EbDecHandle *dec_handle,
+void assign_intrabc_mv(ParseCtxt *parse_ctx,
     IntMv ref_mvs[INTRA_FRAME + 1][MAX_MV_REF_CANDIDATES],
     PartitionInfo_t *pi, int mi_row, int mi_col, SvtReader *r)
 {
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     BlockModeInfo *mbmi = pi->mi;
     IntMv nearestmv, nearmv;
     svt_find_best_ref_mvs(0, ref_mvs[INTRA_FRAME], &nearestmv, &nearmv, 0);
     IntMv dv_ref = nearestmv.as_int == 0 ? nearmv : nearestmv;
     if (dv_ref.as_int == 0) {
-        av1_find_ref_dv(&dv_ref, &parse_ctxt->cur_tile_info,
+        av1_find_ref_dv(&dv_ref, &parse_ctx->cur_tile_info,
             dec_handle->seq_header.sb_mi_size, mi_row, mi_col);
     }
     // Ref DV should not have sub-pel.
     int valid_dv = (dv_ref.as_mv.col & 7) == 0 && (dv_ref.as_mv.row & 7) == 0;
     dv_ref.as_mv.col = (dv_ref.as_mv.col >> 3) * 8;
     dv_ref.as_mv.row = (dv_ref.as_mv.row >> 3) * 8;
-    valid_dv = valid_dv && dec_assign_dv(dec_handle, pi, &mbmi->mv[0], &dv_ref,
+    valid_dv = valid_dv && dec_assign_dv(parse_ctx, pi, &mbmi->mv[0], &dv_ref,
         mi_row, mi_col, r);
 }
 
 
-void read_interintra_mode(EbDecHandle *dec_handle,
+void read_interintra_mode(ParseCtxt *parse_ctx,
     BlockModeInfo *mbmi, SvtReader *r)
 {
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
-    FRAME_CONTEXT *frm_ctx = &parse_ctxt->cur_tile_ctx;
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
+    FRAME_CONTEXT *frm_ctx = &parse_ctx->cur_tile_ctx;
     BlockSize bsize = mbmi->sb_type;
     if (dec_handle->seq_header.enable_interintra_compound
         && !mbmi->skip_mode && is_interintra_allowed(mbmi))
@@ -1595,8 +1594,8 @@ static INLINE void add_samples(BlockModeInfo *mbmi, int *pts, int *pts_inref,
     pts_inref[1] = (y * 8) + mbmi->mv[0].as_mv.row;
 }
 
-int find_warp_samples(EbDecHandle *dec_handle, PartitionInfo_t *pi,
-    int mi_row, int mi_col, int *pts, int *pts_inref)
+int find_warp_samples(EbDecHandle *dec_handle, TileInfo *tile,
+    PartitionInfo_t *pi, int mi_row, int mi_col, int *pts, int *pts_inref)
 {
     BlockModeInfo *const mbmi0 = pi->mi;
     int ref_frame = mbmi0->ref_frame[0];
@@ -1604,8 +1603,6 @@ int find_warp_samples(EbDecHandle *dec_handle, PartitionInfo_t *pi,
     int left_available = pi->left_available;
     int i, mi_step = 1, np = 0;
 
-    ParseCtxt *parse_ctx = (ParseCtxt*)dec_handle->pv_parse_ctxt;
-    TileInfo *tile = &parse_ctx->cur_tile_info;
     int do_tl = 1;
     int do_tr = 1;
     int b4_w = mi_size_wide[pi->mi->sb_type];
@@ -1735,10 +1732,10 @@ int find_warp_samples(EbDecHandle *dec_handle, PartitionInfo_t *pi,
     return np;
 }
 
-int has_overlappable_cand(EbDecHandle *dec_handle, PartitionInfo_t *pi,
+int has_overlappable_cand(ParseCtxt *parse_ctx, PartitionInfo_t *pi,
     int mi_row, int mi_col)
 {
-    ParseCtxt *parse_ctx = (ParseCtxt*)dec_handle->pv_parse_ctxt;
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     const TileInfo *const tile = &parse_ctx->cur_tile_info;
     BlockModeInfo *mbmi = pi->mi;
     if (!is_motion_variation_allowed_bsize(mbmi->sb_type)) return 0;
@@ -1768,10 +1765,11 @@ int has_overlappable_cand(EbDecHandle *dec_handle, PartitionInfo_t *pi,
     return 0;
 }
 
-static INLINE MotionMode is_motion_mode_allowed(EbDecHandle *dec_handle,
+static INLINE MotionMode is_motion_mode_allowed(ParseCtxt *parse_ctx,
     GlobalMotionParams *gm_params, PartitionInfo_t *pi, int mi_row,
     int mi_col, int allow_warped_motion)
 {
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     BlockModeInfo *mbmi = pi->mi;
     if (dec_handle->frame_header.force_integer_mv == 0) {
         const TransformationType gm_type = gm_params[mbmi->ref_frame[0]].gm_type;
@@ -1781,7 +1779,7 @@ static INLINE MotionMode is_motion_mode_allowed(EbDecHandle *dec_handle,
     if ((block_size_wide[mbmi->sb_type] >= 8 && block_size_high[mbmi->sb_type] >= 8) &&
         (mbmi->mode >= NEARESTMV && mbmi->mode < MB_MODE_COUNT)
         && mbmi->ref_frame[1] != INTRA_FRAME && !has_second_ref(mbmi)) {
-        if (!has_overlappable_cand(dec_handle, pi, mi_row, mi_col))
+        if (!has_overlappable_cand(parse_ctx, pi, mi_row, mi_col))
             return SIMPLE_TRANSLATION;
         assert(!has_second_ref(mbmi));
 
@@ -1800,11 +1798,11 @@ static INLINE MotionMode is_motion_mode_allowed(EbDecHandle *dec_handle,
     }
 }
 
-MotionMode read_motion_mode(EbDecHandle *dec_handle,
+MotionMode read_motion_mode(ParseCtxt *parse_ctx,
     PartitionInfo_t *pi, int mi_row, int mi_col, SvtReader *r)
 {
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
-    FRAME_CONTEXT *frm_ctx = &parse_ctxt->cur_tile_ctx;
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
+    FRAME_CONTEXT *frm_ctx = &parse_ctx->cur_tile_ctx;
     FrameHeader *frame_info = &dec_handle->frame_header;
     int allow_warped_motion = frame_info->allow_warped_motion;
     BlockModeInfo *mbmi = pi->mi;
@@ -1813,7 +1811,7 @@ MotionMode read_motion_mode(EbDecHandle *dec_handle,
     if (mbmi->skip_mode) return SIMPLE_TRANSLATION;
 
     const MotionMode last_motion_mode_allowed =
-        is_motion_mode_allowed(dec_handle,
+        is_motion_mode_allowed(parse_ctx,
             dec_handle->cur_pic_buf[0]->global_motion, pi,
             mi_row, mi_col, allow_warped_motion);
     int motion_mode;
@@ -1902,33 +1900,32 @@ int get_comp_index_context(EbDecHandle *dec_handle, PartitionInfo_t *pi) {
     return above_ctx + left_ctx + 3 * offset;
 }
 
-void update_compound_ctx(EbDecHandle *dec_handle, PartitionInfo_t *pi,
+void update_compound_ctx(ParseCtxt *parse_ctx, PartitionInfo_t *pi,
     uint32_t blk_row, uint32_t blk_col,
     uint32_t comp_grp_idx)
 {
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
-    ParseNbr4x4Ctxt *ngr_ctx = &parse_ctxt->parse_nbr4x4_ctxt;
+    ParseNbr4x4Ctxt *ngr_ctx = &parse_ctx->parse_nbr4x4_ctxt;
 
     const uint32_t bw = mi_size_wide[pi->mi->sb_type];
     const uint32_t bh = mi_size_high[pi->mi->sb_type];
 
     int8_t *above_ctx = ngr_ctx->above_comp_grp_idx + blk_col;
     int8_t *left_ctx = ngr_ctx->left_comp_grp_idx +
-        ((blk_row - parse_ctxt->sb_row_mi) & MAX_MIB_MASK);
+        ((blk_row - parse_ctx->sb_row_mi) & MAX_MIB_MASK);
 
     memset(above_ctx, comp_grp_idx, bw);
     memset(left_ctx, comp_grp_idx, bh);
 }
 
-void read_compound_type(EbDecHandle *dec_handle, PartitionInfo_t *pi,
+void read_compound_type(ParseCtxt *parse_ctx, PartitionInfo_t *pi,
     int32_t mi_row, int32_t mi_col, SvtReader *r)
 {
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     BlockModeInfo *mbmi = pi->mi;
     BlockSize bsize = mbmi->sb_type;
     int32_t comp_group_idx = 0;
     mbmi->compound_idx = 1;
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
-    FRAME_CONTEXT *frm_ctx = &parse_ctxt->cur_tile_ctx;
+    FRAME_CONTEXT *frm_ctx = &parse_ctx->cur_tile_ctx;
 
     if (mbmi->skip_mode) mbmi->inter_inter_compound.type = COMPOUND_AVERAGE;
 
@@ -1938,7 +1935,7 @@ void read_compound_type(EbDecHandle *dec_handle, PartitionInfo_t *pi,
             dec_handle->seq_header.enable_masked_compound;
 
         if (masked_compound_used) {
-            const int ctx_comp_group_idx = get_comp_group_idx_context(parse_ctxt, pi);
+            const int ctx_comp_group_idx = get_comp_group_idx_context(parse_ctx, pi);
             comp_group_idx = svt_read_symbol(
                 r, frm_ctx->comp_group_idx_cdf[ctx_comp_group_idx], 2, ACCT_STR);
         }
@@ -1985,7 +1982,7 @@ void read_compound_type(EbDecHandle *dec_handle, PartitionInfo_t *pi,
         }
     }
 
-    update_compound_ctx(dec_handle, pi, mi_row, mi_col, comp_group_idx);
+    update_compound_ctx(parse_ctx, pi, mi_row, mi_col, comp_group_idx);
 }
 
 static INLINE int is_nontrans_global_motion(PartitionInfo_t *pi,
@@ -2061,16 +2058,16 @@ int get_context_interp(PartitionInfo_t *pi, int dir) {
     return filter_type_ctx;
 }
 
-void inter_block_mode_info(EbDecHandle *dec_handle, PartitionInfo_t* pi,
+void inter_block_mode_info(ParseCtxt *parse_ctx, PartitionInfo_t* pi,
     int mi_row, int mi_col, SvtReader *r)
 {
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     BlockModeInfo *mbmi = pi->mi;
     const int allow_hp = dec_handle->frame_header.allow_high_precision_mv;
     IntMv ref_mvs[MODE_CTX_REF_FRAMES][MAX_MV_REF_CANDIDATES] = { { { 0 } } };
     int16_t inter_mode_ctx[MODE_CTX_REF_FRAMES];
     int pts[SAMPLES_ARRAY_SIZE], pts_inref[SAMPLES_ARRAY_SIZE];
     SegmentationParams *seg = &dec_handle->frame_header.segmentation_params;
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
     MvCount mv_cnt;
 
     mbmi->palette_size[0] = 0;
@@ -2080,7 +2077,7 @@ void inter_block_mode_info(EbDecHandle *dec_handle, PartitionInfo_t* pi,
 
     svt_collect_neighbors_ref_counts(pi);
 
-    read_ref_frames(dec_handle, pi, r);
+    read_ref_frames(parse_ctx, pi, r);
    /* if ((pi->mi->ref_frame[0] >= BWDREF_FRAME && pi->mi->ref_frame[0] <= ALTREF_FRAME) ||
         (pi->mi->ref_frame[1] >= BWDREF_FRAME && pi->mi->ref_frame[1] <= ALTREF_FRAME)) {
         printf("ALTREF found - frame : %d\n", dec_handle->dec_cnt);
@@ -2090,7 +2087,7 @@ void inter_block_mode_info(EbDecHandle *dec_handle, PartitionInfo_t* pi,
 
     MvReferenceFrame ref_frame = av1_ref_frame_type(mbmi->ref_frame);
     IntMv global_mvs[2];
-    av1_find_mv_refs(dec_handle, pi, ref_frame, pi->ref_mv_stack,
+    av1_find_mv_refs(parse_ctx, pi, ref_frame, pi->ref_mv_stack,
         ref_mvs, global_mvs, mi_row, mi_col,
         inter_mode_ctx, &mv_cnt);
 
@@ -2118,17 +2115,17 @@ void inter_block_mode_info(EbDecHandle *dec_handle, PartitionInfo_t* pi,
             mbmi->mode = GLOBALMV;
         else {
             if (is_compound)
-                mbmi->mode = read_inter_compound_mode(dec_handle, r, mode_ctx);
+                mbmi->mode = read_inter_compound_mode(parse_ctx, r, mode_ctx);
             else {
-                int new_mv = svt_read_symbol(r, parse_ctxt->cur_tile_ctx.
+                int new_mv = svt_read_symbol(r, parse_ctx->cur_tile_ctx.
                     newmv_cdf[mode_ctx & NEWMV_CTX_MASK], 2, ACCT_STR);
                 if (new_mv) {
                     int zero_mv = svt_read_symbol(r,
-                        parse_ctxt->cur_tile_ctx.zeromv_cdf
+                        parse_ctx->cur_tile_ctx.zeromv_cdf
                         [(mode_ctx >> GLOBALMV_OFFSET) & GLOBALMV_CTX_MASK],
                         2, ACCT_STR);
                     if (zero_mv) {
-                        int ref_mv = svt_read_symbol(r, parse_ctxt->cur_tile_ctx.
+                        int ref_mv = svt_read_symbol(r, parse_ctx->cur_tile_ctx.
                             refmv_cdf[(mode_ctx >> REFMV_OFFSET) & REFMV_CTX_MASK],
                             2, ACCT_STR);
                         mbmi->mode = ref_mv ? NEARMV : NEARESTMV;
@@ -2141,7 +2138,7 @@ void inter_block_mode_info(EbDecHandle *dec_handle, PartitionInfo_t* pi,
             }
             if (mbmi->mode == NEWMV || mbmi->mode == NEW_NEWMV ||
                 has_nearmv(mbmi->mode))
-                read_drl_idx(dec_handle, pi, mbmi, r, mv_cnt.num_mv_found[ref_frame]);
+                read_drl_idx(parse_ctx, pi, mbmi, r, mv_cnt.num_mv_found[ref_frame]);
         }
     }
     mbmi->uv_mode = UV_DC_PRED;
@@ -2198,7 +2195,7 @@ void inter_block_mode_info(EbDecHandle *dec_handle, PartitionInfo_t* pi,
         }
     }
 
-    assign_mv(dec_handle, pi, mbmi->mv, global_mvs,
+    assign_mv(parse_ctx, pi, mbmi->mv, global_mvs,
         ref_mv, nearestmv, nearmv, is_compound, allow_hp, r);
 
 #if EXTRA_DUMP
@@ -2207,18 +2204,19 @@ void inter_block_mode_info(EbDecHandle *dec_handle, PartitionInfo_t* pi,
         fflush(stdout);
     }
 #endif
-    read_interintra_mode(dec_handle, mbmi, r);
+    read_interintra_mode(parse_ctx, mbmi, r);
 
     for (int ref = 0; ref < 1 + has_second_ref(mbmi); ++ref) {
         const MvReferenceFrame frame = mbmi->ref_frame[ref];
         pi->block_ref_sf[ref] = get_ref_scale_factors(dec_handle, frame);
     }
 
-    pi->num_samples = find_warp_samples(dec_handle, pi, mi_row, mi_col, pts, pts_inref);
+    pi->num_samples = find_warp_samples(dec_handle, &parse_ctx->cur_tile_info,
+        pi, mi_row, mi_col, pts, pts_inref);
 
-    mbmi->motion_mode = read_motion_mode(dec_handle, pi, mi_row, mi_col, r);
+    mbmi->motion_mode = read_motion_mode(parse_ctx, pi, mi_row, mi_col, r);
 
-    read_compound_type(dec_handle, pi, mi_row, mi_col, r);
+    read_compound_type(parse_ctx, pi, mi_row, mi_col, r);
 
     if (!av1_is_interp_needed(pi, dec_handle->cur_pic_buf[0]->global_motion)) {
         mbmi->interp_filters =
@@ -2235,7 +2233,7 @@ void inter_block_mode_info(EbDecHandle *dec_handle, PartitionInfo_t* pi,
             for (int dir = 0; dir < 2; ++dir) {
                 const int ctx = get_context_interp(pi, dir);
                 ref0_filter[dir] = (InterpFilter)svt_read_symbol(
-                    r, parse_ctxt->cur_tile_ctx.switchable_interp_cdf[ctx], SWITCHABLE_FILTERS, ACCT_STR);
+                    r, parse_ctx->cur_tile_ctx.switchable_interp_cdf[ctx], SWITCHABLE_FILTERS, ACCT_STR);
                 if (dec_handle->seq_header.enable_dual_filter == 0) {
                     ref0_filter[1] = ref0_filter[0];
                     break;
@@ -2308,12 +2306,12 @@ int get_palette_color_context(
 }
 
 
-void palette_tokens(EbDecHandle *dec_handle, PartitionInfo_t *pi,
+void palette_tokens(ParseCtxt *parse_ctx, PartitionInfo_t *pi,
     int mi_row, int mi_col, SvtReader *r)
 {
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     BlockModeInfo *mbmi = pi->mi;
     BlockSize bsize = mbmi->sb_type;
-    ParseCtxt *parse_ctx = (ParseCtxt*)dec_handle->pv_parse_ctxt;
     ParseNbr4x4Ctxt  *nbr_ctx = &parse_ctx->parse_nbr4x4_ctxt;
     FRAME_CONTEXT *frm_ctx = &parse_ctx->cur_tile_ctx;
     int block_height = block_size_high[bsize];
@@ -19,6 +19,7 @@
 #include "EbDefinitions.h"
 #include "EbUtility.h"
 #include "EbEntropyCoding.h"
+#include "EbThreads.h"
 
 #include"EbAv1Structs.h"
 #include "EbDecStruct.h"
@@ -42,6 +43,8 @@
 #include "EbDecLF.h"
 
 #include "EbDecCdef.h"
+#include "EbDecPostFilter.h"
+#include "EbDecFrameThreads.h"
 
 
 #define CONFIG_MAX_DECODE_PROFILE 2
@@ -52,9 +55,6 @@ void dec_init_intra_predictors_12b_internal(void);
 int remap_lr_type[4] = {
     RESTORE_NONE, RESTORE_SWITCHABLE, RESTORE_WIENER, RESTORE_SGRPROJ };
 
-void av1_superres_upscale(Av1Common *cm, FrameHeader *frm_hdr, SeqHeader*seq_hdr,
-    EbPictureBufferDesc *recon_picture_src);
-
 /* Checks that the remaining bits start with a 1 and ends with 0s.
  * It consumes an additional byte, if already byte aligned before the check. */
 int av1_check_trailing_bits(bitstrm_t *bs)
@@ -1567,6 +1567,24 @@ EbErrorType reset_parse_ctx(FRAME_CONTEXT *frm_ctx, uint8_t base_qp) {
     return return_error;
 }
 
+/* Loads the CDFs of the primary reference frame and projects the MVs of the
+   reference frames */
+void setup_ref_frame_ctxts(EbDecHandle *dec_handle_ptr)
+{
+    FrameHeader *frame_info = &dec_handle_ptr->frame_header;
+    ParseCtxt   *parse_ctxt = (ParseCtxt *)dec_handle_ptr->pv_parse_ctxt;
+
+    if (frame_info->primary_ref_frame == PRIMARY_REF_NONE)
+        reset_parse_ctx(&parse_ctxt->init_frm_ctx,
+            frame_info->quantization_params.base_q_idx);
+    else
+        /* Load CDF */
+        parse_ctxt->init_frm_ctx = get_ref_frame_buf(dec_handle_ptr,
+            frame_info->primary_ref_frame + 1)->final_frm_ctx;
+
+    svt_setup_motion_field(dec_handle_ptr);
+}
+
 void setup_frame_sign_bias(EbDecHandle *dec_handle) {
     MvReferenceFrame ref_frame;
     for (ref_frame = LAST_FRAME; ref_frame <= ALTREF_FRAME; ++ref_frame) {
@@ -1992,15 +2010,6 @@ void read_uncompressed_header(bitstrm_t *bs, EbDecHandle *dec_handle_ptr,
     read_frame_delta_lf_params(bs, frame_info);
     setup_segmentation_dequant(dec_handle_ptr, &seq_header->color_config);
 
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle_ptr->pv_parse_ctxt;
-    if (frame_info->primary_ref_frame == PRIMARY_REF_NONE)
-        reset_parse_ctx(&parse_ctxt->init_frm_ctx,
-            frame_info->quantization_params.base_q_idx);
-    else
-        /* Load CDF */
-        parse_ctxt->init_frm_ctx = get_ref_frame_buf(dec_handle_ptr,
-            frame_info->primary_ref_frame + 1)->final_frm_ctx;
-
     frame_info->coded_lossless = 1;
     for (int i = 0; i < MAX_SEGMENTS; ++i) {
         int qindex = get_qindex(&frame_info->segmentation_params, i,
@@ -2065,9 +2074,10 @@ void read_uncompressed_header(bitstrm_t *bs, EbDecHandle *dec_handle_ptr,
     dec_handle_ptr->show_frame          = frame_info->show_frame;
     dec_handle_ptr->showable_frame      = frame_info->showable_frame;
 
-    /* TODO: Should be moved to caller */
-    if(!frame_info->show_existing_frame)
-        svt_setup_motion_field(dec_handle_ptr);
+    /* A frame ctxt loads them on its frame thread, once the reference
+       frames are parsed */
+    if (!frame_info->show_existing_frame && !dec_handle_ptr->pv_frame_job)
+        setup_ref_frame_ctxts(dec_handle_ptr);
 }
 
 EbErrorType read_frame_header_obu(bitstrm_t *bs, EbDecHandle *dec_handle_ptr,
@@ -2104,12 +2114,12 @@ EbErrorType read_frame_header_obu(bitstrm_t *bs, EbDecHandle *dec_handle_ptr,
     return status;
 }
 
-void clear_above_context(EbDecHandle *dec_handle_ptr, int mi_col_start,
+void clear_above_context(ParseCtxt *parse_ctxt, int mi_col_start,
                          int mi_col_end, const int tile_row)
 {
     assert(0 == tile_row);
 
-    ParseCtxt   *parse_ctxt = (ParseCtxt *)dec_handle_ptr->pv_parse_ctxt;
+    EbDecHandle *dec_handle_ptr = (EbDecHandle *)parse_ctxt->dec_handle_ptr;
     SeqHeader   *seq_params = &dec_handle_ptr->seq_header;
 
     int num_planes  = av1_num_planes(&seq_params->color_config);
@@ -2158,9 +2168,9 @@ void clear_above_context(EbDecHandle *dec_handle_ptr, int mi_col_start,
         tx_size_wide[TX_SIZES_LARGEST], width_y * sizeof(uint8_t));
 }
 
-void clear_left_context(EbDecHandle *dec_handle_ptr)
+void clear_left_context(ParseCtxt *parse_ctxt)
 {
-    ParseCtxt   *parse_ctxt = (ParseCtxt *)dec_handle_ptr->pv_parse_ctxt;
+    EbDecHandle *dec_handle_ptr = (EbDecHandle *)parse_ctxt->dec_handle_ptr;
     SeqHeader   *seq_params = &dec_handle_ptr->seq_header;
 
     /* Maintained only for 1 left SB! */
@@ -2194,9 +2204,8 @@ void clear_cdef(int8_t *sb_cdef_strength, int32_t cdef_factor)
     memset(sb_cdef_strength, -1, cdef_factor * sizeof(*sb_cdef_strength));
 }
 
-void clear_loop_filter_delta(EbDecHandle *dec_handle)
+void clear_loop_filter_delta(ParseCtxt *parse_ctx)
 {
-    ParseCtxt *parse_ctx = (ParseCtxt*)dec_handle->pv_parse_ctxt;
     for (int lf_id = 0; lf_id < FRAME_LF_COUNT; ++lf_id)
         parse_ctx->parse_nbr4x4_ctxt.delta_lf[lf_id] = 0;
 }
@@ -2209,21 +2218,22 @@ void clear_loop_restoration(int num_planes, PartitionInfo_t *part_info)
     }
 }
 
-EbErrorType parse_tile(bitstrm_t *bs, EbDecHandle *dec_handle_ptr,
-                       TilesInfo *tile_info, int32_t tile_row, int32_t tile_col)
+EbErrorType parse_tile(ParseCtxt *parse_ctx, TilesInfo *tile_info,
+                       int32_t tile_row, int32_t tile_col)
 {
-    (void)bs;
     EbErrorType status = EB_ErrorNone;
 
+    EbDecHandle *dec_handle_ptr = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     EbColorConfig *color_config = &dec_handle_ptr->seq_header.color_config;
     int num_planes = av1_num_planes(color_config);
 
-    clear_above_context(dec_handle_ptr, tile_info->tile_col_start_mi[tile_col],
-                        tile_info->tile_col_start_mi[tile_col + 1], 0 /*TODO: For MultiThread*/);
-    clear_loop_filter_delta(dec_handle_ptr);
+    /* Above ctxt is per thread, so each tile starts from its own column 0 */
+    clear_above_context(parse_ctx, tile_info->tile_col_start_mi[tile_col],
+                        tile_info->tile_col_start_mi[tile_col + 1], 0);
+    clear_loop_filter_delta(parse_ctx);
 
     /* Init ParseCtxt */
-    ParseCtxt *parse_ctx = (ParseCtxt*)dec_handle_ptr->pv_parse_ctxt;
+    DecModCtxt *dec_mod_ctxt = (DecModCtxt*)parse_ctx->pv_dec_mod_ctxt;
     RestorationUnitInfo *lr_unit[MAX_MB_PLANE];
 
     // Default initialization of Wiener and SGR Filter
@@ -2243,11 +2253,10 @@ EbErrorType parse_tile(bitstrm_t *bs, EbDecHandle *dec_handle_ptr,
     {
         int32_t sb_row = (mi_row << 2) >> dec_handle_ptr->seq_header.sb_size_log2;
 
-        clear_left_context(dec_handle_ptr);
+        clear_left_context(parse_ctx);
 
-        /*TODO: Move CFL to thread ctxt! We need to access DecModCtxt from parse_tile function */
         /*add tile level cfl init */
-        cfl_init(&((DecModCtxt*)dec_handle_ptr->pv_dec_mod_ctxt)->cfl_ctx, color_config);
+        cfl_init(&dec_mod_ctxt->cfl_ctx, color_config);
 
         for (uint32_t mi_col = tile_info->tile_col_start_mi[tile_col];
             mi_col < tile_info->tile_col_start_mi[tile_col + 1];
@@ -2291,10 +2300,11 @@ EbErrorType parse_tile(bitstrm_t *bs, EbDecHandle *dec_handle_ptr,
                 (sb_row * num_mis_in_sb * master_frame_buf->sb_cols >> sy) +
                 (sb_col * num_mis_in_sb >> sx);
 #if SINGLE_THRD_COEFF_BUF_OPT
-            /*TODO : Change to macro */
-            sb_info->sb_coeff[AOM_PLANE_Y] = frame_buf->coeff[AOM_PLANE_Y];
-            sb_info->sb_coeff[AOM_PLANE_U] = frame_buf->coeff[AOM_PLANE_U];
-            sb_info->sb_coeff[AOM_PLANE_V] = frame_buf->coeff[AOM_PLANE_V];
+            /* SB is decoded right after it is parsed, so the buffer is
+               reused by every SB of the thread */
+            sb_info->sb_coeff[AOM_PLANE_Y] = parse_ctx->sb_coeff_buf[AOM_PLANE_Y];
+            sb_info->sb_coeff[AOM_PLANE_U] = parse_ctx->sb_coeff_buf[AOM_PLANE_U];
+            sb_info->sb_coeff[AOM_PLANE_V] = parse_ctx->sb_coeff_buf[AOM_PLANE_V];
 #else
             /*TODO : Change to macro */
             sb_info->sb_coeff[AOM_PLANE_Y] = frame_buf->coeff[AOM_PLANE_Y] +
@@ -2339,7 +2349,6 @@ EbErrorType parse_tile(bitstrm_t *bs, EbDecHandle *dec_handle_ptr,
             parse_ctx->prev_blk_has_chroma = 1; //default at start of frame / tile
 
             /* Init DecModCtxt */
-            DecModCtxt *dec_mod_ctxt = (DecModCtxt*)dec_handle_ptr->pv_dec_mod_ctxt;
 #if !FRAME_MI_MAP
             dec_mod_ctxt->sb_row_mi = mi_row;
             dec_mod_ctxt->sb_col_mi = mi_col;
@@ -2357,7 +2366,7 @@ EbErrorType parse_tile(bitstrm_t *bs, EbDecHandle *dec_handle_ptr,
             update_nbrs_before_sb(&master_frame_buf->frame_mi_map, sb_col);
 #endif
             // Bit-stream parsing of the superblock
-            parse_super_block(dec_handle_ptr, mi_row, mi_col, sb_info);
+            parse_super_block(parse_ctx, mi_row, mi_col, sb_info);
 
             /* TO DO : Will move later */
             // decoding of the superblock
@@ -2420,16 +2429,80 @@ void svt_tile_init(TileInfo *cur_tile_info, FrameHeader *frame_header,
     assert(cur_tile_info->mi_col_end > cur_tile_info->mi_col_start);
 }
 
-// Read Tile group information
-EbErrorType read_tile_group_obu(bitstrm_t *bs, EbDecHandle *dec_handle_ptr,
-    TilesInfo *tiles_info, ObuHeader *obu_header, int *is_last_tg)
+/* Parses and decodes one tile of the tile group with the thread's ctxt */
+static EbErrorType decode_tile_job(ParseCtxt *parse_ctx, DecTileJob *tile_job)
 {
     EbErrorType status = EB_ErrorNone;
 
-    ParseCtxt   *parse_ctxt = (ParseCtxt *)dec_handle_ptr->pv_parse_ctxt;
-
+    EbDecHandle *dec_handle_ptr = (EbDecHandle *)parse_ctx->dec_handle_ptr;
+    ParseCtxt   *master_parse_ctx = (ParseCtxt *)dec_handle_ptr->pv_parse_ctxt;
     FrameHeader *frame_header = &dec_handle_ptr->frame_header;
+    TilesInfo   *tiles_info = &frame_header->tiles_info;
+
+    svt_tile_init(&parse_ctx->cur_tile_info, frame_header,
+                  tile_job->tile_row, tile_job->tile_col);
+
+    parse_ctx->parse_nbr4x4_ctxt.cur_q_ind =
+        frame_header->quantization_params.base_q_idx;
+
+    status = init_svt_reader(&parse_ctx->r, tile_job->data, tile_job->data_end,
+        tile_job->size, !(frame_header->disable_cdf_update));
+    if (status != EB_ErrorNone)
+        return status;
+
+    parse_ctx->cur_tile_ctx = master_parse_ctx->init_frm_ctx;
+
+    status = parse_tile(parse_ctx, tiles_info, tile_job->tile_row,
+                        tile_job->tile_col);
+
+    /* Save CDF */
+    if (!frame_header->disable_frame_end_update_cdf &&
+        (tile_job->tile_num == tiles_info->context_update_tile_id))
+    {
+        dec_handle_ptr->cur_pic_buf[0]->final_frm_ctx =
+                                    parse_ctx->cur_tile_ctx;
+        eb_av1_reset_cdf_symbol_counters(&dec_handle_ptr->cur_pic_buf[0]->final_frm_ctx);
+    }
 
+    return status;
+}
+
+/* Picks the tiles of the current tile group until all of them are taken */
+static void decode_tile_jobs(ParseCtxt *parse_ctx)
+{
+    EbDecHandle *dec_handle_ptr = (EbDecHandle *)parse_ctx->dec_handle_ptr;
+    int32_t job_idx;
+
+    while ((job_idx = eb_atomic_fetch_add(&dec_handle_ptr->next_tile_job, 1)) <
+           dec_handle_ptr->num_tile_jobs)
+    {
+        DecTileJob *tile_job = &dec_handle_ptr->tile_jobs[job_idx];
+        tile_job->status = decode_tile_job(parse_ctx, tile_job);
+    }
+}
+
+/* Tile thread kernel, runs one pass over the tile jobs per tile group */
+void* dec_thread_kernel(void *input_ptr)
+{
+    ParseCtxt   *parse_ctx = (ParseCtxt *)input_ptr;
+    EbDecHandle *dec_handle_ptr = (EbDecHandle *)parse_ctx->dec_handle_ptr;
+
+    for (;;) {
+        eb_block_on_semaphore(dec_handle_ptr->thread_start_semaphore);
+        if (dec_handle_ptr->thread_stage == DEC_STAGE_POST_FILTER)
+            dec_post_filter_rows(dec_handle_ptr);
+        else
+            decode_tile_jobs(parse_ctx);
+        eb_post_semaphore(dec_handle_ptr->thread_done_semaphore);
+    }
+    return NULL;
+}
+
+/* Reads the tile group header and the tile sizes, the tiles are appended
+   to the tile jobs of the frame */
+EbErrorType read_tile_group_header(bitstrm_t *bs, EbDecHandle *dec_handle_ptr,
+    TilesInfo *tiles_info, ObuHeader *obu_header, int *is_last_tg)
+{
     int num_tiles, tg_start, tg_end, tile_bits, tile_start_and_end_present_flag = 0;
     int tile_row, tile_col;
     size_t tile_size;
@@ -2476,7 +2549,11 @@ EbErrorType read_tile_group_obu(bitstrm_t *bs, EbDecHandle *dec_handle_ptr,
     dec_handle_ptr->cm.frm_size = dec_handle_ptr->frame_header.frame_size;
     dec_handle_ptr->cm.tiles_info = dec_handle_ptr->frame_header.tiles_info;
 
+    /* Tile sizes are read upfront so that the tiles can be parsed in any
+       order by the tile threads */
     for (int tile_num = tg_start; tile_num <= tg_end; tile_num++) {
+        DecTileJob *tile_job = &dec_handle_ptr->tile_jobs[dec_handle_ptr->num_tile_jobs++];
+
         tile_row = tile_num / tiles_info->tile_cols;
         tile_col = tile_num % tiles_info->tile_cols;
 
@@ -2487,117 +2564,87 @@ EbErrorType read_tile_group_obu(bitstrm_t *bs, EbDecHandle *dec_handle_ptr,
             obu_header->payload_size -= (tiles_info->tile_size_bytes + tile_size);
         }
         PRINT_FRAME("tile_size", (tile_size));
-        svt_tile_init(&parse_ctxt->cur_tile_info, frame_header,
-                        tile_row, tile_col);
-
-        parse_ctxt->parse_nbr4x4_ctxt.cur_q_ind =
-            frame_header->quantization_params.base_q_idx;
-
-        //init_symbol(tileSize)
 
-        status = init_svt_reader(&parse_ctxt->r,
-            (const uint8_t *)get_bitsteam_buf(bs), bs->buf_max, tile_size,
-            !(frame_header->disable_cdf_update));
-        if (status != EB_ErrorNone)
-            return status;
-#if 0
-        reset_parse_ctx(&parse_ctxt->frm_ctx[0],
-            frame_header->quantization_params.base_q_idx);
-#else
-        parse_ctxt->cur_tile_ctx = parse_ctxt->init_frm_ctx;
-#endif
-        /* TO DO decode_tile() */
-        status = parse_tile(bs, dec_handle_ptr, tiles_info, tile_row, tile_col);
+        tile_job->tile_num = tile_num;
+        tile_job->tile_row = tile_row;
+        tile_job->tile_col = tile_col;
+        tile_job->data = (const uint8_t *)get_bitsteam_buf(bs);
+        tile_job->data_end = bs->buf_max;
+        tile_job->size = tile_size;
+        tile_job->status = EB_ErrorNone;
 
-        /* Save CDF */
-        if (!frame_header->disable_frame_end_update_cdf &&
-            (tile_num == tiles_info->context_update_tile_id))
-        {
-            dec_handle_ptr->cur_pic_buf[0]->final_frm_ctx =
-                                        parse_ctxt->cur_tile_ctx;
-            eb_av1_reset_cdf_symbol_counters(&dec_handle_ptr->cur_pic_buf[0]->final_frm_ctx);
+        if (tile_num != tg_end) {
+            if (tile_size > (size_t)(bs->buf_max - tile_job->data))
+                return EB_Corrupt_Frame;
+            dec_bits_init(bs, tile_job->data + tile_size, obu_header->payload_size);
         }
-
-        dec_bits_init(bs, (uint8_t *)parse_ctxt->r.ec.bptr, obu_header->payload_size);
-
-        if (status != EB_ErrorNone)
-            return status;
     }
 
-    if ((tg_end + 1) != num_tiles)
-        return 0;
+    return EB_ErrorNone;
+}
 
-    if (!dec_handle_ptr->frame_header.allow_intrabc) {
-        if (dec_handle_ptr->frame_header.loop_filter_params.filter_level[0] ||
-            dec_handle_ptr->frame_header.loop_filter_params.filter_level[1])
-        {
-            /*LF Trigger function for each frame*/
-            dec_av1_loop_filter_frame(dec_handle_ptr,
-                dec_handle_ptr->cur_pic_buf[0]->ps_pic_buf,
-                dec_handle_ptr->pv_lf_ctxt,
-                AOM_PLANE_Y, MAX_MB_PLANE);
-        }
-
-        const int32_t do_cdef =
-            !frame_header->coded_lossless &&
-            (frame_header->CDEF_params.cdef_bits ||
-             frame_header->CDEF_params.cdef_y_strength[0] ||
-             frame_header->CDEF_params.cdef_uv_strength[0]);
-
-        int32_t do_upscale = !av1_superres_unscaled(&dec_handle_ptr->
-                             frame_header.frame_size);
-
-        const int opt_lr = !do_cdef && !do_upscale;
-
-        LRParams *lr_param = dec_handle_ptr->frame_header.lr_params;
-        int do_loop_restoration =
-            lr_param[AOM_PLANE_Y].frame_restoration_type != RESTORE_NONE ||
-            lr_param[AOM_PLANE_U].frame_restoration_type != RESTORE_NONE ||
-            lr_param[AOM_PLANE_V].frame_restoration_type != RESTORE_NONE;
-
-        if (!opt_lr) {
-            if (do_loop_restoration)
-                dec_av1_loop_restoration_save_boundary_lines(dec_handle_ptr, 0);
-
-            /*Calling cdef frame level function*/
-            if (do_cdef)
-                svt_cdef_frame(dec_handle_ptr);
-
-            if (do_upscale) {
-                av1_superres_upscale(&dec_handle_ptr->cm, &dec_handle_ptr->frame_header,
-                    &dec_handle_ptr->seq_header,
-                    dec_handle_ptr->cur_pic_buf[0]->ps_pic_buf);
-                dec_handle_ptr->cm.frm_size.frame_width =
-                    dec_handle_ptr->frame_header.frame_size.frame_width;
-            }
+/* Parses and reconstructs the tile jobs, and once the last tile group is
+   in, filters and pads the frame */
+EbErrorType decode_frame_tiles(EbDecHandle *dec_handle_ptr, int is_last_tg)
+{
+    ParseCtxt   *parse_ctxt = (ParseCtxt *)dec_handle_ptr->pv_parse_ctxt;
+    FrameHeader *frame_header = &dec_handle_ptr->frame_header;
+    EbDecPicBuf *cur_pic_buf = dec_handle_ptr->cur_pic_buf[0];
 
-            if (do_loop_restoration) {
-                dec_av1_loop_restoration_save_boundary_lines(dec_handle_ptr, 1);
+    /* Kick the tile threads, the calling thread works on the tiles too */
+    int32_t num_workers = AOMMIN(dec_handle_ptr->num_threads,
+                                 dec_handle_ptr->num_tile_jobs);
+    dec_handle_ptr->next_tile_job = 0;
+    dec_handle_ptr->thread_stage = DEC_STAGE_TILES;
+    for (int32_t i = 1; i < num_workers; i++)
+        eb_post_semaphore(dec_handle_ptr->thread_start_semaphore);
+    decode_tile_jobs(parse_ctxt);
+    for (int32_t i = 1; i < num_workers; i++)
+        eb_block_on_semaphore(dec_handle_ptr->thread_done_semaphore);
 
-                /* Padded bits are required for filtering pixel around frame boundary */
-                pad_pic(dec_handle_ptr->cur_pic_buf[0]->ps_pic_buf,
-                        &dec_handle_ptr->frame_header);
-                dec_av1_loop_restoration_filter_frame(dec_handle_ptr, opt_lr);
-            }
-        }
-        else {
-            if (do_loop_restoration) {
-                /* Padded bits are required for filtering pixel around frame boundary */
-                pad_pic(dec_handle_ptr->cur_pic_buf[0]->ps_pic_buf,
-                        &dec_handle_ptr->frame_header);
-                dec_av1_loop_restoration_filter_frame(dec_handle_ptr, opt_lr);
-            }
-        }
+    for (int32_t i = 0; i < dec_handle_ptr->num_tile_jobs; i++) {
+        if (dec_handle_ptr->tile_jobs[i].status != EB_ErrorNone)
+            return dec_handle_ptr->tile_jobs[i].status;
     }
 
+    if (!is_last_tg)
+        return EB_ErrorNone;
+
     /* Save CDF */
     if (frame_header->disable_frame_end_update_cdf)
-        dec_handle_ptr->cur_pic_buf[0]->final_frm_ctx = parse_ctxt->init_frm_ctx;
+        cur_pic_buf->final_frm_ctx = parse_ctxt->init_frm_ctx;
 
-    pad_pic(dec_handle_ptr->cur_pic_buf[0]->ps_pic_buf,
-            &dec_handle_ptr->frame_header);
+    /* The frames predicting their CDFs, segment ids and MVs from this one
+       can start */
+    if (dec_handle_ptr->pv_frame_job)
+        dec_pic_publish_progress(cur_pic_buf, &cur_pic_buf->parse_done, 1);
 
-    return status;
+    if (!frame_header->allow_intrabc)
+        dec_post_filter_frame(dec_handle_ptr);
+
+    /* A frame ctxt pads the rows as the post filters are done with them */
+    if (dec_handle_ptr->pv_frame_job)
+        dec_frame_publish_rows(dec_handle_ptr,
+            frame_header->frame_size.frame_height);
+    else
+        pad_pic(cur_pic_buf->ps_pic_buf, frame_header);
+
+    return EB_ErrorNone;
+}
+
+// Read Tile group information
+EbErrorType read_tile_group_obu(bitstrm_t *bs, EbDecHandle *dec_handle_ptr,
+    TilesInfo *tiles_info, ObuHeader *obu_header, int *is_last_tg)
+{
+    EbErrorType status;
+
+    dec_handle_ptr->num_tile_jobs = 0;
+    status = read_tile_group_header(bs, dec_handle_ptr, tiles_info,
+                                    obu_header, is_last_tg);
+    if (status != EB_ErrorNone)
+        return status;
+
+    return decode_frame_tiles(dec_handle_ptr, *is_last_tg);
 }
 
 EbErrorType decode_obu(EbDecHandle *dec_handle_ptr, unsigned char *data, unsigned int data_size)
@@ -2714,8 +2761,13 @@ EbErrorType decode_multiple_obu(EbDecHandle *dec_handle_ptr, uint8_t **data,
             if (!dec_handle_ptr->seen_frame_header)
             {
                 dec_handle_ptr->seen_frame_header = 1;
-                status = read_frame_header_obu(&bs, dec_handle_ptr, &obu_header,
-                                               obu_header.obu_type != OBU_FRAME);
+                if (dec_handle_ptr->pv_frame_thrd_ctxt)
+                    status = dec_frame_thrd_read_frame_header(dec_handle_ptr,
+                        &bs, &obu_header, obu_header.obu_type != OBU_FRAME,
+                        *data, data_size);
+                else
+                    status = read_frame_header_obu(&bs, dec_handle_ptr,
+                        &obu_header, obu_header.obu_type != OBU_FRAME);
             }
             /*else {
                  For OBU_REDUNDANT_FRAME_HEADER, previous frame_header is taken from dec_handle_ptr->frame_header
@@ -2730,9 +2782,13 @@ EbErrorType decode_multiple_obu(EbDecHandle *dec_handle_ptr, uint8_t **data,
             PRINT_NAME("**************OBU_TILE_GROUP*******************");
             if (!dec_handle_ptr->seen_frame_header)
                 return EB_Corrupt_Frame;
-            status = read_tile_group_obu(&bs, dec_handle_ptr,
-                &dec_handle_ptr->frame_header.tiles_info,
-                &obu_header, &frame_decoding_finished);
+            if (dec_handle_ptr->pv_frame_thrd_ctxt)
+                status = dec_frame_thrd_read_tile_group(dec_handle_ptr, &bs,
+                    &obu_header, &frame_decoding_finished);
+            else
+                status = read_tile_group_obu(&bs, dec_handle_ptr,
+                    &dec_handle_ptr->frame_header.tiles_info,
+                    &obu_header, &frame_decoding_finished);
             if (status != EB_ErrorNone) return status;
             if (frame_decoding_finished)
                 dec_handle_ptr->seen_frame_header = 0;
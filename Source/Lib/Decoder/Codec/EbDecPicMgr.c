@@ -69,7 +69,14 @@ EbErrorType dec_pic_mgr_init(EbDecHandle  *dec_handle_ptr) {
 
     EbDecPicMgr *ps_pic_mgr = *pps_pic_mgr;
 
-    for(i = 0; i < MAX_PIC_BUFS; i++){
+    /* Frame parallel decoding holds a buffer per frame in flight and per
+       frame waiting for output */
+    ps_pic_mgr->track_progress = dec_handle_ptr->num_frms_prll > 1;
+    ps_pic_mgr->max_pic_bufs = ps_pic_mgr->track_progress ?
+        REF_FRAMES + 1 + 2 * dec_handle_ptr->num_frms_prll : REF_FRAMES + 2;
+    assert(ps_pic_mgr->max_pic_bufs <= MAX_PIC_BUFS);
+
+    for(i = 0; i < ps_pic_mgr->max_pic_bufs; i++){
         ps_pic_mgr->as_dec_pic[i].ps_pic_buf = NULL;
         ps_pic_mgr->as_dec_pic[i].is_free    = 1;
         ps_pic_mgr->as_dec_pic[i].size       = 0;
@@ -78,6 +85,14 @@ EbErrorType dec_pic_mgr_init(EbDecHandle  *dec_handle_ptr) {
         EB_MALLOC_DEC(uint8_t*, ps_pic_mgr->as_dec_pic[i].segment_maps,
             size * sizeof(uint8_t), EB_N_PTR);
         memset(ps_pic_mgr->as_dec_pic[i].segment_maps, 0, size);
+
+        ps_pic_mgr->as_dec_pic[i].progress_mutex = NULL;
+        ps_pic_mgr->as_dec_pic[i].progress_semaphore = NULL;
+        if (ps_pic_mgr->track_progress) {
+            EB_CREATE_MUTEX_DEC(ps_pic_mgr->as_dec_pic[i].progress_mutex);
+            EB_CREATE_SEMAPHORE_DEC(ps_pic_mgr->as_dec_pic[i].progress_semaphore,
+                0, DEC_MAX_NUM_FRM_PRLL * MAX_TILE_ROWS * MAX_TILE_COLS);
+        }
     }
 
     ps_pic_mgr->num_pic_bufs = 0;
@@ -124,12 +139,12 @@ EbDecPicBuf * dec_pic_mgr_get_cur_pic(EbDecPicMgr *ps_pic_mgr,
     EbDecPicBuf *pic_buf = NULL;
     /* TODO: Add lock and unlock for MT */
     // Find a free buffer.
-    for (i = 0; i < MAX_PIC_BUFS; i++) {
+    for (i = 0; i < ps_pic_mgr->max_pic_bufs; i++) {
         if (ps_pic_mgr->as_dec_pic[i].is_free == 1)
             break;
     }
 
-    if (i >= MAX_PIC_BUFS)
+    if (i >= ps_pic_mgr->max_pic_bufs)
         return NULL;
 
     uint16_t    frame_width  = frame_info->frame_size.frame_width;
@@ -184,9 +199,26 @@ EbDecPicBuf * dec_pic_mgr_get_cur_pic(EbDecPicMgr *ps_pic_mgr,
 
     pic_buf = &ps_pic_mgr->as_dec_pic[i];
 
+    /* Without frame parallel decoding a picture is complete by the time it
+       is referenced */
+    pic_buf->sb_size_log2 = seq_header->sb_size_log2;
+    pic_buf->sb_rows = (frame_height + (1 << pic_buf->sb_size_log2) - 1) >>
+        pic_buf->sb_size_log2;
+    pic_buf->parse_done = !ps_pic_mgr->track_progress;
+    pic_buf->sb_rows_done = ps_pic_mgr->track_progress ? 0 : pic_buf->sb_rows;
+    pic_buf->num_waiters = 0;
+
     return pic_buf;
 }
 
+EbBool dec_pic_mgr_has_free_pic(EbDecPicMgr *ps_pic_mgr) {
+    for (int32_t i = 0; i < ps_pic_mgr->max_pic_bufs; i++) {
+        if (ps_pic_mgr->as_dec_pic[i].is_free == 1)
+            return EB_TRUE;
+    }
+    return EB_FALSE;
+}
+
 static INLINE void dec_ref_count_and_rel(EbDecPicBuf *ps_pic_buf) {
 
     if (ps_pic_buf != NULL) {
@@ -199,6 +231,43 @@ static INLINE void dec_ref_count_and_rel(EbDecPicBuf *ps_pic_buf) {
     }
 }
 
+/* Holds a picture for a frame in flight or waiting for output */
+void dec_pic_mgr_add_ref(EbDecPicBuf *ps_pic_buf) {
+    ps_pic_buf->ref_count++;
+}
+
+void dec_pic_mgr_release(EbDecPicBuf *ps_pic_buf) {
+    dec_ref_count_and_rel(ps_pic_buf);
+}
+
+/* Waits until *progress reaches value. The progress is checked under
+   progress_mutex, and every update wakes up the readers waiting then */
+void dec_pic_wait_progress(EbDecPicBuf *ps_pic_buf, volatile int32_t *progress,
+                           int32_t value)
+{
+    eb_block_on_mutex(ps_pic_buf->progress_mutex);
+    while (*progress < value) {
+        ps_pic_buf->num_waiters++;
+        eb_release_mutex(ps_pic_buf->progress_mutex);
+        eb_block_on_semaphore(ps_pic_buf->progress_semaphore);
+        eb_block_on_mutex(ps_pic_buf->progress_mutex);
+    }
+    eb_release_mutex(ps_pic_buf->progress_mutex);
+}
+
+void dec_pic_publish_progress(EbDecPicBuf *ps_pic_buf,
+                              volatile int32_t *progress, int32_t value)
+{
+    eb_block_on_mutex(ps_pic_buf->progress_mutex);
+    eb_atomic_store(progress, value);
+    int32_t num_waiters = ps_pic_buf->num_waiters;
+    ps_pic_buf->num_waiters = 0;
+    eb_release_mutex(ps_pic_buf->progress_mutex);
+
+    for (int32_t i = 0; i < num_waiters; i++)
+        eb_post_semaphore(ps_pic_buf->progress_semaphore);
+}
+
 /**
 *******************************************************************************
 *
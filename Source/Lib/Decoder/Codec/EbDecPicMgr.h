@@ -6,6 +6,8 @@
 #ifndef EbDecPicMgr_h
 #define EbDecPicMgr_h
 
+#include "EbThreads.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -19,6 +21,12 @@ typedef struct EbDecPicMgr {
     /* number of picture buffers */
     uint8_t     num_pic_bufs;
 
+    /* number of picture buffers in use, more in frame parallel decoding */
+    uint8_t     max_pic_bufs;
+
+    /* Pictures publish their decode progress, for frame parallel decoding */
+    uint8_t     track_progress;
+
 } EbDecPicMgr;
 
 typedef struct RefFrameInfo {
@@ -41,6 +49,31 @@ void dec_pic_mgr_update_ref_pic(EbDecHandle *dec_handle_ptr, int32_t frame_decod
 
 void generate_next_ref_frame_map(EbDecHandle *dec_handle_ptr);
 
+EbBool dec_pic_mgr_has_free_pic(EbDecPicMgr *ps_pic_mgr);
+void dec_pic_mgr_add_ref(EbDecPicBuf *ps_pic_buf);
+void dec_pic_mgr_release(EbDecPicBuf *ps_pic_buf);
+
+void dec_pic_wait_progress(EbDecPicBuf *ps_pic_buf, volatile int32_t *progress,
+                           int32_t value);
+void dec_pic_publish_progress(EbDecPicBuf *ps_pic_buf,
+                              volatile int32_t *progress, int32_t value);
+
+/* Waits for the CDFs, MVs and segment ids of a picture being decoded */
+static INLINE void dec_pic_wait_parse(EbDecPicBuf *ps_pic_buf) {
+    if (!eb_atomic_load(&ps_pic_buf->parse_done))
+        dec_pic_wait_progress(ps_pic_buf, &ps_pic_buf->parse_done, 1);
+}
+
+/* Waits for the SB rows of a picture being decoded, down to the one of luma
+   row y. Rows out of the picture are in the padding of the first or last
+   SB row */
+static INLINE void dec_pic_wait_rows(EbDecPicBuf *ps_pic_buf, int32_t y) {
+    const int32_t sb_row = AOMMIN(AOMMAX(y, 0) >> ps_pic_buf->sb_size_log2,
+                                  ps_pic_buf->sb_rows - 1);
+    if (eb_atomic_load(&ps_pic_buf->sb_rows_done) <= sb_row)
+        dec_pic_wait_progress(ps_pic_buf, &ps_pic_buf->sb_rows_done, sb_row + 1);
+}
+
 EbDecPicBuf *get_ref_frame_buf(EbDecHandle *dec_handle_ptr, const MvReferenceFrame ref_frame);
 void svt_setup_frame_buf_refs(EbDecHandle *dec_handle_ptr);
 
@@ -0,0 +1,211 @@
+/*
+* Copyright(c) 2019 Netflix, Inc.
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+// SUMMARY
+//   Row pipelined loop filter, CDEF and loop restoration of a frame.
+//   SB rows are handed out to the decoder threads. A row is deblocked SB by
+//   SB behind the row above, and once row r + 1 is deblocked the same thread
+//   CDEFs and restores row r, while the other threads deblock the rows below.
+//   CDEF and LR carry line buffers from one row to the next, so those run in
+//   row order, chained by pf_row_semaphores.
+
+#include "EbDefinitions.h"
+#include "EbThreads.h"
+#include "EbDecHandle.h"
+#include "EbDecUtils.h"
+#include "EbRestoration.h"
+#include "EbDecLF.h"
+#include "EbDecCdef.h"
+#include "EbDecRestoration.h"
+#include "EbDecPostFilter.h"
+#include "EbDecFrameThreads.h"
+
+void av1_superres_upscale(Av1Common *cm, FrameHeader *frm_hdr, SeqHeader*seq_hdr,
+    EbPictureBufferDesc *recon_picture_src);
+
+/* Deblocks a SB row, SB by SB once the row above is done up to the SB
+   above right */
+static void dec_lf_sb_row(EbDecHandle *dec_handle_ptr, int32_t sb_row)
+{
+    DecPostFilterJob *post_filter_job = &dec_handle_ptr->post_filter_job;
+    MasterFrameBuf *master_frame_buf = &dec_handle_ptr->master_frame_buf;
+    EbPictureBufferDesc *recon_picture_buf =
+        dec_handle_ptr->cur_pic_buf[0]->ps_pic_buf;
+    const int32_t sb_cols = master_frame_buf->sb_cols;
+    const int32_t sb_rows = master_frame_buf->sb_rows;
+    int32_t sb_above_done = 0;
+
+    for (int32_t sb_col = 0; sb_col < sb_cols; sb_col++) {
+        if (sb_row > 0) {
+            int32_t sb_above_needed = AOMMIN(sb_col + 2, sb_cols);
+            for (; sb_above_done < sb_above_needed; sb_above_done++) {
+                eb_block_on_semaphore(
+                    post_filter_job->lf_row_semaphores[sb_row - 1]);
+            }
+        }
+
+        dec_av1_loop_filter_sb(dec_handle_ptr, recon_picture_buf,
+            dec_handle_ptr->pv_lf_ctxt, sb_row, sb_col, AOM_PLANE_Y,
+            MAX_MB_PLANE);
+
+        if (sb_row < sb_rows - 1)
+            eb_post_semaphore(post_filter_job->lf_row_semaphores[sb_row]);
+    }
+}
+
+/* CDEF and LR of a SB row, the row below has to be deblocked */
+static void dec_cdef_lr_sb_row(EbDecHandle *dec_handle_ptr, int32_t sb_row)
+{
+    DecPostFilterJob *post_filter_job = &dec_handle_ptr->post_filter_job;
+    FrameHeader *frame_header = &dec_handle_ptr->frame_header;
+    const int32_t sb_rows = dec_handle_ptr->master_frame_buf.sb_rows;
+    const int32_t fb_per_sb =
+        block_size_high[dec_handle_ptr->seq_header.sb_size] >> 6;
+    const int32_t nvfb = (frame_header->mi_rows + MI_SIZE_64X64 - 1) /
+        MI_SIZE_64X64;
+    const int32_t fbr_start = sb_row * fb_per_sb;
+    const int32_t fbr_end = AOMMIN(fbr_start + fb_per_sb, nvfb);
+
+    if (sb_row > 0)
+        eb_block_on_semaphore(post_filter_job->pf_row_semaphores[sb_row]);
+
+    for (int32_t fbr = fbr_start; fbr < fbr_end; fbr++) {
+        /* The deblocked lines around a stripe boundary are saved before
+           CDEF of the 64x64 row above the boundary */
+        if (post_filter_job->do_lr && !post_filter_job->opt_lr) {
+            if (fbr == 0)
+                dec_av1_loop_restoration_save_stripe_boundary_lines(
+                    dec_handle_ptr, 0);
+            dec_av1_loop_restoration_save_stripe_boundary_lines(
+                dec_handle_ptr, fbr + 1);
+        }
+        if (post_filter_job->do_cdef)
+            svt_cdef_row(dec_handle_ptr, fbr);
+    }
+
+    /* Stripe s ends 8 luma rows above the bottom of 64x64 row s, the
+       last 64x64 row of the frame also takes the stripe below it */
+    if (post_filter_job->do_lr && fbr_start < nvfb) {
+        const int32_t stripe_end = fbr_end == nvfb ?
+            dec_av1_loop_restoration_num_stripes(dec_handle_ptr) : fbr_end;
+        for (int32_t stripe = fbr_start; stripe < stripe_end; stripe++) {
+            dec_av1_loop_restoration_filter_stripe(dec_handle_ptr, stripe,
+                post_filter_job->opt_lr);
+        }
+    }
+
+    /* Frame parallel decoding : LR writes a stripe back to the frame once
+       the stripe below is restored, the rows are final down to 72 luma rows
+       above the bottom of the SB row then */
+    if (post_filter_job->publish_rows) {
+        const int32_t sb_size = block_size_high[dec_handle_ptr->seq_header.sb_size];
+        dec_frame_publish_rows(dec_handle_ptr, sb_row == sb_rows - 1 ?
+            frame_header->frame_size.frame_height : (sb_row + 1) * sb_size -
+            (post_filter_job->do_lr ? RESTORATION_PROC_UNIT_SIZE +
+             RESTORATION_UNIT_OFFSET : 0));
+    }
+
+    if (sb_row < sb_rows - 1)
+        eb_post_semaphore(post_filter_job->pf_row_semaphores[sb_row + 1]);
+}
+
+/* Post filter work of one thread : SB rows until the frame is done */
+void dec_post_filter_rows(EbDecHandle *dec_handle_ptr)
+{
+    DecPostFilterJob *post_filter_job = &dec_handle_ptr->post_filter_job;
+    const int32_t sb_rows = dec_handle_ptr->master_frame_buf.sb_rows;
+    const int32_t do_cdef_lr = post_filter_job->do_cdef ||
+        post_filter_job->do_lr || post_filter_job->publish_rows;
+    int32_t sb_row;
+
+    while ((sb_row = eb_atomic_fetch_add(&post_filter_job->next_sb_row, 1)) <
+           sb_rows)
+    {
+        if (post_filter_job->do_lf)
+            dec_lf_sb_row(dec_handle_ptr, sb_row);
+
+        if (do_cdef_lr && sb_row > 0)
+            dec_cdef_lr_sb_row(dec_handle_ptr, sb_row - 1);
+        if (do_cdef_lr && sb_row == sb_rows - 1)
+            dec_cdef_lr_sb_row(dec_handle_ptr, sb_row);
+    }
+}
+
+/* LF, CDEF, superres and LR of the current frame */
+void dec_post_filter_frame(EbDecHandle *dec_handle_ptr)
+{
+    DecPostFilterJob *post_filter_job = &dec_handle_ptr->post_filter_job;
+    FrameHeader *frame_header = &dec_handle_ptr->frame_header;
+
+    const int32_t do_lf =
+        frame_header->loop_filter_params.filter_level[0] ||
+        frame_header->loop_filter_params.filter_level[1];
+
+    const int32_t do_cdef =
+        !frame_header->coded_lossless &&
+        (frame_header->CDEF_params.cdef_bits ||
+         frame_header->CDEF_params.cdef_y_strength[0] ||
+         frame_header->CDEF_params.cdef_uv_strength[0]);
+
+    int32_t do_upscale = !av1_superres_unscaled(&frame_header->frame_size);
+
+    const int opt_lr = !do_cdef && !do_upscale;
+
+    LRParams *lr_param = frame_header->lr_params;
+    int do_loop_restoration =
+        lr_param[AOM_PLANE_Y].frame_restoration_type != RESTORE_NONE ||
+        lr_param[AOM_PLANE_U].frame_restoration_type != RESTORE_NONE ||
+        lr_param[AOM_PLANE_V].frame_restoration_type != RESTORE_NONE;
+
+    /* Superres upscales the whole CDEF'd frame before LR, only LF is
+       pipelined then */
+    post_filter_job->do_lf = do_lf;
+    post_filter_job->do_cdef = do_cdef && !do_upscale;
+    post_filter_job->do_lr = do_loop_restoration && !do_upscale;
+    post_filter_job->opt_lr = opt_lr;
+    post_filter_job->publish_rows =
+        dec_handle_ptr->pv_frame_job != NULL && !do_upscale;
+
+    if (post_filter_job->do_lf || post_filter_job->do_cdef ||
+        post_filter_job->do_lr)
+    {
+        int32_t num_workers = AOMMIN(dec_handle_ptr->num_threads,
+                                     dec_handle_ptr->master_frame_buf.sb_rows);
+
+        if (post_filter_job->do_lf) {
+            dec_av1_loop_filter_frame_init(dec_handle_ptr,
+                dec_handle_ptr->pv_lf_ctxt, AOM_PLANE_Y, MAX_MB_PLANE);
+        }
+        if (post_filter_job->do_cdef)
+            svt_cdef_init(dec_handle_ptr);
+
+        /* Kick the decoder threads, the calling thread works on rows too */
+        post_filter_job->next_sb_row = 0;
+        dec_handle_ptr->thread_stage = DEC_STAGE_POST_FILTER;
+        for (int32_t i = 1; i < num_workers; i++)
+            eb_post_semaphore(dec_handle_ptr->thread_start_semaphore);
+        dec_post_filter_rows(dec_handle_ptr);
+        for (int32_t i = 1; i < num_workers; i++)
+            eb_block_on_semaphore(dec_handle_ptr->thread_done_semaphore);
+    }
+
+    if (do_upscale) {
+        if (do_loop_restoration)
+            dec_av1_loop_restoration_save_boundary_lines(dec_handle_ptr, 0);
+
+        /*Calling cdef frame level function*/
+        if (do_cdef)
+            svt_cdef_frame(dec_handle_ptr);
+
+        av1_superres_upscale(&dec_handle_ptr->cm, frame_header,
+            &dec_handle_ptr->seq_header,
+            dec_handle_ptr->cur_pic_buf[0]->ps_pic_buf);
+        dec_handle_ptr->cm.frm_size.frame_width =
+            frame_header->frame_size.frame_width;
+
+        if (do_loop_restoration)
+            dec_av1_loop_restoration_filter_frame(dec_handle_ptr, opt_lr);
+    }
+}
@@ -0,0 +1,22 @@
+/*
+* Copyright(c) 2019 Netflix, Inc.
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#ifndef EbDecPostFilter_h
+#define EbDecPostFilter_h
+
+#include "EbDecHandle.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void dec_post_filter_rows(EbDecHandle *dec_handle_ptr);
+void dec_post_filter_frame(EbDecHandle *dec_handle_ptr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // EbDecPostFilter_h
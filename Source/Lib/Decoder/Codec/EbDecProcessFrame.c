@@ -19,6 +19,7 @@
 #include "EbDecInverseQuantize.h"
 #include "EbDecProcessFrame.h"
 #include "EbDecProcessBlock.h"
+#include "EbObuParse.h"
 #include "EbDecNbr.h"
 
 /* decode partition */
@@ -147,7 +148,7 @@ void decode_super_block(DecModCtxt *dec_mod_ctxt,
     dec_mod_ctxt->iquant_cur_ptr = dec_mod_ctxt->sb_iquant_ptr;
 
     /* SB level dequant update */
-    update_dequant(dec_handle, sb_info);
+    update_dequant(dec_mod_ctxt, sb_info);
 
     /* Decode partition */
     decode_partition(dec_mod_ctxt, mi_row, mi_col,
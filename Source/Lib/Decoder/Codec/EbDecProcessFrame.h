@@ -60,6 +60,9 @@ typedef struct DecModCtxt {
     DECLARE_ALIGNED(16, uint8_t, seg_mask[2 * MAX_SB_SQUARE]);
 } DecModCtxt;
 
+/* Number of restored stripes per plane held in LRCtxt.dst */
+#define LR_DST_STRIPES 2
+
 typedef struct LRCtxt {
     /** Decoder Handle */
     void *dec_handle_ptr;
@@ -75,7 +78,7 @@ typedef struct LRCtxt {
     /* Used to store CDEF line buffer around stripe boundary */
     RestorationLineBuffers *rlbs;
 
-    /* Scratch buffer to hold LR output */
+    /* Scratch buffer to hold LR output, LR_DST_STRIPES stripes per plane */
     uint8_t *dst;
     uint16_t dst_stride;
 
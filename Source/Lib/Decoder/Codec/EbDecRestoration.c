@@ -26,8 +26,42 @@
 void save_tile_row_boundary_lines(uint8_t *src, int32_t src_stride,
     int32_t src_width, int32_t src_height, int32_t use_highbd, int32_t plane,
     Av1Common *cm, int32_t after_cdef, RestorationStripeBoundaries *boundaries);
+int32_t save_stripe_boundary_lines(uint8_t *src, int32_t src_stride,
+    int32_t src_width, int32_t src_height, int32_t use_highbd, int32_t plane,
+    Av1Common *cm, int32_t after_cdef, int32_t tile_stripe,
+    RestorationStripeBoundaries *boundaries);
 
-void dec_av1_loop_restoration_filter_frame(EbDecHandle *dec_handle, int optimized_lr)
+/* Copies rows [y_start, y_end) of a restored stripe back to the frame */
+static void copy_stripe_to_frame(LRCtxt *lr_ctxt, int32_t plane,
+    int32_t stripe, int32_t y_start, int32_t y_end, int32_t width,
+    uint8_t *src, int32_t src_stride, int use_highbd)
+{
+    uint8_t *dst = lr_ctxt->dst + ((plane * LR_DST_STRIPES +
+        stripe % LR_DST_STRIPES) * RESTORATION_PROC_UNIT_SIZE *
+        lr_ctxt->dst_stride << use_highbd);
+
+    src += y_start * src_stride << use_highbd;
+    for (int32_t y = y_start; y < y_end; y++) {
+        memcpy(src, dst, width << use_highbd);
+        src += src_stride << use_highbd;
+        dst += lr_ctxt->dst_stride << use_highbd;
+    }
+}
+
+/* Number of LR stripes of the frame, in luma */
+int32_t dec_av1_loop_restoration_num_stripes(EbDecHandle *dec_handle)
+{
+    return (dec_handle->frame_header.frame_size.frame_height +
+        RESTORATION_UNIT_OFFSET + RESTORATION_PROC_UNIT_SIZE - 1) /
+        RESTORATION_PROC_UNIT_SIZE;
+}
+
+/* Restores a 64 luma rows high stripe (8 rows shorter at the top) of every
+   plane, its rows have to be CDEF'd and the rows of the previous stripes
+   restored. The result stays in lr_ctxt->dst until the stripe below, which
+   still reads the unrestored rows above it, is restored. */
+void dec_av1_loop_restoration_filter_stripe(EbDecHandle *dec_handle,
+    int32_t stripe, int optimized_lr)
 {
     assert(!dec_handle->frame_header.all_lossless);
 
@@ -40,15 +74,11 @@ void dec_av1_loop_restoration_filter_frame(EbDecHandle *dec_handle, int optimize
     EbPictureBufferDesc *cur_pic_buf = dec_handle->cur_pic_buf[0]->ps_pic_buf;
     RestorationUnitInfo *lr_unit;
 
-    lr_ctxt->lr_unit[AOM_PLANE_Y] = frame_buf->lr_unit[AOM_PLANE_Y];
-    lr_ctxt->lr_unit[AOM_PLANE_U] = frame_buf->lr_unit[AOM_PLANE_U];
-    lr_ctxt->lr_unit[AOM_PLANE_V] = frame_buf->lr_unit[AOM_PLANE_V];
-
     int num_plane = av1_num_planes(&dec_handle->seq_header.color_config);
     int use_highbd = (dec_handle->seq_header.color_config.bit_depth > 8);
     int bit_depth = dec_handle->seq_header.color_config.bit_depth;
     int h = 0, w = 0, x, y, unit_row, unit_col;
-    int src_stride, dst_stride, tile_stripe0 = 0;
+    int src_stride, tile_stripe0 = 0;
     uint8_t *src, *dst;
 
     for (int plane = 0; plane < num_plane; plane++)
@@ -58,18 +88,20 @@ void dec_av1_loop_restoration_filter_frame(EbDecHandle *dec_handle, int optimize
         int is_uv = plane > 0;
         int sx = 0, sy = 0;
 
+        if (lr_params->frame_restoration_type == RESTORE_NONE)
+            continue;
+
         if (plane) {
             sx = dec_handle->seq_header.color_config.subsampling_x;
             sy = dec_handle->seq_header.color_config.subsampling_y;
         }
 
+        lr_ctxt->lr_unit[plane] = frame_buf->lr_unit[plane];
+
         // src points to frame start
         derive_blk_pointers(cur_pic_buf, plane, 0, 0, (void *)&src,
                             &src_stride, sx, sy);
 
-        dst = lr_ctxt->dst;
-        dst_stride = lr_ctxt->dst_stride;
-
         tile_rect = whole_frame_rect(&dec_handle->frame_header.frame_size,
             dec_handle->seq_header.color_config.subsampling_x,
             dec_handle->seq_header.color_config.subsampling_y, is_uv);
@@ -77,9 +109,33 @@ void dec_av1_loop_restoration_filter_frame(EbDecHandle *dec_handle, int optimize
         int tile_h = tile_rect.bottom - tile_rect.top;
         int tile_w = tile_rect.right - tile_rect.left;
 
-        if (lr_params->frame_restoration_type == RESTORE_NONE)
+        const int stripe_h = RESTORATION_PROC_UNIT_SIZE >> sy;
+        const int voffset = RESTORATION_UNIT_OFFSET >> sy;
+        const int stripe_start = AOMMAX(0, stripe * stripe_h - voffset);
+        const int stripe_end = AOMMIN(tile_h, (stripe + 1) * stripe_h - voffset);
+
+        if (stripe_start >= tile_h)
             continue;
 
+        if (!optimized_lr) {
+            uint8_t *src_buf = REAL_PTR(use_highbd, use_highbd ?
+                                        CONVERT_TO_BYTEPTR(src) : src);
+            save_stripe_boundary_lines(src_buf, src_stride,
+                frame_header->frame_size.frame_width >> sx,
+                frame_header->frame_size.frame_height >> sy, use_highbd, plane,
+                &dec_handle->cm, 1, stripe, &lr_ctxt->boundaries[plane]);
+        }
+
+        /* Padded bits are required for filtering pixel around frame boundary */
+        pad_rows(cur_pic_buf, frame_header, plane, sx, sy, stripe_start,
+                 AOMMIN(stripe_end + RESTORATION_BORDER, tile_h));
+
+        // dst maps row stripe_start to the start of the stripe's slot
+        dst = lr_ctxt->dst + ((plane * LR_DST_STRIPES +
+            stripe % LR_DST_STRIPES) * RESTORATION_PROC_UNIT_SIZE *
+            lr_ctxt->dst_stride << use_highbd);
+        dst -= stripe_start * lr_ctxt->dst_stride << use_highbd;
+
         for (y = 0, unit_row = 0; y < tile_h; y += h, unit_row++)
         {
             int remaining_h = tile_h - y;
@@ -90,10 +146,15 @@ void dec_av1_loop_restoration_filter_frame(EbDecHandle *dec_handle, int optimize
             assert(tile_limit.v_end <= tile_rect.bottom);
 
             // Offset the tile upwards to align with the restoration processing stripe
-            const int voffset = RESTORATION_UNIT_OFFSET >> sy;
             tile_limit.v_start = AOMMAX(tile_rect.top, tile_limit.v_start - voffset);
             if (tile_limit.v_end < tile_rect.bottom) tile_limit.v_end -= voffset;
 
+            // Only the part of the unit in the stripe
+            tile_limit.v_start = AOMMAX(tile_limit.v_start, stripe_start);
+            tile_limit.v_end = AOMMIN(tile_limit.v_end, stripe_end);
+            if (tile_limit.v_start >= tile_limit.v_end)
+                continue;
+
             for (x = 0, unit_col = 0; x < tile_w; x += w, unit_col++)
             {
                 int remaining_w = tile_w - x;
@@ -110,23 +171,70 @@ void dec_av1_loop_restoration_filter_frame(EbDecHandle *dec_handle, int optimize
                     eb_av1_loop_restoration_filter_unit(1, &tile_limit, lr_unit,
                         &lr_ctxt->boundaries[plane], lr_ctxt->rlbs, &tile_rect,
                         tile_stripe0, sx, sy, use_highbd, bit_depth, src,
-                        src_stride, dst, dst_stride, lr_ctxt->rst_tmpbuf, optimized_lr);
+                        src_stride, dst, lr_ctxt->dst_stride, lr_ctxt->rst_tmpbuf,
+                        optimized_lr);
                 else
                     eb_av1_loop_restoration_filter_unit(1, &tile_limit, lr_unit,
                         &lr_ctxt->boundaries[plane], lr_ctxt->rlbs, &tile_rect,
                         tile_stripe0, sx, sy, use_highbd, bit_depth,
                         CONVERT_TO_BYTEPTR(src), src_stride, CONVERT_TO_BYTEPTR(dst),
-                        dst_stride, lr_ctxt->rst_tmpbuf, optimized_lr);
+                        lr_ctxt->dst_stride, lr_ctxt->rst_tmpbuf, optimized_lr);
             }
         }
-        for (y = 0; y < tile_h; y++) {
-            memcpy(src, dst, dst_stride * sizeof(*dst) << use_highbd);
-            src += src_stride << use_highbd;
-            dst += dst_stride << use_highbd;
+
+        if (stripe > 0) {
+            copy_stripe_to_frame(lr_ctxt, plane, stripe - 1,
+                AOMMAX(0, (stripe - 1) * stripe_h - voffset), stripe_start,
+                tile_w, src, src_stride, use_highbd);
+        }
+        if (stripe_end == tile_h) {
+            copy_stripe_to_frame(lr_ctxt, plane, stripe, stripe_start,
+                stripe_end, tile_w, src, src_stride, use_highbd);
         }
     }
 }
 
+void dec_av1_loop_restoration_filter_frame(EbDecHandle *dec_handle, int optimized_lr)
+{
+    const int32_t num_stripes = dec_av1_loop_restoration_num_stripes(dec_handle);
+
+    for (int32_t stripe = 0; stripe < num_stripes; stripe++)
+        dec_av1_loop_restoration_filter_stripe(dec_handle, stripe, optimized_lr);
+}
+
+/* Saves the deblocked boundary lines of a stripe of every plane, before
+   CDEF of the rows around it */
+void dec_av1_loop_restoration_save_stripe_boundary_lines(EbDecHandle *dec_handle,
+    int32_t stripe)
+{
+    const int num_planes = av1_num_planes(&dec_handle->seq_header.color_config);
+    const int use_highbd = (dec_handle->seq_header.color_config.bit_depth > 8);
+    LRCtxt *lr_ctxt = (LRCtxt *)dec_handle->pv_lr_ctxt;
+    FrameSize *frame_size = &dec_handle->frame_header.frame_size;
+    EbPictureBufferDesc *cur_pic_buf = dec_handle->cur_pic_buf[0]->ps_pic_buf;
+
+    for (int p = 0; p < num_planes; ++p) {
+        int32_t sx = 0, sy = 0;
+        uint8_t *src;
+        int32_t stride;
+
+        if (dec_handle->frame_header.lr_params[p].frame_restoration_type ==
+            RESTORE_NONE)
+            continue;
+        if (p) {
+            sx = dec_handle->seq_header.color_config.subsampling_x;
+            sy = dec_handle->seq_header.color_config.subsampling_y;
+        }
+        derive_blk_pointers(cur_pic_buf, p, 0, 0, (void *)&src, &stride, sx, sy);
+        uint8_t *src_buf = REAL_PTR(use_highbd, use_highbd ?
+                                    CONVERT_TO_BYTEPTR(src) : src);
+
+        save_stripe_boundary_lines(src_buf, stride,
+            frame_size->frame_width >> sx, frame_size->frame_height >> sy,
+            use_highbd, p, &dec_handle->cm, 0, stripe, &lr_ctxt->boundaries[p]);
+    }
+}
+
 void dec_av1_loop_restoration_save_boundary_lines(EbDecHandle *dec_handle,
     int after_cdef)
 {
@@ -12,8 +12,13 @@ extern "C" {
 
 #include "EbDecHandle.h"
 
+int32_t dec_av1_loop_restoration_num_stripes(EbDecHandle *dec_handle);
+void dec_av1_loop_restoration_filter_stripe(EbDecHandle *dec_handle,
+                                            int32_t stripe, int optimized_lr);
 void dec_av1_loop_restoration_filter_frame(EbDecHandle *dec_handle,
                                            int optimized_lr);
+void dec_av1_loop_restoration_save_stripe_boundary_lines(
+    EbDecHandle *dec_handle, int32_t stripe);
 void dec_av1_loop_restoration_save_boundary_lines(EbDecHandle *dec_handle,
                                                   int after_cdef);
 
@@ -10,6 +10,7 @@
  * Includes
  **************************************/
 #include <stdlib.h>
+#include <string.h>
 
 #include "EbDefinitions.h"
 #include "EbUtility.h"
@@ -179,6 +180,57 @@ void pad_pic(EbPictureBufferDesc *recon_picture_buf, FrameHeader *frame_hdr) {
     }
 }
 
+/* Pads the left and right borders of rows [row_start, row_end) of a plane,
+   and the top / bottom borders along with the first / last row */
+void pad_rows(EbPictureBufferDesc *recon_picture_buf, FrameHeader *frame_hdr,
+              int32_t plane, int32_t sub_x, int32_t sub_y,
+              int32_t row_start, int32_t row_end)
+{
+    FrameSize *frame_size = &frame_hdr->frame_size;
+    const int32_t width = (frame_size->superres_upscaled_width + sub_x) >> sub_x;
+    const int32_t height = (frame_size->frame_height + sub_y) >> sub_y;
+    const int32_t pad_x = recon_picture_buf->origin_x >> sub_x;
+    const int32_t pad_y = recon_picture_buf->origin_y >> sub_y;
+    void *buf;
+    int32_t stride;
+
+    derive_blk_pointers(recon_picture_buf, plane, 0, 0, &buf, &stride,
+                        sub_x, sub_y);
+
+    if (recon_picture_buf->bit_depth == EB_8BIT) {
+        uint8_t *first = (uint8_t *)buf - pad_x;
+        uint8_t *last = first + (height - 1) * stride;
+        uint8_t *row = (uint8_t *)buf + row_start * stride;
+
+        for (int32_t y = row_start; y < row_end; y++, row += stride) {
+            memset(row - pad_x, row[0], pad_x);
+            memset(row + width, row[width - 1], pad_x);
+        }
+        for (int32_t i = 1; row_start == 0 && i <= pad_y; i++)
+            memcpy(first - i * stride, first, width + 2 * pad_x);
+        for (int32_t i = 1; row_end == height && i <= pad_y; i++)
+            memcpy(last + i * stride, last, width + 2 * pad_x);
+    }
+    else {
+        uint16_t *first = (uint16_t *)buf - pad_x;
+        uint16_t *last = first + (height - 1) * stride;
+        uint16_t *row = (uint16_t *)buf + row_start * stride;
+
+        for (int32_t y = row_start; y < row_end; y++, row += stride) {
+            for (int32_t x = 1; x <= pad_x; x++) {
+                row[-x] = row[0];
+                row[width - 1 + x] = row[width - 1];
+            }
+        }
+        for (int32_t i = 1; row_start == 0 && i <= pad_y; i++)
+            memcpy(first - i * stride, first,
+                   (width + 2 * pad_x) * sizeof(*first));
+        for (int32_t i = 1; row_end == height && i <= pad_y; i++)
+            memcpy(last + i * stride, last,
+                   (width + 2 * pad_x) * sizeof(*last));
+    }
+}
+
 int inverse_recenter(int r, int v)
 {
     if (v > 2 * r)
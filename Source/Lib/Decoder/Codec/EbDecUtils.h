@@ -32,6 +32,9 @@ void derive_blk_pointers(EbPictureBufferDesc *recon_picture_buf, int32_t plane,
                          int32_t sub_x, int32_t sub_y);
 
 void pad_pic(EbPictureBufferDesc *recon_picture_buf, FrameHeader *frame_hdr);
+void pad_rows(EbPictureBufferDesc *recon_picture_buf, FrameHeader *frame_hdr,
+              int32_t plane, int32_t sub_x, int32_t sub_y,
+              int32_t row_start, int32_t row_end);
 
 int inverse_recenter(int r, int v);
 
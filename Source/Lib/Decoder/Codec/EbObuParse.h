@@ -186,17 +186,31 @@ typedef struct ParseCtxt {
     RestorationUnitInfo ref_lr_unit[MAX_MB_PLANE];
 
     EbBool  read_deltas;
+
+    /* Coeff buf of the SB being parsed, owned by this context */
+    int32_t *sb_coeff_buf[MAX_MB_PLANE];
+
+    /* Decode module context of the same thread */
+    void    *pv_dec_mod_ctxt;
 } ParseCtxt;
 
 int get_qindex(SegmentationParams *seg_params, int segment_id, int base_q_idx);
-void parse_super_block(EbDecHandle *dec_handle, uint32_t blk_row,
+void parse_super_block(ParseCtxt *parse_ctx, uint32_t blk_row,
                        uint32_t blk_col, SBInfo *sbInfo);
 
 void svt_setup_motion_field(EbDecHandle *dec_handle);
+void setup_ref_frame_ctxts(EbDecHandle *dec_handle_ptr);
+
+EbErrorType read_frame_header_obu(bitstrm_t *bs, EbDecHandle *dec_handle_ptr,
+    ObuHeader *obu_header, int trailing_bit);
+EbErrorType read_tile_group_header(bitstrm_t *bs, EbDecHandle *dec_handle_ptr,
+    TilesInfo *tiles_info, ObuHeader *obu_header, int *is_last_tg);
+EbErrorType decode_frame_tiles(EbDecHandle *dec_handle_ptr, int is_last_tg);
 
 EbErrorType decode_obu(EbDecHandle *dec_handle_ptr, uint8_t *data, uint32_t data_size);
 EbErrorType decode_multiple_obu(EbDecHandle *dec_handle_ptr, uint8_t **data,
     size_t data_size, uint32_t is_annexb);
+void* dec_thread_kernel(void *input_ptr);
 
 static INLINE int allow_intrabc(const EbDecHandle *dec_handle) {
     return  (dec_handle->frame_header.frame_type == KEY_FRAME
@@ -37,6 +37,7 @@ extern EbErrorType cdef_context_ctor(
     uint32_t                max_input_luma_height
    );
 
+extern void cdef_task(void *input_ptr, EbObjectWrapper *input_wrapper_ptr);
 extern void* cdef_kernel(void *input_ptr);
 
 #endif
@@ -51,6 +51,7 @@
 #include "EbCdefProcess.h"
 #include "EbRestProcess.h"
 #include "EbObject.h"
+#include "EbSharedAnalysis.h"
 
 #ifdef _WIN32
 #include <windows.h>
@@ -281,6 +282,45 @@ void EbSetThreadManagementParameters(EbSvtAv1EncConfiguration *config_ptr)
 #endif
 }
 
+/* The pools are allocated, and the pages their ctors write placed, by the
+   thread calling eb_init_encoder. When the worker threads are bound to one
+   socket, that thread runs there too until the pools are ready, so that
+   first touch puts the reference and picture control set pools on the NUMA
+   node of the threads consuming them rather than on the node of the caller */
+#ifdef _WIN32
+typedef GROUP_AFFINITY CallerAffinity;
+#elif defined(__linux__)
+typedef cpu_set_t CallerAffinity;
+#else
+typedef int CallerAffinity;
+#endif
+
+static EbBool bind_caller_to_workers(CallerAffinity *caller_affinity)
+{
+#ifdef _WIN32
+    if (num_groups > 1 && !alternate_groups)
+        return (EbBool)SetThreadGroupAffinity(GetCurrentThread(), &group_affinity, caller_affinity);
+#elif defined(__linux__)
+    if (num_groups > 1 && CPU_COUNT(&group_affinity) > 0 &&
+        pthread_getaffinity_np(pthread_self(), sizeof(cpu_set_t), caller_affinity) == 0)
+        return pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &group_affinity) == 0;
+#else
+    UNUSED(caller_affinity);
+#endif
+    return EB_FALSE;
+}
+
+static void restore_caller_affinity(CallerAffinity *caller_affinity)
+{
+#ifdef _WIN32
+    SetThreadGroupAffinity(GetCurrentThread(), caller_affinity, NULL);
+#elif defined(__linux__)
+    pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), caller_affinity);
+#else
+    UNUSED(caller_affinity);
+#endif
+}
+
 void asmSetConvolveAsmTable(void);
 void asmSetConvolveHbdAsmTable(void);
 void init_intra_dc_predictors_c_internal(void);
@@ -355,6 +395,214 @@ int32_t set_parent_pcs(EbSvtAv1EncConfiguration*   config, uint32_t core_count,
         return -1;
     }
 }
+/* Picture pool depths, from the number of pictures the encoder keeps in
+   flight and the lookahead distance */
+static void set_picture_pool_counts(
+    SequenceControlSet       *sequence_control_set_ptr,
+    uint32_t                  input_pic)
+{
+    sequence_control_set_ptr->input_buffer_fifo_init_count = input_pic + SCD_LAD + sequence_control_set_ptr->static_config.look_ahead_distance;
+    sequence_control_set_ptr->output_stream_buffer_fifo_init_count =
+        sequence_control_set_ptr->input_buffer_fifo_init_count + 4;
+    sequence_control_set_ptr->picture_control_set_pool_init_count       = input_pic + SCD_LAD + sequence_control_set_ptr->static_config.look_ahead_distance;
+    if (sequence_control_set_ptr->static_config.enable_overlays)
+        sequence_control_set_ptr->picture_control_set_pool_init_count = MAX(sequence_control_set_ptr->picture_control_set_pool_init_count,
+            sequence_control_set_ptr->static_config.look_ahead_distance + // frames in the LAD
+            sequence_control_set_ptr->static_config.look_ahead_distance / (1 << sequence_control_set_ptr->static_config.hierarchical_levels) + 1 +  // number of overlayes in the LAD
+            ((1 << sequence_control_set_ptr->static_config.hierarchical_levels) + SCD_LAD) * 2 +// minigop formation in PD + SCD_LAD *(normal pictures + potential pictures )
+            (1 << sequence_control_set_ptr->static_config.hierarchical_levels)); // minigop in PM
+    sequence_control_set_ptr->reference_picture_buffer_init_count       = MAX((uint32_t)(input_pic >> 1),
+                                                                          (uint32_t)((1 << sequence_control_set_ptr->static_config.hierarchical_levels) + 2)) +
+                                                                          sequence_control_set_ptr->static_config.look_ahead_distance + SCD_LAD;
+    sequence_control_set_ptr->pa_reference_picture_buffer_init_count    = MAX((uint32_t)(input_pic >> 1),
+                                                                          (uint32_t)((1 << sequence_control_set_ptr->static_config.hierarchical_levels) + 2)) +
+                                                                          sequence_control_set_ptr->static_config.look_ahead_distance + SCD_LAD;
+    sequence_control_set_ptr->output_recon_buffer_fifo_init_count       = sequence_control_set_ptr->reference_picture_buffer_init_count;
+    sequence_control_set_ptr->overlay_input_picture_buffer_init_count   = sequence_control_set_ptr->static_config.enable_overlays ?
+                                                                          (2 << sequence_control_set_ptr->static_config.hierarchical_levels) + SCD_LAD : 1;
+}
+
+/* Process counts of the stages and child PCS count, from the core count */
+static void set_process_counts(
+    SequenceControlSet       *sequence_control_set_ptr,
+    uint32_t                  core_count)
+{
+    sequence_control_set_ptr->picture_control_set_pool_init_count_child = MAX(MAX(MIN(3, core_count/2), core_count / 6), 1);
+    sequence_control_set_ptr->total_process_init_count                    = 0;
+    if (core_count > 1){
+        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->picture_analysis_process_init_count            = MAX(MIN(15, core_count >> 1), core_count / 6));
+        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->motion_estimation_process_init_count =  MAX(MIN(20, core_count >> 1), core_count / 3));//1);//
+        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->source_based_operations_process_init_count     = MAX(MIN(3, core_count >> 1), core_count / 12));
+        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->mode_decision_configuration_process_init_count = MAX(MIN(3, core_count >> 1), core_count / 12));
+        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->enc_dec_process_init_count                     = MAX(MIN(40, core_count >> 1), core_count));
+        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->entropy_coding_process_init_count              = MAX(MIN(3, core_count >> 1), core_count / 12));
+        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->dlf_process_init_count                         = MAX(MIN(40, core_count >> 1), core_count));
+        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->cdef_process_init_count                        = MAX(MIN(40, core_count >> 1), core_count));
+        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->rest_process_init_count                        = MAX(MIN(40, core_count >> 1), core_count));
+    }else{
+        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->picture_analysis_process_init_count            = 1);
+        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->motion_estimation_process_init_count           = 1);
+        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->source_based_operations_process_init_count     = 1);
+        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->mode_decision_configuration_process_init_count = 1);
+        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->enc_dec_process_init_count                     = 1);
+        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->entropy_coding_process_init_count              = 1);
+        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->dlf_process_init_count                         = 1);
+        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->cdef_process_init_count                        = 1);
+        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->rest_process_init_count                        = 1);
+    }
+
+    sequence_control_set_ptr->total_process_init_count += 6; // single processes count
+}
+
+/* Estimated bytes of one entry of each pool and of one context of the
+   stages with a picture size footprint. The picture buffers and the SB
+   arenas are sized as their ctors do, the rest of the PCS, PPCS and
+   contexts was measured and is scaled by the picture size. */
+typedef struct EncMemoryEstimate
+{
+    uint64_t    ppcs;
+    uint64_t    pcs;
+    uint64_t    reference;
+    uint64_t    pa_reference;
+    uint64_t    input;
+    uint64_t    output;
+    uint64_t    recon;
+    uint64_t    enc_dec;
+    uint64_t    motion_estimation;
+    uint64_t    fixed;
+} EncMemoryEstimate;
+
+// Measured at one process per stage, in bytes
+#define MEM_PPCS_FIXED                  ((uint64_t)21 << 16)
+#define MEM_PCS_FIXED                   ((uint64_t)54 << 20)
+#define MEM_PCS_BYTES_PER_PIXEL         77
+#define MEM_ENC_DEC_CONTEXT             ((uint64_t)95 << 20)
+#define MEM_ME_CONTEXT_FIXED            ((uint64_t)12 << 20)
+#define MEM_ME_CONTEXT_BYTES_PER_PIXEL  15
+#define MEM_FIXED                       ((uint64_t)24 << 20)
+#define MEM_FIXED_BYTES_PER_PIXEL       10
+
+static uint64_t padded_size(uint64_t width, uint64_t height, uint64_t pad) {
+    return (width + 2 * pad) * (height + 2 * pad);
+}
+
+static void estimate_memory_usage(
+    SequenceControlSet       *sequence_control_set_ptr,
+    EncMemoryEstimate        *estimate)
+{
+    EbSvtAv1EncConfiguration *config = &sequence_control_set_ptr->static_config;
+    const uint64_t width = sequence_control_set_ptr->max_input_luma_width;
+    const uint64_t height = sequence_control_set_ptr->max_input_luma_height;
+    const uint64_t pixels = width * height;
+    const uint64_t bytes_per_sample = config->encoder_bit_depth > EB_8BIT ? 2 : 1;
+    // luma and chroma samples per 4 luma samples
+    const uint64_t samples = 4 + (8 >> (sequence_control_set_ptr->subsampling_x + sequence_control_set_ptr->subsampling_y));
+    const uint64_t sb_sz = sequence_control_set_ptr->sb_sz;
+    const uint64_t sb_size_pix = config->super_block_size;
+    const uint32_t ppcs_sb_count = (uint32_t)(((width + sb_sz - 1) / sb_sz) * ((height + sb_sz - 1) / sb_sz));
+    const uint64_t pcs_sb_count = ((width + sb_size_pix - 1) / sb_size_pix) * ((height + sb_size_pix - 1) / sb_size_pix);
+
+    estimate->input = padded_size(width, height, sequence_control_set_ptr->left_padding) * samples / 4 * bytes_per_sample;
+    estimate->output = EB_OUTPUTSTREAMBUFFERSIZE_MACRO(config->source_width * config->source_height);
+    estimate->recon = pixels * samples / 4 * bytes_per_sample;
+
+    // The 10 bit references keep a packed and an unpacked copy
+    estimate->reference = padded_size(width, height, PAD_VALUE) * samples / 4 * bytes_per_sample * bytes_per_sample;
+    if (sequence_control_set_ptr->mfmv_enabled)
+        estimate->reference += ((height / 8 + 1) / 2) * ((width / 8 + 1) / 2) * sizeof(MV_REF);
+
+    // The full resolution PA picture is the input picture
+    estimate->pa_reference = (padded_size(width / 2, height / 2, sb_sz / 2) + padded_size(width / 4, height / 4, sb_sz / 4)) * bytes_per_sample;
+    if (sequence_control_set_ptr->down_sampling_method_me_search == ME_FILTERED_DOWNSAMPLED)
+        estimate->pa_reference *= 2;
+    if (sequence_control_set_ptr->me_successive_elimination)
+        estimate->pa_reference += padded_size(width, height, sb_sz + ME_FILTER_TAP) * sizeof(uint16_t);
+
+    estimate->ppcs = picture_parent_control_set_arena_size(ppcs_sb_count, sequence_control_set_ptr->nsq_present, sequence_control_set_ptr->mrp_mode) +
+        MEM_PPCS_FIXED;
+    estimate->pcs = pcs_sb_count * (largest_coding_unit_arena_size((uint8_t)sb_size_pix, (EbColorFormat)config->encoder_color_format) +
+        sizeof(FRAME_CONTEXT) + sizeof(MdRateEstimationContext)) +
+        MEM_PCS_FIXED + pixels * MEM_PCS_BYTES_PER_PIXEL;
+
+    estimate->enc_dec = MEM_ENC_DEC_CONTEXT;
+    estimate->motion_estimation = MEM_ME_CONTEXT_FIXED + pixels * MEM_ME_CONTEXT_BYTES_PER_PIXEL;
+    estimate->fixed = MEM_FIXED + pixels * MEM_FIXED_BYTES_PER_PIXEL;
+}
+
+static uint64_t estimate_memory_total(
+    SequenceControlSet       *sequence_control_set_ptr,
+    const EncMemoryEstimate  *estimate)
+{
+    return
+        estimate->ppcs * sequence_control_set_ptr->picture_control_set_pool_init_count +
+        estimate->pcs * sequence_control_set_ptr->picture_control_set_pool_init_count_child +
+        estimate->reference * sequence_control_set_ptr->reference_picture_buffer_init_count +
+        estimate->pa_reference * sequence_control_set_ptr->pa_reference_picture_buffer_init_count +
+        estimate->input * sequence_control_set_ptr->input_buffer_fifo_init_count +
+        estimate->output * sequence_control_set_ptr->output_stream_buffer_fifo_init_count +
+        (sequence_control_set_ptr->static_config.enable_overlays ?
+            estimate->input * sequence_control_set_ptr->overlay_input_picture_buffer_init_count : 0) +
+        (sequence_control_set_ptr->static_config.recon_enabled ?
+            estimate->recon * sequence_control_set_ptr->output_recon_buffer_fifo_init_count : 0) +
+        estimate->enc_dec * sequence_control_set_ptr->enc_dec_process_init_count +
+        estimate->motion_estimation * sequence_control_set_ptr->motion_estimation_process_init_count +
+        estimate->fixed;
+}
+
+/* Shrinks the picture pools down to the minimum to start encoding, then the
+   lookahead in CQP (the RC modes need a lookahead of an intra period), then
+   the process counts of the segment parallel stages, until the estimated
+   memory fits in max_memory_mb */
+static void fit_memory_budget(
+    SequenceControlSet       *sequence_control_set_ptr,
+    uint32_t                  input_pic,
+    uint32_t                  core_count)
+{
+    EbSvtAv1EncConfiguration *config = &sequence_control_set_ptr->static_config;
+    const uint64_t budget = (uint64_t)config->max_memory_mb << 20;
+    const uint32_t min_input_pic = (2 << config->hierarchical_levels) + 1;
+    EncMemoryEstimate estimate;
+
+    estimate_memory_usage(sequence_control_set_ptr, &estimate);
+    while (estimate_memory_total(sequence_control_set_ptr, &estimate) > budget) {
+        if (input_pic > min_input_pic)
+            input_pic = MAX(min_input_pic, input_pic - MAX(input_pic >> 2, 1));
+        else if (config->rate_control_mode == 0 && config->look_ahead_distance > 0)
+            config->look_ahead_distance >>= 1;
+        else if (core_count > 1) {
+            core_count >>= 1;
+            set_process_counts(sequence_control_set_ptr, core_count);
+            continue;
+        }
+        else {
+            SVT_LOG("SVT [warning]: the encoder needs more than MaxMemoryMB (%u MB)\n", config->max_memory_mb);
+            break;
+        }
+        set_picture_pool_counts(sequence_control_set_ptr, input_pic);
+    }
+}
+
+/* Memory accounting of the pools, in the layout of eb_print_memory_usage() */
+static void print_memory_estimate(
+    SequenceControlSet       *sequence_control_set_ptr)
+{
+    EncMemoryEstimate estimate;
+    const double mb = 1024.0 * 1024.0;
+
+    estimate_memory_usage(sequence_control_set_ptr, &estimate);
+    SVT_LOG("SVT Memory Budget: %u MB\n", sequence_control_set_ptr->static_config.max_memory_mb);
+    SVT_LOG("    estimated memory:             %.2lf MB\n", estimate_memory_total(sequence_control_set_ptr, &estimate) / mb);
+    SVT_LOG("        parent pcs:          %4u x %.2lf MB\n", sequence_control_set_ptr->picture_control_set_pool_init_count, estimate.ppcs / mb);
+    SVT_LOG("        child pcs:           %4u x %.2lf MB\n", sequence_control_set_ptr->picture_control_set_pool_init_count_child, estimate.pcs / mb);
+    SVT_LOG("        reference:           %4u x %.2lf MB\n", sequence_control_set_ptr->reference_picture_buffer_init_count, estimate.reference / mb);
+    SVT_LOG("        pa reference:        %4u x %.2lf MB\n", sequence_control_set_ptr->pa_reference_picture_buffer_init_count, estimate.pa_reference / mb);
+    SVT_LOG("        input:               %4u x %.2lf MB\n", sequence_control_set_ptr->input_buffer_fifo_init_count, estimate.input / mb);
+    SVT_LOG("        output:              %4u x %.2lf MB\n", sequence_control_set_ptr->output_stream_buffer_fifo_init_count, estimate.output / mb);
+    SVT_LOG("        enc dec context:     %4u x %.2lf MB\n", sequence_control_set_ptr->enc_dec_process_init_count, estimate.enc_dec / mb);
+    SVT_LOG("        me context:          %4u x %.2lf MB\n", sequence_control_set_ptr->motion_estimation_process_init_count, estimate.motion_estimation / mb);
+    SVT_LOG("    lookahead distance: %u\n", sequence_control_set_ptr->static_config.look_ahead_distance);
+}
+
 EbErrorType load_default_buffer_configuration_settings(
     SequenceControlSet       *sequence_control_set_ptr){
     EbErrorType           return_error = EB_ErrorNone;
@@ -401,9 +649,6 @@ EbErrorType load_default_buffer_configuration_settings(
     if (return_ppcs == -1)
         return EB_ErrorInsufficientResources;
     uint32_t input_pic = (uint32_t)return_ppcs;
-    sequence_control_set_ptr->input_buffer_fifo_init_count = input_pic + SCD_LAD + sequence_control_set_ptr->static_config.look_ahead_distance;
-    sequence_control_set_ptr->output_stream_buffer_fifo_init_count =
-        sequence_control_set_ptr->input_buffer_fifo_init_count + 4;
 
     // ME segments
     sequence_control_set_ptr->me_segment_row_count_array[0] = meSegH;
@@ -448,25 +693,6 @@ EbErrorType load_default_buffer_configuration_settings(
 
     sequence_control_set_ptr->tf_segment_column_count = meSegW;//1;//
     sequence_control_set_ptr->tf_segment_row_count =  meSegH;//1;//
-    //#====================== Data Structures and Picture Buffers ======================
-    sequence_control_set_ptr->picture_control_set_pool_init_count       = input_pic + SCD_LAD + sequence_control_set_ptr->static_config.look_ahead_distance;
-    if (sequence_control_set_ptr->static_config.enable_overlays)
-        sequence_control_set_ptr->picture_control_set_pool_init_count = MAX(sequence_control_set_ptr->picture_control_set_pool_init_count,
-            sequence_control_set_ptr->static_config.look_ahead_distance + // frames in the LAD
-            sequence_control_set_ptr->static_config.look_ahead_distance / (1 << sequence_control_set_ptr->static_config.hierarchical_levels) + 1 +  // number of overlayes in the LAD
-            ((1 << sequence_control_set_ptr->static_config.hierarchical_levels) + SCD_LAD) * 2 +// minigop formation in PD + SCD_LAD *(normal pictures + potential pictures )
-            (1 << sequence_control_set_ptr->static_config.hierarchical_levels)); // minigop in PM
-    sequence_control_set_ptr->picture_control_set_pool_init_count_child = MAX(MAX(MIN(3, core_count/2), core_count / 6), 1);
-    sequence_control_set_ptr->reference_picture_buffer_init_count       = MAX((uint32_t)(input_pic >> 1),
-                                                                          (uint32_t)((1 << sequence_control_set_ptr->static_config.hierarchical_levels) + 2)) +
-                                                                          sequence_control_set_ptr->static_config.look_ahead_distance + SCD_LAD;
-    sequence_control_set_ptr->pa_reference_picture_buffer_init_count    = MAX((uint32_t)(input_pic >> 1),
-                                                                          (uint32_t)((1 << sequence_control_set_ptr->static_config.hierarchical_levels) + 2)) +
-                                                                          sequence_control_set_ptr->static_config.look_ahead_distance + SCD_LAD;
-    sequence_control_set_ptr->output_recon_buffer_fifo_init_count       = sequence_control_set_ptr->reference_picture_buffer_init_count;
-    sequence_control_set_ptr->overlay_input_picture_buffer_init_count   = sequence_control_set_ptr->static_config.enable_overlays ?
-                                                                          (2 << sequence_control_set_ptr->static_config.hierarchical_levels) + SCD_LAD : 1;
-
     //#====================== Inter process Fifos ======================
     sequence_control_set_ptr->resource_coordination_fifo_init_count       = 300;
     sequence_control_set_ptr->picture_analysis_fifo_init_count            = 300;
@@ -482,31 +708,19 @@ EbErrorType load_default_buffer_configuration_settings(
     sequence_control_set_ptr->dlf_fifo_init_count                         = 300;
     sequence_control_set_ptr->cdef_fifo_init_count                        = 300;
     sequence_control_set_ptr->rest_fifo_init_count                        = 300;
+    //#====================== Data Structures and Picture Buffers ======================
+    set_picture_pool_counts(sequence_control_set_ptr, input_pic);
     //#====================== Processes number ======================
-    sequence_control_set_ptr->total_process_init_count                    = 0;
-    if (core_count > 1){
-        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->picture_analysis_process_init_count            = MAX(MIN(15, core_count >> 1), core_count / 6));
-        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->motion_estimation_process_init_count =  MAX(MIN(20, core_count >> 1), core_count / 3));//1);//
-        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->source_based_operations_process_init_count     = MAX(MIN(3, core_count >> 1), core_count / 12));
-        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->mode_decision_configuration_process_init_count = MAX(MIN(3, core_count >> 1), core_count / 12));
-        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->enc_dec_process_init_count                     = MAX(MIN(40, core_count >> 1), core_count));
-        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->entropy_coding_process_init_count              = MAX(MIN(3, core_count >> 1), core_count / 12));
-        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->dlf_process_init_count                         = MAX(MIN(40, core_count >> 1), core_count));
-        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->cdef_process_init_count                        = MAX(MIN(40, core_count >> 1), core_count));
-        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->rest_process_init_count                        = MAX(MIN(40, core_count >> 1), core_count));
-    }else{
-        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->picture_analysis_process_init_count            = 1);
-        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->motion_estimation_process_init_count           = 1);
-        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->source_based_operations_process_init_count     = 1);
-        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->mode_decision_configuration_process_init_count = 1);
-        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->enc_dec_process_init_count                     = 1);
-        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->entropy_coding_process_init_count              = 1);
-        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->dlf_process_init_count                         = 1);
-        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->cdef_process_init_count                        = 1);
-        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->rest_process_init_count                        = 1);
+    set_process_counts(sequence_control_set_ptr, core_count);
+
+    if (sequence_control_set_ptr->static_config.max_memory_mb) {
+        fit_memory_budget(sequence_control_set_ptr, input_pic, core_count);
+        print_memory_estimate(sequence_control_set_ptr);
     }
 
-    sequence_control_set_ptr->total_process_init_count += 6; // single processes count
+    // With the task scheduler the segment-parallel stage counts above only bound
+    // the concurrency of each stage, the work runs on core_count pool workers
+    sequence_control_set_ptr->task_pool_worker_count = sequence_control_set_ptr->static_config.enable_task_scheduler ? core_count : 0;
     printf("Number of logical cores available: %u\nNumber of PPCS %u\n", core_count, sequence_control_set_ptr->picture_control_set_pool_init_count);
 
     return return_error;
@@ -582,6 +796,345 @@ void lib_svt_encoder_send_error_exit(
     EbPtr                    hComponent,
     uint32_t                 error_code);
 
+void init_fn_ptr(void);
+extern void av1_init_wedge_masks(void);
+extern void eb_av1_build_quantizer(
+    AomBitDepth bit_depth,
+    int32_t y_dc_delta_q,
+    int32_t u_dc_delta_q,
+    int32_t u_ac_delta_q,
+    int32_t v_dc_delta_q,
+    int32_t v_ac_delta_q,
+    Quants *const quants,
+    Dequants *const deq);
+
+/**********************************
+* Shared Resources
+*   Process wide resources of the encoder handles: the lookup tables
+*   and function pointers, which are global and only built by the first
+*   handle, and for multi-channel encoding (active_channel_count > 1)
+*   with the task scheduler, one task pool that runs the segment
+*   parallel stages of all the channels, and the analysis groups of the
+*   channels.
+**********************************/
+typedef struct EncSharedResources
+{
+    uint32_t            handle_count;
+    EbAsm               asm_type;
+    uint32_t            sb_size;
+    Quants             *quants_bd[2];
+    Dequants           *deq_bd[2];
+
+    EbThreadPool       *task_pool_ptr;
+    EbHandle           *task_pool_thread_handle_array;
+    uint32_t            task_pool_worker_count;
+    uint32_t            task_pool_free_task_count;
+    uint32_t            task_pool_handle_count;
+
+    SharedAnalysisGroup *analysis_group_list;
+} EncSharedResources;
+
+static EncSharedResources shared_resources;
+static EbHandle shared_resources_mutex;
+
+#ifdef _WIN32
+static INIT_ONCE shared_resources_once = INIT_ONCE_STATIC_INIT;
+
+BOOL CALLBACK create_shared_resources_mutex(
+    PINIT_ONCE InitOnce,
+    PVOID Parameter,
+    PVOID *lpContext)
+{
+    (void)InitOnce;
+    (void)Parameter;
+    (void)lpContext;
+    shared_resources_mutex = eb_create_mutex();
+    return TRUE;
+}
+
+static EbHandle get_shared_resources_mutex()
+{
+    InitOnceExecuteOnce(&shared_resources_once, create_shared_resources_mutex, NULL, NULL);
+    return shared_resources_mutex;
+}
+#else
+static void create_shared_resources_mutex()
+{
+    shared_resources_mutex = eb_create_mutex();
+}
+
+static pthread_once_t shared_resources_once = PTHREAD_ONCE_INIT;
+
+static EbHandle get_shared_resources_mutex()
+{
+    pthread_once(&shared_resources_once, create_shared_resources_mutex);
+    return shared_resources_mutex;
+}
+#endif
+
+static EbErrorType build_shared_tables(EbAsm asm_type, uint32_t sb_size)
+{
+    setup_rtcd_internal(asm_type);
+    asmSetConvolveAsmTable();
+
+    init_intra_dc_predictors_c_internal();
+
+    asmSetConvolveHbdAsmTable();
+
+    init_intra_predictors_internal();
+
+    build_blk_geom(sb_size == 128);
+
+    eb_av1_init_me_luts();
+    init_fn_ptr();
+    av1_init_wedge_masks();
+
+    // The encoder never codes a delta q, the tables only depend on the bit depth
+    for (uint32_t bd_index = 0; bd_index < 2; ++bd_index) {
+        EB_MALLOC_ALIGNED_ARRAY(shared_resources.quants_bd[bd_index], 1);
+        EB_MALLOC_ALIGNED_ARRAY(shared_resources.deq_bd[bd_index], 1);
+        eb_av1_build_quantizer(
+            bd_index ? AOM_BITS_10 : AOM_BITS_8,
+            0, 0, 0, 0, 0,
+            shared_resources.quants_bd[bd_index],
+            shared_resources.deq_bd[bd_index]);
+    }
+    shared_resources.asm_type = asm_type;
+    shared_resources.sb_size = sb_size;
+
+    return EB_ErrorNone;
+}
+
+/**********************************
+* acquire_shared_resources
+*   The tables are global, a handle can only join the running ones
+*   when it needs the same (asm type and SB size).
+**********************************/
+static EbErrorType acquire_shared_resources(EbEncHandle *enc_handle_ptr)
+{
+    EbErrorType return_error = EB_ErrorNone;
+    EbHandle mutex = get_shared_resources_mutex();
+    EbAsm asm_type = enc_handle_ptr->sequence_control_set_instance_array[0]->encode_context_ptr->asm_type;
+    uint32_t sb_size = enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->static_config.super_block_size;
+
+    eb_block_on_mutex(mutex);
+    if (shared_resources.handle_count == 0)
+        return_error = build_shared_tables(asm_type, sb_size);
+    else if (shared_resources.asm_type != asm_type || shared_resources.sb_size != sb_size) {
+        SVT_LOG("Error: the encoder channels of a process must use the same asm type and super block size\n");
+        return_error = EB_ErrorBadParameter;
+    }
+    if (return_error == EB_ErrorNone) {
+        ++shared_resources.handle_count;
+        enc_handle_ptr->shared_resources_acquired = EB_TRUE;
+    }
+    eb_release_mutex(mutex);
+
+    for (uint32_t instance_index = 0; instance_index < enc_handle_ptr->encode_instance_total_count; ++instance_index) {
+        SequenceControlSet *sequence_control_set_ptr = enc_handle_ptr->sequence_control_set_instance_array[instance_index]->sequence_control_set_ptr;
+        for (uint32_t bd_index = 0; bd_index < 2; ++bd_index) {
+            sequence_control_set_ptr->quants_bd[bd_index] = shared_resources.quants_bd[bd_index];
+            sequence_control_set_ptr->deq_bd[bd_index] = shared_resources.deq_bd[bd_index];
+        }
+    }
+
+    return return_error;
+}
+
+static void release_shared_resources(EbEncHandle *enc_handle_ptr)
+{
+    EbHandle mutex = get_shared_resources_mutex();
+
+    if (!enc_handle_ptr->shared_resources_acquired)
+        return;
+
+    eb_block_on_mutex(mutex);
+    if (--shared_resources.handle_count == 0) {
+        for (uint32_t bd_index = 0; bd_index < 2; ++bd_index) {
+            EB_FREE_ALIGNED_ARRAY(shared_resources.quants_bd[bd_index]);
+            EB_FREE_ALIGNED_ARRAY(shared_resources.deq_bd[bd_index]);
+        }
+    }
+    enc_handle_ptr->shared_resources_acquired = EB_FALSE;
+    eb_release_mutex(mutex);
+}
+
+static EbErrorType create_shared_task_pool(
+    uint32_t     worker_count,
+    uint32_t     task_capacity)
+{
+    EB_NEW(
+        shared_resources.task_pool_ptr,
+        eb_thread_pool_ctor,
+        worker_count,
+        task_capacity);
+    shared_resources.task_pool_worker_count = shared_resources.task_pool_ptr->worker_count;
+    shared_resources.task_pool_free_task_count = task_capacity;
+    EB_CREATE_THREAD_ARRAY(shared_resources.task_pool_thread_handle_array, shared_resources.task_pool_worker_count,
+        eb_thread_pool_kernel,
+        shared_resources.task_pool_ptr->worker_ptr_array);
+
+    return EB_ErrorNone;
+}
+
+/**********************************
+* acquire_shared_task_pool
+*   The first channel creates the pool with room for the tasks of
+*   active_channel_count channels, the next ones attach to it. A
+*   channel that does not fit keeps task_pool_ptr NULL and creates
+*   a pool of its own.
+**********************************/
+static EbErrorType acquire_shared_task_pool(
+    EbEncHandle *enc_handle_ptr,
+    uint32_t     worker_count,
+    uint32_t     task_count)
+{
+    EbErrorType return_error = EB_ErrorNone;
+    EbHandle mutex = get_shared_resources_mutex();
+    uint32_t channel_count = enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->static_config.active_channel_count;
+
+    eb_block_on_mutex(mutex);
+    if (shared_resources.task_pool_ptr == NULL)
+        return_error = create_shared_task_pool(worker_count, task_count * channel_count);
+    if (return_error == EB_ErrorNone && shared_resources.task_pool_free_task_count >= task_count) {
+        shared_resources.task_pool_free_task_count -= task_count;
+        ++shared_resources.task_pool_handle_count;
+        enc_handle_ptr->task_pool_ptr = shared_resources.task_pool_ptr;
+        enc_handle_ptr->task_pool_task_count = task_count;
+        enc_handle_ptr->task_pool_shared = EB_TRUE;
+    }
+    eb_release_mutex(mutex);
+
+    return return_error;
+}
+
+/**********************************
+* release_shared_task_pool
+*   Called once the channel has no more pictures in flight, its last
+*   tasks may still be returning on the workers.
+**********************************/
+static void release_shared_task_pool(EbEncHandle *enc_handle_ptr)
+{
+    EbHandle mutex = get_shared_resources_mutex();
+
+    eb_block_on_mutex(mutex);
+    eb_thread_pool_wait_running_tasks(shared_resources.task_pool_ptr);
+    shared_resources.task_pool_free_task_count += enc_handle_ptr->task_pool_task_count;
+    if (--shared_resources.task_pool_handle_count == 0) {
+        EB_DESTROY_THREAD_ARRAY(shared_resources.task_pool_thread_handle_array, shared_resources.task_pool_worker_count);
+        EB_DELETE(shared_resources.task_pool_ptr);
+    }
+    enc_handle_ptr->task_pool_ptr = NULL;
+    enc_handle_ptr->task_pool_shared = EB_FALSE;
+    eb_release_mutex(mutex);
+}
+
+static EbErrorType create_analysis_group(
+    SequenceControlSet   *sequence_control_set_ptr,
+    uint32_t              sb_total_count,
+    SharedAnalysisGroup **group_ptr)
+{
+    EbSvtAv1EncConfiguration *config = &sequence_control_set_ptr->static_config;
+
+    EB_NEW(
+        *group_ptr,
+        shared_analysis_group_ctor,
+        config->analysis_group,
+        sequence_control_set_ptr->max_input_luma_width,
+        sequence_control_set_ptr->max_input_luma_height,
+        config->encoder_bit_depth,
+        (EbColorFormat)config->encoder_color_format,
+        sb_total_count);
+    (*group_ptr)->next_ptr = shared_resources.analysis_group_list;
+    shared_resources.analysis_group_list = *group_ptr;
+
+    return EB_ErrorNone;
+}
+
+/**********************************
+* join_analysis_group
+*   The channels of an analysis group must code the same picture
+*   layout, and at most one of them is the primary.
+**********************************/
+static EbErrorType join_analysis_group(EbEncHandle *enc_handle_ptr)
+{
+    EbErrorType return_error = EB_ErrorNone;
+    EbHandle mutex = get_shared_resources_mutex();
+    SequenceControlSet *sequence_control_set_ptr = enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr;
+    EbSvtAv1EncConfiguration *config = &sequence_control_set_ptr->static_config;
+    const uint32_t sb_sz = sequence_control_set_ptr->sb_sz;
+    const uint32_t sb_total_count =
+        ((sequence_control_set_ptr->max_input_luma_width + sb_sz - 1) / sb_sz) *
+        ((sequence_control_set_ptr->max_input_luma_height + sb_sz - 1) / sb_sz);
+    SharedAnalysisGroup *group_ptr;
+
+    if (config->analysis_group == 0)
+        return EB_ErrorNone;
+
+    eb_block_on_mutex(mutex);
+    group_ptr = shared_resources.analysis_group_list;
+    while (group_ptr && group_ptr->group_id != config->analysis_group)
+        group_ptr = group_ptr->next_ptr;
+    if (group_ptr == NULL)
+        return_error = create_analysis_group(sequence_control_set_ptr, sb_total_count, &group_ptr);
+    else if (group_ptr->width != sequence_control_set_ptr->max_input_luma_width ||
+        group_ptr->height != sequence_control_set_ptr->max_input_luma_height ||
+        group_ptr->encoder_bit_depth != config->encoder_bit_depth ||
+        group_ptr->color_format != (EbColorFormat)config->encoder_color_format ||
+        group_ptr->sb_total_count != sb_total_count) {
+        SVT_LOG("Error: the channels of analysis group %u must use the same resolution, bit depth and color format\n", config->analysis_group);
+        return_error = EB_ErrorBadParameter;
+    }
+    else if (config->analysis_primary && group_ptr->has_primary) {
+        SVT_LOG("Error: analysis group %u already has a primary channel\n", config->analysis_group);
+        return_error = EB_ErrorBadParameter;
+    }
+    if (return_error == EB_ErrorNone) {
+        eb_block_on_mutex(group_ptr->mutex);
+        ++group_ptr->member_count;
+        if (config->analysis_primary)
+            group_ptr->has_primary = EB_TRUE;
+        eb_release_mutex(group_ptr->mutex);
+        enc_handle_ptr->analysis_group_ptr = group_ptr;
+        for (uint32_t instance_index = 0; instance_index < enc_handle_ptr->encode_instance_total_count; ++instance_index)
+            enc_handle_ptr->sequence_control_set_instance_array[instance_index]->sequence_control_set_ptr->analysis_group_ptr = group_ptr;
+    }
+    eb_release_mutex(mutex);
+
+    return return_error;
+}
+
+/**********************************
+* leave_analysis_group
+*   Called once the channel has no more pictures in flight. When the
+*   primary leaves, the siblings do their own analysis of the pictures
+*   it did not publish. The last channel deletes the group.
+**********************************/
+static void leave_analysis_group(EbEncHandle *enc_handle_ptr)
+{
+    EbHandle mutex = get_shared_resources_mutex();
+    SharedAnalysisGroup *group_ptr = enc_handle_ptr->analysis_group_ptr;
+
+    if (group_ptr == NULL)
+        return;
+    if (enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->static_config.analysis_primary)
+        shared_analysis_primary_leave(group_ptr);
+
+    eb_block_on_mutex(mutex);
+    eb_block_on_mutex(group_ptr->mutex);
+    --group_ptr->member_count;
+    eb_release_mutex(group_ptr->mutex);
+    if (group_ptr->member_count == 0) {
+        SharedAnalysisGroup **link_ptr = &shared_resources.analysis_group_list;
+        while (*link_ptr != group_ptr)
+            link_ptr = &(*link_ptr)->next_ptr;
+        *link_ptr = group_ptr->next_ptr;
+        EB_DELETE(group_ptr);
+    }
+    enc_handle_ptr->analysis_group_ptr = NULL;
+    eb_release_mutex(mutex);
+}
+
 static void eb_enc_handle_stop_threads(EbEncHandle *enc_handle_ptr)
 {
     SequenceControlSet*  control_set_ptr = enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr;
@@ -627,6 +1180,14 @@ static void eb_enc_handle_stop_threads(EbEncHandle *enc_handle_ptr)
 
     // Packetization
     EB_DESTROY_THREAD(enc_handle_ptr->packetization_thread_handle);
+
+    // Task Pool
+    if (enc_handle_ptr->task_pool_shared)
+        release_shared_task_pool(enc_handle_ptr);
+    else
+        EB_DESTROY_THREAD_ARRAY(enc_handle_ptr->task_pool_thread_handle_array, control_set_ptr->task_pool_worker_count);
+
+    leave_analysis_group(enc_handle_ptr);
 }
 /**********************************
 * Encoder Library Handle Deonstructor
@@ -636,6 +1197,7 @@ static void eb_enc_handle_dctor(EbPtr p)
     EbEncHandle *enc_handle_ptr = (EbEncHandle *)p;
 
     eb_enc_handle_stop_threads(enc_handle_ptr);
+    EB_DELETE(enc_handle_ptr->task_pool_ptr);
     EB_FREE_PTR_ARRAY(enc_handle_ptr->app_callback_ptr_array, enc_handle_ptr->encode_instance_total_count);
     EB_DELETE(enc_handle_ptr->sequence_control_set_pool_ptr);
     EB_DELETE_PTR_ARRAY(enc_handle_ptr->picture_parent_control_set_pool_ptr_array, enc_handle_ptr->encode_instance_total_count);
@@ -689,6 +1251,7 @@ static void eb_enc_handle_dctor(EbPtr p)
     EB_FREE_ARRAY(enc_handle_ptr->output_recon_buffer_producer_fifo_ptr_dbl_array);
     EB_FREE_ARRAY(enc_handle_ptr->output_recon_buffer_consumer_fifo_ptr_dbl_array);
 
+    release_shared_resources(enc_handle_ptr);
 }
 
 /**********************************
@@ -809,25 +1372,19 @@ EbErrorType RestResultsCreator(
     return EB_ErrorNone;
 }
 
-void init_fn_ptr(void);
-extern void av1_init_wedge_masks(void);
 /**********************************
 * Initialize Encoder Library
 **********************************/
-#ifdef __GNUC__
-__attribute__((visibility("default")))
-#endif
-EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
+static EbErrorType init_encoder(EbEncHandle *enc_handle_ptr)
 {
-    if(svt_enc_component == NULL)
-        return EB_ErrorBadParameter;
-    EbEncHandle *enc_handle_ptr = (EbEncHandle*)svt_enc_component->p_component_private;
     EbErrorType return_error = EB_ErrorNone;
     uint32_t instance_index;
     uint32_t processIndex;
     uint32_t max_picture_width;
     EbBool is16bit = (EbBool)(enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->static_config.encoder_bit_depth > EB_8BIT);
     EbColorFormat color_format = enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->static_config.encoder_color_format;
+    // The MD recon reuse pool is only allocated when the mode can be used
+    uint8_t md_recon_reuse = !is16bit && enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->static_config.md_recon_reuse == 1;
     SequenceControlSet* control_set_ptr;
 
     /************************************
@@ -837,22 +1394,15 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
         enc_handle_ptr->sequence_control_set_instance_array[0]->encode_context_ptr->asm_type = GetCpuAsmType();
     else
         enc_handle_ptr->sequence_control_set_instance_array[0]->encode_context_ptr->asm_type = enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->static_config.asm_type;
-    setup_rtcd_internal(enc_handle_ptr->sequence_control_set_instance_array[0]->encode_context_ptr->asm_type);
-    asmSetConvolveAsmTable();
-
-    init_intra_dc_predictors_c_internal();
-
-    asmSetConvolveHbdAsmTable();
+    return_error = acquire_shared_resources(enc_handle_ptr);
+    if (return_error != EB_ErrorNone)
+        return return_error;
+    return_error = join_analysis_group(enc_handle_ptr);
+    if (return_error != EB_ErrorNone)
+        return return_error;
 
-    init_intra_predictors_internal();
     EbSequenceControlSetInitData scs_init;
     scs_init.sb_size = enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->static_config.super_block_size;
-
-    build_blk_geom(scs_init.sb_size == 128);
-
-    eb_av1_init_me_luts();
-    init_fn_ptr();
-    av1_init_wedge_masks();
     /************************************
     * Sequence Control Set
     ************************************/
@@ -1073,6 +1623,7 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
         EbPaReferenceObjectDescInitDataStructure.reference_picture_desc_init_data = referencePictureBufferDescInitData;
         EbPaReferenceObjectDescInitDataStructure.quarter_picture_desc_init_data = quarterPictureBufferDescInitData;
         EbPaReferenceObjectDescInitDataStructure.sixteenth_picture_desc_init_data = sixteenthPictureBufferDescInitData;
+        EbPaReferenceObjectDescInitDataStructure.me_block_sum = (EbBool)enc_handle_ptr->sequence_control_set_instance_array[instance_index]->sequence_control_set_ptr->me_successive_elimination;
         // Reference Picture Buffers
         EB_NEW(enc_handle_ptr->pa_reference_picture_pool_ptr_array[instance_index],
             eb_system_resource_ctor,
@@ -1579,6 +2130,7 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
             is16bit,
             color_format,
             enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->static_config.enable_hbd_mode_decision,
+            md_recon_reuse,
             enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->max_input_luma_width,
             enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->max_input_luma_height
             );
@@ -1596,6 +2148,7 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
             is16bit,
             color_format,
             enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->static_config.enable_hbd_mode_decision,
+            md_recon_reuse,
             enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->max_input_luma_width,
             enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->max_input_luma_height
         );
@@ -1678,23 +2231,70 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
     ************************************/
     EbSvtAv1EncConfiguration   *config_ptr = &enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->static_config;
 
-    EbSetThreadManagementParameters(config_ptr);
-
     control_set_ptr = enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr;
 
+    // Task Pool
+    if (config_ptr->enable_task_scheduler) {
+        // At most one pending task per stage context
+        const uint32_t task_count =
+            control_set_ptr->picture_analysis_process_init_count +
+            control_set_ptr->motion_estimation_process_init_count +
+            control_set_ptr->enc_dec_process_init_count +
+            control_set_ptr->dlf_process_init_count +
+            control_set_ptr->cdef_process_init_count +
+            control_set_ptr->rest_process_init_count;
+        if (config_ptr->active_channel_count > 1) {
+            return_error = acquire_shared_task_pool(enc_handle_ptr, control_set_ptr->task_pool_worker_count, task_count);
+            if (return_error != EB_ErrorNone)
+                return return_error;
+        }
+        if (enc_handle_ptr->task_pool_ptr == NULL) {
+            EB_NEW(
+                enc_handle_ptr->task_pool_ptr,
+                eb_thread_pool_ctor,
+                control_set_ptr->task_pool_worker_count,
+                task_count);
+            EB_CREATE_THREAD_ARRAY(enc_handle_ptr->task_pool_thread_handle_array, control_set_ptr->task_pool_worker_count,
+                eb_thread_pool_kernel,
+                enc_handle_ptr->task_pool_ptr->worker_ptr_array);
+        }
+    }
+
     // Resource Coordination
     EB_CREATE_THREAD(enc_handle_ptr->resource_coordination_thread_handle, resource_coordination_kernel, enc_handle_ptr->resource_coordination_context_ptr);
-    EB_CREATE_THREAD_ARRAY(enc_handle_ptr->picture_analysis_thread_handle_array,control_set_ptr->picture_analysis_process_init_count,
-        picture_analysis_kernel,
-        enc_handle_ptr->picture_analysis_context_ptr_array);
+    if (enc_handle_ptr->task_pool_ptr) {
+        for (processIndex = 0; processIndex < control_set_ptr->picture_analysis_process_init_count; ++processIndex) {
+            eb_fifo_attach_task_pool(
+                enc_handle_ptr->picture_analysis_context_ptr_array[processIndex]->resource_coordination_results_input_fifo_ptr,
+                enc_handle_ptr->task_pool_ptr,
+                picture_analysis_task,
+                enc_handle_ptr->picture_analysis_context_ptr_array[processIndex]);
+        }
+    }
+    else {
+        EB_CREATE_THREAD_ARRAY(enc_handle_ptr->picture_analysis_thread_handle_array, control_set_ptr->picture_analysis_process_init_count,
+            picture_analysis_kernel,
+            enc_handle_ptr->picture_analysis_context_ptr_array);
+    }
 
     // Picture Decision
     EB_CREATE_THREAD(enc_handle_ptr->picture_decision_thread_handle, picture_decision_kernel, enc_handle_ptr->picture_decision_context_ptr);
 
     // Motion Estimation
-    EB_CREATE_THREAD_ARRAY(enc_handle_ptr->motion_estimation_thread_handle_array, control_set_ptr->motion_estimation_process_init_count,
-        motion_estimation_kernel,
-        enc_handle_ptr->motion_estimation_context_ptr_array);
+    if (enc_handle_ptr->task_pool_ptr) {
+        for (processIndex = 0; processIndex < control_set_ptr->motion_estimation_process_init_count; ++processIndex) {
+            eb_fifo_attach_task_pool(
+                enc_handle_ptr->motion_estimation_context_ptr_array[processIndex]->picture_decision_results_input_fifo_ptr,
+                enc_handle_ptr->task_pool_ptr,
+                motion_estimation_task,
+                enc_handle_ptr->motion_estimation_context_ptr_array[processIndex]);
+        }
+    }
+    else {
+        EB_CREATE_THREAD_ARRAY(enc_handle_ptr->motion_estimation_thread_handle_array, control_set_ptr->motion_estimation_process_init_count,
+            motion_estimation_kernel,
+            enc_handle_ptr->motion_estimation_context_ptr_array);
+    }
 
     // Initial Rate Control
     EB_CREATE_THREAD(enc_handle_ptr->initial_rate_control_thread_handle, initial_rate_control_kernel, enc_handle_ptr->initial_rate_control_context_ptr);
@@ -1717,24 +2317,68 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
 
 
     // EncDec Process
-    EB_CREATE_THREAD_ARRAY(enc_handle_ptr->enc_dec_thread_handle_array, control_set_ptr->enc_dec_process_init_count,
-        enc_dec_kernel,
-        enc_handle_ptr->enc_dec_context_ptr_array);
+    if (enc_handle_ptr->task_pool_ptr) {
+        for (processIndex = 0; processIndex < control_set_ptr->enc_dec_process_init_count; ++processIndex) {
+            eb_fifo_attach_task_pool(
+                enc_handle_ptr->enc_dec_context_ptr_array[processIndex]->mode_decision_input_fifo_ptr,
+                enc_handle_ptr->task_pool_ptr,
+                enc_dec_task,
+                enc_handle_ptr->enc_dec_context_ptr_array[processIndex]);
+        }
+    }
+    else {
+        EB_CREATE_THREAD_ARRAY(enc_handle_ptr->enc_dec_thread_handle_array, control_set_ptr->enc_dec_process_init_count,
+            enc_dec_kernel,
+            enc_handle_ptr->enc_dec_context_ptr_array);
+    }
 
     // Dlf Process
-    EB_CREATE_THREAD_ARRAY(enc_handle_ptr->dlf_thread_handle_array, control_set_ptr->dlf_process_init_count,
-        dlf_kernel,
-        enc_handle_ptr->dlf_context_ptr_array);
+    if (enc_handle_ptr->task_pool_ptr) {
+        for (processIndex = 0; processIndex < control_set_ptr->dlf_process_init_count; ++processIndex) {
+            eb_fifo_attach_task_pool(
+                enc_handle_ptr->dlf_context_ptr_array[processIndex]->dlf_input_fifo_ptr,
+                enc_handle_ptr->task_pool_ptr,
+                dlf_task,
+                enc_handle_ptr->dlf_context_ptr_array[processIndex]);
+        }
+    }
+    else {
+        EB_CREATE_THREAD_ARRAY(enc_handle_ptr->dlf_thread_handle_array, control_set_ptr->dlf_process_init_count,
+            dlf_kernel,
+            enc_handle_ptr->dlf_context_ptr_array);
+    }
 
     // Cdef Process
-    EB_CREATE_THREAD_ARRAY(enc_handle_ptr->cdef_thread_handle_array, control_set_ptr->cdef_process_init_count,
-        cdef_kernel,
-        enc_handle_ptr->cdef_context_ptr_array);
+    if (enc_handle_ptr->task_pool_ptr) {
+        for (processIndex = 0; processIndex < control_set_ptr->cdef_process_init_count; ++processIndex) {
+            eb_fifo_attach_task_pool(
+                enc_handle_ptr->cdef_context_ptr_array[processIndex]->cdef_input_fifo_ptr,
+                enc_handle_ptr->task_pool_ptr,
+                cdef_task,
+                enc_handle_ptr->cdef_context_ptr_array[processIndex]);
+        }
+    }
+    else {
+        EB_CREATE_THREAD_ARRAY(enc_handle_ptr->cdef_thread_handle_array, control_set_ptr->cdef_process_init_count,
+            cdef_kernel,
+            enc_handle_ptr->cdef_context_ptr_array);
+    }
 
     // Rest Process
-    EB_CREATE_THREAD_ARRAY(enc_handle_ptr->rest_thread_handle_array, control_set_ptr->rest_process_init_count,
-        rest_kernel,
-        enc_handle_ptr->rest_context_ptr_array);
+    if (enc_handle_ptr->task_pool_ptr) {
+        for (processIndex = 0; processIndex < control_set_ptr->rest_process_init_count; ++processIndex) {
+            eb_fifo_attach_task_pool(
+                enc_handle_ptr->rest_context_ptr_array[processIndex]->rest_input_fifo_ptr,
+                enc_handle_ptr->task_pool_ptr,
+                rest_task,
+                enc_handle_ptr->rest_context_ptr_array[processIndex]);
+        }
+    }
+    else {
+        EB_CREATE_THREAD_ARRAY(enc_handle_ptr->rest_thread_handle_array, control_set_ptr->rest_process_init_count,
+            rest_kernel,
+            enc_handle_ptr->rest_context_ptr_array);
+    }
 
     // Entropy Coding Process
     EB_CREATE_THREAD_ARRAY(enc_handle_ptr->entropy_coding_thread_handle_array, control_set_ptr->entropy_coding_process_init_count,
@@ -1752,6 +2396,27 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
     return return_error;
 }
 
+#ifdef __GNUC__
+__attribute__((visibility("default")))
+#endif
+EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
+{
+    if(svt_enc_component == NULL)
+        return EB_ErrorBadParameter;
+    EbEncHandle *enc_handle_ptr = (EbEncHandle*)svt_enc_component->p_component_private;
+    CallerAffinity caller_affinity;
+    EbErrorType return_error;
+
+    EbSetThreadManagementParameters(&enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->static_config);
+
+    const EbBool caller_bound = bind_caller_to_workers(&caller_affinity);
+    return_error = init_encoder(enc_handle_ptr);
+    if (caller_bound)
+        restore_caller_affinity(&caller_affinity);
+
+    return return_error;
+}
+
 /**********************************
 * DeInitialize Encoder Library
 **********************************/
@@ -2009,6 +2674,11 @@ void SetParamBasedOnInput(SequenceControlSet *sequence_control_set_ptr)
     else
         sequence_control_set_ptr->down_sampling_method_me_search = ME_DECIMATED_DOWNSAMPLED;
 
+    // Set successive elimination of the full-pel ME     Settings
+    // 0                            0: OFF
+    // 1                            1: ON, the search areas are large enough to pay for the block sums
+    sequence_control_set_ptr->me_successive_elimination = sequence_control_set_ptr->input_resolution >= INPUT_SIZE_1080p_RANGE ? 1 : 0;
+
     // Set over_boundary_block_mode     Settings
     // 0                            0: not allowed
     // 1                            1: allowed
@@ -2121,6 +2791,9 @@ void CopyApiFromApp(
     sequence_control_set_ptr->static_config.enable_hme_level0_flag = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->enable_hme_level0_flag;
     sequence_control_set_ptr->static_config.enable_hme_level1_flag = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->enable_hme_level1_flag;
     sequence_control_set_ptr->static_config.enable_hme_level2_flag = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->enable_hme_level2_flag;
+    sequence_control_set_ptr->static_config.predictive_hme = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->predictive_hme;
+    sequence_control_set_ptr->static_config.enable_motion_hints = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->enable_motion_hints;
+    sequence_control_set_ptr->static_config.export_motion_field = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->export_motion_field;
     sequence_control_set_ptr->static_config.search_area_width = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->search_area_width;
     sequence_control_set_ptr->static_config.search_area_height = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->search_area_height;
     sequence_control_set_ptr->static_config.number_hme_search_region_in_width = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->number_hme_search_region_in_width;
@@ -2154,6 +2827,7 @@ void CopyApiFromApp(
     sequence_control_set_ptr->static_config.constrained_intra = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->constrained_intra;
     sequence_control_set_ptr->static_config.enable_palette = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->enable_palette;
     sequence_control_set_ptr->static_config.olpd_refinement = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->olpd_refinement;
+    sequence_control_set_ptr->static_config.md_recon_reuse = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->md_recon_reuse;
     // Adaptive Loop Filter
     sequence_control_set_ptr->static_config.tile_rows = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->tile_rows;
     sequence_control_set_ptr->static_config.tile_columns = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->tile_columns;
@@ -2217,6 +2891,10 @@ void CopyApiFromApp(
     sequence_control_set_ptr->static_config.active_channel_count = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->active_channel_count;
     sequence_control_set_ptr->static_config.logical_processors = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->logical_processors;
     sequence_control_set_ptr->static_config.target_socket = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->target_socket;
+    sequence_control_set_ptr->static_config.enable_task_scheduler = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->enable_task_scheduler;
+    sequence_control_set_ptr->static_config.max_memory_mb = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->max_memory_mb;
+    sequence_control_set_ptr->static_config.analysis_group = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->analysis_group;
+    sequence_control_set_ptr->static_config.analysis_primary = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->analysis_primary;
     sequence_control_set_ptr->qp = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->qp;
     sequence_control_set_ptr->static_config.recon_enabled = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->recon_enabled;
 
@@ -2235,6 +2913,7 @@ void CopyApiFromApp(
     sequence_control_set_ptr->static_config.altref_strength = pComponentParameterStructure->altref_strength;
     sequence_control_set_ptr->static_config.altref_nframes = pComponentParameterStructure->altref_nframes;
     sequence_control_set_ptr->static_config.enable_overlays = pComponentParameterStructure->enable_overlays;
+    sequence_control_set_ptr->static_config.tf_adaptive_skip = pComponentParameterStructure->tf_adaptive_skip;
 
     sequence_control_set_ptr->static_config.sq_weight = pComponentParameterStructure->sq_weight;
 
@@ -2404,6 +3083,11 @@ static EbErrorType VerifySettings(
         return_error = EB_ErrorBadParameter;
     }
 
+    if (config->predictive_hme < -1 || config->predictive_hme > 1) {
+        SVT_LOG("Error Instance %u: invalid PredictiveHme. PredictiveHme must be [-1 - 1]\n", channelNumber + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
     if ((config->search_area_width > 256) || (config->search_area_width == 0)) {
         SVT_LOG("Error Instance %u: Invalid search_area_width. search_area_width must be [1 - 256]\n", channelNumber + 1);
         return_error = EB_ErrorBadParameter;
@@ -2579,6 +3263,27 @@ static EbErrorType VerifySettings(
         return_error = EB_ErrorBadParameter;
     }
 
+    if (config->enable_task_scheduler != 0 && config->enable_task_scheduler != 1) {
+        SVT_LOG("Error instance %u: Invalid enable_task_scheduler. enable_task_scheduler must be [0 - 1] \n", channelNumber + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
+    if (config->analysis_primary != 0 && config->analysis_primary != 1) {
+        SVT_LOG("Error instance %u: Invalid analysis_primary. analysis_primary must be [0 - 1] \n", channelNumber + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
+    if (config->analysis_primary && config->analysis_group == 0) {
+        SVT_LOG("Error instance %u: analysis_primary requires an analysis_group \n", channelNumber + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
+    // the siblings wait for the primary, they would hold the workers the primary needs
+    if (config->analysis_group && config->enable_task_scheduler) {
+        SVT_LOG("Error instance %u: analysis_group is not supported with enable_task_scheduler \n", channelNumber + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
     // alt-ref frames related
     if (config->altref_strength > ALTREF_MAX_STRENGTH ) {
         SVT_LOG("Error instance %u: invalid altref-strength, should be in the range [0 - %d] \n", channelNumber + 1, ALTREF_MAX_STRENGTH);
@@ -2590,6 +3295,11 @@ static EbErrorType VerifySettings(
         return_error = EB_ErrorBadParameter;
     }
 
+    if (config->tf_adaptive_skip < -1 || config->tf_adaptive_skip > 1) {
+        SVT_LOG("Error instance %u: invalid tf-adaptive-skip, should be in the range [-1 - 1] \n", channelNumber + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
     // palette
     if (config->enable_palette < (int32_t)(-1) || config->enable_palette >6) {
         SVT_LOG( "Error instance %u: Invalid Palette Mode [0 .. 6], your input: %i\n", channelNumber + 1, config->enable_palette);
@@ -2612,6 +3322,11 @@ static EbErrorType VerifySettings(
         return_error = EB_ErrorBadParameter;
     }
 
+    if (config->md_recon_reuse < -1 || config->md_recon_reuse > 1) {
+        SVT_LOG("Error instance %u: Invalid MdReconReuse [-1, 0, 1], your input: %i\n", channelNumber + 1, config->md_recon_reuse);
+        return_error = EB_ErrorBadParameter;
+    }
+
     return return_error;
 }
 
@@ -2671,6 +3386,9 @@ EbErrorType eb_svt_enc_init_parameter(
     config_ptr->enable_hme_level0_flag = EB_TRUE;
     config_ptr->enable_hme_level1_flag = EB_FALSE;
     config_ptr->enable_hme_level2_flag = EB_FALSE;
+    config_ptr->predictive_hme = -1;
+    config_ptr->enable_motion_hints = EB_FALSE;
+    config_ptr->export_motion_field = EB_FALSE;
     config_ptr->search_area_width = 16;
     config_ptr->search_area_height = 7;
     config_ptr->number_hme_search_region_in_width = 2;
@@ -2693,6 +3411,7 @@ EbErrorType eb_svt_enc_init_parameter(
     config_ptr->constrained_intra = EB_FALSE;
     config_ptr->enable_palette = -1;
     config_ptr->olpd_refinement = -1;
+    config_ptr->md_recon_reuse = -1;
     // Bitstream options
     //config_ptr->codeVpsSpsPps = 0;
     //config_ptr->codeEosNal = 0;
@@ -2723,6 +3442,10 @@ EbErrorType eb_svt_enc_init_parameter(
     // Channel info
     config_ptr->logical_processors = 0;
     config_ptr->target_socket = -1;
+    config_ptr->enable_task_scheduler = EB_FALSE;
+    config_ptr->max_memory_mb = 0;
+    config_ptr->analysis_group = 0;
+    config_ptr->analysis_primary = EB_FALSE;
     config_ptr->channel_id = 0;
     config_ptr->active_channel_count = 1;
 
@@ -2734,6 +3457,7 @@ EbErrorType eb_svt_enc_init_parameter(
     config_ptr->altref_nframes = 7;
     config_ptr->altref_strength = 5;
     config_ptr->enable_overlays = EB_FALSE;
+    config_ptr->tf_adaptive_skip = -1;
 
     config_ptr->sq_weight = 100;
 
@@ -2925,6 +3649,7 @@ EB_API EbErrorType eb_svt_enc_stream_header(
     outputStreamBuffer->size = sizeof(EbBufferHeaderType);
     outputStreamBuffer->n_alloc_len = PACKETIZATION_PROCESS_BUFFER_SIZE;
     outputStreamBuffer->p_app_private = NULL;
+    outputStreamBuffer->motion_field = NULL;
     outputStreamBuffer->pic_type = EB_AV1_INVALID_PICTURE;
     outputStreamBuffer->n_filled_len = 0;
 
@@ -3129,6 +3854,29 @@ static EbErrorType CopyFrameBuffer(
     }
     return return_error;
 }
+/**************************************
+* Copy the motion hints of an input picture,
+* none when they are not on the 64x64 grid
+* of the source
+**************************************/
+static void CopyMotionField(
+    EbSvtMotionField       *dst,
+    const EbSvtMotionField *src)
+{
+    if (src == NULL || src->mvs == NULL ||
+        src->block_cols != dst->block_cols || src->block_rows != dst->block_rows) {
+        dst->mv_count = 0;
+        return;
+    }
+    dst->mv_count = MIN(src->mv_count, EB_MOTION_FIELD_MAX_MV_COUNT);
+    for (uint32_t block_index = 0; block_index < dst->block_cols * dst->block_rows; block_index++) {
+        EB_MEMCPY(
+            &dst->mvs[block_index * dst->mv_count],
+            &src->mvs[block_index * src->mv_count],
+            dst->mv_count * sizeof(EbSvtMotionVector));
+    }
+}
+
 static void CopyInputBuffer(
     SequenceControlSet*    sequenceControlSet,
     EbBufferHeaderType*     dst,
@@ -3148,6 +3896,10 @@ static void CopyInputBuffer(
     // Copy the picture buffer
     if (src->p_buffer != NULL)
         CopyFrameBuffer(sequenceControlSet, dst->p_buffer, src->p_buffer);
+
+    // Copy the motion hints
+    if (dst->motion_field)
+        CopyMotionField(dst->motion_field, src->motion_field);
 }
 
 /**********************************
@@ -3396,6 +4148,33 @@ static EbErrorType allocate_frame_buffer(
 
     return return_error;
 }
+/**************************************
+* Motion field of a buffer header, on the
+* 64x64 grid of the source
+**************************************/
+static EbErrorType allocate_motion_field(
+    EbBufferHeaderType *buffer,
+    uint32_t            width,
+    uint32_t            height)
+{
+    EB_CALLOC(buffer->motion_field, 1, sizeof(EbSvtMotionField));
+    buffer->motion_field->block_cols = (width + EB_MOTION_FIELD_BLOCK_SIZE - 1) / EB_MOTION_FIELD_BLOCK_SIZE;
+    buffer->motion_field->block_rows = (height + EB_MOTION_FIELD_BLOCK_SIZE - 1) / EB_MOTION_FIELD_BLOCK_SIZE;
+    buffer->motion_field->mv_count = 0;
+    EB_MALLOC_ARRAY(
+        buffer->motion_field->mvs,
+        buffer->motion_field->block_cols * buffer->motion_field->block_rows * EB_MOTION_FIELD_MAX_MV_COUNT);
+    return EB_ErrorNone;
+}
+
+static void free_motion_field(EbBufferHeaderType *buffer)
+{
+    if (buffer->motion_field) {
+        EB_FREE_ARRAY(buffer->motion_field->mvs);
+        EB_FREE(buffer->motion_field);
+    }
+}
+
 /**************************************
 * EbBufferHeaderType Constructor
 **************************************/
@@ -3418,6 +4197,15 @@ EbErrorType EbInputBufferHeaderCreator(
 
     inputBuffer->p_app_private = NULL;
 
+    if (sequence_control_set_ptr->static_config.enable_motion_hints) {
+        EbErrorType return_error = allocate_motion_field(
+            inputBuffer,
+            sequence_control_set_ptr->max_input_luma_width,
+            sequence_control_set_ptr->max_input_luma_height);
+        if (return_error != EB_ErrorNone)
+            return return_error;
+    }
+
     return EB_ErrorNone;
 }
 
@@ -3430,6 +4218,7 @@ void EbInputBufferHeaderDestoryer(    EbPtr p)
     EB_FREE_ALIGNED_ARRAY(buf->buffer_bit_inc_cr);
 
     EB_DELETE(buf);
+    free_motion_field(obj);
     EB_FREE(obj);
 }
 
@@ -3456,7 +4245,14 @@ EbErrorType EbOutputBufferHeaderCreator(
     outBufPtr->n_alloc_len = n_stride;
     outBufPtr->p_app_private = NULL;
 
-    (void)objectInitDataPtr;
+    if (config->export_motion_field) {
+        EbErrorType return_error = allocate_motion_field(
+            outBufPtr,
+            config->source_width,
+            config->source_height);
+        if (return_error != EB_ErrorNone)
+            return return_error;
+    }
 
     return EB_ErrorNone;
 }
@@ -3465,6 +4261,7 @@ void EbOutputBufferHeaderDestoryer(    EbPtr p)
 {
     EbBufferHeaderType* obj = (EbBufferHeaderType*)p;
     EB_FREE(obj->p_buffer);
+    free_motion_field(obj);
     EB_FREE(obj);
 }
 
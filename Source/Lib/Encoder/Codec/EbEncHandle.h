@@ -92,6 +92,19 @@ typedef struct EbEncHandle
 
     EbHandle                               packetization_thread_handle;
 
+    // Task pool running the segment-parallel stages when enable_task_scheduler is set
+    EbThreadPool                          *task_pool_ptr;
+    EbHandle                              *task_pool_thread_handle_array;
+    // task_pool_ptr is the pool shared by the channels of the process, task_pool_task_count of its tasks are ours
+    EbBool                                 task_pool_shared;
+    uint32_t                               task_pool_task_count;
+
+    // Holds a reference on the process wide tables
+    EbBool                                 shared_resources_acquired;
+
+    // Analysis group the channel is a member of (analysis_group), NULL when none
+    struct SharedAnalysisGroup            *analysis_group_ptr;
+
     // Contexts
     ResourceCoordinationContext            *resource_coordination_context_ptr;
     PictureAnalysisContext                 **picture_analysis_context_ptr_array;
@@ -530,6 +530,14 @@ static void CopyInputBuffer(
     // Copy the picture buffer
     if (src->p_buffer != NULL)
         copy_frame_buffer(sequenceControlSet, dst->p_buffer, src->p_buffer);
+
+    // Copy the motion hints, both on the grid of the source
+    if (dst->motion_field && src->motion_field) {
+        dst->motion_field->mv_count = src->motion_field->mv_count;
+        EB_MEMCPY(dst->motion_field->mvs,
+            src->motion_field->mvs,
+            src->motion_field->block_cols * src->motion_field->block_rows * src->motion_field->mv_count * sizeof(EbSvtMotionVector));
+    }
 }
 
 #if TWO_PASS
@@ -784,6 +792,7 @@ void* resource_coordination_kernel(void *input_ptr)
 
             picture_control_set_ptr->overlay_ppcs_ptr = NULL;
             picture_control_set_ptr->is_alt_ref       = 0;
+            picture_control_set_ptr->tf_hme_frame_count = 0;
             if (loop_index) {
                 picture_control_set_ptr->is_overlay = 1;
                 // set the overlay_ppcs_ptr in the original (ALT_REF) ppcs to the current ppcs
@@ -10,6 +10,9 @@
 #include "EbComputeSAD_C.h"
 #include "EbComputeSAD_SSE4_1.h"
 #include "EbMeSadCalculation.h"
+extern "C" {
+#include "EbPictureDecisionProcess.h"
+}
 #include "EbMotionEstimation.h"
 #include "EbUnitTest.h"
 #include "EbUnitTestUtility.h"
@@ -333,3 +336,39 @@ TEST(MotionEstimation_avx512, DISABLED_sadMxNx4d_speed) {
 }
 
 #endif  // !NON_AVX512_SUPPORT
+
+// The block sums of the successive elimination match the 8x4 blocks of the
+// even rows of the padded picture at every position
+TEST(MotionEstimation, me_block_sums_match) {
+    const uint16_t stride = 136;
+    const uint32_t height = 100;
+    uint8_t *buffer_y = (uint8_t *)malloc(stride * height);
+    uint16_t *block_sum = (uint16_t *)malloc(stride * height * sizeof(uint16_t));
+    EbPictureBufferDesc picture;
+    EbPaReferenceObject pa_reference_object;
+
+    eb_buf_random_u8(buffer_y, stride * height);
+    memset(&picture, 0, sizeof(picture));
+    memset(&pa_reference_object, 0, sizeof(pa_reference_object));
+    picture.buffer_y = buffer_y;
+    picture.stride_y = stride;
+    picture.luma_size = stride * height;
+    pa_reference_object.input_padded_picture_ptr = &picture;
+    pa_reference_object.me_block_sum = block_sum;
+
+    GenerateMeBlockSums(&pa_reference_object);
+
+    for (uint32_t y = 0; y + 7 < height; y++) {
+        for (uint32_t x = 0; x + 8 <= stride; x++) {
+            uint32_t sum = 0;
+            for (uint32_t row = 0; row < 8; row += 2)
+                for (uint32_t col = 0; col < 8; col++)
+                    sum += buffer_y[(y + row) * stride + x + col];
+            ASSERT_EQ(sum, block_sum[y * stride + x])
+                << "block sum at (" << x << ", " << y << ")";
+        }
+    }
+
+    free(buffer_y);
+    free(block_sum);
+}
@@ -0,0 +1,152 @@
+/*
+ * Copyright(c) 2019 Intel Corporation
+ * SPDX - License - Identifier: BSD - 2 - Clause - Patent
+ */
+
+/******************************************************************************
+ * @file SystemResourceTest.cc
+ *
+ * @brief Unit test of the system resource manager hand-off between
+ * producer and consumer threads (locked and LOCK_FREE_FIFO builds):
+ * - eb_get_empty_object
+ * - eb_post_full_object
+ * - eb_get_full_object
+ * - eb_release_object
+ *
+ ******************************************************************************/
+
+#include <string.h>
+#include "gtest/gtest.h"
+// workaround to eliminate the compiling warning on linux
+// The macro will conflict with definition in gtest.h
+#ifdef __USE_GNU
+#undef __USE_GNU  // defined in EbThreads.h
+#endif
+#ifdef _GNU_SOURCE
+#undef _GNU_SOURCE  // defined in EbThreads.h
+#endif
+#include "EbSystemResourceManager.h"
+
+namespace {
+
+const uint32_t kProducerCount = 3;
+const uint32_t kConsumerCount = 3;
+const uint32_t kObjectCount = 8;
+const uint32_t kMessagePerProducer = 20000;
+
+typedef struct Message {
+    uint32_t producer;
+    uint32_t sequence;
+} Message;
+
+typedef struct ProducerContext {
+    EbFifo *empty_fifo;
+    uint32_t index;
+} ProducerContext;
+
+typedef struct ConsumerContext {
+    EbFifo *full_fifo;
+    EbHandle done;
+    uint32_t received;
+    // last sequence seen per producer, plus one
+    uint32_t next_sequence[kProducerCount];
+    EbBool in_order;
+} ConsumerContext;
+
+static EbErrorType message_creator(EbPtr *object_dbl_ptr,
+                                   EbPtr object_init_data_ptr) {
+    (void)object_init_data_ptr;
+    *object_dbl_ptr = calloc(1, sizeof(Message));
+    return *object_dbl_ptr ? EB_ErrorNone : EB_ErrorInsufficientResources;
+}
+
+static void message_destroyer(EbPtr p) {
+    free(p);
+}
+
+static void *producer_kernel(void *input_ptr) {
+    ProducerContext *context = (ProducerContext *)input_ptr;
+    for (uint32_t i = 0; i < kMessagePerProducer; i++) {
+        EbObjectWrapper *wrapper_ptr;
+        eb_get_empty_object(context->empty_fifo, &wrapper_ptr);
+        Message *message = (Message *)wrapper_ptr->object_ptr;
+        message->producer = context->index;
+        message->sequence = i;
+        eb_post_full_object(wrapper_ptr);
+    }
+    return NULL;
+}
+
+static void *consumer_kernel(void *input_ptr) {
+    ConsumerContext *context = (ConsumerContext *)input_ptr;
+    for (;;) {
+        EbObjectWrapper *wrapper_ptr;
+        eb_get_full_object(context->full_fifo, &wrapper_ptr);
+        Message *message = (Message *)wrapper_ptr->object_ptr;
+        // A single producer's messages can not overtake each other
+        if (message->sequence < context->next_sequence[message->producer])
+            context->in_order = EB_FALSE;
+        context->next_sequence[message->producer] = message->sequence + 1;
+        ++context->received;
+        eb_release_object(wrapper_ptr);
+        eb_post_semaphore(context->done);
+    }
+    return NULL;
+}
+
+TEST(SystemResourceTest, HandsEveryObjectOverOnce) {
+    EbSystemResource resource;
+    EbFifo **producer_fifos;
+    EbFifo **consumer_fifos;
+    ProducerContext producers[kProducerCount];
+    ConsumerContext consumers[kConsumerCount];
+    EbHandle producer_threads[kProducerCount];
+    EbHandle consumer_threads[kConsumerCount];
+    EbHandle done = eb_create_semaphore(0, kProducerCount * kMessagePerProducer);
+
+    memset(&resource, 0, sizeof(resource));
+    memset(consumers, 0, sizeof(consumers));
+    ASSERT_EQ(eb_system_resource_ctor(&resource,
+                                      kObjectCount,
+                                      kProducerCount,
+                                      kConsumerCount,
+                                      &producer_fifos,
+                                      &consumer_fifos,
+                                      EB_TRUE,
+                                      message_creator,
+                                      NULL,
+                                      message_destroyer),
+              EB_ErrorNone);
+
+    for (uint32_t i = 0; i < kConsumerCount; i++) {
+        consumers[i].full_fifo = consumer_fifos[i];
+        consumers[i].done = done;
+        consumers[i].in_order = EB_TRUE;
+        consumer_threads[i] = eb_create_thread(consumer_kernel, &consumers[i]);
+    }
+    for (uint32_t i = 0; i < kProducerCount; i++) {
+        producers[i].empty_fifo = producer_fifos[i];
+        producers[i].index = i;
+        producer_threads[i] = eb_create_thread(producer_kernel, &producers[i]);
+    }
+
+    for (uint32_t i = 0; i < kProducerCount * kMessagePerProducer; i++)
+        eb_block_on_semaphore(done);
+
+    for (uint32_t i = 0; i < kProducerCount; i++)
+        eb_destroy_thread(producer_threads[i]);
+    for (uint32_t i = 0; i < kConsumerCount; i++)
+        eb_destroy_thread(consumer_threads[i]);
+
+    uint32_t received = 0;
+    for (uint32_t i = 0; i < kConsumerCount; i++) {
+        received += consumers[i].received;
+        EXPECT_EQ(consumers[i].in_order, EB_TRUE) << "consumer " << i;
+    }
+    EXPECT_EQ(received, kProducerCount * kMessagePerProducer);
+
+    eb_destroy_semaphore(done);
+    resource.dctor(&resource);
+}
+
+}  // namespace
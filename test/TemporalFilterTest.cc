@@ -7,8 +7,10 @@
  * @file TemporalFilterTest.cc
  *
  * @brief Unit test for Temporal Filter functions:
- * - svt_av1_apply_temporal_filter_sse4_1
- * - svt_av1_highbd_apply_temporal_filter_sse4_1
+ * - svt_av1_apply_temporal_filter_{sse4_1,avx2,avx512}
+ * - svt_av1_highbd_apply_temporal_filter_{sse4_1,avx2,avx512}
+ * - svt_av1_get_final_filtered_pixels_{avx2,avx512}
+ * - svt_av1_get_final_filtered_pixels_highbd_{avx2,avx512}
  *
  * @author Cidana-Ivy
  *
@@ -21,6 +23,7 @@
 #include "EbPictureOperators.h"
 #include "EbIntraPrediction.h"
 #include "EbTemporalFiltering.h"
+#include "aom_dsp_rtcd.h"
 #include "random.h"
 #include "util.h"
 
@@ -438,4 +441,286 @@ INSTANTIATE_TEST_CASE_P(
                        ::testing::ValuesIn(FW_PATTERNS),
                        ::testing::ValuesIn(ALTREF_STRENGTH)));
 
+typedef void (*TemporalFilterFunc)(
+    const uint8_t *y_src, int y_src_stride, const uint8_t *y_pre,
+    int y_pre_stride, const uint8_t *u_src, const uint8_t *v_src,
+    int uv_src_stride, const uint8_t *u_pre, const uint8_t *v_pre,
+    int uv_pre_stride, unsigned int block_width, unsigned int block_height,
+    int ss_x, int ss_y, int strength, const int *blk_fw, int use_whole_blk,
+    uint32_t *y_accum, uint16_t *y_count, uint32_t *u_accum, uint16_t *u_count,
+    uint32_t *v_accum, uint16_t *v_count);
+typedef void (*HbdTemporalFilterFunc)(
+    const uint16_t *y_src, int y_src_stride, const uint16_t *y_pre,
+    int y_pre_stride, const uint16_t *u_src, const uint16_t *v_src,
+    int uv_src_stride, const uint16_t *u_pre, const uint16_t *v_pre,
+    int uv_pre_stride, unsigned int block_width, unsigned int block_height,
+    int ss_x, int ss_y, int strength, const int *blk_fw, int use_whole_blk,
+    uint32_t *y_accum, uint16_t *y_count, uint32_t *u_accum, uint16_t *u_count,
+    uint32_t *v_accum, uint16_t *v_count);
+
+typedef std::tuple<int, int> Subsampling;
+Subsampling TEST_SUBSAMPLING[] = {
+    Subsampling(1, 1), Subsampling(1, 0), Subsampling(0, 1), Subsampling(0, 0)};
+
+/**
+ * @brief Unit test for the SIMD Temporal Filter functions:
+ *  - svt_av1_apply_temporal_filter_{sse4_1,avx2,avx512}
+ *  - svt_av1_highbd_apply_temporal_filter_{sse4_1,avx2,avx512}
+ *
+ * Test strategy:
+ * Predictions are the source plus a random noise of increasing amplitude so
+ * that every filter modifier is exercised, on top of random accumulators and
+ * counters. The accum and count of the C function and of the SIMD function
+ * are compared.
+ *
+ * Expect result:
+ * accum and count from c function and SIMD function are equal.
+ *
+ * Test cases:
+ *  chroma subsampling {420, 422, 440, 444}
+ *  alt-ref strength{0,1,2,3,4,5,6}
+ *  filter weight pattern {min, max, mid, random}
+ */
+template <typename Sample, typename FuncType>
+class TemporalFilterSimdTest
+    : public ::testing::Test,
+      public ::testing::WithParamInterface<
+          std::tuple<Subsampling, int, FilterWeightPattern, FuncType>> {
+  protected:
+    static const int block_size_ = 32;
+
+    void run_test(FuncType ref_func, int bit_depth) {
+        const int ss_x = std::get<0>(std::get<0>(this->GetParam()));
+        const int ss_y = std::get<1>(std::get<0>(this->GetParam()));
+        const int strength =
+            std::get<1>(this->GetParam()) + 2 * (bit_depth - 8);
+        const FilterWeightPattern fw_pattern = std::get<2>(this->GetParam());
+        const FuncType tst_func = std::get<3>(this->GetParam());
+        const int max_val = (1 << bit_depth) - 1;
+        const int uv_width = block_size_ >> ss_x;
+        const int uv_height = block_size_ >> ss_y;
+        SVTRandom rnd_pixel(0, max_val);
+        SVTRandom rnd_count(0, 1000);
+        SVTRandom rnd_weight(0, 2);
+
+        for (int loop = 0; loop < 64; loop++) {
+            const int noise = 1 << (loop % (bit_depth - 1));
+            SVTRandom rnd_noise(-noise, noise);
+            int blk_fw[4];
+
+            for (int i = 0; i < 4; i++) {
+                switch (fw_pattern) {
+                case FW_MIN: blk_fw[i] = 0; break;
+                case FW_MAX: blk_fw[i] = 2; break;
+                case FW_MID: blk_fw[i] = 1; break;
+                default: blk_fw[i] = rnd_weight.random(); break;
+                }
+            }
+            for (int i = 0; i < BLK_PELS * COLOR_CHANNELS; i++) {
+                const int val = rnd_pixel.random();
+                const int noisy = val + rnd_noise.random();
+                src_[i] = (Sample)val;
+                pred_[i] = (Sample)AOMMAX(0, AOMMIN(max_val, noisy));
+                count_ref_[i] = count_tst_[i] = rnd_count.random();
+                accum_ref_[i] = accum_tst_[i] = count_ref_[i] * max_val / 2;
+            }
+
+            // The source lives in a 64x64 picture, the prediction, counts
+            // and accumulators in 32x32 blocks
+            ref_func(src_, BW, pred_, block_size_, src_ + BLK_PELS,
+                     src_ + 2 * BLK_PELS, BW, pred_ + BLK_PELS,
+                     pred_ + 2 * BLK_PELS, uv_width, block_size_, block_size_,
+                     ss_x, ss_y, strength, blk_fw, 0, accum_ref_,
+                     count_ref_, accum_ref_ + BLK_PELS, count_ref_ + BLK_PELS,
+                     accum_ref_ + 2 * BLK_PELS, count_ref_ + 2 * BLK_PELS);
+            tst_func(src_, BW, pred_, block_size_, src_ + BLK_PELS,
+                     src_ + 2 * BLK_PELS, BW, pred_ + BLK_PELS,
+                     pred_ + 2 * BLK_PELS, uv_width, block_size_, block_size_,
+                     ss_x, ss_y, strength, blk_fw, 0, accum_tst_,
+                     count_tst_, accum_tst_ + BLK_PELS, count_tst_ + BLK_PELS,
+                     accum_tst_ + 2 * BLK_PELS, count_tst_ + 2 * BLK_PELS);
+
+            for (int plane = 0; plane < COLOR_CHANNELS; plane++) {
+                const int width = plane ? uv_width : block_size_;
+                const int height = plane ? uv_height : block_size_;
+                const int stride = plane ? uv_width : block_size_;
+                for (int i = 0; i < height; i++) {
+                    for (int j = 0; j < width; j++) {
+                        const int k = plane * BLK_PELS + i * stride + j;
+                        ASSERT_EQ(accum_ref_[k], accum_tst_[k])
+                            << "accum mismatch plane " << plane << " at ("
+                            << i << ", " << j << ") loop " << loop;
+                        ASSERT_EQ(count_ref_[k], count_tst_[k])
+                            << "count mismatch plane " << plane << " at ("
+                            << i << ", " << j << ") loop " << loop;
+                    }
+                }
+            }
+        }
+    }
+
+    Sample src_[BLK_PELS * COLOR_CHANNELS];
+    Sample pred_[BLK_PELS * COLOR_CHANNELS];
+    uint32_t accum_ref_[BLK_PELS * COLOR_CHANNELS];
+    uint32_t accum_tst_[BLK_PELS * COLOR_CHANNELS];
+    uint16_t count_ref_[BLK_PELS * COLOR_CHANNELS];
+    uint16_t count_tst_[BLK_PELS * COLOR_CHANNELS];
+};
+
+typedef TemporalFilterSimdTest<uint8_t, TemporalFilterFunc>
+    TemporalFilterLbdTest;
+typedef TemporalFilterSimdTest<uint16_t, HbdTemporalFilterFunc>
+    TemporalFilterHbdTest;
+
+TEST_P(TemporalFilterLbdTest, MatchC) {
+    run_test(svt_av1_apply_filtering_c, 8);
+}
+
+TEST_P(TemporalFilterHbdTest, MatchC) {
+    run_test(svt_av1_apply_filtering_highbd_c, 10);
+}
+
+INSTANTIATE_TEST_CASE_P(
+    TemporalFilter, TemporalFilterLbdTest,
+    ::testing::Combine(
+        ::testing::ValuesIn(TEST_SUBSAMPLING),
+        ::testing::ValuesIn(ALTREF_STRENGTH), ::testing::ValuesIn(FW_PATTERNS),
+        ::testing::Values(svt_av1_apply_temporal_filter_sse4_1,
+                          svt_av1_apply_temporal_filter_avx2)));
+
+INSTANTIATE_TEST_CASE_P(
+    TemporalFilter, TemporalFilterHbdTest,
+    ::testing::Combine(
+        ::testing::ValuesIn(TEST_SUBSAMPLING),
+        ::testing::ValuesIn(ALTREF_STRENGTH), ::testing::ValuesIn(FW_PATTERNS),
+        ::testing::Values(svt_av1_highbd_apply_temporal_filter_sse4_1,
+                          svt_av1_highbd_apply_temporal_filter_avx2)));
+
+#ifndef NON_AVX512_SUPPORT
+INSTANTIATE_TEST_CASE_P(
+    TemporalFilterAVX512, TemporalFilterLbdTest,
+    ::testing::Combine(
+        ::testing::ValuesIn(TEST_SUBSAMPLING),
+        ::testing::ValuesIn(ALTREF_STRENGTH), ::testing::ValuesIn(FW_PATTERNS),
+        ::testing::Values(svt_av1_apply_temporal_filter_avx512)));
+
+INSTANTIATE_TEST_CASE_P(
+    TemporalFilterAVX512, TemporalFilterHbdTest,
+    ::testing::Combine(
+        ::testing::ValuesIn(TEST_SUBSAMPLING),
+        ::testing::ValuesIn(ALTREF_STRENGTH), ::testing::ValuesIn(FW_PATTERNS),
+        ::testing::Values(svt_av1_highbd_apply_temporal_filter_avx512)));
+#endif
+
+typedef void (*FinalFilteredPixelsFunc)(const uint32_t *accum,
+                                        const uint16_t *count, uint32_t width,
+                                        uint32_t height, uint8_t *dst,
+                                        uint32_t dst_stride, uint64_t *sse);
+typedef void (*HbdFinalFilteredPixelsFunc)(const uint32_t *accum,
+                                           const uint16_t *count,
+                                           uint32_t width, uint32_t height,
+                                           uint16_t *dst, uint32_t dst_stride,
+                                           uint64_t *sse);
+
+typedef std::tuple<uint32_t, uint32_t> PlaneSize;
+PlaneSize TEST_PLANE_SIZES[] = {PlaneSize(64, 64),
+                                PlaneSize(32, 32),
+                                PlaneSize(32, 64),
+                                PlaneSize(64, 32),
+                                PlaneSize(8, 8),
+                                PlaneSize(24, 16)};
+
+/**
+ * @brief Unit test for the normalization of the filter output:
+ *  - svt_av1_get_final_filtered_pixels_{avx2,avx512}
+ *  - svt_av1_get_final_filtered_pixels_highbd_{avx2,avx512}
+ *
+ * Test strategy:
+ * Random counts, from 1 to the largest count the filter produces, with
+ * accumulators up to the maximum pixel value times the count. The filtered
+ * pixels and the squared error of the C function and of the SIMD function
+ * are compared.
+ */
+template <typename Sample, typename FuncType>
+class FinalFilteredPixelsTest
+    : public ::testing::Test,
+      public ::testing::WithParamInterface<std::tuple<PlaneSize, FuncType>> {
+  protected:
+    void run_test(FuncType ref_func, int bit_depth) {
+        const uint32_t width = std::get<0>(std::get<0>(this->GetParam()));
+        const uint32_t height = std::get<1>(std::get<0>(this->GetParam()));
+        const FuncType tst_func = std::get<1>(this->GetParam());
+        const int max_val = (1 << bit_depth) - 1;
+        const int max_count = 32 * (ALTREF_MAX_NFRAMES + 1);
+        SVTRandom rnd_pixel(0, max_val);
+        SVTRandom rnd_small_count(1, 32);
+        SVTRandom rnd_large_count(1, max_count);
+        SVTRandom rnd_accum(0, INT_MAX);
+
+        for (int loop = 0; loop < 100; loop++) {
+            SVTRandom &rnd_count = loop & 1 ? rnd_large_count : rnd_small_count;
+            uint64_t sse_ref = loop, sse_tst = loop;
+
+            for (uint32_t i = 0; i < BLK_PELS; i++) {
+                count_[i] = rnd_count.random();
+                accum_[i] = rnd_accum.random() % (count_[i] * max_val + 1);
+            }
+            for (uint32_t i = 0; i < BW * BH; i++)
+                dst_ref_[i] = dst_tst_[i] = rnd_pixel.random();
+
+            ref_func(accum_, count_, width, height, dst_ref_, BW, &sse_ref);
+            tst_func(accum_, count_, width, height, dst_tst_, BW, &sse_tst);
+
+            ASSERT_EQ(sse_ref, sse_tst) << "sse mismatch loop " << loop;
+            for (uint32_t i = 0; i < BW * BH; i++)
+                ASSERT_EQ(dst_ref_[i], dst_tst_[i])
+                    << "pixel mismatch at " << i << " loop " << loop;
+        }
+    }
+
+    uint32_t accum_[BLK_PELS];
+    uint16_t count_[BLK_PELS];
+    Sample dst_ref_[BW * BH];
+    Sample dst_tst_[BW * BH];
+};
+
+typedef FinalFilteredPixelsTest<uint8_t, FinalFilteredPixelsFunc>
+    FinalFilteredPixelsLbdTest;
+typedef FinalFilteredPixelsTest<uint16_t, HbdFinalFilteredPixelsFunc>
+    FinalFilteredPixelsHbdTest;
+
+TEST_P(FinalFilteredPixelsLbdTest, MatchC) {
+    run_test(svt_av1_get_final_filtered_pixels_c, 8);
+}
+
+TEST_P(FinalFilteredPixelsHbdTest, MatchC) {
+    run_test(svt_av1_get_final_filtered_pixels_highbd_c, 10);
+}
+
+INSTANTIATE_TEST_CASE_P(
+    TemporalFilter, FinalFilteredPixelsLbdTest,
+    ::testing::Combine(
+        ::testing::ValuesIn(TEST_PLANE_SIZES),
+        ::testing::Values(svt_av1_get_final_filtered_pixels_avx2)));
+
+INSTANTIATE_TEST_CASE_P(
+    TemporalFilter, FinalFilteredPixelsHbdTest,
+    ::testing::Combine(
+        ::testing::ValuesIn(TEST_PLANE_SIZES),
+        ::testing::Values(svt_av1_get_final_filtered_pixels_highbd_avx2)));
+
+#ifndef NON_AVX512_SUPPORT
+INSTANTIATE_TEST_CASE_P(
+    TemporalFilterAVX512, FinalFilteredPixelsLbdTest,
+    ::testing::Combine(
+        ::testing::ValuesIn(TEST_PLANE_SIZES),
+        ::testing::Values(svt_av1_get_final_filtered_pixels_avx512)));
+
+INSTANTIATE_TEST_CASE_P(
+    TemporalFilterAVX512, FinalFilteredPixelsHbdTest,
+    ::testing::Combine(
+        ::testing::ValuesIn(TEST_PLANE_SIZES),
+        ::testing::Values(svt_av1_get_final_filtered_pixels_highbd_avx512)));
+#endif
+
 }  // namespace
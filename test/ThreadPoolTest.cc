@@ -0,0 +1,213 @@
+/*
+ * Copyright(c) 2019 Intel Corporation
+ * SPDX - License - Identifier: BSD - 2 - Clause - Patent
+ */
+
+/******************************************************************************
+ * @file ThreadPoolTest.cc
+ *
+ * @brief Unit test of the encoder task pool:
+ * - eb_thread_pool_submit from outside and from inside the pool
+ * - eb_fifo_attach_task_pool
+ * - eb_thread_pool_wait_running_tasks
+ *
+ ******************************************************************************/
+
+#include <string.h>
+#include "gtest/gtest.h"
+// workaround to eliminate the compiling warning on linux
+// The macro will conflict with definition in gtest.h
+#ifdef __USE_GNU
+#undef __USE_GNU  // defined in EbThreads.h
+#endif
+#ifdef _GNU_SOURCE
+#undef _GNU_SOURCE  // defined in EbThreads.h
+#endif
+#include "EbThreadPool.h"
+#include "EbSystemResourceManager.h"
+
+namespace {
+
+const uint32_t kWorkerCount = 4;
+const uint32_t kTaskCount = 512;
+
+class ThreadPoolTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        memset(&pool_, 0, sizeof(pool_));
+        ASSERT_EQ(eb_thread_pool_ctor(&pool_, kWorkerCount, 2 * kTaskCount),
+                  EB_ErrorNone);
+        for (uint32_t i = 0; i < kWorkerCount; i++) {
+            threads_[i] = eb_create_thread(eb_thread_pool_kernel,
+                                           pool_.worker_ptr_array[i]);
+            ASSERT_NE(threads_[i], (EbHandle)NULL);
+        }
+        done_ = eb_create_semaphore(0, 2 * kTaskCount);
+        memset(run_count_, 0, sizeof(run_count_));
+    }
+
+    void TearDown() override {
+        stop_workers();
+        eb_destroy_semaphore(done_);
+        pool_.dctor(&pool_);
+    }
+
+    void stop_workers() {
+        for (uint32_t i = 0; i < kWorkerCount; i++) {
+            if (threads_[i])
+                eb_destroy_thread(threads_[i]);
+            threads_[i] = NULL;
+        }
+    }
+
+    void wait_tasks(uint32_t count) {
+        for (uint32_t i = 0; i < count; i++)
+            eb_block_on_semaphore(done_);
+    }
+
+    static void count_task(void *arg) {
+        uint32_t *slot = (uint32_t *)arg;
+        ThreadPoolTest *test = self_;
+        eb_block_on_mutex(test->lock_);
+        ++*slot;
+        eb_release_mutex(test->lock_);
+        eb_post_semaphore(test->done_);
+    }
+
+    // Submits its child from inside the pool, exercises the worker local
+    // queue and the stealing path.
+    static void parent_task(void *arg) {
+        uint32_t *slot = (uint32_t *)arg;
+        eb_thread_pool_submit(&self_->pool_, count_task, slot + kTaskCount);
+        count_task(slot);
+    }
+
+    // Holds a worker until the gate opens, then marks its slot.
+    static void gated_task(void *arg) {
+        uint32_t *slot = (uint32_t *)arg;
+        eb_post_semaphore(self_->done_);
+        eb_block_on_semaphore(self_->gate_);
+        *slot = 1;
+    }
+
+    EbThreadPool pool_;
+    EbHandle threads_[kWorkerCount];
+    EbHandle done_;
+    EbHandle gate_;
+    EbHandle lock_;
+    uint32_t run_count_[2 * kTaskCount];
+    static ThreadPoolTest *self_;
+};
+
+ThreadPoolTest *ThreadPoolTest::self_ = NULL;
+
+TEST_F(ThreadPoolTest, RunsEveryTaskOnce) {
+    self_ = this;
+    lock_ = eb_create_mutex();
+    for (uint32_t i = 0; i < kTaskCount; i++)
+        ASSERT_EQ(eb_thread_pool_submit(&pool_, count_task, &run_count_[i]),
+                  EB_ErrorNone);
+    wait_tasks(kTaskCount);
+    for (uint32_t i = 0; i < kTaskCount; i++)
+        EXPECT_EQ(run_count_[i], 1u) << "task " << i;
+    eb_destroy_mutex(lock_);
+}
+
+TEST_F(ThreadPoolTest, RunsNestedTasks) {
+    self_ = this;
+    lock_ = eb_create_mutex();
+    for (uint32_t i = 0; i < kTaskCount; i++)
+        ASSERT_EQ(eb_thread_pool_submit(&pool_, parent_task, &run_count_[i]),
+                  EB_ErrorNone);
+    wait_tasks(2 * kTaskCount);
+    for (uint32_t i = 0; i < 2 * kTaskCount; i++)
+        EXPECT_EQ(run_count_[i], 1u) << "task " << i;
+    eb_destroy_mutex(lock_);
+}
+
+TEST_F(ThreadPoolTest, WaitsForRunningTasks) {
+    self_ = this;
+    gate_ = eb_create_semaphore(0, kWorkerCount);
+    for (uint32_t i = 0; i < kWorkerCount; i++)
+        ASSERT_EQ(eb_thread_pool_submit(&pool_, gated_task, &run_count_[i]),
+                  EB_ErrorNone);
+    // A task blocks its worker, so every worker runs one of them
+    wait_tasks(kWorkerCount);
+    for (uint32_t i = 0; i < kWorkerCount; i++)
+        eb_post_semaphore(gate_);
+    eb_thread_pool_wait_running_tasks(&pool_);
+    for (uint32_t i = 0; i < kWorkerCount; i++)
+        EXPECT_EQ(run_count_[i], 1u) << "task " << i;
+    eb_destroy_semaphore(gate_);
+}
+
+typedef struct FifoTaskContext {
+    EbHandle done;
+    uint32_t run_count[kTaskCount];
+} FifoTaskContext;
+
+static EbErrorType counter_creator(EbPtr *object_dbl_ptr,
+                                   EbPtr object_init_data_ptr) {
+    (void)object_init_data_ptr;
+    *object_dbl_ptr = calloc(1, sizeof(uint32_t));
+    return *object_dbl_ptr ? EB_ErrorNone : EB_ErrorInsufficientResources;
+}
+
+static void counter_destroyer(EbPtr p) {
+    free(p);
+}
+
+static void fifo_task(void *task_context, EbObjectWrapper *wrapper_ptr) {
+    FifoTaskContext *context = (FifoTaskContext *)task_context;
+    uint32_t index = *(uint32_t *)wrapper_ptr->object_ptr;
+    // Each consumer fifo runs one task at a time, no lock needed
+    ++context->run_count[index];
+    eb_release_object(wrapper_ptr);
+    eb_post_semaphore(context->done);
+}
+
+TEST_F(ThreadPoolTest, DrainsAttachedFifos) {
+    const uint32_t consumer_count = 3;
+    EbSystemResource resource;
+    EbFifo **producer_fifos;
+    EbFifo **consumer_fifos;
+    FifoTaskContext context[consumer_count];
+
+    memset(&resource, 0, sizeof(resource));
+    memset(context, 0, sizeof(context));
+    ASSERT_EQ(eb_system_resource_ctor(&resource,
+                                      16,
+                                      1,
+                                      consumer_count,
+                                      &producer_fifos,
+                                      &consumer_fifos,
+                                      EB_TRUE,
+                                      counter_creator,
+                                      NULL,
+                                      counter_destroyer),
+              EB_ErrorNone);
+    for (uint32_t i = 0; i < consumer_count; i++) {
+        context[i].done = done_;
+        eb_fifo_attach_task_pool(consumer_fifos[i], &pool_, fifo_task, &context[i]);
+    }
+
+    for (uint32_t i = 0; i < kTaskCount; i++) {
+        EbObjectWrapper *wrapper_ptr;
+        eb_get_empty_object(producer_fifos[0], &wrapper_ptr);
+        *(uint32_t *)wrapper_ptr->object_ptr = i;
+        eb_post_full_object(wrapper_ptr);
+    }
+    wait_tasks(kTaskCount);
+
+    for (uint32_t i = 0; i < kTaskCount; i++) {
+        uint32_t total = 0;
+        for (uint32_t c = 0; c < consumer_count; c++)
+            total += context[c].run_count[i];
+        EXPECT_EQ(total, 1u) << "object " << i;
+    }
+    // The fifos are re-queued after the last post, stop the pool first
+    stop_workers();
+    resource.dctor(&resource);
+}
+
+}  // namespace